@@ -56,8 +56,8 @@
 
 
 // Create an instance of the OpenMenuOS class with button and display pins, along with menu item names
-// OpenMenuOS menu(10, NULL, 5, 12);  //btn_up, btn_down, btn_sel, tft_bl    If you don't have all of the 3 buttons, just put "NULL" instead of the pin of this button
-OpenMenuOS menu(19, NULL, 2, 36);  //btn_up, btn_down, btn_sel, tft_bl
+// OpenMenuOS menu(10, BUTTON_NO_PIN, 5, 12);  //btn_up, btn_down, btn_sel, tft_bl    If you don't have all of the 3 buttons, just put "BUTTON_NO_PIN" (-1) instead of the pin of this button, 0 is a real pin
+OpenMenuOS menu(19, BUTTON_NO_PIN, 2, 36);  //btn_up, btn_down, btn_sel, tft_bl
 
 void setup() {
   Serial.begin(921600);  // Initialize serial communication
@@ -82,11 +82,11 @@ void setup() {
 }
 
 void loop() {
-  menu.loop();  // MUST call the loop() function first
+  menu.waitForEvent(1000);  // Wait for a button press or an animation, nothing is redrawn while the menu is idle
+  menu.loop();              // MUST call the loop() function first
 
   // Display the menu if the current screen is the main menu (screen 0)
   if (menu.getCurrentScreen() == 0) {
-    delay(100);                                                                     // Small delay for stability
     menu.drawMenu(true, "Tile Menu", "Submenu", "Settings", "Informations", NULL);  // Draw the main menu on the screen. Set to "true" to display the 16x16 images for the items, else, set to "false"
                                                                                     // canvas.fillSmoothRoundRect(1, 1, 50, 50, 5, 0xfa60, TFT_BLACK);
 
@@ -111,7 +111,6 @@ void loop() {
         if (menu.getCurrentScreen() == 1) {
           Serial.println("screen 1");
 
-          delay(100);                                                                 // Small delay for stability
           menu.drawSubmenu(true, "Long name submenu item....", "2", "3", "4", NULL);  // Draw the submenu on the screen. Set to "true" to display the 16x16 images for the items, else, set to "false"
         } else {
           Serial.println(menu.getSelectedItemSubmenu() + "eee");
@@ -1,182 +1,98 @@
 #include "images.h"
 
-const uint8_t Menu_icon_1[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x59, 0xce, 0x18, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x52, 0x20, 0x00, 0x00, 0x00, 0x41, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xa5, 0x39, 0xce, 0xd3, 0x9c, 0x41, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xa4, 0x21, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xa4, 0x21, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xa4, 0x21, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xa4, 0x21, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xa4, 0x21, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xa4, 0x21, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x18, 0xc6, 0xcf, 0x7b, 0x21, 0x08, 0x18, 0xc6, 0x18, 0xc6, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+// 16x16, 123 bytes (512 raw)
+const uint8_t Menu_icon_1[] PROGMEM = {
+  0x4f, 0x4d, 0x01, 0x10, 0x10, 0x00, 0x10, 0x00, 0xa5, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x59, 0xce, 0x18, 0xc6, 0x8b, 0xff, 0xff, 0x03, 0x8a, 0x52, 0x20, 0x00, 0x00, 0x00, 0x41, 0x08, 0x8b, 0xff,
+  0xff, 0x03, 0x34, 0xa5, 0x39, 0xce, 0xd3, 0x9c, 0x41, 0x08, 0x8d, 0xff, 0xff, 0x01, 0xf4, 0xa4, 0x21, 0x08, 0x8d, 0xff, 0xff, 0x01, 0xf4, 0xa4, 0x21, 0x08, 0x8d, 0xff, 0xff, 0x01, 0xf4, 0xa4,
+  0x21, 0x08, 0x8d, 0xff, 0xff, 0x01, 0xf4, 0xa4, 0x21, 0x08, 0x8d, 0xff, 0xff, 0x01, 0xf4, 0xa4, 0x21, 0x08, 0x8d, 0xff, 0xff, 0x01, 0xf4, 0xa4, 0x21, 0x08, 0x8b, 0xff, 0xff, 0x03, 0xdb, 0xde,
+  0x18, 0xc6, 0xcf, 0x7b, 0x21, 0x08, 0x81, 0x18, 0xc6, 0x00, 0x9e, 0xf7, 0x88, 0xff, 0xff, 0x00, 0xeb, 0x5a, 0x84, 0x00, 0x00, 0x00, 0x38, 0xc6, 0xb3, 0xff, 0xff,
 };
 const size_t Menu_icon_1_size {sizeof(Menu_icon_1) / sizeof(Menu_icon_1[0])};
 
-const uint8_t Menu_icon_2[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb7, 0xbd, 0x71, 0x8c, 0x55, 0xad, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0x41, 0x08, 0x61, 0x08, 0xa6, 0x31, 0x21, 0x08, 0x04, 0x21, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0xb7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x6a, 0x52, 0xe7, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xa5, 0x00, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x7b, 0x04, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xde, 0x41, 0x08, 0x96, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x25, 0x29, 0x6d, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0x45, 0x29, 0xcb, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x45, 0x29, 0x49, 0x4a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x04, 0x21, 0xa7, 0x39, 0xf8, 0xc5, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+// 16x16, 151 bytes (512 raw)
+const uint8_t Menu_icon_2[] PROGMEM = {
+  0x4f, 0x4d, 0x01, 0x10, 0x10, 0x00, 0x10, 0x00, 0xa4, 0xff, 0xff, 0x04, 0xdf, 0xff, 0xb7, 0xbd, 0x71, 0x8c, 0x55, 0xad, 0xbe, 0xf7, 0x89, 0xff, 0xff, 0x06, 0x59, 0xce, 0x41, 0x08, 0x61, 0x08,
+  0xa6, 0x31, 0x21, 0x08, 0x04, 0x21, 0xdb, 0xde, 0x88, 0xff, 0xff, 0x01, 0x9a, 0xd6, 0xb7, 0xbd, 0x81, 0xff, 0xff, 0x02, 0xbe, 0xf7, 0x6a, 0x52, 0xe7, 0x39, 0x8d, 0xff, 0xff, 0x02, 0x34, 0xa5,
+  0x00, 0x00, 0xdf, 0xff, 0x8c, 0xff, 0xff, 0x01, 0xcf, 0x7b, 0x04, 0x21, 0x8c, 0xff, 0xff, 0x02, 0xbb, 0xde, 0x41, 0x08, 0x96, 0xb5, 0x8b, 0xff, 0xff, 0x02, 0x9e, 0xf7, 0x25, 0x29, 0x6d, 0x6b,
+  0x8b, 0xff, 0xff, 0x02, 0x3d, 0xef, 0x45, 0x29, 0xcb, 0x5a, 0x8b, 0xff, 0xff, 0x03, 0x7d, 0xef, 0x45, 0x29, 0x49, 0x4a, 0xdf, 0xff, 0x8a, 0xff, 0xff, 0x03, 0x1c, 0xe7, 0x04, 0x21, 0xa7, 0x39,
+  0xf8, 0xc5, 0x82, 0x18, 0xc6, 0x00, 0xdf, 0xff, 0x87, 0xff, 0xff, 0x00, 0x35, 0xad, 0x85, 0x00, 0x00, 0x00, 0x1c, 0xe7, 0xb3, 0xff, 0xff,
 };
 const size_t Menu_icon_2_size {sizeof(Menu_icon_2) / sizeof(Menu_icon_2[0])};
 
-const uint8_t Menu_icon_3[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0x72, 0x94, 0x14, 0xa5, 0x3c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x41, 0x08, 0xa6, 0x31, 0x41, 0x08, 0x20, 0x00, 0x72, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0xdf, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x2c, 0x63, 0x20, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0x00, 0x00, 0x3d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xc6, 0x69, 0x4a, 0xc7, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0x73, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x1c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xc6, 0x66, 0x31, 0xc7, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x00, 0x00, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x00, 0x00, 0xb6, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0xb3, 0x9c, 0x9e, 0xf7, 0xff, 0xff, 0x7e, 0xf7, 0x69, 0x4a, 0x04, 0x21, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x82, 0x10, 0x2c, 0x63, 0xfc, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0x7a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+// 16x16, 167 bytes (512 raw)
+const uint8_t Menu_icon_3[] PROGMEM = {
+  0x4f, 0x4d, 0x01, 0x10, 0x10, 0x00, 0x10, 0x00, 0xa5, 0xff, 0xff, 0x03, 0x18, 0xc6, 0x72, 0x94, 0x14, 0xa5, 0x3c, 0xe7, 0x8a, 0xff, 0xff, 0x05, 0x00, 0x00, 0x41, 0x08, 0xa6, 0x31, 0x41, 0x08,
+  0x20, 0x00, 0x72, 0x94, 0x89, 0xff, 0xff, 0x06, 0x18, 0xc6, 0xdf, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x2c, 0x63, 0x20, 0x00, 0xdf, 0xff, 0x8c, 0xff, 0xff, 0x02, 0x18, 0xc6, 0x00, 0x00, 0x3d, 0xef,
+  0x8b, 0xff, 0xff, 0x02, 0x38, 0xc6, 0x69, 0x4a, 0xc7, 0x39, 0x8a, 0xff, 0xff, 0x00, 0xae, 0x73, 0x81, 0x00, 0x00, 0x01, 0x24, 0x21, 0x1c, 0xe7, 0x8c, 0xff, 0xff, 0x02, 0x38, 0xc6, 0x66, 0x31,
+  0xc7, 0x39, 0x8d, 0xff, 0xff, 0x02, 0x5d, 0xef, 0x00, 0x00, 0xd7, 0xbd, 0x8c, 0xff, 0xff, 0x02, 0x5d, 0xef, 0x00, 0x00, 0xb6, 0xb5, 0x87, 0xff, 0xff, 0x07, 0x59, 0xce, 0xb3, 0x9c, 0x9e, 0xf7,
+  0xff, 0xff, 0x7e, 0xf7, 0x69, 0x4a, 0x04, 0x21, 0xbe, 0xf7, 0x87, 0xff, 0xff, 0x01, 0x18, 0xc6, 0x21, 0x08, 0x81, 0x00, 0x00, 0x02, 0x82, 0x10, 0x2c, 0x63, 0xfc, 0xe6, 0x8a, 0xff, 0xff, 0x01,
+  0x7e, 0xf7, 0x7a, 0xd6, 0xa7, 0xff, 0xff,
 };
 const size_t Menu_icon_3_size {sizeof(Menu_icon_3) / sizeof(Menu_icon_3[0])};
 
-const uint8_t Menu_icon_4[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x18, 0xc6, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0xe3, 0x18, 0x00, 0x00, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x6b, 0xaa, 0x52, 0x00, 0x00, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xc6, 0xc3, 0x18, 0xfc, 0xe6, 0x00, 0x00, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x04, 0x21, 0x76, 0xb5, 0x5d, 0xef, 0x00, 0x00, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x73, 0x49, 0x4a, 0xff, 0xff, 0x5d, 0xef, 0x00, 0x00, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0x62, 0x10, 0x3c, 0xe7, 0xff, 0xff, 0x5d, 0xef, 0x00, 0x00, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x52, 0xa7, 0x39, 0x10, 0x84, 0x10, 0x84, 0xaf, 0x7b, 0x00, 0x00, 0xeb, 0x5a, 0x14, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0x10, 0x84, 0x10, 0x84, 0x10, 0x84, 0xaf, 0x7b, 0x00, 0x00, 0xeb, 0x5a, 0x14, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x00, 0x00, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x00, 0x00, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+// 16x16, 167 bytes (512 raw)
+const uint8_t Menu_icon_4[] PROGMEM = {
+  0x4f, 0x4d, 0x01, 0x10, 0x10, 0x00, 0x10, 0x00, 0xa7, 0xff, 0xff, 0x02, 0x1c, 0xe7, 0x18, 0xc6, 0x7e, 0xf7, 0x8b, 0xff, 0xff, 0x03, 0xbe, 0xf7, 0xe3, 0x18, 0x00, 0x00, 0xd7, 0xbd, 0x8b, 0xff,
+  0xff, 0x03, 0x4d, 0x6b, 0xaa, 0x52, 0x00, 0x00, 0xd7, 0xbd, 0x8a, 0xff, 0xff, 0x04, 0x38, 0xc6, 0xc3, 0x18, 0xfc, 0xe6, 0x00, 0x00, 0xd7, 0xbd, 0x89, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x04, 0x21,
+  0x76, 0xb5, 0x5d, 0xef, 0x00, 0x00, 0xd7, 0xbd, 0x89, 0xff, 0xff, 0x05, 0x8e, 0x73, 0x49, 0x4a, 0xff, 0xff, 0x5d, 0xef, 0x00, 0x00, 0xd7, 0xbd, 0x88, 0xff, 0xff, 0x06, 0x59, 0xce, 0x62, 0x10,
+  0x3c, 0xe7, 0xff, 0xff, 0x5d, 0xef, 0x00, 0x00, 0xd7, 0xbd, 0x88, 0xff, 0xff, 0x01, 0xaa, 0x52, 0xa7, 0x39, 0x81, 0x10, 0x84, 0x03, 0xaf, 0x7b, 0x00, 0x00, 0xeb, 0x5a, 0x14, 0xa5, 0x87, 0xff,
+  0xff, 0x00, 0x55, 0xad, 0x82, 0x10, 0x84, 0x03, 0xaf, 0x7b, 0x00, 0x00, 0xeb, 0x5a, 0x14, 0xa5, 0x8b, 0xff, 0xff, 0x02, 0x5d, 0xef, 0x00, 0x00, 0xd7, 0xbd, 0x8c, 0xff, 0xff, 0x02, 0x5d, 0xef,
+  0x00, 0x00, 0xd7, 0xbd, 0xb4, 0xff, 0xff,
 };
 const size_t Menu_icon_4_size {sizeof(Menu_icon_4) / sizeof(Menu_icon_4[0])};
 
-const uint8_t Menu_icon_5[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xfc, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x21, 0xf3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x21, 0xf3, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x21, 0xe7, 0x39, 0x28, 0x42, 0x2d, 0x6b, 0xf8, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x52, 0xf0, 0x83, 0xaf, 0x7b, 0xc7, 0x39, 0x00, 0x00, 0x71, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x94, 0x00, 0x00, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x00, 0x00, 0x18, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0x00, 0x00, 0xbb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0xb2, 0x94, 0xdb, 0xde, 0xff, 0xff, 0x5d, 0xef, 0xc7, 0x39, 0x86, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xc6, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x4a, 0x3d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0x59, 0xce, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+// 16x16, 155 bytes (512 raw)
+const uint8_t Menu_icon_5[] PROGMEM = {
+  0x4f, 0x4d, 0x01, 0x10, 0x10, 0x00, 0x10, 0x00, 0xa4, 0xff, 0xff, 0x00, 0x59, 0xce, 0x83, 0x18, 0xc6, 0x00, 0xfc, 0xe6, 0x89, 0xff, 0xff, 0x00, 0x04, 0x21, 0x83, 0x00, 0x00, 0x00, 0xae, 0x73,
+  0x89, 0xff, 0xff, 0x01, 0x04, 0x21, 0xf3, 0x9c, 0x8d, 0xff, 0xff, 0x01, 0x04, 0x21, 0xf3, 0x9c, 0x8d, 0xff, 0xff, 0x04, 0x24, 0x21, 0xe7, 0x39, 0x28, 0x42, 0x2d, 0x6b, 0xf8, 0xc5, 0x8a, 0xff,
+  0xff, 0x05, 0x6a, 0x52, 0xf0, 0x83, 0xaf, 0x7b, 0xc7, 0x39, 0x00, 0x00, 0x71, 0x8c, 0x8d, 0xff, 0xff, 0x02, 0x92, 0x94, 0x00, 0x00, 0x5d, 0xef, 0x8c, 0xff, 0xff, 0x02, 0x1c, 0xe7, 0x00, 0x00,
+  0x18, 0xc6, 0x8c, 0xff, 0xff, 0x02, 0x59, 0xce, 0x00, 0x00, 0xbb, 0xde, 0x87, 0xff, 0xff, 0x06, 0x59, 0xce, 0xb2, 0x94, 0xdb, 0xde, 0xff, 0xff, 0x5d, 0xef, 0xc7, 0x39, 0x86, 0x31, 0x88, 0xff,
+  0xff, 0x01, 0x38, 0xc6, 0x21, 0x08, 0x82, 0x00, 0x00, 0x01, 0x29, 0x4a, 0x3d, 0xef, 0x8a, 0xff, 0xff, 0x02, 0x7e, 0xf7, 0x59, 0xce, 0x7d, 0xef, 0xa6, 0xff, 0xff,
 };
 const size_t Menu_icon_5_size {sizeof(Menu_icon_5) / sizeof(Menu_icon_5[0])};
 
-const uint8_t Menu_icon_6[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xb5, 0x51, 0x8c, 0x75, 0xad, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x8a, 0x52, 0x00, 0x00, 0x66, 0x31, 0xa3, 0x18, 0x20, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0xa2, 0x10, 0xba, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x62, 0x10, 0x92, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0x00, 0x00, 0xd7, 0xbd, 0x4d, 0x6b, 0x49, 0x4a, 0xf0, 0x83, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0x00, 0x00, 0xe3, 0x18, 0x10, 0x84, 0x75, 0xad, 0x86, 0x31, 0x45, 0x29, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xad, 0x00, 0x00, 0x10, 0x84, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x61, 0x08, 0xb2, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0x00, 0x00, 0xf8, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x39, 0x4d, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x62, 0x10, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x21, 0xcf, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x7b, 0xa7, 0x39, 0x9e, 0xf7, 0xff, 0xff, 0x14, 0xa5, 0x00, 0x00, 0x59, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x73, 0x41, 0x08, 0x00, 0x00, 0x62, 0x10, 0x55, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x79, 0xce, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+// 16x16, 201 bytes (512 raw)
+const uint8_t Menu_icon_6[] PROGMEM = {
+  0x4f, 0x4d, 0x01, 0x10, 0x10, 0x00, 0x10, 0x00, 0xa6, 0xff, 0xff, 0x03, 0xb6, 0xb5, 0x51, 0x8c, 0x75, 0xad, 0xdf, 0xff, 0x89, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x8a, 0x52, 0x00, 0x00, 0x66, 0x31,
+  0xa3, 0x18, 0x20, 0x00, 0x89, 0xff, 0xff, 0x02, 0x10, 0x84, 0xa2, 0x10, 0xba, 0xd6, 0x81, 0xff, 0xff, 0x00, 0x79, 0xce, 0x88, 0xff, 0xff, 0x02, 0xbe, 0xf7, 0x62, 0x10, 0x92, 0x94, 0x8c, 0xff,
+  0xff, 0x06, 0x59, 0xce, 0x00, 0x00, 0xd7, 0xbd, 0x4d, 0x6b, 0x49, 0x4a, 0xf0, 0x83, 0x9e, 0xf7, 0x88, 0xff, 0xff, 0x07, 0x55, 0xad, 0x00, 0x00, 0xe3, 0x18, 0x10, 0x84, 0x75, 0xad, 0x86, 0x31,
+  0x45, 0x29, 0xdf, 0xff, 0x87, 0xff, 0xff, 0x02, 0x55, 0xad, 0x00, 0x00, 0x10, 0x84, 0x81, 0xff, 0xff, 0x02, 0x9e, 0xf7, 0x61, 0x08, 0xb2, 0x94, 0x87, 0xff, 0xff, 0x02, 0x18, 0xc6, 0x00, 0x00,
+  0xf8, 0xc5, 0x82, 0xff, 0xff, 0x01, 0xc7, 0x39, 0x4d, 0x6b, 0x87, 0xff, 0xff, 0x02, 0xbf, 0xff, 0x62, 0x10, 0x75, 0xad, 0x82, 0xff, 0xff, 0x01, 0x24, 0x21, 0xcf, 0x7b, 0x88, 0xff, 0xff, 0x06,
+  0xaf, 0x7b, 0xa7, 0x39, 0x9e, 0xf7, 0xff, 0xff, 0x14, 0xa5, 0x00, 0x00, 0x59, 0xce, 0x89, 0xff, 0xff, 0x04, 0x8e, 0x73, 0x41, 0x08, 0x00, 0x00, 0x62, 0x10, 0x55, 0xad, 0x8b, 0xff, 0xff, 0x02,
+  0xbf, 0xff, 0x79, 0xce, 0xdf, 0xff, 0xa5, 0xff, 0xff,
 };
 const size_t Menu_icon_6_size {sizeof(Menu_icon_6) / sizeof(Menu_icon_6[0])};
 
-const uint8_t Menu_icon_7[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7b, 0xa3, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x18, 0xae, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xb5, 0x00, 0x00, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x52, 0xe7, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x20, 0x00, 0x14, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0x8c, 0x61, 0x08, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x21, 0x4d, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0x00, 0x00, 0x7a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x62, 0x66, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+// 16x16, 115 bytes (512 raw)
+const uint8_t Menu_icon_7[] PROGMEM = {
+  0x4f, 0x4d, 0x01, 0x10, 0x10, 0x00, 0x10, 0x00, 0xa3, 0xff, 0xff, 0x00, 0x9e, 0xf7, 0x85, 0x18, 0xc6, 0x00, 0x7d, 0xef, 0x87, 0xff, 0xff, 0x00, 0x39, 0xce, 0x85, 0x00, 0x00, 0x00, 0xd7, 0xbd,
+  0x8c, 0xff, 0xff, 0x01, 0xef, 0x7b, 0xa3, 0x18, 0x8d, 0xff, 0xff, 0x01, 0xc3, 0x18, 0xae, 0x73, 0x8c, 0xff, 0xff, 0x02, 0xb6, 0xb5, 0x00, 0x00, 0xdb, 0xde, 0x8c, 0xff, 0xff, 0x01, 0x8a, 0x52,
+  0xe7, 0x39, 0x8c, 0xff, 0xff, 0x02, 0x7d, 0xef, 0x20, 0x00, 0x14, 0xa5, 0x8c, 0xff, 0xff, 0x02, 0x51, 0x8c, 0x61, 0x08, 0xdf, 0xff, 0x8c, 0xff, 0xff, 0x01, 0x04, 0x21, 0x4d, 0x6b, 0x8c, 0xff,
+  0xff, 0x02, 0x18, 0xc6, 0x00, 0x00, 0x7a, 0xd6, 0x8c, 0xff, 0xff, 0x01, 0xec, 0x62, 0x66, 0x31, 0xb7, 0xff, 0xff,
 };
 const size_t Menu_icon_7_size {sizeof(Menu_icon_7) / sizeof(Menu_icon_7[0])};
 
-const uint8_t Menu_icon_8[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0xd3, 0x9c, 0x92, 0x94, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x84, 0x00, 0x00, 0x82, 0x10, 0xe3, 0x18, 0x00, 0x00, 0x0c, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x00, 0x00, 0xaf, 0x7b, 0xff, 0xff, 0xff, 0xff, 0x92, 0x94, 0x00, 0x00, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x00, 0x00, 0x59, 0xce, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x00, 0x00, 0xf7, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x31, 0xab, 0x5a, 0x9a, 0xd6, 0xfc, 0xe6, 0x4d, 0x6b, 0xe3, 0x18, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x04, 0x21, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x18, 0x59, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x31, 0x86, 0x31, 0xb2, 0x94, 0x14, 0xa5, 0xe8, 0x41, 0xe3, 0x18, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x00, 0x00, 0x7d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x10, 0x92, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xa5, 0x00, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x21, 0xf0, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x00, 0x00, 0x6e, 0x73, 0xff, 0xff, 0xff, 0xff, 0x71, 0x8c, 0x00, 0x00, 0xf8, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x9c, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x10, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+// 16x16, 210 bytes (512 raw)
+const uint8_t Menu_icon_8[] PROGMEM = {
+  0x4f, 0x4d, 0x01, 0x10, 0x10, 0x00, 0x10, 0x00, 0xa5, 0xff, 0xff, 0x03, 0xfb, 0xde, 0xd3, 0x9c, 0x92, 0x94, 0x9a, 0xd6, 0x8a, 0xff, 0xff, 0x05, 0x10, 0x84, 0x00, 0x00, 0x82, 0x10, 0xe3, 0x18,
+  0x00, 0x00, 0x0c, 0x63, 0x88, 0xff, 0xff, 0x02, 0x9e, 0xf7, 0x00, 0x00, 0xaf, 0x7b, 0x81, 0xff, 0xff, 0x02, 0x92, 0x94, 0x00, 0x00, 0x9a, 0xd6, 0x87, 0xff, 0xff, 0x02, 0xfb, 0xde, 0x00, 0x00,
+  0x59, 0xce, 0x81, 0xff, 0xff, 0x02, 0x7d, 0xef, 0x00, 0x00, 0xf7, 0xbd, 0x88, 0xff, 0xff, 0x06, 0xa6, 0x31, 0xab, 0x5a, 0x9a, 0xd6, 0xfc, 0xe6, 0x4d, 0x6b, 0xe3, 0x18, 0xbf, 0xff, 0x88, 0xff,
+  0xff, 0x01, 0xfb, 0xde, 0x04, 0x21, 0x81, 0x00, 0x00, 0x01, 0xa3, 0x18, 0x59, 0xce, 0x89, 0xff, 0xff, 0x81, 0x86, 0x31, 0x04, 0xb2, 0x94, 0x14, 0xa5, 0xe8, 0x41, 0xe3, 0x18, 0x7e, 0xf7, 0x87,
+  0xff, 0xff, 0x02, 0x96, 0xb5, 0x00, 0x00, 0x7d, 0xef, 0x82, 0xff, 0xff, 0x01, 0xa2, 0x10, 0x92, 0x94, 0x87, 0xff, 0xff, 0x02, 0x14, 0xa5, 0x00, 0x00, 0xdf, 0xff, 0x82, 0xff, 0xff, 0x01, 0x04,
+  0x21, 0xf0, 0x83, 0x87, 0xff, 0xff, 0x02, 0xdb, 0xde, 0x00, 0x00, 0x6e, 0x73, 0x81, 0xff, 0xff, 0x02, 0x71, 0x8c, 0x00, 0x00, 0xf8, 0xc5, 0x88, 0xff, 0xff, 0x01, 0xd3, 0x9c, 0x82, 0x10, 0x81,
+  0x00, 0x00, 0x01, 0x41, 0x08, 0x10, 0x84, 0x8b, 0xff, 0xff, 0x01, 0xdb, 0xde, 0x9a, 0xd6, 0xa6, 0xff, 0xff,
 };
 const size_t Menu_icon_8_size {sizeof(Menu_icon_8) / sizeof(Menu_icon_8[0])};
 
-const uint8_t Menu_icon_9[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x92, 0x94, 0xd3, 0x9c, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0x8c, 0x00, 0x00, 0x04, 0x21, 0x82, 0x10, 0x62, 0x10, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xd6, 0x00, 0x00, 0x34, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x7b, 0x86, 0x31, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x94, 0x62, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x00, 0x00, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x94, 0x41, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x00, 0x00, 0xf4, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0x00, 0x00, 0x96, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x83, 0x00, 0x00, 0x30, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7b, 0x21, 0x08, 0x0c, 0x63, 0x69, 0x4a, 0x45, 0x29, 0xa2, 0x10, 0x51, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0x71, 0x8c, 0x51, 0x8c, 0x3d, 0xef, 0x20, 0x00, 0x75, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xa5, 0x62, 0x10, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xc6, 0xff, 0xff, 0xbe, 0xf7, 0x35, 0xad, 0x61, 0x08, 0x30, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x41, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x18, 0xb2, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x9a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+// 16x16, 195 bytes (512 raw)
+const uint8_t Menu_icon_9[] PROGMEM = {
+  0x4f, 0x4d, 0x01, 0x10, 0x10, 0x00, 0x10, 0x00, 0xa5, 0xff, 0xff, 0x03, 0x9a, 0xd6, 0x92, 0x94, 0xd3, 0x9c, 0xdb, 0xde, 0x8a, 0xff, 0xff, 0x05, 0x51, 0x8c, 0x00, 0x00, 0x04, 0x21, 0x82, 0x10,
+  0x62, 0x10, 0x9a, 0xd6, 0x88, 0xff, 0xff, 0x02, 0x7a, 0xd6, 0x00, 0x00, 0x34, 0xa5, 0x81, 0xff, 0xff, 0x01, 0xaf, 0x7b, 0x86, 0x31, 0x88, 0xff, 0xff, 0x01, 0xb2, 0x94, 0x62, 0x10, 0x82, 0xff,
+  0xff, 0x02, 0xfb, 0xde, 0x00, 0x00, 0x9a, 0xd6, 0x87, 0xff, 0xff, 0x01, 0xb2, 0x94, 0x41, 0x08, 0x82, 0xff, 0xff, 0x02, 0xdb, 0xde, 0x00, 0x00, 0xf4, 0xa4, 0x87, 0xff, 0xff, 0x02, 0x79, 0xce,
+  0x00, 0x00, 0x96, 0xb5, 0x81, 0xff, 0xff, 0x02, 0xf0, 0x83, 0x00, 0x00, 0x30, 0x84, 0x88, 0xff, 0xff, 0x06, 0xef, 0x7b, 0x21, 0x08, 0x0c, 0x63, 0x69, 0x4a, 0x45, 0x29, 0xa2, 0x10, 0x51, 0x8c,
+  0x89, 0xff, 0xff, 0x05, 0x79, 0xce, 0x71, 0x8c, 0x51, 0x8c, 0x3d, 0xef, 0x20, 0x00, 0x75, 0xad, 0x8c, 0xff, 0xff, 0x02, 0x14, 0xa5, 0x62, 0x10, 0x9e, 0xf7, 0x88, 0xff, 0xff, 0x05, 0x18, 0xc6,
+  0xff, 0xff, 0xbe, 0xf7, 0x35, 0xad, 0x61, 0x08, 0x30, 0x84, 0x89, 0xff, 0xff, 0x00, 0xe8, 0x41, 0x81, 0x00, 0x00, 0x01, 0xc3, 0x18, 0xb2, 0x94, 0x8b, 0xff, 0xff, 0x01, 0x9e, 0xf7, 0x9a, 0xd6,
+  0xa7, 0xff, 0xff,
 };
 const size_t Menu_icon_9_size {sizeof(Menu_icon_9) / sizeof(Menu_icon_9[0])};
 
@@ -193,140 +109,767 @@ const unsigned char* bitmap_icons[] = {
 };
 const size_t bitmap_icons_size {sizeof(bitmap_icons) / sizeof(bitmap_icons[0])};
 
-const uint8_t Boot_img[] = {
-  0xcc, 0x01, 0xec, 0x01, 0xec, 0x01, 0x0c, 0x02, 0x0d, 0x02, 0x4e, 0x02, 0x8b, 0x09, 0xec, 0x01, 0x0c, 0x02, 0x2d, 0x02, 0x8e, 0x02, 0x2d, 0x02, 0xf0, 0x02, 0x6a, 0x01, 0xcb, 0x01, 0x2d, 0x02, 0x6e, 0x02, 0xcf, 0x02, 0xab, 0x01, 0x2d, 0x02, 0x6e, 0x02, 0x10, 0x03, 0xab, 0x01, 0x2d, 0x02, 0xaa, 0x01, 0xcb, 0x01, 0xae, 0x02, 0x6e, 0x02, 0x31, 0x03, 0x72, 0x13, 0x8a, 0x01, 0xec, 0x01, 0x6d, 0x02, 0x4d, 0x02, 0x0d, 0x02, 0x6e, 0x02, 0xcf, 0x0a, 0x4d, 0x02, 0xef, 0x02, 0x91, 0x0b, 0xeb, 0x01, 0xcb, 0x01, 0xec, 0x01, 0x2d, 0x02, 0x4d, 0x02, 0xcf, 0x02, 0x2d, 0x02, 0x2d, 0x0a, 0x0c, 0x02, 0x2d, 0x02, 0x2d, 0x02, 0x2d, 0x02, 0x2d, 0x02, 0x2d, 0x02, 0x2d, 0x02, 0x2d, 0x02, 0x2d, 0x02, 0x2d, 0x02, 0x2d, 0x02, 0x2d, 0x02, 0x4d, 0x02, 0x4d, 0x02, 0x4d, 0x02, 0x4d, 0x02, 0x6d, 0x02, 0x8e, 0x02, 0x8e, 0x0a, 0x6d, 0x02, 0x6d, 0x02, 0x8e, 0x02, 0x8e, 0x02, 0xae, 0x02, 0x4d, 0x0a, 0xae, 0x12, 0x8e, 0x02, 0x8d, 0x02, 0x8e, 0x02, 0x8e, 0x02, 0x8e, 0x02, 0x8e, 0x02, 0xae, 0x02, 0xae, 0x02, 0x8e, 0x02, 0x8e, 0x02, 0x8e, 0x02, 0x8d, 0x02, 0x6d, 0x02, 0x8d, 0x0a, 0x2c, 0x02, 0x2c, 0x02, 0x10, 0x94, 0x0c, 0x0a, 0x2c, 0x0a, 0xcb, 0x01, 0xeb, 0x01, 0x0b, 0x02, 0x0b, 0x0a, 0x0b, 0x12, 0x2c, 0x22, 0x4c, 0x2a, 0x2c, 0x32, 0x0b, 0x22, 0x2c, 0x32, 0x2c, 0x3a, 0x2c, 0x32, 0x2c, 0x3a, 0x2c, 0x42, 0x2c, 0x42, 0x2c, 0x42, 0x4c, 0x4a, 0x4c, 0x52, 0x8d, 0x6a, 0xad, 0x7a, 0x8c, 0x72, 0x6d, 0x6a, 0x2b, 0x62, 0x8d, 0x7a, 0x8d, 0x72, 0x2b, 0x52, 0x4d, 0x6a, 0x6c, 0x7a, 0x6c, 0x72, 0x6c, 0x62, 0x4c, 0x7a, 0x8d, 0x8a, 0x4c, 0x6a, 0x6c, 0x6a, 0x6b, 0x72, 0x6c, 0x72, 0x4c, 0x7a, 0x6c, 0x7a, 0x6c, 0x7a, 0x6c, 0x82, 0x6b, 0x82, 0x8c, 0x8a, 0x6c, 0x7a, 0x4c, 0x7a, 0x6c, 0x7a, 0x6c, 0x7a, 0x8c, 0x82, 0x6c, 0x7a, 0x6c, 0x7a, 0x6c, 0x7a, 0x6c, 0x7a, 0x8c, 0x7a, 0x6c, 0x82, 0x6c, 0x82, 0x8c, 0x7a, 0x6c, 0x7a, 0x8c, 0x82, 0x8d, 0x82, 0x8c, 0x82, 0x6c, 0x82, 0x8c, 0x7a, 0x8c, 0x7a, 0x8c, 0x82, 0x8c, 0x82, 0x8c, 0x82, 0x8c, 0x82, 0x8c, 0x82, 
-  0xcc, 0x01, 0xec, 0x01, 0xec, 0x01, 0x0c, 0x02, 0x0d, 0x02, 0x6e, 0x0a, 0x8a, 0x01, 0xcb, 0x01, 0xec, 0x01, 0x2d, 0x02, 0x8e, 0x02, 0x2d, 0x02, 0xcf, 0x0a, 0x6a, 0x01, 0xcb, 0x01, 0x2d, 0x02, 0x8f, 0x02, 0xf0, 0x02, 0x31, 0x03, 0xec, 0x01, 0x4e, 0x0a, 0xef, 0x02, 0x6b, 0x01, 0xeb, 0x01, 0xab, 0x01, 0x2d, 0x0a, 0xaf, 0x0a, 0x4e, 0x02, 0xef, 0x02, 0xd3, 0x13, 0x8a, 0x01, 0xec, 0x01, 0x0d, 0x02, 0xcf, 0x02, 0x6e, 0x0a, 0x31, 0x0b, 0x10, 0x03, 0xaf, 0x12, 0xcf, 0x02, 0x72, 0x03, 0xcb, 0x09, 0x8a, 0x01, 0x0c, 0x02, 0x8e, 0x02, 0xd0, 0x02, 0x31, 0x03, 0x8e, 0x02, 0x2d, 0x02, 0x4d, 0x02, 0x4d, 0x02, 0x4d, 0x02, 0x4d, 0x02, 0x4d, 0x02, 0x6d, 0x02, 0x6d, 0x02, 0x6d, 0x02, 0x6d, 0x02, 0x6e, 0x02, 0x6e, 0x02, 0x8e, 0x02, 0x8e, 0x02, 0x8e, 0x02, 0x8e, 0x02, 0x8e, 0x02, 0x8e, 0x02, 0xaf, 0x0a, 0xf2, 0x5b, 0xcf, 0x0a, 0xae, 0x02, 0xae, 0x02, 0xae, 0x02, 0xd1, 0x02, 0xd0, 0x02, 0x8e, 0x02, 0xae, 0x02, 0xae, 0x02, 0xae, 0x02, 0xae, 0x02, 0xce, 0x02, 0xce, 0x02, 0xce, 0x02, 0xce, 0x02, 0xce, 0x02, 0xae, 0x02, 0xae, 0x02, 0xae, 0x02, 0xae, 0x12, 0x4d, 0x02, 0x6d, 0x0a, 0x4c, 0x02, 0x6e, 0x02, 0x4e, 0x12, 0xeb, 0x01, 0x0b, 0x02, 0x0b, 0x02, 0x0c, 0x02, 0x2c, 0x0a, 0x2c, 0x12, 0x2c, 0x22, 0x4c, 0x2a, 0x4c, 0x2a, 0x2c, 0x2a, 0x4c, 0x3a, 0x6c, 0x42, 0x2c, 0x32, 0x2c, 0x42, 0x6d, 0x52, 0x8d, 0x62, 0xce, 0x7a, 0x4c, 0x6a, 0x6d, 0x72, 0xce, 0x82, 0xee, 0x8a, 0x0e, 0x93, 0xae, 0x82, 0x6c, 0x6a, 0xae, 0x72, 0x8c, 0x82, 0xce, 0x8a, 0x8d, 0x7a, 0x6c, 0x7a, 0xce, 0x8a, 0x0b, 0x5a, 0x6d, 0x62, 0x4d, 0x6a, 0x6d, 0x7a, 0xad, 0x82, 0x8c, 0x7a, 0x8c, 0x7a, 0xac, 0x82, 0xac, 0x8a, 0xac, 0x8a, 0x8c, 0x8a, 0x8d, 0x8a, 0xad, 0x82, 0x8c, 0x8a, 0x8c, 0x8a, 0x8c, 0x82, 0x6c, 0x82, 0x8d, 0x82, 0x8c, 0x8a, 0x8c, 0x8a, 0xac, 0x8a, 0x8c, 0x8a, 0xac, 0x92, 0x8c, 0x8a, 0x8c, 0x8a, 0x8c, 0x8a, 0x8c, 0x8a, 0x8c, 0x8a, 0x8c, 0x8a, 0x8c, 0x8a, 0x8c, 0x8a, 0x8c, 0x8a, 0x8c, 0x8a, 0x8c, 0x8a, 0x8c, 0x8a, 0x8c, 0x8a, 0x8c, 0x8a, 0x8c, 0x8a, 
-  0xcc, 0x01, 0xcc, 0x01, 0xcc, 0x01, 0x0c, 0x02, 0x0d, 0x02, 0x2d, 0x02, 0x8e, 0x02, 0x0d, 0x02, 0xec, 0x01, 0x0c, 0x02, 0x2d, 0x02, 0x8f, 0x0a, 0xcc, 0x01, 0x0c, 0x02, 0x2d, 0x02, 0x6e, 0x02, 0x8e, 0x02, 0xf0, 0x02, 0x51, 0x03, 0xd3, 0x1b, 0x2d, 0x0a, 0x8f, 0x02, 0x11, 0x03, 0xd0, 0x0a, 0x8a, 0x01, 0x4d, 0x02, 0x8e, 0x02, 0x10, 0x03, 0xaf, 0x02, 0xb2, 0x1b, 0x2d, 0x02, 0x0c, 0x02, 0x0d, 0x0a, 0xec, 0x01, 0x8e, 0x02, 0xf0, 0x02, 0x71, 0x03, 0x6e, 0x0a, 0x6f, 0x0a, 0x31, 0x0b, 0x8a, 0x09, 0xcb, 0x01, 0x2d, 0x02, 0x8e, 0x02, 0xf0, 0x02, 0x10, 0x03, 0x92, 0x1b, 0x6d, 0x02, 0x6d, 0x02, 0x6d, 0x02, 0x6e, 0x02, 0x8e, 0x02, 0x6e, 0x02, 0xad, 0x0a, 0xaf, 0x02, 0xae, 0x02, 0x8e, 0x12, 0xae, 0x0a, 0xae, 0x0a, 0xaf, 0x0a, 0xae, 0x02, 0x8e, 0x02, 0xae, 0x02, 0xaf, 0x02, 0xcf, 0x0a, 0xae, 0x02, 0xae, 0x02, 0xcf, 0x02, 0xce, 0x02, 0xcf, 0x02, 0xcf, 0x02, 0xce, 0x02, 0xcf, 0x02, 0xce, 0x02, 0xce, 0x02, 0xcf, 0x02, 0xcf, 0x02, 0xcf, 0x02, 0xee, 0x0a, 0xef, 0x0a, 0x0f, 0x0b, 0xef, 0x02, 0xee, 0x12, 0xee, 0x0a, 0xae, 0x02, 0xae, 0x0a, 0x6d, 0x0a, 0x6c, 0x02, 0x6d, 0x12, 0x4c, 0x02, 0x2c, 0x0a, 0xeb, 0x01, 0x2c, 0x0a, 0x0c, 0x02, 0x2c, 0x1a, 0xce, 0x42, 0xae, 0x5a, 0xf0, 0x62, 0x4c, 0x3a, 0x2c, 0x1a, 0x4c, 0x2a, 0x4c, 0x32, 0x6d, 0x4a, 0x4c, 0x3a, 0x6d, 0x4a, 0xce, 0x6a, 0xae, 0x72, 0x8d, 0x6a, 0x8d, 0x7a, 0xad, 0x82, 0x6d, 0x72, 0x8d, 0x72, 0xad, 0x7a, 0xee, 0x9a, 0x2e, 0x9b, 0xed, 0x8a, 0x6c, 0x72, 0xad, 0x7a, 0x0f, 0xa3, 0x8c, 0x82, 0x8d, 0x72, 0x8d, 0x7a, 0x8d, 0x82, 0x8d, 0x82, 0xad, 0x8a, 0xad, 0x8a, 0xad, 0x92, 0xcd, 0x8a, 0xad, 0x92, 0x8c, 0x82, 0xcc, 0x92, 0xcc, 0xa2, 0x6c, 0x82, 0xac, 0x8a, 0x8c, 0x92, 0xad, 0x92, 0xad, 0x8a, 0xac, 0x92, 0xac, 0x92, 0xac, 0x9a, 0xac, 0x9a, 0xcd, 0x9a, 0xcc, 0x92, 0x8c, 0x8a, 0xcd, 0x92, 0xac, 0x92, 0xac, 0x92, 0xac, 0x92, 0xac, 0x92, 0xad, 0x92, 0xac, 0x92, 0xad, 0x92, 0xad, 0x92, 0xac, 0x92, 0xac, 0x92, 0xad, 0x92, 0xad, 0x92, 0xac, 0x92, 0xac, 0x8a, 0x8c, 0x8a, 
-  0xcc, 0x01, 0xcc, 0x01, 0xcc, 0x01, 0xec, 0x01, 0x0c, 0x02, 0x2d, 0x02, 0x4e, 0x0a, 0xd0, 0x0a, 0xab, 0x01, 0xcc, 0x01, 0x2d, 0x02, 0x4d, 0x02, 0x6e, 0x02, 0xf0, 0x0a, 0x2d, 0x02, 0xaf, 0x0a, 0x2d, 0x02, 0xd0, 0x02, 0xf0, 0x02, 0x51, 0x13, 0x0d, 0x02, 0xaf, 0x02, 0xf1, 0x02, 0xd3, 0x0b, 0x8a, 0x01, 0x2d, 0x02, 0xaf, 0x02, 0xf0, 0x02, 0x71, 0x03, 0x14, 0x24, 0x31, 0x0b, 0xd2, 0x0b, 0xcb, 0x01, 0x0c, 0x02, 0x4d, 0x02, 0xcf, 0x02, 0xd0, 0x02, 0x31, 0x0b, 0x10, 0x13, 0xcf, 0x02, 0x31, 0x0b, 0xcb, 0x01, 0x2d, 0x0a, 0xaf, 0x02, 0xcf, 0x02, 0x10, 0x03, 0xd2, 0x03, 0xec, 0x11, 0x2d, 0x02, 0xae, 0x02, 0x8e, 0x02, 0x8e, 0x02, 0xae, 0x02, 0x8f, 0x12, 0xcd, 0x0a, 0x2f, 0xf3, 0x8f, 0x0a, 0x6b, 0x2a, 0x10, 0x95, 0xad, 0x02, 0xcf, 0x02, 0xcf, 0x02, 0xcf, 0x02, 0xcf, 0x02, 0xcf, 0x02, 0xcf, 0x02, 0xcf, 0x02, 0xcf, 0x02, 0xef, 0x0a, 0xef, 0x02, 0xef, 0x02, 0xef, 0x02, 0xcf, 0x02, 0xef, 0x02, 0xef, 0x02, 0xef, 0x02, 0xef, 0x02, 0xef, 0x02, 0xef, 0x02, 0x2f, 0x13, 0x2f, 0x03, 0x0f, 0x03, 0xf0, 0x0a, 0xef, 0x0a, 0xce, 0x0a, 0x8d, 0x02, 0x6d, 0x0a, 0x6d, 0x0a, 0x6c, 0x02, 0xae, 0x12, 0x0b, 0x02, 0x2c, 0x02, 0x2c, 0x1a, 0x8e, 0x4a, 0x8e, 0x52, 0x8d, 0x4a, 0x6d, 0x52, 0x8e, 0x62, 0xce, 0x72, 0xad, 0x7a, 0x2f, 0x8b, 0x8d, 0x5a, 0x2c, 0x42, 0xae, 0x5a, 0x8d, 0x62, 0xad, 0x72, 0xee, 0x8a, 0x50, 0xa3, 0xad, 0x6a, 0xad, 0x62, 0x8d, 0x6a, 0x2c, 0x62, 0xae, 0x6a, 0xcf, 0x82, 0x4c, 0x62, 0x6b, 0x5a, 0x8d, 0x5a, 0x8e, 0x6a, 0xcd, 0x72, 0xac, 0x7a, 0xad, 0x7a, 0xad, 0x82, 0xad, 0x8a, 0xcc, 0x9a, 0xed, 0x9a, 0x8c, 0x8a, 0xcd, 0x92, 0x0c, 0x93, 0xcd, 0xba, 0xed, 0xaa, 0x6b, 0x82, 0xac, 0x9a, 0x8c, 0x8a, 0xac, 0x8a, 0xcd, 0x92, 0xcc, 0x92, 0xcc, 0xaa, 0xed, 0xaa, 0xcd, 0xaa, 0xac, 0x9a, 0xcd, 0x9a, 0xcd, 0xa2, 0xac, 0xa2, 0xac, 0x9a, 0xcd, 0xa2, 0xac, 0xa2, 0xac, 0xa2, 0xcd, 0xa2, 0xcd, 0xa2, 0xcd, 0xa2, 0xcd, 0xa2, 0xac, 0x9a, 0xcc, 0xa2, 0xac, 0x92, 0x8c, 0x92, 0xac, 0x92, 0xac, 0x92, 0xac, 0x92, 0xac, 0x92, 0xac, 0x92, 
-  0xcc, 0x01, 0xcc, 0x01, 0xcc, 0x01, 0xec, 0x01, 0xec, 0x01, 0x0d, 0x02, 0x2e, 0x02, 0x4e, 0x0a, 0xcb, 0x01, 0xab, 0x01, 0xec, 0x01, 0x2d, 0x02, 0x6e, 0x02, 0xd0, 0x02, 0x72, 0x0b, 0xcc, 0x01, 0x4d, 0x02, 0x8e, 0x02, 0xd0, 0x0a, 0x4e, 0x0a, 0x0c, 0x02, 0x6e, 0x02, 0xaf, 0x02, 0x31, 0x0b, 0x8b, 0x01, 0xec, 0x01, 0x2d, 0x02, 0xd0, 0x02, 0x31, 0x03, 0xf3, 0x13, 0x31, 0x13, 0x53, 0x24, 0x54, 0x54, 0xeb, 0x09, 0x0c, 0x02, 0x6e, 0x0a, 0xf0, 0x02, 0x92, 0x03, 0x72, 0x1b, 0x8f, 0x02, 0x72, 0x03, 0xab, 0x01, 0x0d, 0x02, 0xcf, 0x02, 0x10, 0x03, 0x11, 0x0b, 0x92, 0x13, 0xec, 0x01, 0x4c, 0x02, 0x0c, 0x0a, 0x6d, 0x0a, 0x0e, 0x53, 0xac, 0x0a, 0x0d, 0x0a, 0xec, 0x01, 0xae, 0x0a, 0x69, 0xaa, 0xcd, 0x12, 0x8f, 0x0a, 0xef, 0x02, 0xef, 0x02, 0xef, 0x02, 0xef, 0x02, 0xef, 0x02, 0xd0, 0x02, 0x51, 0x0b, 0x12, 0x54, 0x10, 0x03, 0x0f, 0x03, 0x0f, 0x03, 0x0f, 0x03, 0x0f, 0x03, 0x0f, 0x03, 0x0f, 0x03, 0x0f, 0x03, 0x0f, 0x03, 0x30, 0x03, 0x0f, 0x03, 0x2f, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x6f, 0x2b, 0x31, 0x03, 0xae, 0x0a, 0x8d, 0x0a, 0x8e, 0x12, 0x6d, 0x02, 0xae, 0x12, 0x4c, 0x0a, 0x2c, 0x0a, 0xae, 0x42, 0x6d, 0x4a, 0x4c, 0x42, 0x6d, 0x4a, 0x8d, 0x52, 0xad, 0x6a, 0xce, 0x72, 0xce, 0x7a, 0xce, 0x7a, 0x0e, 0x8b, 0xee, 0x82, 0x2e, 0x8b, 0xcd, 0x7a, 0xee, 0x8a, 0x4f, 0xa3, 0xad, 0x82, 0xce, 0x9a, 0x2e, 0xa3, 0x6f, 0xb3, 0xad, 0x82, 0xca, 0x31, 0x2b, 0x4a, 0x6d, 0x62, 0x8d, 0x6a, 0xad, 0x6a, 0x8d, 0x72, 0x8d, 0x7a, 0xad, 0x7a, 0xad, 0x82, 0xcd, 0x8a, 0xcd, 0x9a, 0x0d, 0xab, 0xac, 0x92, 0xed, 0x92, 0x0d, 0xb3, 0xcd, 0xa2, 0x8c, 0x82, 0xed, 0xa2, 0xed, 0xaa, 0x8c, 0x92, 0xcd, 0x92, 0xcc, 0x9a, 0xec, 0xa2, 0xed, 0xb2, 0xed, 0xaa, 0xec, 0xa2, 0xec, 0x9a, 0xcd, 0xa2, 0xcd, 0xaa, 0xed, 0xaa, 0xac, 0xaa, 0xcd, 0xb2, 0xed, 0xaa, 0xac, 0xa2, 0xcd, 0xaa, 0xed, 0xb2, 0xcd, 0xaa, 0xcd, 0xa2, 0xcc, 0x9a, 0xac, 0x9a, 0xcc, 0x9a, 0xac, 0x9a, 0xac, 0x9a, 0xac, 0x9a, 0xac, 0x9a, 0xac, 0x9a, 0xad, 0x9a, 0xac, 0x92, 0xac, 0x92, 
-  0xcc, 0x01, 0x2e, 0x02, 0x0d, 0x02, 0x2e, 0x02, 0x8b, 0x01, 0xcc, 0x01, 0x0d, 0x02, 0xcb, 0x01, 0xcb, 0x01, 0xab, 0x01, 0xcc, 0x01, 0xec, 0x01, 0x4e, 0x02, 0xae, 0x02, 0xf1, 0x02, 0xf0, 0x12, 0x4d, 0x0a, 0x2d, 0x02, 0x8e, 0x0a, 0xaf, 0x02, 0xaf, 0x02, 0x0d, 0x02, 0x8f, 0x02, 0x4d, 0x0a, 0x31, 0x03, 0xd0, 0x0a, 0xab, 0x01, 0xed, 0x09, 0x6e, 0x02, 0x11, 0x03, 0xb3, 0x0b, 0x74, 0x3c, 0x74, 0x4c, 0xb5, 0x64, 0x8d, 0x12, 0xec, 0x09, 0x6e, 0x02, 0xf0, 0x02, 0x11, 0x03, 0xf3, 0x1b, 0x51, 0x03, 0xaa, 0x09, 0x0d, 0x02, 0xaf, 0x02, 0x6e, 0x02, 0x30, 0x03, 0x92, 0x13, 0x91, 0x0b, 0xef, 0x22, 0xca, 0x01, 0x4d, 0x02, 0x90, 0x12, 0x92, 0x4b, 0x4a, 0x09, 0x0c, 0x02, 0xae, 0x02, 0xd0, 0x02, 0xcf, 0x0a, 0xef, 0x02, 0x0f, 0x0b, 0x31, 0x03, 0x6e, 0x3b, 0x0f, 0x03, 0x0f, 0x03, 0x30, 0x0b, 0xef, 0x02, 0x0f, 0x0b, 0x30, 0x03, 0x0f, 0x03, 0x0f, 0x03, 0x2f, 0x03, 0x2f, 0x03, 0x2f, 0x03, 0x0f, 0x03, 0x2f, 0x03, 0x2f, 0x03, 0x51, 0x03, 0x2f, 0x1b, 0x50, 0x03, 0x50, 0x03, 0x90, 0x03, 0x50, 0x03, 0x50, 0x03, 0x2f, 0x03, 0x8d, 0x02, 0xae, 0x1a, 0x8d, 0x02, 0x8d, 0x12, 0x8d, 0x0a, 0x4c, 0x12, 0x6d, 0x52, 0xce, 0x5a, 0xce, 0x62, 0xce, 0x72, 0xce, 0x7a, 0x2f, 0x93, 0xef, 0x82, 0x8e, 0x62, 0xce, 0x6a, 0xcf, 0x7a, 0x0f, 0x93, 0x4f, 0xa3, 0xad, 0x8a, 0x0e, 0x93, 0x0f, 0x8b, 0xad, 0x82, 0xcc, 0x82, 0x2e, 0xb3, 0x0d, 0xab, 0x0d, 0x9b, 0x6f, 0xb3, 0xf1, 0xdb, 0x6c, 0x42, 0x8c, 0x5a, 0x8d, 0x6a, 0xad, 0x6a, 0xad, 0x7a, 0xce, 0x82, 0xad, 0x8a, 0x0e, 0x93, 0xcc, 0x92, 0x6c, 0x82, 0xed, 0x9a, 0xac, 0x9a, 0xec, 0x92, 0xcd, 0x9a, 0x0d, 0xb3, 0xac, 0x9a, 0x4e, 0xbb, 0xec, 0xb2, 0xed, 0xba, 0x2d, 0xc3, 0x6d, 0xcb, 0xec, 0xb2, 0xed, 0xa2, 0x0d, 0xc3, 0xec, 0xaa, 0xed, 0xaa, 0xcc, 0xb2, 0xec, 0xba, 0xec, 0xaa, 0xec, 0xa2, 0x0d, 0xab, 0xcc, 0xa2, 0xcd, 0xaa, 0xcc, 0xaa, 0xcd, 0xaa, 0xec, 0xb2, 0xed, 0xaa, 0xcc, 0xa2, 0xcc, 0xaa, 0xed, 0xaa, 0xac, 0xa2, 0xac, 0xa2, 0xcc, 0xa2, 0xcc, 0xa2, 0xcc, 0xa2, 0xac, 0xa2, 0xcc, 0x9a, 0xcd, 0x9a, 
-  0xec, 0x01, 0x2d, 0x02, 0x6e, 0x02, 0x8f, 0x0a, 0x8e, 0x0a, 0xab, 0x01, 0xec, 0x01, 0xab, 0x01, 0xab, 0x01, 0xab, 0x01, 0xcc, 0x01, 0xcc, 0x01, 0x4d, 0x02, 0x6e, 0x02, 0x10, 0x03, 0x0d, 0x02, 0xcc, 0x01, 0xcc, 0x01, 0x2d, 0x02, 0xcf, 0x02, 0x51, 0x03, 0xd3, 0x13, 0xab, 0x01, 0x2d, 0x02, 0x10, 0x03, 0x93, 0x0b, 0x34, 0x2c, 0xcb, 0x01, 0x4d, 0x02, 0x11, 0x03, 0x92, 0x0b, 0x12, 0x1c, 0x75, 0x54, 0xb5, 0x64, 0x54, 0x34, 0x53, 0x44, 0xb5, 0x64, 0x8e, 0x02, 0x11, 0x0b, 0xb2, 0x13, 0x4d, 0x02, 0xcf, 0x02, 0xcb, 0x01, 0xae, 0x02, 0x2d, 0x02, 0xaf, 0x02, 0x51, 0x03, 0xd2, 0x23, 0xd2, 0x1b, 0xca, 0x09, 0x2c, 0x02, 0xcf, 0x02, 0x10, 0x0b, 0xab, 0x01, 0x4d, 0x02, 0xae, 0x02, 0xef, 0x02, 0xf0, 0x02, 0xf0, 0x02, 0x30, 0x03, 0xf1, 0x0a, 0x2f, 0x03, 0x0f, 0x03, 0x2f, 0x03, 0x2f, 0x03, 0x30, 0x0b, 0x0f, 0x0b, 0x2f, 0x03, 0x2f, 0x03, 0x50, 0x03, 0x50, 0x03, 0x2f, 0x0b, 0x10, 0x6c, 0x30, 0x03, 0x2f, 0x03, 0x30, 0x03, 0x51, 0x03, 0x30, 0x0b, 0x90, 0x03, 0x70, 0x03, 0x50, 0x0b, 0xb2, 0x03, 0x70, 0x03, 0x4e, 0x0a, 0xae, 0x02, 0xcf, 0x0a, 0xce, 0x0a, 0x6d, 0x0a, 0x8d, 0x0a, 0xae, 0x3a, 0x6d, 0x42, 0xae, 0x52, 0xee, 0x5a, 0xce, 0x6a, 0xef, 0x7a, 0x2f, 0x8b, 0x0f, 0x9b, 0x6e, 0xbb, 0x11, 0xcc, 0x2f, 0x93, 0xae, 0x62, 0xad, 0x6a, 0xad, 0x7a, 0xee, 0x82, 0xce, 0x8a, 0xed, 0x8a, 0xed, 0x92, 0x6f, 0xb3, 0x6f, 0xc3, 0xaf, 0xc3, 0x8e, 0xcb, 0x8e, 0xd3, 0xef, 0xdb, 0x8c, 0x6a, 0x4c, 0x62, 0x6d, 0x6a, 0xce, 0x8a, 0x8e, 0x7a, 0xcd, 0x72, 0xac, 0x92, 0x2e, 0xa3, 0x0d, 0xbb, 0xed, 0xa2, 0x2d, 0xc3, 0xec, 0xa2, 0xec, 0x9a, 0x0d, 0xc3, 0xec, 0xba, 0x8f, 0xd3, 0xec, 0xb2, 0xed, 0x9a, 0xed, 0xa2, 0xec, 0xb2, 0x2c, 0xd3, 0x0d, 0xc3, 0x0d, 0xbb, 0x2d, 0xc3, 0x2d, 0xbb, 0xcc, 0xaa, 0x0d, 0xbb, 0x0c, 0xc3, 0x0c, 0xc3, 0xec, 0xb2, 0x0c, 0xc3, 0xec, 0xca, 0xed, 0xb2, 0xcc, 0xa2, 0xed, 0xb2, 0x0d, 0xb3, 0xec, 0xb2, 0xec, 0xba, 0xcc, 0xaa, 0xcd, 0xb2, 0xcd, 0xaa, 0xed, 0xaa, 0xcd, 0xaa, 0xcd, 0xa2, 0xcd, 0xa2, 0xcc, 0xa2, 0xcc, 0xa2, 
-  0x0c, 0x02, 0x4e, 0x02, 0x8f, 0x02, 0xaf, 0x0a, 0xb0, 0x0a, 0x8a, 0x01, 0xab, 0x01, 0x8b, 0x01, 0x8b, 0x01, 0xec, 0x01, 0xac, 0x01, 0xec, 0x01, 0x6e, 0x02, 0x6e, 0x02, 0xd0, 0x02, 0xec, 0x01, 0xcb, 0x09, 0x0d, 0x02, 0x4e, 0x02, 0x8e, 0x02, 0x72, 0x03, 0xb2, 0x0b, 0xec, 0x09, 0x4d, 0x02, 0xd0, 0x02, 0x31, 0x03, 0x55, 0x2c, 0xcb, 0x01, 0x4e, 0x02, 0xf0, 0x02, 0x92, 0x13, 0x74, 0x44, 0x71, 0x23, 0xb3, 0x0b, 0x53, 0x24, 0x94, 0x64, 0xd3, 0x74, 0x59, 0xa6, 0xd0, 0x02, 0x51, 0x03, 0xec, 0x01, 0xd0, 0x0a, 0x51, 0x0b, 0x2c, 0x02, 0x4d, 0x0a, 0x8d, 0x12, 0xf1, 0x02, 0x73, 0x3c, 0x30, 0x03, 0x8a, 0x01, 0x4d, 0x02, 0xce, 0x02, 0xab, 0x01, 0xab, 0x01, 0x2c, 0x02, 0x8e, 0x0a, 0xcf, 0x02, 0x30, 0x03, 0x30, 0x03, 0x31, 0x03, 0x6d, 0x02, 0x4f, 0x0b, 0x0f, 0x03, 0x30, 0x03, 0x50, 0x03, 0x2f, 0x03, 0xef, 0x0a, 0x0d, 0x02, 0x4d, 0x0a, 0x30, 0x03, 0x50, 0x03, 0x6e, 0x0b, 0x6f, 0x03, 0x50, 0x03, 0x50, 0x03, 0x50, 0x0b, 0x8f, 0x03, 0xb1, 0x0b, 0xb1, 0x03, 0x91, 0x0b, 0x90, 0x23, 0x91, 0x0b, 0xaf, 0x0b, 0x70, 0x0b, 0x2d, 0xe4, 0x4f, 0xb4, 0x50, 0x74, 0xae, 0x0a, 0xad, 0x12, 0x6d, 0x2a, 0x6d, 0x2a, 0x6d, 0x32, 0xae, 0x4a, 0x0f, 0x73, 0xef, 0x7a, 0xce, 0x72, 0xee, 0x72, 0xae, 0x6a, 0x0f, 0x73, 0xee, 0x7a, 0x2f, 0x83, 0xcd, 0x6a, 0xee, 0x72, 0xce, 0x7a, 0xee, 0x7a, 0x4f, 0xa3, 0xee, 0x9a, 0x4e, 0xbb, 0x6e, 0xc3, 0xae, 0xc3, 0xae, 0xd3, 0xef, 0xdb, 0x0f, 0xec, 0xb1, 0xfc, 0xcd, 0x82, 0xee, 0x9a, 0x4f, 0xab, 0xee, 0x9a, 0x6c, 0x6a, 0xae, 0x8a, 0xec, 0x9a, 0xed, 0xb2, 0x8d, 0xdb, 0x2f, 0xc3, 0x6e, 0xd3, 0x4d, 0xd3, 0x30, 0xe4, 0xec, 0xa2, 0x4d, 0xab, 0xed, 0xb2, 0xec, 0xba, 0x6d, 0xd3, 0x0c, 0xbb, 0x6e, 0xdb, 0xcc, 0xba, 0x0d, 0xcb, 0x2d, 0xcb, 0x2d, 0xd3, 0x2c, 0xd3, 0x4c, 0xd3, 0x2c, 0xd3, 0x2c, 0xd3, 0x2d, 0xc3, 0xed, 0xba, 0x0d, 0xc3, 0x0d, 0xc3, 0x0d, 0xc3, 0x0c, 0xcb, 0xec, 0xc2, 0x0c, 0xcb, 0xec, 0xba, 0xed, 0xba, 0xcc, 0xba, 0xed, 0xba, 0xed, 0xba, 0xcd, 0xb2, 0xcd, 0xaa, 0xcd, 0xaa, 0xcc, 0xaa, 0xcc, 0xa2, 
-  0xec, 0x01, 0x2d, 0x02, 0x8f, 0x02, 0xd0, 0x0a, 0x6e, 0x02, 0x2d, 0x02, 0x6e, 0x02, 0x6f, 0x0a, 0xab, 0x01, 0xab, 0x09, 0x6a, 0x01, 0xec, 0x01, 0x4d, 0x02, 0x6e, 0x02, 0x6e, 0x02, 0x11, 0x0b, 0x72, 0x13, 0xcc, 0x01, 0x8e, 0x02, 0x11, 0x03, 0x52, 0x03, 0xb3, 0x03, 0x51, 0x2b, 0x2d, 0x02, 0xd0, 0x02, 0x72, 0x03, 0x31, 0x03, 0xd4, 0x2b, 0xcf, 0x02, 0xf0, 0x02, 0xb2, 0x0b, 0x34, 0x3c, 0xf5, 0x7c, 0x71, 0x0b, 0xd2, 0x13, 0x95, 0x5c, 0xd4, 0x7c, 0xf3, 0xa4, 0x6d, 0x02, 0x72, 0x03, 0x70, 0x23, 0x6e, 0x0a, 0x51, 0x0b, 0xec, 0x01, 0x8e, 0x0a, 0x4d, 0x02, 0x31, 0x0b, 0x4c, 0x12, 0x8a, 0x01, 0x2d, 0x02, 0x0c, 0x0a, 0x6d, 0x0a, 0xcd, 0x83, 0x32, 0x95, 0x2c, 0x12, 0x0c, 0x02, 0x6d, 0x02, 0x2c, 0x02, 0xae, 0x02, 0xcf, 0x02, 0x2e, 0x1b, 0x0f, 0x03, 0x10, 0x03, 0x50, 0x03, 0x50, 0x03, 0x50, 0x0b, 0x0c, 0x02, 0x4d, 0x02, 0x8e, 0x02, 0xce, 0x02, 0x50, 0x03, 0x6f, 0x13, 0x70, 0x13, 0x70, 0x03, 0x71, 0x03, 0x70, 0x03, 0xb2, 0x03, 0xb1, 0x03, 0xd1, 0x03, 0xd1, 0x03, 0xb1, 0x0b, 0xb1, 0x03, 0xcd, 0x02, 0x6d, 0x0a, 0x6c, 0x0a, 0x2d, 0x1b, 0xee, 0x0a, 0xee, 0x02, 0xae, 0x1a, 0x6d, 0x1a, 0x8d, 0x2a, 0xad, 0x3a, 0xad, 0x4a, 0x8d, 0x5a, 0xad, 0x5a, 0xce, 0x62, 0xce, 0x72, 0xce, 0x6a, 0x0e, 0x73, 0x2f, 0xa3, 0x0f, 0xf4, 0x4f, 0xfc, 0x50, 0xc4, 0xf0, 0x72, 0x0d, 0x9b, 0xee, 0x9a, 0x2f, 0x9b, 0x0e, 0xab, 0x6e, 0xcb, 0xee, 0xeb, 0x2f, 0xfc, 0x4f, 0xfc, 0x6f, 0xfc, 0xb0, 0xfc, 0x4d, 0x9b, 0xcd, 0x8a, 0x0d, 0x9b, 0x2d, 0xab, 0x6d, 0xc3, 0x8e, 0xcb, 0xae, 0xd3, 0x0c, 0xcb, 0xaf, 0xdb, 0xed, 0xaa, 0x0d, 0xb3, 0x0e, 0xbb, 0x0d, 0xbb, 0x2e, 0xbb, 0x2c, 0xd3, 0xce, 0xeb, 0xca, 0xc2, 0x4d, 0xd3, 0x0c, 0xc3, 0x6e, 0xcb, 0x6d, 0xdb, 0x6d, 0xdb, 0x8d, 0xe3, 0x6c, 0xe3, 0xad, 0xe3, 0x6c, 0xdb, 0x2d, 0xc3, 0x2d, 0xc3, 0x4c, 0xd3, 0x2c, 0xd3, 0x2c, 0xd3, 0x4d, 0xdb, 0x0d, 0xc3, 0xcc, 0xaa, 0xec, 0xba, 0x0c, 0xcb, 0x0c, 0xc3, 0xec, 0xca, 0xec, 0xca, 0xec, 0xc2, 0xec, 0xba, 0xec, 0xba, 0xec, 0xba, 0xec, 0xb2, 0xcc, 0xb2, 0xcd, 0xaa, 
-  0x0c, 0x02, 0x4e, 0x0a, 0x4e, 0x02, 0xd0, 0x0a, 0xd0, 0x0a, 0x6d, 0x02, 0x8f, 0x02, 0xb0, 0x02, 0x51, 0x0b, 0xec, 0x09, 0x8b, 0x01, 0xcc, 0x01, 0xec, 0x01, 0x4e, 0x02, 0xaf, 0x02, 0x32, 0x0b, 0xd3, 0x13, 0xd3, 0x3b, 0x2d, 0x02, 0x11, 0x0b, 0x71, 0x03, 0x34, 0x24, 0xab, 0x01, 0x4e, 0x02, 0xf0, 0x02, 0x92, 0x0b, 0x51, 0x03, 0xf4, 0x23, 0x2d, 0x02, 0xf0, 0x02, 0x71, 0x03, 0x34, 0x34, 0x95, 0x64, 0x91, 0x13, 0xd2, 0x2b, 0xd2, 0x1b, 0x53, 0x44, 0xb4, 0x7c, 0x14, 0x9d, 0x55, 0xa5, 0x93, 0x0b, 0x94, 0x64, 0x37, 0x85, 0xab, 0x01, 0xae, 0x02, 0x10, 0x03, 0x92, 0x03, 0xec, 0x01, 0x48, 0x11, 0x70, 0xc4, 0xcf, 0xa3, 0x8b, 0xf3, 0xcf, 0x12, 0x51, 0x03, 0x34, 0x1c, 0x8a, 0x01, 0x2d, 0x02, 0xef, 0x0a, 0x2d, 0x02, 0xad, 0x22, 0xce, 0x02, 0x0f, 0x0b, 0xae, 0x0a, 0x89, 0x09, 0xcb, 0x09, 0x2c, 0x0a, 0x6d, 0x02, 0xef, 0x0a, 0x50, 0x03, 0x0e, 0x03, 0x2f, 0x0b, 0x51, 0x03, 0x70, 0x03, 0x70, 0x03, 0x91, 0x03, 0x91, 0x03, 0xb0, 0x43, 0x70, 0x1b, 0xf2, 0x03, 0xf2, 0x03, 0x92, 0x0b, 0xd4, 0x64, 0x4d, 0x02, 0xce, 0x02, 0xae, 0x02, 0x0e, 0x23, 0x8e, 0x2a, 0xee, 0x32, 0x10, 0x5b, 0xf0, 0x6a, 0xae, 0x62, 0x6c, 0x42, 0x6d, 0x4a, 0x8d, 0x4a, 0x8e, 0x4a, 0xce, 0x5a, 0xad, 0x6a, 0xee, 0x82, 0x6e, 0xb3, 0xee, 0xdb, 0x30, 0xf4, 0x2f, 0xfc, 0xd0, 0xfc, 0x71, 0xfd, 0xad, 0x82, 0xce, 0x72, 0x0f, 0x7b, 0xee, 0x8a, 0xec, 0x8a, 0x4e, 0xbb, 0xef, 0xdb, 0x0e, 0xec, 0xb0, 0xfc, 0xef, 0xfc, 0x51, 0xf5, 0x0e, 0x9b, 0x6e, 0xc3, 0x4d, 0xcb, 0x6e, 0xcb, 0xae, 0xdb, 0xcf, 0xdb, 0xec, 0xb2, 0x0c, 0xbb, 0x2d, 0xcb, 0x4c, 0xd3, 0x2c, 0xd3, 0x8e, 0xdb, 0x4d, 0xcb, 0x2c, 0xd3, 0x6d, 0xdb, 0x6d, 0xd3, 0x0c, 0xcb, 0x6d, 0xdb, 0x8d, 0xeb, 0x8d, 0xeb, 0x8c, 0xeb, 0xad, 0xeb, 0x2c, 0xcb, 0x6c, 0xdb, 0x6c, 0xdb, 0x6c, 0xe3, 0x6c, 0xeb, 0x4c, 0xd3, 0x0c, 0xcb, 0x4d, 0xc3, 0x4d, 0xcb, 0x0d, 0xcb, 0x2c, 0xd3, 0x4c, 0xdb, 0x2c, 0xcb, 0x0d, 0xcb, 0x0d, 0xd3, 0x0c, 0xcb, 0x0c, 0xcb, 0xec, 0xc2, 0xed, 0xc2, 0xed, 0xc2, 0xed, 0xba, 0xcc, 0xba, 0xcd, 0xb2, 
-  0x0c, 0x02, 0x2d, 0x02, 0x4e, 0x02, 0x8f, 0x02, 0x6e, 0x02, 0xaf, 0x0a, 0x6e, 0x02, 0xf0, 0x02, 0x51, 0x03, 0xac, 0x01, 0x6a, 0x01, 0xcc, 0x01, 0x2d, 0x02, 0x2d, 0x02, 0x8f, 0x02, 0x31, 0x03, 0xb3, 0x13, 0x14, 0x24, 0x93, 0x0b, 0xb2, 0x13, 0xf1, 0x0a, 0x34, 0x1c, 0xcb, 0x01, 0x6f, 0x02, 0x6e, 0x02, 0x51, 0x03, 0x31, 0x13, 0x71, 0x0b, 0xaf, 0x12, 0xaf, 0x02, 0x10, 0x03, 0xb2, 0x13, 0xf3, 0x2b, 0x54, 0x44, 0xb3, 0x0b, 0x93, 0x5c, 0xf1, 0x0b, 0xb4, 0x54, 0x35, 0x95, 0x94, 0xad, 0xd1, 0x03, 0x53, 0x4c, 0x35, 0x8d, 0xca, 0x09, 0x8e, 0x02, 0x91, 0x03, 0xb2, 0x03, 0x33, 0x34, 0xae, 0x0a, 0xcd, 0x0a, 0xed, 0x01, 0x2e, 0x53, 0x8e, 0x0a, 0x30, 0x03, 0x92, 0x03, 0x6d, 0x0a, 0x6d, 0x02, 0x0f, 0x03, 0xcf, 0x02, 0x30, 0x03, 0x51, 0x03, 0xef, 0x0a, 0xcb, 0x01, 0x6d, 0x0a, 0x8e, 0x0a, 0x2d, 0x0a, 0xce, 0x02, 0x10, 0x03, 0x92, 0x0b, 0x2f, 0x03, 0x71, 0x03, 0x90, 0x03, 0x91, 0x03, 0x91, 0x03, 0xb1, 0x03, 0xd1, 0x03, 0xb2, 0x03, 0xf2, 0x0b, 0x6b, 0xc3, 0xcd, 0xc3, 0x34, 0x8d, 0xf2, 0x0b, 0xad, 0x02, 0xce, 0x02, 0xce, 0x02, 0xad, 0x0a, 0xce, 0x3a, 0xce, 0x52, 0x10, 0x73, 0x6c, 0x3a, 0xae, 0x4a, 0xad, 0x5a, 0x6d, 0x42, 0x6d, 0x52, 0xce, 0x6a, 0xee, 0x82, 0x2e, 0x8b, 0x4e, 0xa3, 0x6e, 0xab, 0x8f, 0xbb, 0xcf, 0xd3, 0xaf, 0xfc, 0x10, 0xfd, 0x0f, 0xfd, 0x71, 0xfd, 0xed, 0x7a, 0xee, 0x8a, 0x0e, 0x93, 0x0d, 0xa3, 0x4d, 0xbb, 0x8e, 0xcb, 0xce, 0xdb, 0xef, 0xe3, 0x6f, 0xf4, 0xb1, 0xfd, 0x0e, 0xab, 0xce, 0xcb, 0x8b, 0xe3, 0x70, 0xf4, 0x6e, 0xcb, 0x4e, 0xdb, 0x2d, 0xdb, 0x8d, 0xdb, 0xaf, 0xe3, 0x4c, 0xcb, 0x0c, 0xd3, 0x0c, 0xcb, 0xec, 0xc2, 0x4d, 0xeb, 0xad, 0xeb, 0x4d, 0xdb, 0x6d, 0xeb, 0x8d, 0xeb, 0xad, 0xf3, 0xcd, 0xfb, 0x6c, 0xeb, 0xad, 0xf3, 0x6c, 0xeb, 0x8c, 0xeb, 0x8d, 0xeb, 0xcd, 0xeb, 0x4c, 0xdb, 0x6c, 0xe3, 0x6d, 0xe3, 0x6c, 0xe3, 0x8d, 0xe3, 0x8d, 0xeb, 0x6d, 0xdb, 0x0c, 0xc3, 0x4d, 0xdb, 0x2c, 0xdb, 0x2c, 0xd3, 0x2c, 0xd3, 0x0c, 0xcb, 0x2c, 0xcb, 0x0c, 0xcb, 0xec, 0xca, 0xed, 0xc2, 0xec, 0xba, 0xcd, 0xba, 
-  0x2d, 0x02, 0x0d, 0x02, 0x4e, 0x02, 0x8e, 0x02, 0x6e, 0x02, 0x6e, 0x02, 0x8e, 0x02, 0xd0, 0x02, 0x51, 0x03, 0xab, 0x01, 0x8a, 0x01, 0xab, 0x01, 0xec, 0x01, 0x8e, 0x02, 0x0c, 0x02, 0xd0, 0x02, 0x31, 0x03, 0xb3, 0x0b, 0x34, 0x24, 0x75, 0x3c, 0x37, 0x65, 0xd3, 0x13, 0xcb, 0x09, 0x8f, 0x02, 0x4f, 0x0a, 0x52, 0x03, 0x6e, 0x02, 0x10, 0x03, 0xf0, 0x02, 0xaf, 0x12, 0xaf, 0x02, 0x51, 0x0b, 0xb2, 0x03, 0x55, 0x34, 0x33, 0x34, 0xb1, 0x1b, 0x95, 0x34, 0x74, 0x4c, 0x94, 0x4c, 0x15, 0x85, 0xf5, 0x74, 0x73, 0x3c, 0x32, 0x5c, 0xf1, 0x63, 0x4d, 0x02, 0xf0, 0x0a, 0xd2, 0x03, 0x74, 0x4c, 0x4d, 0x02, 0x51, 0x03, 0x12, 0x04, 0x69, 0x01, 0x2d, 0x02, 0x10, 0x03, 0x31, 0x03, 0x14, 0x3c, 0x6d, 0x02, 0xef, 0x02, 0x30, 0x03, 0x51, 0x0b, 0xd1, 0x0b, 0xab, 0x01, 0x4c, 0x0a, 0xf0, 0x0a, 0x71, 0x0b, 0x2c, 0x02, 0x6e, 0x0a, 0x0f, 0x03, 0x71, 0x03, 0xb2, 0x0b, 0x70, 0x0b, 0x90, 0x03, 0xb1, 0x03, 0xb0, 0x03, 0xf2, 0x03, 0xf1, 0x03, 0xf2, 0x0b, 0x12, 0x04, 0x12, 0x04, 0x4f, 0x5c, 0x13, 0x0c, 0x33, 0x0c, 0xad, 0x02, 0xee, 0x02, 0xce, 0x0a, 0xcf, 0x42, 0xef, 0x52, 0x4c, 0x32, 0xcd, 0x2a, 0x8d, 0x42, 0xef, 0x72, 0x51, 0x9b, 0x90, 0xbb, 0x0f, 0x8b, 0x8d, 0x5a, 0xee, 0x72, 0x0e, 0x83, 0x2e, 0x9b, 0x4e, 0xb3, 0x8f, 0xcb, 0xce, 0xdb, 0xb0, 0xfc, 0x4f, 0xec, 0xcf, 0xfc, 0xd0, 0xfd, 0xf4, 0xed, 0xce, 0x72, 0x0e, 0x8b, 0x2e, 0xa3, 0x4e, 0xbb, 0x8d, 0xc3, 0xee, 0xdb, 0xcd, 0xeb, 0x6e, 0xf4, 0xd0, 0xfc, 0xcb, 0xc2, 0xec, 0x92, 0x8d, 0x4a, 0xad, 0x52, 0xad, 0x5a, 0x2e, 0x9b, 0x2e, 0xcb, 0x4e, 0xbb, 0x2d, 0xd3, 0x8d, 0xf3, 0x0c, 0xd3, 0x6c, 0xeb, 0xcd, 0xfb, 0x4c, 0xd3, 0x8d, 0xe3, 0x8c, 0xeb, 0xad, 0xf3, 0xac, 0xf3, 0xcd, 0xf3, 0xcd, 0xf3, 0xad, 0xf3, 0x8d, 0xf3, 0xcd, 0xeb, 0x0c, 0xd3, 0x8d, 0xeb, 0x8c, 0xeb, 0xad, 0xf3, 0x4c, 0xdb, 0x4c, 0xdb, 0x4c, 0xdb, 0x6c, 0xe3, 0x6d, 0xe3, 0x6c, 0xdb, 0x4d, 0xe3, 0x4d, 0xdb, 0x4c, 0xdb, 0x4c, 0xdb, 0x2c, 0xdb, 0x2c, 0xd3, 0x2c, 0xd3, 0x0c, 0xd3, 0x0c, 0xcb, 0x0c, 0xcb, 0xec, 0xc2, 0xec, 0xc2, 
-  0x0d, 0x02, 0x2d, 0x02, 0x2d, 0x02, 0x4e, 0x02, 0xaf, 0x02, 0x4e, 0x02, 0x6e, 0x0a, 0xd0, 0x02, 0x32, 0x03, 0x10, 0x03, 0x4e, 0x0a, 0xcc, 0x01, 0xab, 0x01, 0x4d, 0x02, 0xcf, 0x0a, 0xaf, 0x02, 0xaf, 0x02, 0x52, 0x03, 0xd3, 0x0b, 0x54, 0x2c, 0xd6, 0x5c, 0x73, 0x2c, 0x17, 0x75, 0x4e, 0x02, 0xf0, 0x0a, 0xd0, 0x02, 0x0c, 0x02, 0x6e, 0x02, 0x32, 0x0b, 0xd3, 0x0b, 0xce, 0x1a, 0x4e, 0x02, 0xf1, 0x0a, 0xb2, 0x03, 0x34, 0x2c, 0xf6, 0x64, 0x92, 0x0b, 0x75, 0x2c, 0x95, 0x54, 0x77, 0x75, 0x90, 0x13, 0xb5, 0x4c, 0x93, 0x54, 0x75, 0x95, 0xae, 0x1a, 0x71, 0x03, 0x54, 0x1c, 0x95, 0x3c, 0xee, 0x0a, 0x91, 0x2b, 0x53, 0x0c, 0xcb, 0x09, 0x8e, 0x02, 0xf0, 0x02, 0x71, 0x03, 0x33, 0x14, 0xef, 0x1a, 0xae, 0x02, 0x30, 0x03, 0x91, 0x03, 0x13, 0x1c, 0xae, 0x02, 0x30, 0x03, 0x71, 0x0b, 0x51, 0x0b, 0x31, 0x1b, 0x4d, 0x0a, 0xae, 0x02, 0x70, 0x0b, 0x91, 0x03, 0xb1, 0x0b, 0x90, 0x03, 0xd1, 0x0b, 0x90, 0x13, 0x13, 0x9d, 0xf2, 0x03, 0x12, 0x0c, 0x12, 0x04, 0xf1, 0x03, 0x32, 0x0c, 0xf1, 0x0b, 0x6f, 0x0b, 0xef, 0x32, 0xef, 0x4a, 0xae, 0x0a, 0xce, 0x02, 0x8d, 0x02, 0x8d, 0x1a, 0xce, 0x62, 0xce, 0x7a, 0x0f, 0x8b, 0x2e, 0x9b, 0x6f, 0xab, 0xaf, 0xbb, 0xef, 0xd3, 0xcf, 0xdb, 0x32, 0xdc, 0xcf, 0xcb, 0xed, 0x92, 0x0d, 0x9b, 0x8e, 0xab, 0xcf, 0xcb, 0x0f, 0xdc, 0x2f, 0xe4, 0xd0, 0xfc, 0x50, 0xfd, 0xcd, 0x82, 0x0f, 0x9b, 0x6e, 0xb3, 0x6e, 0xcb, 0xee, 0xe3, 0x0e, 0xe4, 0xce, 0xe3, 0x6f, 0xf4, 0x8f, 0xfc, 0x4b, 0x52, 0x8c, 0x62, 0xad, 0x72, 0xcd, 0x82, 0x0d, 0x93, 0x0d, 0xa3, 0x0c, 0xb3, 0x6c, 0xe3, 0xad, 0xfb, 0x6c, 0xe3, 0x8d, 0xfb, 0x4c, 0xeb, 0x6c, 0xeb, 0x8d, 0xf3, 0xcd, 0xfb, 0xcd, 0xfb, 0xed, 0xfb, 0x2e, 0xfc, 0x8c, 0xf3, 0xad, 0xfb, 0x6c, 0xe3, 0x6c, 0xe3, 0x8d, 0xf3, 0xcd, 0xfb, 0x2b, 0xe3, 0x8c, 0xeb, 0xad, 0xf3, 0xee, 0xfb, 0x4b, 0xe3, 0xce, 0xf3, 0xce, 0xf3, 0x6c, 0xeb, 0x6d, 0xeb, 0x6d, 0xeb, 0x6d, 0xe3, 0x4c, 0xe3, 0x4c, 0xe3, 0x4c, 0xdb, 0x4c, 0xdb, 0x2c, 0xdb, 0x2c, 0xd3, 0x0c, 0xd3, 0x0c, 0xcb, 0xec, 0xca, 0xec, 0xca, 
-  0x2d, 0x02, 0x4d, 0x02, 0x4e, 0x02, 0x4e, 0x02, 0x8f, 0x02, 0x2d, 0x02, 0x4e, 0x02, 0xaf, 0x02, 0xf0, 0x02, 0x51, 0x03, 0x52, 0x03, 0x14, 0x24, 0x8b, 0x01, 0x2d, 0x02, 0x8f, 0x02, 0xf0, 0x02, 0xf0, 0x02, 0x6f, 0x02, 0x51, 0x03, 0xf4, 0x1b, 0x33, 0x34, 0x54, 0x3c, 0xf5, 0x84, 0xaf, 0x0a, 0x8f, 0x02, 0x8f, 0x0a, 0xf0, 0x0a, 0xd3, 0x13, 0xf0, 0x02, 0x91, 0x03, 0x8b, 0xca, 0x8c, 0x52, 0x6f, 0x0a, 0x10, 0x03, 0x92, 0x03, 0x13, 0x24, 0xb3, 0x23, 0xb2, 0x03, 0x53, 0x2c, 0x16, 0x75, 0x30, 0x03, 0x13, 0x1c, 0xd5, 0x44, 0xf5, 0x6c, 0x4d, 0x0a, 0x51, 0x03, 0xb2, 0x13, 0xf3, 0x03, 0x74, 0x3c, 0xb4, 0x64, 0x14, 0x7d, 0x54, 0xc5, 0x14, 0x95, 0x8e, 0x0a, 0xaf, 0x02, 0xd4, 0x03, 0x13, 0x44, 0x6d, 0x02, 0x0f, 0x0b, 0x10, 0x0b, 0xd3, 0x13, 0xef, 0x02, 0xb1, 0x03, 0xb1, 0x03, 0x10, 0x1b, 0xaf, 0x02, 0x2f, 0x03, 0xf3, 0x0b, 0x30, 0x0b, 0x71, 0x03, 0x53, 0x3c, 0xd0, 0x03, 0xf1, 0x03, 0x12, 0x04, 0x12, 0x04, 0x12, 0x04, 0x32, 0x04, 0x52, 0x04, 0x2f, 0x03, 0x50, 0x03, 0x70, 0x03, 0x30, 0x33, 0x8d, 0x0a, 0xce, 0x02, 0xef, 0x02, 0xad, 0x02, 0xaf, 0x4a, 0xce, 0x62, 0xee, 0x72, 0xee, 0x82, 0x2f, 0x93, 0x2e, 0x9b, 0x6f, 0xab, 0xaf, 0xbb, 0xce, 0xd3, 0x0f, 0xe4, 0xee, 0xeb, 0x90, 0xc3, 0x0e, 0x8b, 0x4e, 0xa3, 0x8e, 0xb3, 0xce, 0xd3, 0x2f, 0xec, 0x6f, 0xfc, 0xcf, 0xfc, 0x10, 0xfd, 0x0b, 0x9b, 0x0d, 0x9b, 0x0c, 0x9b, 0x2d, 0xab, 0x6d, 0xb3, 0x8e, 0xcb, 0xce, 0xdb, 0x4f, 0xec, 0x70, 0xd4, 0xad, 0x6a, 0xcc, 0x72, 0x0d, 0x8b, 0xec, 0x9a, 0x2d, 0xab, 0x0f, 0xf4, 0xcd, 0xfb, 0xcd, 0xfb, 0xcd, 0xf3, 0xcd, 0xfb, 0x6c, 0xf3, 0xad, 0xfb, 0xcd, 0xfb, 0xed, 0xfb, 0x0d, 0xfc, 0x2e, 0xfc, 0xad, 0xf3, 0xad, 0xfb, 0xce, 0xfb, 0x8d, 0xf3, 0xcd, 0xfb, 0xed, 0xfb, 0xac, 0xf3, 0xee, 0xfb, 0xed, 0xfb, 0x4c, 0xeb, 0xce, 0xfb, 0xcd, 0xfb, 0x8c, 0xf3, 0xad, 0xf3, 0xcd, 0xf3, 0xad, 0xf3, 0xad, 0xf3, 0xad, 0xf3, 0x8d, 0xeb, 0x8d, 0xeb, 0x6d, 0xe3, 0x6d, 0xe3, 0x6d, 0xe3, 0x4d, 0xdb, 0x4c, 0xdb, 0x2c, 0xdb, 0x2c, 0xd3, 0x0c, 0xd3, 0xec, 0xca, 
-  0x4e, 0x02, 0x4e, 0x02, 0x6e, 0x02, 0x6e, 0x02, 0xaf, 0x02, 0x8e, 0x02, 0x0c, 0x02, 0x4e, 0x02, 0x8f, 0x02, 0x10, 0x03, 0x52, 0x03, 0xd3, 0x0b, 0xb7, 0x4c, 0xcc, 0x09, 0x4e, 0x02, 0x4e, 0x02, 0xd0, 0x0a, 0x72, 0x0b, 0xf3, 0x13, 0x57, 0x65, 0x52, 0x03, 0xd6, 0x54, 0x75, 0x44, 0x71, 0x23, 0x92, 0x03, 0x54, 0x2c, 0xd6, 0x44, 0xf0, 0x0a, 0x51, 0x0b, 0x65, 0x00, 0x0c, 0xfb, 0x6e, 0xfc, 0xcb, 0x09, 0xf0, 0x0a, 0x4e, 0x02, 0x31, 0x03, 0xf3, 0x13, 0x72, 0x0b, 0xf3, 0x0b, 0x95, 0x44, 0xaf, 0x02, 0xb2, 0x03, 0x34, 0x1c, 0xb5, 0x44, 0x2d, 0x02, 0x10, 0x0b, 0xf3, 0x13, 0x13, 0x1c, 0xf2, 0x13, 0x95, 0x44, 0xb3, 0x5c, 0x74, 0xad, 0xd4, 0xe5, 0x8e, 0x0a, 0x33, 0x2c, 0x35, 0x9d, 0x16, 0xde, 0x2b, 0x1a, 0x8c, 0x09, 0x6d, 0x02, 0x2f, 0x03, 0x70, 0x13, 0xf3, 0x33, 0x74, 0x34, 0xcb, 0x01, 0x8e, 0x0a, 0x10, 0x03, 0x71, 0x03, 0x91, 0x13, 0xb1, 0x1b, 0x12, 0x2c, 0xf1, 0x03, 0x11, 0x04, 0x11, 0x04, 0x32, 0x04, 0x31, 0x04, 0x12, 0x04, 0x70, 0x03, 0x90, 0x03, 0x90, 0x03, 0x70, 0x0b, 0xad, 0x02, 0x8d, 0x12, 0xef, 0x4a, 0xce, 0x62, 0x0e, 0x73, 0xee, 0x7a, 0x2e, 0x83, 0x4e, 0x93, 0x0d, 0x9b, 0x2e, 0xa3, 0x4e, 0xab, 0x6f, 0xbb, 0xaf, 0xcb, 0xcf, 0xdb, 0x0f, 0xec, 0x2e, 0xf4, 0x0e, 0xf4, 0x70, 0xf4, 0x0d, 0xa3, 0x8e, 0xbb, 0xee, 0xd3, 0x2e, 0xf4, 0x6f, 0xfc, 0xd0, 0xfc, 0x10, 0xfd, 0x0d, 0x83, 0xab, 0x62, 0x8d, 0x6a, 0xae, 0x72, 0xed, 0x82, 0x2e, 0xa3, 0x8f, 0xc3, 0x4f, 0xd3, 0x2c, 0x2a, 0x6d, 0x32, 0xed, 0x8a, 0xad, 0xeb, 0xad, 0xfb, 0x4d, 0xfc, 0xac, 0xfb, 0x0d, 0xfc, 0xd0, 0xfc, 0x4f, 0xfc, 0xac, 0xfb, 0xed, 0xfb, 0xed, 0xfb, 0x2d, 0xfc, 0x4e, 0xfc, 0xad, 0xfb, 0xed, 0xfb, 0x2e, 0xfc, 0xcd, 0xfb, 0x0e, 0xfc, 0xed, 0xfb, 0x0e, 0xfc, 0x0e, 0xfc, 0x0e, 0xfc, 0x0e, 0xfc, 0xed, 0xfb, 0xed, 0xfb, 0xcd, 0xfb, 0xed, 0xfb, 0xed, 0xfb, 0xed, 0xfb, 0xed, 0xfb, 0xcd, 0xf3, 0xcd, 0xf3, 0xcd, 0xf3, 0xad, 0xf3, 0xad, 0xeb, 0x8d, 0xeb, 0x8d, 0xeb, 0x6d, 0xe3, 0x6d, 0xe3, 0x6c, 0xe3, 0x4c, 0xdb, 0x2c, 0xdb, 0x2c, 0xd3, 0x0c, 0xd3, 
-  0x6e, 0x02, 0x6e, 0x02, 0xaf, 0x02, 0x2d, 0x02, 0x8f, 0x02, 0xaf, 0x02, 0xec, 0x01, 0x0d, 0x02, 0xaf, 0x0a, 0xf0, 0x02, 0x52, 0x03, 0xd3, 0x0b, 0xf3, 0x23, 0xcc, 0x01, 0xaf, 0x0a, 0x72, 0x13, 0x6e, 0x02, 0x52, 0x0b, 0x34, 0x24, 0x74, 0x3c, 0xf0, 0x12, 0x11, 0x03, 0xb2, 0x0b, 0x34, 0x34, 0xf3, 0x1b, 0x54, 0x34, 0x74, 0x3c, 0x17, 0x65, 0x09, 0x01, 0x26, 0x08, 0xec, 0xfa, 0x6d, 0xfc, 0xf4, 0xe5, 0x2d, 0x0a, 0x11, 0x0b, 0x52, 0x1b, 0x10, 0x0b, 0x52, 0x0b, 0xf3, 0x0b, 0x91, 0x03, 0x13, 0x14, 0xd3, 0x23, 0x92, 0x03, 0x54, 0x1c, 0xb4, 0x3c, 0x76, 0x85, 0xb5, 0xad, 0x4f, 0x0b, 0xb4, 0x4c, 0x91, 0x13, 0x13, 0x0c, 0xd4, 0x6c, 0x75, 0xd5, 0xf5, 0x84, 0x58, 0xce, 0xd3, 0x64, 0x74, 0xbd, 0x93, 0xf5, 0xef, 0x3a, 0xef, 0x02, 0xd2, 0x0b, 0x33, 0x3c, 0x53, 0x3c, 0x56, 0x7d, 0x2c, 0x02, 0x8d, 0x02, 0x51, 0x03, 0x71, 0x03, 0xf2, 0x13, 0xd1, 0x0b, 0x93, 0x64, 0x11, 0x04, 0x73, 0x0c, 0x12, 0x04, 0xcf, 0x0b, 0xf1, 0x1b, 0xf2, 0x03, 0xb0, 0x03, 0x50, 0x0b, 0x33, 0x44, 0x0f, 0x13, 0xce, 0x2a, 0xae, 0x42, 0xce, 0x5a, 0xef, 0x72, 0xce, 0x5a, 0x8c, 0x4a, 0xad, 0x5a, 0xad, 0x6a, 0xce, 0x7a, 0xef, 0x82, 0xef, 0x92, 0x0d, 0xa3, 0x2f, 0xb3, 0xaf, 0xcb, 0x8e, 0xdb, 0x8d, 0xdb, 0x0e, 0xfc, 0x4e, 0xfc, 0x70, 0xfc, 0x2f, 0xe4, 0xcf, 0xeb, 0x4f, 0xfc, 0xcf, 0xfc, 0x30, 0xfd, 0x71, 0xfd, 0xad, 0x72, 0xee, 0x82, 0x0e, 0x9b, 0x6d, 0xb3, 0xed, 0xe3, 0xac, 0xeb, 0xec, 0xfb, 0x4c, 0xfc, 0x0d, 0xdb, 0xee, 0xfb, 0x6d, 0xfb, 0xed, 0xfb, 0xac, 0xfb, 0xcd, 0xfb, 0x8e, 0xfc, 0x0e, 0xfc, 0xcd, 0xfb, 0xac, 0xfb, 0xac, 0xfb, 0x4e, 0xfc, 0xcd, 0xfb, 0xcd, 0xfb, 0x0d, 0xfc, 0x2d, 0xfc, 0xcc, 0xfb, 0x2e, 0xfc, 0x4e, 0xfc, 0x4e, 0xfc, 0xed, 0xfb, 0xed, 0xfb, 0x2e, 0xfc, 0x2e, 0xfc, 0x2d, 0xfc, 0x4e, 0xfc, 0x2e, 0xfc, 0x2e, 0xfc, 0x2e, 0xfc, 0x2e, 0xfc, 0x2e, 0xfc, 0x0d, 0xfc, 0x0d, 0xfc, 0xed, 0xfb, 0xed, 0xfb, 0xcd, 0xf3, 0xcd, 0xf3, 0xad, 0xf3, 0xad, 0xf3, 0x8d, 0xeb, 0x8d, 0xeb, 0x6d, 0xe3, 0x4c, 0xe3, 0x4c, 0xdb, 0x2c, 0xdb, 0x0c, 0xdb, 
-  0x6e, 0x02, 0x6e, 0x02, 0x4d, 0x02, 0x4e, 0x02, 0x8f, 0x02, 0xb0, 0x02, 0xef, 0x02, 0xed, 0x09, 0x8f, 0x02, 0xd0, 0x0a, 0x31, 0x03, 0xb3, 0x1b, 0x51, 0x0b, 0xf3, 0x13, 0xf7, 0x54, 0x92, 0x1b, 0x75, 0x34, 0x92, 0x1b, 0xd3, 0x13, 0x13, 0x24, 0xaf, 0x02, 0x31, 0x03, 0xf0, 0x0a, 0x52, 0x03, 0x14, 0x24, 0x95, 0x3c, 0x16, 0x65, 0xec, 0x11, 0x64, 0x08, 0x66, 0x08, 0x2a, 0xb2, 0x0e, 0xfc, 0x90, 0xfd, 0xae, 0x6b, 0x11, 0x03, 0x15, 0x1c, 0x2d, 0x02, 0xaf, 0x02, 0x31, 0x0b, 0xcf, 0x02, 0xd3, 0x03, 0x90, 0x23, 0x91, 0x23, 0xd2, 0x03, 0xd5, 0x44, 0x35, 0x7d, 0x55, 0xa5, 0xb6, 0xad, 0x13, 0x0c, 0xb3, 0x74, 0x33, 0xa5, 0xd6, 0xb5, 0x12, 0x14, 0x15, 0x95, 0x56, 0xb5, 0xf1, 0x1b, 0x54, 0xa5, 0x73, 0xcd, 0xf0, 0x73, 0xcf, 0x0a, 0xd2, 0x03, 0x33, 0x14, 0x13, 0x2c, 0x13, 0x4c, 0x50, 0x03, 0x8d, 0x02, 0x71, 0x03, 0x50, 0x03, 0xd1, 0x13, 0x70, 0x03, 0x13, 0x44, 0xb3, 0x74, 0x36, 0xad, 0x51, 0x14, 0x54, 0x0c, 0x32, 0x14, 0xb0, 0x0b, 0xee, 0x02, 0x2f, 0x0b, 0xd1, 0x2b, 0x31, 0x3c, 0x73, 0x6c, 0xed, 0x0a, 0xee, 0x02, 0x10, 0x0b, 0x6d, 0x22, 0xad, 0x52, 0xad, 0x6a, 0xad, 0x7a, 0xce, 0x7a, 0xee, 0x8a, 0x4e, 0xa3, 0x50, 0xa3, 0xed, 0x7a, 0x10, 0xdc, 0x0d, 0xf4, 0xce, 0xeb, 0xae, 0xdb, 0x6f, 0xdb, 0xf0, 0xf3, 0xae, 0xeb, 0xce, 0xf3, 0x6f, 0xfc, 0x8f, 0xfc, 0x30, 0xfd, 0xd0, 0xfd, 0xef, 0x7a, 0x6c, 0x62, 0xcd, 0x6a, 0xee, 0x72, 0xce, 0x82, 0xee, 0x82, 0xcc, 0x82, 0xad, 0xfb, 0x0b, 0xfb, 0x2e, 0xfc, 0x8c, 0xfb, 0x0e, 0xfc, 0xed, 0xf3, 0x6c, 0xf3, 0x6c, 0xfb, 0xac, 0xfb, 0x4d, 0xfc, 0x6e, 0xfc, 0xed, 0xfb, 0x0e, 0xfc, 0xed, 0xfb, 0x2d, 0xfc, 0x2d, 0xfc, 0x2d, 0xfc, 0x2d, 0xfc, 0x8e, 0xfc, 0x2d, 0xfc, 0x4e, 0xfc, 0x6e, 0xfc, 0x6e, 0xfc, 0x8e, 0xfc, 0xaf, 0xfc, 0x4e, 0xfc, 0x6e, 0xfc, 0x6e, 0xfc, 0x6e, 0xfc, 0x4e, 0xfc, 0x4e, 0xfc, 0x4e, 0xfc, 0x2e, 0xfc, 0x2e, 0xfc, 0x0d, 0xfc, 0x0d, 0xfc, 0xed, 0xfb, 0xed, 0xfb, 0xcd, 0xf3, 0xcd, 0xf3, 0xad, 0xf3, 0xad, 0xeb, 0x8d, 0xeb, 0x6d, 0xe3, 0x4d, 0xe3, 0x2c, 0xdb, 0x2c, 0xdb, 
-  0x8f, 0x02, 0x8f, 0x02, 0xf0, 0x02, 0x4d, 0x02, 0x6e, 0x02, 0xb0, 0x02, 0xd0, 0x02, 0x0d, 0x02, 0x4e, 0x02, 0x8f, 0x02, 0xf1, 0x02, 0x92, 0x0b, 0xb2, 0x1b, 0x74, 0x44, 0xb2, 0x13, 0x14, 0x1c, 0x94, 0x44, 0xb5, 0x74, 0x57, 0x85, 0x75, 0x2c, 0xd5, 0x54, 0x8f, 0x02, 0xcf, 0x02, 0xb3, 0x13, 0xb2, 0x13, 0xf3, 0x13, 0xb5, 0x4c, 0x66, 0x08, 0x46, 0x08, 0x46, 0x00, 0x67, 0x61, 0x4a, 0xfb, 0x8f, 0xfd, 0x8e, 0xfd, 0x8e, 0x0a, 0x91, 0x0b, 0xf0, 0x02, 0x92, 0x13, 0x6e, 0x02, 0xaf, 0x02, 0x53, 0x24, 0xb3, 0x0b, 0x53, 0x24, 0x91, 0x13, 0x74, 0x2c, 0xd4, 0x4c, 0xf4, 0x94, 0x8d, 0x22, 0x51, 0x0b, 0x33, 0x34, 0xf4, 0x7c, 0xd5, 0xbd, 0xb2, 0x03, 0x93, 0x5c, 0x55, 0x8d, 0x53, 0x9d, 0x78, 0xf6, 0xf5, 0x84, 0x56, 0xd6, 0xae, 0x02, 0x71, 0x03, 0xb2, 0x03, 0xb4, 0x3c, 0x30, 0x03, 0xef, 0x0a, 0x2f, 0x03, 0xd2, 0x0b, 0xd1, 0x03, 0x53, 0x34, 0x70, 0x03, 0x33, 0x1c, 0x73, 0x64, 0xf2, 0xb4, 0x0d, 0x23, 0x8d, 0x02, 0x8d, 0x02, 0xce, 0x0a, 0x0e, 0x03, 0x70, 0x03, 0xf1, 0x1b, 0x12, 0x2c, 0x32, 0x6c, 0x6f, 0x2b, 0x0e, 0x0b, 0x0f, 0x03, 0xce, 0x72, 0xee, 0x82, 0x0e, 0x8b, 0x2e, 0xa3, 0x4e, 0xab, 0x6f, 0xc3, 0x8f, 0xcb, 0x6e, 0xcb, 0xce, 0xe3, 0xce, 0xf3, 0x30, 0xfc, 0x4d, 0xd3, 0x6d, 0xeb, 0xad, 0xfb, 0xed, 0xfb, 0x0e, 0xfc, 0x4d, 0xfc, 0x8f, 0xfc, 0x11, 0xfd, 0x0f, 0xfd, 0xee, 0x7a, 0xcd, 0x72, 0x8c, 0x6a, 0x8d, 0x62, 0xcd, 0x6a, 0x4d, 0xb3, 0xcd, 0xfb, 0x4f, 0xfc, 0xab, 0xfb, 0x4c, 0xfb, 0x2e, 0xfc, 0x8b, 0xf3, 0xcd, 0xfb, 0xac, 0xfb, 0x2d, 0xfc, 0x4d, 0xfc, 0xcd, 0xfb, 0xed, 0xfb, 0x0d, 0xfc, 0x4d, 0xfc, 0x2d, 0xfc, 0x8e, 0xfc, 0x2d, 0xfc, 0x6e, 0xfc, 0x2d, 0xfc, 0x6e, 0xfc, 0x8e, 0xfc, 0xae, 0xfc, 0xce, 0xfc, 0xcf, 0xfc, 0xef, 0xfc, 0xae, 0xfc, 0xae, 0xfc, 0xaf, 0xfc, 0x8f, 0xfc, 0x8f, 0xfc, 0x8e, 0xfc, 0x8e, 0xfc, 0x6e, 0xfc, 0x6e, 0xfc, 0x6e, 0xfc, 0x4e, 0xfc, 0x2e, 0xfc, 0x2e, 0xfc, 0x0e, 0xfc, 0xed, 0xfb, 0xed, 0xfb, 0xcd, 0xfb, 0xcd, 0xfb, 0xad, 0xf3, 0xad, 0xf3, 0x8d, 0xeb, 0x6d, 0xeb, 0x4c, 0xe3, 0x4c, 0xe3, 
-  0x8f, 0x02, 0x8f, 0x02, 0xaf, 0x02, 0x8f, 0x02, 0xaf, 0x02, 0xcf, 0x02, 0x11, 0x03, 0xed, 0x09, 0x2e, 0x02, 0x6e, 0x02, 0xd1, 0x02, 0x72, 0x0b, 0x72, 0x03, 0x13, 0x14, 0xb6, 0x4c, 0xd3, 0x13, 0x94, 0x3c, 0x77, 0x9d, 0xfa, 0xbd, 0x55, 0x24, 0x15, 0x6d, 0xce, 0x12, 0xf1, 0x0a, 0xb2, 0x0b, 0x54, 0x24, 0x73, 0x0b, 0x29, 0x09, 0x65, 0x08, 0x45, 0x00, 0x85, 0x00, 0x45, 0x08, 0xcb, 0xfa, 0xed, 0xfc, 0xcd, 0xfc, 0x51, 0xe5, 0x0d, 0x0a, 0x10, 0x03, 0xd2, 0x13, 0xb5, 0x4c, 0x4e, 0x0a, 0x71, 0x03, 0x13, 0x24, 0x36, 0x7d, 0x91, 0x0b, 0x14, 0x65, 0x75, 0xa5, 0xb4, 0x5c, 0x94, 0xcd, 0xf4, 0x9c, 0xb2, 0x0b, 0x92, 0x34, 0xf4, 0x7c, 0x0f, 0x13, 0xf2, 0x13, 0x73, 0x44, 0x34, 0x8d, 0x75, 0xa5, 0x93, 0xfd, 0xf5, 0xcd, 0x32, 0x14, 0xf5, 0x6c, 0x70, 0x0b, 0x54, 0x24, 0xf0, 0x0a, 0x8d, 0x02, 0x0f, 0x0b, 0x70, 0x03, 0x33, 0x1c, 0xae, 0x0a, 0xd1, 0x03, 0x52, 0x14, 0x93, 0x6c, 0x13, 0xad, 0xf4, 0x9c, 0x2e, 0x4b, 0x6d, 0x02, 0x30, 0x03, 0x12, 0x34, 0x2f, 0x0b, 0xd0, 0x0b, 0xf1, 0x2b, 0xd1, 0x3b, 0xed, 0x02, 0x2f, 0x03, 0xae, 0x52, 0xad, 0x72, 0xee, 0x7a, 0x2e, 0x9b, 0x2d, 0xb3, 0xaf, 0xcb, 0xed, 0xaa, 0x4e, 0xc3, 0x6e, 0xd3, 0xae, 0xeb, 0x2d, 0xd3, 0x4d, 0xdb, 0xee, 0xf3, 0x4d, 0xc3, 0x2d, 0xc3, 0xae, 0xe3, 0x8c, 0xfb, 0x70, 0xfc, 0x0f, 0xd4, 0x70, 0xd4, 0x51, 0xc4, 0x8d, 0x4a, 0x4b, 0x5a, 0xee, 0x9a, 0xaf, 0xfb, 0x2b, 0xfb, 0x8b, 0xfb, 0xed, 0xfb, 0xac, 0xfb, 0x0e, 0xfc, 0x6b, 0xfb, 0xcd, 0xfb, 0xac, 0xfb, 0x0d, 0xfc, 0x4d, 0xfc, 0xec, 0xfb, 0x8e, 0xfc, 0x2d, 0xfc, 0x8e, 0xfc, 0x8e, 0xfc, 0x6e, 0xfc, 0x6d, 0xfc, 0xae, 0xfc, 0x8e, 0xfc, 0xcf, 0xfc, 0xae, 0xfc, 0xce, 0xfc, 0xef, 0xfc, 0xef, 0xfc, 0xef, 0xfc, 0xef, 0xfc, 0x0f, 0xfd, 0x0f, 0xfd, 0xef, 0xfc, 0xcf, 0xfc, 0xae, 0xfc, 0xaf, 0xfc, 0xaf, 0xfc, 0xaf, 0xfc, 0x8f, 0xfc, 0x8e, 0xfc, 0x6e, 0xfc, 0x6e, 0xfc, 0x4e, 0xfc, 0x2e, 0xfc, 0x2e, 0xfc, 0x0e, 0xfc, 0x0d, 0xfc, 0x0d, 0xfc, 0xed, 0xfb, 0xcd, 0xfb, 0xcd, 0xf3, 0xac, 0xf3, 0x8c, 0xeb, 0x6d, 0xeb, 0x4c, 0xe3, 
-  0x8f, 0x02, 0xaf, 0x02, 0xaf, 0x02, 0xcf, 0x02, 0xaf, 0x02, 0xcf, 0x02, 0x31, 0x0b, 0x0d, 0x02, 0x2d, 0x02, 0x6f, 0x02, 0xb0, 0x02, 0x32, 0x0b, 0x11, 0x03, 0xb3, 0x13, 0x74, 0x24, 0xb6, 0x4c, 0x74, 0x34, 0x74, 0x4c, 0x76, 0x75, 0x32, 0x34, 0xb6, 0x44, 0x95, 0x5c, 0xd1, 0x02, 0xd3, 0x03, 0xb3, 0x0b, 0x8a, 0x09, 0x65, 0x08, 0x67, 0x08, 0x66, 0x00, 0x65, 0x08, 0x65, 0x10, 0xce, 0xf4, 0x8b, 0xfc, 0x0c, 0xdc, 0x4e, 0xfd, 0xee, 0x6b, 0xf1, 0x02, 0xf3, 0x0b, 0x53, 0x34, 0x54, 0x44, 0x91, 0x03, 0x54, 0x1c, 0xb4, 0x44, 0x56, 0x9d, 0x35, 0x6d, 0x14, 0xde, 0x35, 0x65, 0x75, 0xa5, 0x94, 0xc5, 0x75, 0xfe, 0x93, 0x03, 0xd2, 0x03, 0xf2, 0x1b, 0x53, 0x34, 0x32, 0x24, 0x94, 0x2c, 0x34, 0x8d, 0xb3, 0xd5, 0x54, 0xfe, 0x92, 0x3c, 0xf4, 0x5c, 0x11, 0x34, 0xd2, 0x0b, 0x50, 0x23, 0x0f, 0x0b, 0x90, 0x03, 0xd4, 0x3c, 0x0e, 0x13, 0x2f, 0x03, 0xf1, 0x03, 0x53, 0x24, 0xf3, 0x64, 0xd2, 0x74, 0xf2, 0x6c, 0x32, 0xbd, 0x8d, 0x1a, 0xef, 0x02, 0x12, 0x2c, 0xd0, 0x33, 0x14, 0x8d, 0x4f, 0x0b, 0xee, 0x0a, 0x0e, 0x03, 0x0e, 0x4b, 0x2d, 0x83, 0x4e, 0xa3, 0x6f, 0xb3, 0xd0, 0xab, 0xcd, 0xa2, 0x2d, 0xbb, 0x6d, 0xd3, 0xae, 0xe3, 0xee, 0xf3, 0xee, 0xf3, 0x0c, 0xc3, 0x2d, 0xc3, 0x4d, 0xcb, 0x6d, 0xdb, 0xae, 0xe3, 0x4d, 0xab, 0x0d, 0xa3, 0x0d, 0xbb, 0x4e, 0xe3, 0x2c, 0xf3, 0x6c, 0xfb, 0x8d, 0xfb, 0xed, 0xfb, 0xed, 0xfb, 0x2d, 0xf4, 0x8c, 0xfb, 0x2d, 0xfc, 0x4d, 0xfc, 0xae, 0xfc, 0x0c, 0xfc, 0x2d, 0xfc, 0x2c, 0xfc, 0x4d, 0xfc, 0x2c, 0xfc, 0xae, 0xfc, 0x4d, 0xfc, 0x8d, 0xfc, 0xad, 0xfc, 0x8d, 0xfc, 0x8e, 0xfc, 0xce, 0xfc, 0xce, 0xfc, 0x0f, 0xfd, 0xef, 0xfc, 0x0f, 0xfd, 0x2f, 0xfd, 0x4f, 0xfd, 0x30, 0xfd, 0x50, 0xfd, 0x70, 0xfd, 0x70, 0xfd, 0x70, 0xfd, 0xb2, 0xfd, 0x50, 0xfd, 0x30, 0xfd, 0x0f, 0xfd, 0xef, 0xfc, 0xcf, 0xfc, 0xaf, 0xfc, 0xaf, 0xfc, 0xaf, 0xfc, 0x8e, 0xfc, 0x6e, 0xfc, 0x6e, 0xfc, 0x4e, 0xfc, 0x4e, 0xfc, 0x2e, 0xfc, 0x0d, 0xfc, 0x0d, 0xfc, 0xed, 0xfb, 0xed, 0xfb, 0xcd, 0xfb, 0xad, 0xf3, 0x8c, 0xf3, 0x8d, 0xeb, 0x6c, 0xeb, 
-  0xaf, 0x02, 0xaf, 0x02, 0xaf, 0x02, 0xcf, 0x02, 0xf0, 0x02, 0xf0, 0x02, 0xf0, 0x02, 0xaf, 0x0a, 0xed, 0x01, 0x2e, 0x02, 0xed, 0x01, 0x8f, 0x02, 0x11, 0x03, 0xb3, 0x03, 0xb2, 0x03, 0x75, 0x34, 0x91, 0x0b, 0x96, 0x3c, 0x96, 0x3c, 0xb8, 0x85, 0x75, 0x24, 0x34, 0x3c, 0xb0, 0x0a, 0x12, 0x03, 0x87, 0x00, 0x45, 0x08, 0x66, 0x08, 0x66, 0x00, 0x46, 0x10, 0x65, 0x10, 0xa9, 0x40, 0x2d, 0xfd, 0x6c, 0xec, 0x0b, 0xa3, 0x0e, 0xfd, 0x30, 0xfd, 0x8f, 0x02, 0x52, 0x03, 0x13, 0x24, 0x51, 0x2b, 0x71, 0x0b, 0x13, 0x0c, 0x94, 0x2c, 0x16, 0x7d, 0xb4, 0x54, 0x54, 0x9d, 0x72, 0x54, 0xf7, 0xb5, 0x73, 0xc5, 0xd4, 0xd5, 0x8e, 0x0a, 0xd4, 0x03, 0x34, 0x24, 0xf3, 0x03, 0x53, 0x1c, 0x56, 0x8d, 0x72, 0x3c, 0x13, 0x95, 0x95, 0xb5, 0xf5, 0xfd, 0xf2, 0x2b, 0x32, 0x34, 0x15, 0x5d, 0x91, 0x03, 0x92, 0x24, 0xb0, 0x23, 0x12, 0x04, 0x33, 0x24, 0x56, 0x8d, 0x72, 0x3c, 0xd1, 0x0b, 0x73, 0x54, 0xcf, 0x0b, 0x72, 0x6c, 0x32, 0xad, 0x76, 0xe6, 0xb1, 0x13, 0xf2, 0x13, 0x32, 0x4c, 0xb2, 0x7c, 0xad, 0x32, 0xae, 0x5a, 0xcd, 0x62, 0xed, 0x72, 0x0e, 0x7b, 0xee, 0x72, 0x2f, 0xb3, 0x6e, 0xc3, 0xae, 0xd3, 0xae, 0xe3, 0x8d, 0xeb, 0x0d, 0xf4, 0x0f, 0xdc, 0xad, 0xba, 0x2c, 0xd3, 0x8d, 0xdb, 0xcb, 0x9a, 0xac, 0x8a, 0x8e, 0xc3, 0xae, 0xeb, 0xeb, 0xe2, 0x6e, 0xfb, 0xcd, 0xfb, 0x6c, 0xfb, 0xed, 0xfb, 0x6b, 0xfb, 0x2d, 0xfc, 0xcc, 0xfb, 0x4d, 0xf4, 0xac, 0xfb, 0xec, 0xfb, 0xcc, 0xfb, 0x2d, 0xfc, 0x4d, 0xfc, 0x8e, 0xfc, 0x6d, 0xfc, 0xef, 0xfc, 0x0e, 0xfd, 0xee, 0xfc, 0x0e, 0xfd, 0x2f, 0xfd, 0xee, 0xfc, 0x0e, 0xfd, 0x2f, 0xfd, 0x4f, 0xfd, 0x6f, 0xfd, 0x4f, 0xfd, 0x70, 0xfd, 0x70, 0xfd, 0x70, 0xfd, 0x90, 0xfd, 0xb0, 0xfd, 0xb0, 0xfd, 0xd1, 0xfd, 0xd1, 0xfd, 0x90, 0xfd, 0x26, 0x00, 0x6a, 0xfc, 0x70, 0xfd, 0x50, 0xfd, 0x10, 0xfd, 0x10, 0xfd, 0xef, 0xfc, 0xcf, 0xfc, 0xcf, 0xfc, 0xaf, 0xfc, 0x8f, 0xfc, 0x8e, 0xfc, 0x6e, 0xfc, 0x4e, 0xfc, 0x4e, 0xfc, 0x2e, 0xfc, 0x0d, 0xfc, 0x0d, 0xfc, 0xed, 0xfb, 0xcd, 0xfb, 0xcd, 0xfb, 0xad, 0xf3, 0x8c, 0xf3, 0x6c, 0xeb, 
-  0xaf, 0x02, 0xd0, 0x02, 0xd0, 0x02, 0xf0, 0x02, 0xf0, 0x02, 0xf0, 0x02, 0xf0, 0x02, 0xd0, 0x02, 0x4e, 0x02, 0x4a, 0x01, 0xac, 0x01, 0x2e, 0x02, 0xd0, 0x02, 0x11, 0x03, 0xd4, 0x13, 0xb3, 0x0b, 0xb6, 0x34, 0xb3, 0x1b, 0xf3, 0x23, 0x34, 0x14, 0x95, 0x24, 0x18, 0x4d, 0xaf, 0x0a, 0xa7, 0x00, 0x66, 0x10, 0x66, 0x08, 0x66, 0x08, 0x67, 0x08, 0x86, 0x00, 0x0a, 0x81, 0xa9, 0x50, 0x6b, 0xfc, 0x2c, 0xa3, 0x88, 0x51, 0xae, 0xfc, 0x0d, 0xfd, 0x0d, 0x63, 0x10, 0x03, 0xd3, 0x0b, 0xf3, 0x2b, 0x30, 0x03, 0xd2, 0x03, 0x74, 0x1c, 0xf4, 0x54, 0x52, 0x1c, 0xf5, 0x5c, 0xb4, 0x4c, 0x96, 0xb5, 0xd5, 0x6c, 0x34, 0x95, 0x35, 0x8d, 0x37, 0xe6, 0x92, 0x0b, 0x8f, 0x0a, 0xd2, 0x03, 0xd4, 0x44, 0x36, 0x65, 0x93, 0x2c, 0xf5, 0x84, 0x4d, 0x02, 0xf0, 0x02, 0x11, 0x03, 0x12, 0x3c, 0xad, 0x02, 0xb2, 0x0b, 0xf2, 0x2b, 0xb1, 0x0b, 0x52, 0x44, 0x52, 0x34, 0x33, 0x85, 0x16, 0xee, 0x12, 0x2c, 0x73, 0x14, 0xd3, 0x8c, 0x93, 0xdd, 0x72, 0xcd, 0xb2, 0x7c, 0xb0, 0x13, 0x2e, 0x1b, 0x70, 0x73, 0x0f, 0x73, 0x0e, 0x73, 0xee, 0x72, 0xee, 0x72, 0x0e, 0x83, 0xee, 0xb2, 0x8e, 0xcb, 0xae, 0xe3, 0x0f, 0xec, 0xaf, 0xcb, 0x2c, 0xa3, 0x0c, 0xa3, 0x0d, 0xb3, 0x2d, 0xc3, 0x2c, 0xcb, 0xae, 0xfb, 0xad, 0xfb, 0x4f, 0xfc, 0x4b, 0xeb, 0xed, 0xfb, 0xed, 0xfb, 0x6c, 0xfb, 0xed, 0xfb, 0xcd, 0xfb, 0x4d, 0xfc, 0x2c, 0xfc, 0x2d, 0xfc, 0x4c, 0xfc, 0xae, 0xfc, 0x6e, 0xfc, 0x4d, 0xfc, 0x6d, 0xfc, 0x8d, 0xfc, 0xad, 0xfc, 0xce, 0xfc, 0x0e, 0xfd, 0x4f, 0xfd, 0x6f, 0xfd, 0x4f, 0xfd, 0x6f, 0xfd, 0x6f, 0xfd, 0x8f, 0xfd, 0x90, 0xfd, 0xb0, 0xfd, 0xb0, 0xfd, 0xb0, 0xfd, 0xd1, 0xfd, 0xf1, 0xfd, 0xf1, 0xfd, 0x11, 0xfe, 0x11, 0xfe, 0x11, 0xfe, 0x31, 0xfe, 0x31, 0xfe, 0x11, 0xfe, 0x48, 0x39, 0x04, 0x10, 0xc7, 0xfb, 0x8b, 0xfc, 0x70, 0xfd, 0x4f, 0xfd, 0x50, 0xfd, 0x2f, 0xfd, 0x0f, 0xfd, 0xef, 0xfc, 0xcf, 0xfc, 0xcf, 0xfc, 0xaf, 0xfc, 0xaf, 0xfc, 0x8f, 0xfc, 0x6e, 0xfc, 0x4e, 0xfc, 0x2e, 0xfc, 0x2e, 0xfc, 0x0e, 0xfc, 0x0d, 0xfc, 0xed, 0xfb, 0xcd, 0xfb, 0xac, 0xf3, 0xac, 0xf3, 
-  0xd0, 0x02, 0xf0, 0x02, 0xf0, 0x02, 0x10, 0x03, 0x10, 0x03, 0x10, 0x03, 0x10, 0x03, 0xf0, 0x02, 0x8b, 0x01, 0x6b, 0x01, 0xcc, 0x01, 0x6f, 0x02, 0xb0, 0x02, 0x8f, 0x0a, 0x72, 0x03, 0x76, 0x2c, 0xb3, 0x0b, 0x14, 0x2c, 0x73, 0x0b, 0xd3, 0x0b, 0x34, 0x14, 0x51, 0x23, 0x45, 0x10, 0x45, 0x08, 0x46, 0x08, 0x66, 0x08, 0x86, 0x00, 0x67, 0x08, 0x66, 0x08, 0xed, 0xa8, 0xac, 0x88, 0x0b, 0xf2, 0x45, 0x08, 0x45, 0x08, 0xec, 0xfb, 0x2e, 0xf5, 0x0e, 0xfd, 0xad, 0x32, 0xf1, 0x02, 0xb4, 0x03, 0xb2, 0x13, 0x71, 0x0b, 0x13, 0x0c, 0xb4, 0x2c, 0xd5, 0x3c, 0xd1, 0x03, 0xd6, 0x44, 0xf4, 0x64, 0x77, 0x8d, 0x34, 0x1c, 0x14, 0x7d, 0x34, 0x9d, 0xf4, 0xdd, 0x8e, 0x02, 0x92, 0x03, 0x32, 0x14, 0x53, 0x14, 0x93, 0x44, 0x10, 0x0b, 0x13, 0x0c, 0x74, 0x3c, 0xf4, 0x74, 0xd4, 0xe5, 0x13, 0xfe, 0x78, 0xde, 0x8e, 0x0a, 0xd0, 0x13, 0x10, 0x0b, 0xd3, 0x0b, 0x93, 0x3c, 0xf3, 0x8c, 0x94, 0xd5, 0x56, 0x95, 0x72, 0x7c, 0x92, 0x64, 0x33, 0xb5, 0xf5, 0xd5, 0x90, 0x23, 0x0e, 0x6b, 0x2e, 0x9b, 0x4e, 0xb3, 0x6e, 0xc3, 0xcf, 0xdb, 0x2f, 0xf4, 0x50, 0xfc, 0xae, 0xe3, 0x4e, 0xc3, 0xee, 0x82, 0xec, 0x92, 0x0d, 0x93, 0x0c, 0x9b, 0x4d, 0xcb, 0xee, 0xf3, 0xcd, 0xf3, 0x0e, 0xfc, 0x8d, 0xfb, 0x0e, 0xfc, 0x8c, 0xfb, 0xed, 0xfb, 0xed, 0xfb, 0xcc, 0xfb, 0x2e, 0xfc, 0x2d, 0xfc, 0x4e, 0xfc, 0xce, 0xfc, 0xae, 0xfc, 0xad, 0xfc, 0x6d, 0xfc, 0xce, 0xf4, 0xce, 0xfc, 0xce, 0xfc, 0xee, 0xfc, 0x0f, 0xfd, 0x2f, 0xfd, 0x6f, 0xfd, 0x6f, 0xfd, 0x6f, 0xfd, 0x90, 0xfd, 0xd0, 0xfd, 0xf1, 0xfd, 0xf1, 0xfd, 0xf0, 0xfd, 0xf0, 0xfd, 0xf1, 0xfd, 0x11, 0xfe, 0x32, 0xfe, 0x32, 0xfe, 0x52, 0xfe, 0x52, 0xfe, 0x72, 0xfe, 0x72, 0xfe, 0x72, 0xfe, 0x91, 0xfe, 0xd2, 0xd5, 0x08, 0x69, 0x67, 0x18, 0x24, 0x00, 0x67, 0xfb, 0xe8, 0xfb, 0x6e, 0xfd, 0xb0, 0xfd, 0x70, 0xfd, 0x70, 0xfd, 0x50, 0xfd, 0x30, 0xfd, 0x0f, 0xfd, 0xef, 0xfc, 0xcf, 0xfc, 0xcf, 0xfc, 0xaf, 0xfc, 0x8f, 0xfc, 0x8e, 0xfc, 0x4e, 0xfc, 0x4e, 0xfc, 0x2e, 0xfc, 0x2d, 0xfc, 0x0d, 0xfc, 0xed, 0xfb, 0xcd, 0xfb, 0xad, 0xf3, 
-  0xf0, 0x02, 0xf0, 0x02, 0x10, 0x03, 0x10, 0x03, 0x11, 0x03, 0x31, 0x03, 0x31, 0x03, 0x6e, 0x0a, 0x29, 0x01, 0x4b, 0x01, 0xac, 0x01, 0x0d, 0x02, 0x6f, 0x02, 0x11, 0x03, 0xd3, 0x13, 0x55, 0x2c, 0x31, 0x03, 0xf4, 0x1b, 0x8e, 0x0a, 0xc8, 0x08, 0xc7, 0x00, 0x45, 0x08, 0x66, 0x08, 0x66, 0x08, 0x66, 0x08, 0x67, 0x08, 0x46, 0x08, 0xcb, 0x38, 0x88, 0x28, 0xed, 0x88, 0x0e, 0xa1, 0xeb, 0x78, 0x26, 0x08, 0x45, 0x10, 0x66, 0x71, 0xcb, 0xf3, 0x0c, 0xfd, 0x4e, 0xfd, 0x6c, 0x1a, 0x32, 0x0b, 0x93, 0x03, 0x72, 0x13, 0x91, 0x03, 0x31, 0x0b, 0x34, 0x0c, 0xf6, 0x4c, 0x54, 0x0c, 0xb4, 0x2c, 0x15, 0x55, 0x94, 0x3c, 0xb4, 0x44, 0x34, 0x9d, 0xf4, 0xed, 0x90, 0x2b, 0x75, 0x5c, 0x96, 0x85, 0x51, 0x0b, 0x72, 0x0b, 0x74, 0x24, 0xf1, 0x03, 0x92, 0x4c, 0x93, 0x3c, 0xb5, 0xcd, 0x13, 0xfe, 0x74, 0xfe, 0x11, 0x64, 0xf3, 0xbc, 0xf4, 0xfd, 0x91, 0x6c, 0x14, 0x8d, 0xf3, 0x64, 0xd3, 0x7c, 0x53, 0xa5, 0xd1, 0x94, 0x93, 0x64, 0xd2, 0x8c, 0x74, 0xdd, 0x4e, 0x0b, 0x12, 0x74, 0x2f, 0x93, 0xaf, 0xcb, 0x6f, 0xc3, 0x4d, 0xbb, 0x6e, 0xcb, 0xcf, 0xa3, 0xed, 0x7a, 0x0e, 0x83, 0xcd, 0x82, 0xac, 0x92, 0xae, 0xeb, 0x0e, 0xfc, 0x2e, 0xfc, 0x2e, 0xfc, 0x8c, 0xfb, 0x2e, 0xfc, 0x4c, 0xfb, 0xad, 0xfb, 0xed, 0xfb, 0xcd, 0xfb, 0xed, 0xfb, 0x0d, 0xfc, 0x4e, 0xfc, 0x8d, 0xfc, 0x8e, 0xfc, 0xce, 0xfc, 0x4f, 0xfd, 0xef, 0xfc, 0xf3, 0x9c, 0x10, 0xed, 0x4e, 0xf5, 0xb0, 0xfd, 0xb0, 0xfd, 0x90, 0xfd, 0xb0, 0xfd, 0xb0, 0xfd, 0xd1, 0xfd, 0x11, 0xfe, 0x11, 0xfe, 0x31, 0xfe, 0x11, 0xfe, 0x31, 0xfe, 0x31, 0xfe, 0x52, 0xfe, 0x52, 0xfe, 0x72, 0xfe, 0x92, 0xfe, 0x92, 0xfe, 0xb2, 0xfe, 0xb2, 0xfe, 0xb2, 0xfe, 0x92, 0xfe, 0xd2, 0xfe, 0xd2, 0xfe, 0x44, 0x10, 0x65, 0x08, 0x45, 0x08, 0x03, 0x10, 0x47, 0xfb, 0xe5, 0xfa, 0x8b, 0xfc, 0xf1, 0xfd, 0xd1, 0xfd, 0x90, 0xfd, 0x70, 0xfd, 0x70, 0xfd, 0x2f, 0xfd, 0x0f, 0xfd, 0xef, 0xfc, 0xcf, 0xfc, 0xcf, 0xfc, 0xaf, 0xfc, 0xaf, 0xfc, 0x8f, 0xfc, 0x6e, 0xfc, 0x4e, 0xfc, 0x2e, 0xfc, 0x2d, 0xfc, 0x0d, 0xfc, 0xed, 0xfb, 0xcd, 0xfb, 
-  0xf0, 0x02, 0x10, 0x03, 0x10, 0x03, 0x11, 0x03, 0x31, 0x03, 0x31, 0x03, 0x31, 0x03, 0xe9, 0x00, 0x2a, 0x01, 0x4b, 0x01, 0x8b, 0x01, 0x0d, 0x02, 0x4f, 0x02, 0xf1, 0x02, 0xb3, 0x0b, 0xd6, 0x34, 0x31, 0x03, 0xea, 0x00, 0xe9, 0x00, 0xc8, 0x00, 0x45, 0x08, 0x45, 0x08, 0x66, 0x08, 0x66, 0x08, 0x67, 0x08, 0x66, 0x08, 0xa8, 0x08, 0x8b, 0x48, 0xca, 0x30, 0x0c, 0x29, 0x87, 0x08, 0x26, 0x10, 0x66, 0x08, 0x26, 0x18, 0x86, 0x18, 0x86, 0x18, 0xce, 0xfc, 0xcd, 0xfc, 0x6d, 0xfd, 0x6e, 0x12, 0xcf, 0x12, 0x92, 0x13, 0xf3, 0x33, 0x90, 0xfc, 0x94, 0x2c, 0xf6, 0x44, 0x92, 0x03, 0x33, 0x0c, 0xb4, 0x44, 0x15, 0x6d, 0x53, 0x0c, 0xd5, 0x54, 0x18, 0xb6, 0x13, 0x0c, 0xb4, 0x4c, 0x55, 0x95, 0x36, 0xee, 0xb3, 0x03, 0xf6, 0x44, 0x70, 0x0b, 0x94, 0x34, 0x73, 0x3c, 0x53, 0x95, 0x95, 0xd5, 0x12, 0xfe, 0xd5, 0xfe, 0x93, 0x74, 0x92, 0xf5, 0xd4, 0xc5, 0x93, 0x7c, 0xf3, 0xf5, 0x53, 0x54, 0x33, 0x95, 0x92, 0xdd, 0xf2, 0x3b, 0x52, 0x2c, 0xb2, 0xa4, 0x70, 0x2b, 0x70, 0x73, 0xae, 0x9b, 0x91, 0x9b, 0x2d, 0x5a, 0x8e, 0x62, 0xce, 0x72, 0x2e, 0x8b, 0x0e, 0xb3, 0x4d, 0xbb, 0x6d, 0xf3, 0xce, 0xfb, 0x0e, 0xfc, 0xcd, 0xfb, 0xcd, 0xfb, 0xcd, 0xfb, 0x4c, 0xfb, 0x0e, 0xfc, 0xcd, 0xfb, 0x0d, 0xfc, 0x4d, 0xfc, 0x6d, 0xfc, 0x8e, 0xfc, 0xae, 0xfc, 0x0e, 0xfd, 0x2f, 0xfd, 0x0f, 0xfd, 0x2f, 0xfd, 0x2f, 0xfd, 0x4d, 0x32, 0xf0, 0x83, 0x2f, 0xfd, 0x2f, 0xfd, 0x90, 0xfd, 0xb0, 0xfd, 0xf1, 0xfd, 0x11, 0xfe, 0x31, 0xfe, 0x51, 0xfe, 0x52, 0xfe, 0x71, 0xfe, 0x72, 0xfe, 0x72, 0xfe, 0x92, 0xfe, 0x92, 0xfe, 0x92, 0xfe, 0xb3, 0xfe, 0xd3, 0xfe, 0xd3, 0xfe, 0xf3, 0xfe, 0xf3, 0xfe, 0x13, 0xff, 0x34, 0xff, 0xf3, 0xfe, 0xd3, 0xfe, 0x0b, 0x6b, 0x23, 0x08, 0x45, 0x00, 0x65, 0x10, 0x66, 0x08, 0xaa, 0xe2, 0x27, 0xfb, 0x48, 0xfc, 0x6a, 0xfc, 0x31, 0xfe, 0xf1, 0xfd, 0xb1, 0xfd, 0x90, 0xfd, 0x70, 0xfd, 0x50, 0xfd, 0x0f, 0xfd, 0x0f, 0xfd, 0xef, 0xfc, 0xcf, 0xfc, 0xaf, 0xfc, 0xaf, 0xfc, 0x8e, 0xfc, 0x6e, 0xfc, 0x4e, 0xfc, 0x4e, 0xfc, 0x2e, 0xfc, 0x0d, 0xfc, 0xed, 0xfb, 
-  0x10, 0x03, 0x11, 0x03, 0x11, 0x03, 0x31, 0x03, 0x31, 0x03, 0x52, 0x03, 0x51, 0x03, 0x0a, 0x01, 0x2a, 0x01, 0x4b, 0x01, 0x8b, 0x01, 0xcc, 0x01, 0x2e, 0x02, 0x8f, 0x02, 0x52, 0x03, 0x34, 0x24, 0xac, 0x01, 0x2a, 0x01, 0x09, 0x01, 0x46, 0x08, 0x65, 0x08, 0x66, 0x08, 0x46, 0x08, 0x66, 0x08, 0x67, 0x08, 0x66, 0x08, 0x8a, 0x28, 0xca, 0x30, 0xca, 0x00, 0xc9, 0x00, 0x67, 0x08, 0x66, 0x00, 0xcb, 0x48, 0xeb, 0x48, 0x88, 0x10, 0xca, 0x92, 0x8d, 0xfc, 0xce, 0xfc, 0xec, 0xfc, 0x6e, 0xfd, 0x0f, 0xd5, 0x48, 0x29, 0x67, 0x08, 0xec, 0xfa, 0x10, 0xd5, 0xd5, 0x95, 0x10, 0x2b, 0x72, 0x03, 0x33, 0x14, 0xf6, 0x44, 0x98, 0x65, 0xf3, 0x0b, 0xae, 0x02, 0xd2, 0x03, 0x94, 0x54, 0xf5, 0x84, 0xd0, 0x7b, 0xca, 0xf3, 0xf3, 0x03, 0xd5, 0x3c, 0xb4, 0x3c, 0x93, 0x14, 0x94, 0xa5, 0xd5, 0x94, 0xf3, 0xed, 0xd5, 0xfe, 0x71, 0x7c, 0xd3, 0xed, 0x94, 0xfe, 0x17, 0xff, 0x12, 0xbd, 0xd5, 0xb5, 0x93, 0x6c, 0x11, 0xa5, 0x4e, 0x2b, 0xd2, 0x0b, 0x72, 0x3c, 0xb0, 0x7b, 0x8e, 0x93, 0xf1, 0xb3, 0xef, 0xcb, 0x0f, 0xe4, 0xca, 0x31, 0xaa, 0x39, 0x2a, 0xfb, 0xcf, 0xfb, 0x6d, 0xfb, 0x2e, 0xfc, 0xec, 0xfb, 0x4e, 0xfc, 0x6e, 0xfc, 0xcd, 0xfb, 0x8c, 0xfb, 0xed, 0xfb, 0x0d, 0xfc, 0x2d, 0xfc, 0x2d, 0xfc, 0xae, 0xfc, 0xed, 0xfc, 0x4f, 0xfd, 0xee, 0xfc, 0xce, 0xfc, 0xb2, 0xfd, 0xcc, 0x6a, 0x48, 0x09, 0x0c, 0x22, 0xd2, 0xf5, 0xb0, 0xfd, 0xd1, 0xfd, 0xf1, 0xfd, 0x11, 0xfe, 0x11, 0xfe, 0x31, 0xfe, 0x72, 0xfe, 0x72, 0xfe, 0xb3, 0xfe, 0x92, 0xfe, 0xc8, 0x8a, 0x92, 0xfe, 0xb3, 0xfe, 0xd2, 0xfe, 0xd3, 0xfe, 0xf3, 0xfe, 0x13, 0xff, 0x13, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x55, 0xff, 0x54, 0xff, 0x54, 0xff, 0x50, 0x8c, 0x44, 0x08, 0x44, 0x08, 0x45, 0x08, 0x45, 0x08, 0x44, 0x08, 0x43, 0x20, 0x48, 0xe3, 0xe9, 0xfb, 0x09, 0xfc, 0x6b, 0xfc, 0x10, 0xfe, 0xf2, 0xfd, 0xf0, 0xfd, 0x90, 0xfd, 0x70, 0xfd, 0x50, 0xfd, 0x30, 0xfd, 0x10, 0xfd, 0xef, 0xfc, 0xcf, 0xfc, 0xcf, 0xfc, 0xaf, 0xfc, 0x8f, 0xfc, 0x6e, 0xfc, 0x4e, 0xfc, 0x2e, 0xfc, 0x2d, 0xfc, 0x0d, 0xfc, 
-  0x10, 0x03, 0x31, 0x03, 0x31, 0x03, 0x31, 0x03, 0x31, 0x03, 0x51, 0x03, 0x31, 0x03, 0xf0, 0x0a, 0x09, 0x01, 0x0a, 0x01, 0x4a, 0x01, 0x6b, 0x09, 0xac, 0x01, 0x6f, 0x02, 0x4f, 0x02, 0x0a, 0x01, 0x6c, 0x01, 0xe9, 0x00, 0x0a, 0x01, 0x66, 0x08, 0x66, 0x08, 0x66, 0x08, 0x66, 0x08, 0x88, 0x08, 0x66, 0x08, 0x89, 0x10, 0x47, 0x08, 0x88, 0x20, 0xea, 0x00, 0x67, 0x00, 0x66, 0x08, 0x67, 0x10, 0x89, 0x28, 0x48, 0x20, 0x88, 0x18, 0xad, 0xfc, 0x2b, 0xf4, 0x8d, 0xfc, 0x8b, 0xfc, 0x0e, 0xfd, 0x45, 0x08, 0x47, 0x08, 0x67, 0x08, 0x8b, 0xda, 0x0b, 0xfb, 0x6e, 0x6b, 0x35, 0x75, 0x92, 0x0b, 0x95, 0x3c, 0x34, 0x0c, 0xb3, 0x3c, 0xce, 0x1a, 0xcf, 0x02, 0xb2, 0x03, 0x12, 0x14, 0xf1, 0x23, 0x64, 0x18, 0x49, 0xfb, 0xd3, 0x64, 0xf3, 0x1b, 0x53, 0x3c, 0x93, 0x54, 0x33, 0x9d, 0x56, 0xd6, 0x32, 0xa5, 0xf7, 0xfe, 0x11, 0x44, 0xd2, 0xa4, 0xb2, 0xf5, 0x52, 0xfe, 0x12, 0x95, 0xf4, 0x9c, 0x73, 0xa5, 0x15, 0xd6, 0x13, 0xa5, 0x37, 0xde, 0x74, 0x74, 0xaf, 0xbb, 0xae, 0xd3, 0x2e, 0xdc, 0x0f, 0xcc, 0xee, 0xd3, 0x0e, 0xf4, 0xaf, 0xfb, 0xf1, 0x3a, 0xaa, 0x09, 0x49, 0x29, 0x4f, 0xfc, 0x4e, 0xfc, 0xce, 0xfc, 0x2e, 0xfc, 0xed, 0xfb, 0x4e, 0xfc, 0xce, 0xfc, 0xce, 0xfc, 0x8e, 0xfc, 0xae, 0xfc, 0xef, 0xfc, 0x4f, 0xfd, 0x71, 0xf5, 0xc8, 0x49, 0xc9, 0x10, 0x28, 0x01, 0x2d, 0x22, 0x11, 0xbd, 0xcf, 0xfd, 0xf1, 0xfd, 0xf1, 0xfd, 0x11, 0xfe, 0x31, 0xfe, 0x51, 0xfe, 0x52, 0xfe, 0x92, 0xfe, 0xb2, 0xfe, 0xd3, 0xfe, 0xf3, 0xfe, 0xb0, 0xa4, 0x47, 0xc2, 0x0a, 0xf4, 0xf3, 0xfe, 0x13, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x75, 0xff, 0x75, 0xff, 0x69, 0x52, 0x45, 0x08, 0x44, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x44, 0x08, 0x84, 0x10, 0x89, 0xfb, 0x48, 0xfb, 0x69, 0xfb, 0x09, 0xfc, 0x4a, 0xfc, 0xcf, 0xfd, 0xf1, 0xfd, 0xd1, 0xfd, 0xb1, 0xfd, 0x90, 0xfd, 0x50, 0xfd, 0x30, 0xfd, 0x10, 0xfd, 0x0f, 0xfd, 0xcf, 0xfc, 0xaf, 0xfc, 0xaf, 0xfc, 0x8f, 0xfc, 0x6e, 0xfc, 0x4e, 0xfc, 0x4e, 0xfc, 0x0d, 0xfc, 
-  0x10, 0x03, 0x31, 0x03, 0x31, 0x03, 0x31, 0x03, 0x51, 0x03, 0x52, 0x03, 0x71, 0x03, 0x72, 0x0b, 0xb3, 0x23, 0x10, 0x53, 0xd6, 0xa4, 0xfa, 0xcd, 0x1a, 0xc6, 0x57, 0xa5, 0x14, 0x74, 0x8f, 0x3a, 0xad, 0x09, 0xea, 0x00, 0xc9, 0x00, 0x66, 0x08, 0x46, 0x08, 0x66, 0x08, 0x88, 0x08, 0x87, 0x08, 0x66, 0x08, 0xa9, 0x10, 0x65, 0x00, 0xa9, 0x08, 0x0a, 0x01, 0x45, 0x08, 0x66, 0x08, 0x87, 0x08, 0x67, 0x10, 0x68, 0x10, 0x6d, 0xe4, 0x6d, 0xfc, 0x6b, 0xfb, 0x0a, 0xfb, 0xaa, 0xfb, 0x0b, 0xfc, 0x24, 0x10, 0x26, 0x00, 0x46, 0x08, 0xc7, 0x48, 0x6b, 0xfa, 0x8c, 0xfa, 0xb0, 0x3a, 0xb6, 0x4c, 0x34, 0x1c, 0xf5, 0x4c, 0x13, 0x0c, 0x91, 0x2b, 0xf0, 0x02, 0x92, 0x03, 0x14, 0x0c, 0x25, 0x08, 0xe7, 0x91, 0x4a, 0xfc, 0xae, 0xfd, 0x72, 0x34, 0x50, 0x13, 0x73, 0x24, 0xb3, 0x5c, 0xd4, 0xcd, 0x13, 0x4d, 0x93, 0xdd, 0xb2, 0x7c, 0x93, 0x6c, 0x13, 0xb5, 0xd2, 0xf5, 0xf2, 0xfd, 0x13, 0xa5, 0x72, 0x4c, 0x30, 0xd5, 0xb3, 0x74, 0x53, 0xad, 0x31, 0xb4, 0x70, 0xdc, 0xce, 0xd3, 0x4c, 0xd3, 0xad, 0xe3, 0xac, 0xfb, 0x4c, 0xfb, 0x0e, 0xfc, 0x0e, 0xf4, 0xae, 0xf3, 0x6e, 0x12, 0xca, 0x09, 0xcb, 0x09, 0x06, 0x21, 0x31, 0xfd, 0x30, 0xfd, 0xcf, 0xfc, 0xce, 0xfc, 0x0f, 0xfd, 0x2f, 0xfd, 0x50, 0xfd, 0xcd, 0x93, 0x6a, 0x11, 0x8a, 0x01, 0x8b, 0x11, 0x8b, 0x09, 0x8e, 0x7b, 0xd0, 0xfd, 0xf2, 0xfd, 0x11, 0xfe, 0x31, 0xfe, 0x31, 0xfe, 0x52, 0xfe, 0x72, 0xfe, 0x72, 0xfe, 0xb3, 0xfe, 0xd3, 0xfe, 0xf3, 0xfe, 0x33, 0xff, 0x15, 0xf7, 0x66, 0x08, 0xe8, 0xe2, 0xc8, 0xfb, 0xee, 0xfd, 0x54, 0xff, 0x54, 0xff, 0x55, 0xff, 0x75, 0xff, 0xb5, 0xff, 0x55, 0xff, 0x54, 0xff, 0x96, 0xff, 0x95, 0xff, 0x8f, 0x73, 0xa9, 0x18, 0x45, 0x08, 0x44, 0x08, 0x25, 0x08, 0x86, 0x08, 0x86, 0x08, 0x25, 0x08, 0xc5, 0x28, 0x4a, 0xfb, 0x08, 0xfb, 0x08, 0xfb, 0x29, 0xfb, 0xea, 0xfb, 0xaa, 0xfc, 0xab, 0xfc, 0x52, 0xfe, 0xf1, 0xfd, 0xb0, 0xfd, 0x90, 0xfd, 0x70, 0xfd, 0x2f, 0xfd, 0x0f, 0xfd, 0xef, 0xfc, 0xcf, 0xfc, 0xcf, 0xfc, 0xaf, 0xfc, 0x8f, 0xfc, 0x6e, 0xfc, 0x4e, 0xfc, 0x2e, 0xfc, 
-  0x11, 0x03, 0x31, 0x03, 0x31, 0x03, 0x51, 0x03, 0x51, 0x03, 0x31, 0x03, 0x14, 0x34, 0xd9, 0x9d, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xf7, 0xf4, 0x6b, 0x87, 0x10, 0x46, 0x08, 0x86, 0x08, 0x88, 0x08, 0x87, 0x08, 0x46, 0x08, 0x67, 0x08, 0x66, 0x08, 0x45, 0x08, 0xe9, 0x08, 0x2b, 0x01, 0x45, 0x08, 0x67, 0x08, 0x47, 0x08, 0x67, 0x10, 0xa6, 0x51, 0xae, 0xfc, 0x6b, 0xfc, 0x8e, 0xfd, 0xe9, 0xfa, 0x8b, 0xfb, 0x6b, 0xfa, 0xec, 0xfb, 0x88, 0x10, 0x66, 0x08, 0x67, 0x08, 0xeb, 0x88, 0x8b, 0x80, 0xeb, 0x50, 0x50, 0x0b, 0x54, 0x14, 0xd5, 0x4c, 0x33, 0x1c, 0x54, 0x3c, 0xef, 0x02, 0x51, 0x03, 0x46, 0x00, 0x45, 0x08, 0x84, 0x28, 0x49, 0xfc, 0x0d, 0xfd, 0xaf, 0xf5, 0x50, 0x13, 0x33, 0x1c, 0x14, 0x85, 0xf5, 0x8c, 0xb4, 0x2c, 0x12, 0x95, 0xb3, 0xed, 0x74, 0xfe, 0xb2, 0x84, 0xd3, 0x8c, 0x72, 0xd5, 0xf2, 0xed, 0x73, 0xfe, 0xf0, 0x53, 0x51, 0x54, 0xf1, 0x7c, 0xf1, 0xed, 0x4e, 0xc3, 0xef, 0xeb, 0x4d, 0xeb, 0xad, 0xf3, 0x0e, 0xfc, 0x6d, 0xfb, 0x6d, 0xfb, 0xac, 0xfb, 0xad, 0xfb, 0x4e, 0xfc, 0x2f, 0xf4, 0x51, 0x84, 0x6d, 0x02, 0x4a, 0x11, 0xcf, 0x9b, 0xb1, 0xed, 0x2b, 0x52, 0x0d, 0xfd, 0x70, 0xfd, 0xa6, 0x08, 0xac, 0x11, 0x6a, 0x09, 0x70, 0x73, 0x91, 0xe5, 0xd1, 0xfd, 0xf0, 0xfd, 0x12, 0xfe, 0x31, 0xfe, 0x51, 0xfe, 0x72, 0xfe, 0x72, 0xfe, 0x92, 0xfe, 0x92, 0xfe, 0xb3, 0xfe, 0xf3, 0xfe, 0x13, 0xff, 0x34, 0xff, 0x55, 0xff, 0x66, 0x08, 0x66, 0x08, 0xc8, 0xf2, 0xc8, 0xfb, 0xa9, 0xfc, 0x33, 0xff, 0x75, 0xff, 0x96, 0xff, 0xb6, 0xff, 0xb5, 0xff, 0x05, 0x19, 0x16, 0xef, 0x0f, 0x84, 0x09, 0x11, 0xa7, 0x00, 0xc8, 0x08, 0x89, 0x10, 0x25, 0x08, 0x45, 0x08, 0x45, 0x10, 0x88, 0x28, 0x24, 0x10, 0xc5, 0x48, 0xe8, 0xfa, 0x28, 0xfb, 0x48, 0xf2, 0x68, 0xfa, 0x49, 0xfb, 0x8a, 0xfc, 0x2b, 0xfc, 0xea, 0xfb, 0x11, 0xfe, 0xf1, 0xfd, 0xb0, 0xfd, 0x90, 0xfd, 0x50, 0xfd, 0x30, 0xfd, 0x10, 0xfd, 0xef, 0xfc, 0xcf, 0xfc, 0xaf, 0xfc, 0xaf, 0xfc, 0x8f, 0xfc, 0x6e, 0xfc, 0x4e, 0xfc, 
-  0x31, 0x03, 0x31, 0x03, 0x51, 0x03, 0x51, 0x03, 0x72, 0x03, 0x37, 0x6d, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xc6, 0x2a, 0x21, 0x88, 0x00, 0x88, 0x08, 0x67, 0x08, 0x67, 0x08, 0xa8, 0x08, 0x67, 0x08, 0x66, 0x08, 0xe9, 0x00, 0x0a, 0x01, 0x66, 0x08, 0x67, 0x00, 0x45, 0x08, 0x67, 0x18, 0x90, 0x6b, 0x0d, 0xfc, 0x4e, 0xfc, 0x30, 0xfd, 0x0a, 0xfb, 0xcd, 0xfb, 0xe9, 0xf9, 0x6c, 0xfb, 0xec, 0xfa, 0xc9, 0x69, 0x66, 0x10, 0x2b, 0x61, 0xec, 0x70, 0x0c, 0x59, 0x0b, 0x49, 0xb3, 0x2b, 0x74, 0x0c, 0xb4, 0x2c, 0xf5, 0x44, 0x57, 0x65, 0x0d, 0x0a, 0x45, 0x08, 0x45, 0x08, 0x66, 0x08, 0xeb, 0xdb, 0x6d, 0xfd, 0x4d, 0xfd, 0x32, 0x14, 0x55, 0x4d, 0x73, 0x2c, 0x73, 0x24, 0x31, 0x2c, 0x93, 0x4c, 0x33, 0xa5, 0xb3, 0xdd, 0x13, 0xfe, 0xf7, 0xfe, 0x92, 0x7c, 0x92, 0xe5, 0x72, 0xfe, 0xf4, 0xb5, 0xd3, 0x7c, 0x73, 0xfe, 0xf1, 0xc4, 0xf3, 0xfd, 0x0d, 0xdb, 0x8c, 0xeb, 0xae, 0xf3, 0xcd, 0xfb, 0x2e, 0xfc, 0xad, 0xfb, 0x2e, 0xfc, 0xed, 0xfb, 0x4e, 0xfc, 0x2d, 0xfc, 0x6d, 0xfc, 0x8e, 0xfc, 0x90, 0xfc, 0x2f, 0x94, 0x71, 0x4b, 0xcb, 0x09, 0xcf, 0x5b, 0xcf, 0x12, 0xc7, 0x10, 0x70, 0xfd, 0x8f, 0xfd, 0xf0, 0xfd, 0x11, 0xfe, 0x31, 0xfe, 0x32, 0xfe, 0x92, 0xfe, 0x52, 0xfe, 0x52, 0xfe, 0x72, 0xfe, 0x72, 0xfe, 0x92, 0xfe, 0xd3, 0xfe, 0xf3, 0xfe, 0x14, 0xff, 0x35, 0xff, 0x94, 0xff, 0x27, 0x42, 0xa7, 0x10, 0x66, 0x08, 0xa7, 0xa1, 0xc8, 0xf3, 0x49, 0xfc, 0x6a, 0xf4, 0x96, 0xff, 0xb6, 0xff, 0xb5, 0xff, 0x6d, 0x63, 0x89, 0x00, 0xc9, 0x08, 0x0b, 0x31, 0x09, 0x09, 0x09, 0x09, 0xe9, 0x08, 0xe9, 0x10, 0xa7, 0x10, 0x44, 0x08, 0x44, 0x00, 0x66, 0x10, 0x87, 0x30, 0xc9, 0x58, 0x48, 0xfb, 0x0a, 0xe2, 0x4a, 0xc1, 0x69, 0xe9, 0x6a, 0xfb, 0xe9, 0xfb, 0x2a, 0xfc, 0x0a, 0xfc, 0x0b, 0xfc, 0x11, 0xfe, 0xf0, 0xfd, 0xb1, 0xfd, 0x90, 0xfd, 0x50, 0xfd, 0x0f, 0xfd, 0xef, 0xfc, 0xef, 0xfc, 0xcf, 0xfc, 0xaf, 0xfc, 0xaf, 0xfc, 0x8e, 0xfc, 0x6e, 0xfc, 
-  0x31, 0x03, 0x31, 0x03, 0x51, 0x03, 0x72, 0x03, 0x3a, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0x0d, 0x3a, 0x67, 0x08, 0x67, 0x08, 0xa8, 0x08, 0xa8, 0x00, 0xc8, 0x08, 0xc8, 0x00, 0x6c, 0x09, 0xc9, 0x00, 0x66, 0x08, 0x66, 0x08, 0x46, 0x08, 0x26, 0x00, 0x52, 0x13, 0xd1, 0x12, 0xd1, 0x0a, 0x50, 0x02, 0x0d, 0xfd, 0xac, 0xec, 0x2e, 0xfb, 0x0c, 0xea, 0x4a, 0xfa, 0x4b, 0xf3, 0x2a, 0xfa, 0x4d, 0xfc, 0xa9, 0x60, 0x0b, 0x59, 0xeb, 0x38, 0xa9, 0x28, 0x4a, 0x11, 0x94, 0x0c, 0xf5, 0x34, 0xb5, 0x44, 0x65, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x49, 0x6a, 0xfc, 0x6e, 0xfd, 0x10, 0xfe, 0x73, 0x14, 0x32, 0x24, 0x33, 0x04, 0xb4, 0x3c, 0x11, 0x04, 0xb3, 0x94, 0x93, 0xb5, 0x13, 0xb5, 0xd2, 0xed, 0xb6, 0xd6, 0x13, 0x9d, 0xb2, 0xe5, 0x96, 0xee, 0x53, 0x3c, 0x31, 0xc5, 0x92, 0x7c, 0xd3, 0xe5, 0xee, 0xdb, 0xee, 0xfb, 0x6c, 0xfb, 0xce, 0xfb, 0x0e, 0xfc, 0xcd, 0xfb, 0x6e, 0xfc, 0x4e, 0xfc, 0x2e, 0xfc, 0x2d, 0xfc, 0x2d, 0xfc, 0x4e, 0xfc, 0xcf, 0xfc, 0xad, 0xfc, 0x8d, 0x93, 0x6d, 0x3a, 0x08, 0x11, 0x6a, 0x09, 0xcc, 0x5a, 0x31, 0xd5, 0xb0, 0xfd, 0xd0, 0xfd, 0xf1, 0xfd, 0x32, 0xfe, 0x52, 0xfe, 0x4f, 0xfe, 0xd0, 0xf5, 0x72, 0xfe, 0x93, 0xfe, 0x72, 0xfe, 0xd3, 0xfe, 0xf3, 0xfe, 0x34, 0xff, 0x55, 0xff, 0x74, 0xff, 0x11, 0xad, 0x45, 0x08, 0x66, 0x08, 0x45, 0x08, 0xa6, 0x18, 0x89, 0xfc, 0xca, 0xeb, 0x48, 0xfc, 0xb6, 0xff, 0xf6, 0xff, 0xf0, 0x7b, 0xe9, 0x08, 0xe9, 0x08, 0xc8, 0x08, 0xe8, 0x00, 0xca, 0x28, 0x0a, 0x19, 0x2a, 0x09, 0x2a, 0x11, 0xe9, 0x10, 0x66, 0x10, 0x65, 0x08, 0x25, 0x08, 0x88, 0x40, 0xcc, 0x88, 0x4b, 0xc1, 0x4b, 0xc1, 0xeb, 0x70, 0x0a, 0x81, 0xea, 0x99, 0x69, 0xfb, 0x29, 0xfc, 0xe9, 0xfb, 0x0b, 0xfc, 0x4a, 0xfa, 0x4d, 0xfc, 0x11, 0xfe, 0xb0, 0xfd, 0x90, 0xfd, 0x50, 0xfd, 0x30, 0xfd, 0x10, 0xfd, 0xef, 0xfc, 0xcf, 0xfc, 0xaf, 0xfc, 0x8f, 0xfc, 0x6e, 0xfc, 
-  0x30, 0x03, 0x51, 0x03, 0x51, 0x03, 0x98, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xde, 0x8a, 0x29, 0xc6, 0x00, 0xa8, 0x08, 0xa8, 0x08, 0x88, 0x08, 0x6b, 0x01, 0x8c, 0x09, 0xc8, 0x00, 0x66, 0x08, 0x67, 0x08, 0xc8, 0x08, 0x4f, 0x0a, 0x52, 0x03, 0x11, 0x0b, 0x4f, 0x0a, 0x6e, 0x0a, 0xae, 0xfc, 0x2c, 0xfc, 0xa7, 0xf9, 0xab, 0xf2, 0x0c, 0xfa, 0xaa, 0xfa, 0x29, 0xfa, 0x0b, 0xfb, 0xa9, 0xe9, 0x51, 0xec, 0xea, 0x38, 0x47, 0x18, 0x05, 0x10, 0x46, 0x10, 0x25, 0x08, 0x44, 0x08, 0x44, 0x00, 0x45, 0x08, 0x45, 0x08, 0x45, 0x08, 0xa7, 0x61, 0xe8, 0xfb, 0x4b, 0xfc, 0x4c, 0xfd, 0x50, 0xbd, 0xb4, 0x2c, 0x90, 0x0b, 0x73, 0x0c, 0x55, 0x65, 0x5a, 0xce, 0x57, 0xfe, 0x59, 0xff, 0xd9, 0xee, 0x1a, 0xff, 0x9a, 0xce, 0xb9, 0xe6, 0x3a, 0xf7, 0xf5, 0x5c, 0x31, 0xcd, 0x72, 0x5c, 0x51, 0xdd, 0x56, 0xfe, 0x76, 0xdd, 0x96, 0xe5, 0xf7, 0xfd, 0x17, 0xfe, 0xd6, 0xfd, 0x17, 0xfe, 0xd6, 0xfd, 0xb5, 0xfd, 0x0d, 0xfc, 0x4e, 0xfc, 0x6e, 0xfc, 0xae, 0xfc, 0x0f, 0xfd, 0x50, 0xfd, 0xee, 0xfc, 0xb1, 0xf5, 0x90, 0xfd, 0xb2, 0xfd, 0xf1, 0xfd, 0xf1, 0xfd, 0x32, 0xfe, 0x32, 0xfe, 0x52, 0xfe, 0x72, 0xfe, 0x72, 0xfe, 0x92, 0xfe, 0xb2, 0xfe, 0xd3, 0xfe, 0xf3, 0xfe, 0x14, 0xff, 0x34, 0xff, 0x55, 0xff, 0x96, 0xff, 0x34, 0xce, 0x45, 0x08, 0x46, 0x08, 0x45, 0x08, 0x46, 0x08, 0x84, 0x18, 0xa9, 0xfb, 0xab, 0x92, 0x8a, 0xfc, 0x8a, 0xfc, 0x8c, 0xcc, 0xc7, 0x00, 0xe9, 0x08, 0xe9, 0x08, 0xe8, 0x08, 0xa7, 0x08, 0x87, 0x08, 0x0b, 0x39, 0x2a, 0x09, 0x4a, 0x01, 0xf0, 0x62, 0x34, 0x9c, 0xf6, 0xa4, 0xf9, 0xc5, 0x37, 0xbd, 0x75, 0xc4, 0x31, 0xbb, 0x4b, 0xa9, 0x2b, 0x69, 0xab, 0x29, 0x8b, 0x31, 0xc6, 0x08, 0x6a, 0xfb, 0xa9, 0xfb, 0xcb, 0xfa, 0x8f, 0xfb, 0x18, 0xfe, 0xdb, 0xfe, 0x5c, 0xff, 0x1a, 0xff, 0xf4, 0xfd, 0x50, 0xfd, 0xb3, 0xfd, 0x98, 0xfe, 0x78, 0xfe, 0x78, 0xfe, 0x52, 0xfd, 0x8f, 0xfc, 
-  0x31, 0x03, 0x51, 0x03, 0x95, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xcd, 0xab, 0x20, 0xc9, 0x00, 0xea, 0x00, 0x2b, 0x09, 0x6b, 0x01, 0x4b, 0x09, 0xea, 0x00, 0xa8, 0x08, 0xa8, 0x00, 0xc9, 0x00, 0xb0, 0x02, 0x52, 0x03, 0x8f, 0x0a, 0x2d, 0x02, 0xb4, 0x0b, 0x8e, 0xb3, 0x8d, 0xfc, 0x6b, 0xfb, 0xa9, 0xc1, 0x6d, 0xfa, 0x4c, 0xfb, 0x0a, 0xea, 0x2c, 0xf2, 0xab, 0xfa, 0x4d, 0xfa, 0xab, 0x40, 0x67, 0x10, 0x65, 0x08, 0x85, 0x08, 0x66, 0x10, 0x24, 0x08, 0x45, 0x08, 0x45, 0x08, 0x45, 0x10, 0xe7, 0x50, 0xa8, 0xaa, 0xa9, 0xfb, 0x88, 0xfb, 0xec, 0xfc, 0x4b, 0xfd, 0x8f, 0xe5, 0x12, 0x14, 0x72, 0x24, 0xf6, 0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0xff, 0x52, 0x6c, 0xd4, 0xbd, 0xf2, 0xa4, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x2e, 0xfc, 0x8e, 0xfc, 0xce, 0xfc, 0x0f, 0xfd, 0x2f, 0xfd, 0x70, 0xfd, 0x90, 0xfd, 0xb0, 0xfd, 0xce, 0xd4, 0x8d, 0xcc, 0xf2, 0xfd, 0x31, 0xfe, 0x52, 0xfe, 0x93, 0xfe, 0xb3, 0xfe, 0x93, 0xfe, 0xb2, 0xfe, 0xd3, 0xfe, 0xd3, 0xfe, 0xf3, 0xfe, 0x14, 0xff, 0x54, 0xff, 0x75, 0xff, 0x75, 0xff, 0xd8, 0xff, 0x67, 0x10, 0x65, 0x08, 0x65, 0x08, 0x66, 0x08, 0x87, 0x08, 0x44, 0x08, 0xab, 0xfb, 0x67, 0x08, 0x09, 0xf4, 0x8b, 0xfc, 0x0b, 0xfd, 0xae, 0xfd, 0xe9, 0x00, 0x8b, 0x09, 0x6b, 0x01, 0x09, 0x01, 0xe8, 0x08, 0xa6, 0x08, 0xcd, 0x49, 0x7b, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xd2, 0x63, 0xac, 0x21, 0xab, 0x29, 0xa9, 0x09, 0xab, 0x01, 0x2d, 0x8b, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xfe, 0x98, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0xfe, 0xaf, 0xfc, 
-  0x51, 0x03, 0x71, 0x0b, 0xfc, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x9a, 0xa9, 0x08, 0xea, 0x00, 0x6c, 0x01, 0x6c, 0x09, 0x2a, 0x01, 0xc8, 0x08, 0xc9, 0x08, 0x4e, 0x02, 0x2e, 0x02, 0x2e, 0x02, 0x8f, 0x0a, 0xb0, 0x0a, 0x92, 0x03, 0x73, 0x03, 0x32, 0x1b, 0xeb, 0xfb, 0xed, 0xfb, 0x6b, 0xf3, 0x6a, 0xfa, 0x6d, 0xfb, 0x0e, 0xfc, 0x0c, 0xea, 0x2c, 0xfa, 0x4d, 0xfa, 0x0a, 0x61, 0x64, 0x08, 0xec, 0x09, 0x90, 0x33, 0x2f, 0x9c, 0x44, 0x08, 0x67, 0x08, 0x46, 0x08, 0x66, 0x08, 0x2c, 0xb9, 0x89, 0xfb, 0xa9, 0xfb, 0x29, 0xfb, 0xcb, 0xfb, 0xcb, 0xfc, 0x6c, 0xfd, 0xad, 0xfd, 0x72, 0xed, 0xca, 0x41, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xff, 0x35, 0xbe, 0xd5, 0x64, 0x15, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xae, 0xfc, 0xcf, 0xfc, 0xef, 0xfc, 0x50, 0xfd, 0x90, 0xfd, 0xb0, 0xfd, 0x70, 0xfd, 0xb0, 0xfd, 0xf1, 0xfd, 0x32, 0xfe, 0x32, 0xfe, 0x52, 0xfe, 0x72, 0xfe, 0x92, 0xfe, 0xb3, 0xfe, 0xd2, 0xfe, 0xf3, 0xfe, 0x13, 0xff, 0x13, 0xff, 0x34, 0xff, 0x54, 0xff, 0x75, 0xff, 0x76, 0xff, 0x74, 0xce, 0x67, 0x08, 0x46, 0x08, 0x66, 0x08, 0x87, 0x08, 0xc8, 0x08, 0xc8, 0x00, 0x09, 0x01, 0xa9, 0x60, 0x87, 0x08, 0xcb, 0xdb, 0x49, 0xfc, 0x29, 0xfc, 0x6c, 0xfd, 0xad, 0xfd, 0x0a, 0x3a, 0xab, 0x01, 0x29, 0x01, 0x29, 0x01, 0x0c, 0x2a, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0x7c, 0xab, 0x09, 0xcb, 0x01, 0xcb, 0x01, 0xdc, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0xfe, 0xaf, 0xfc, 
-  0x51, 0x03, 0x75, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xf6, 0xb1, 0xfc, 0x16, 0xfe, 0x28, 0x21, 0x8c, 0x09, 0x0a, 0x09, 0x09, 0x01, 0x6b, 0x01, 0x2e, 0x02, 0x2e, 0x02, 0xed, 0x01, 0x6e, 0x0a, 0xb3, 0x03, 0x52, 0x0b, 0x93, 0x03, 0x93, 0x03, 0xed, 0x7a, 0x0b, 0xfb, 0x0c, 0xfc, 0xcb, 0xfb, 0x2b, 0xea, 0xcb, 0xfa, 0x2c, 0xea, 0xec, 0xc0, 0x0d, 0xf2, 0x8c, 0x99, 0x31, 0x0b, 0x93, 0x0b, 0xb0, 0x02, 0xcf, 0xc4, 0x6e, 0xac, 0x26, 0x08, 0x88, 0x08, 0xcb, 0x70, 0x0a, 0x99, 0x2a, 0xfb, 0xaa, 0xfb, 0x0b, 0xea, 0x09, 0xfb, 0x2a, 0xfc, 0xeb, 0xf2, 0x4b, 0xfb, 0x65, 0x00, 0x08, 0x21, 0x53, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xc5, 0xd4, 0x74, 0x57, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xf5, 0xf5, 0xce, 0xfc, 0x10, 0xfd, 0x50, 0xfd, 0x71, 0xfd, 0xb1, 0xfd, 0xb1, 0xfd, 0xd1, 0xfd, 0x4f, 0xed, 0xf1, 0xfd, 0x31, 0xfe, 0x52, 0xfe, 0x52, 0xfe, 0xb3, 0xfe, 0xd3, 0xfe, 0xf3, 0xfe, 0x13, 0xff, 0x53, 0xff, 0x36, 0xff, 0x37, 0xff, 0x75, 0xff, 0x76, 0xff, 0xb6, 0xff, 0xb7, 0xff, 0x86, 0x08, 0xe7, 0x10, 0x89, 0x28, 0x89, 0x20, 0xca, 0x28, 0xca, 0x30, 0x4b, 0x39, 0x0a, 0x19, 0x8a, 0x10, 0x85, 0x08, 0x84, 0x08, 0x2a, 0xfc, 0x48, 0xfc, 0xaa, 0xfb, 0x2a, 0xfd, 0x6d, 0xfd, 0xcd, 0xbc, 0x4a, 0x09, 0x29, 0x09, 0xbc, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xd7, 0xfe, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x2a, 0x0c, 0x02, 0x71, 0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0x19, 0xff, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0xfe, 0xaf, 0xfc, 
-  0x51, 0x03, 0x1a, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0xb5, 0x8f, 0x5a, 0x0e, 0x5a, 0xf4, 0x93, 0x5e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x52, 0xe4, 0x33, 0xfd, 0xd4, 0xfd, 0x4a, 0x19, 0xe9, 0x08, 0x2a, 0x09, 0xed, 0x09, 0x8b, 0x01, 0xd1, 0x0a, 0x72, 0x33, 0xd3, 0x43, 0x55, 0x44, 0x11, 0x0b, 0x32, 0x03, 0x52, 0x03, 0xd1, 0x12, 0x09, 0xfa, 0x49, 0xf2, 0x6b, 0xfb, 0x2e, 0xfc, 0x90, 0xfc, 0x91, 0xfc, 0x4f, 0xeb, 0xaf, 0x72, 0x31, 0x0b, 0x31, 0x0b, 0xd1, 0x02, 0xaf, 0x02, 0x8f, 0x0a, 0xea, 0xf4, 0x6e, 0xfd, 0x89, 0x28, 0x89, 0x60, 0x8c, 0xc1, 0x2a, 0xfb, 0x4d, 0xda, 0x95, 0xf4, 0x94, 0xfd, 0xf0, 0xfb, 0xab, 0xfa, 0x47, 0x18, 0x66, 0x00, 0x65, 0x08, 0xa7, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xe6, 0x31, 0x34, 0xd9, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xfe, 0x0f, 0xfd, 0x0f, 0xfd, 0x4f, 0xfd, 0x90, 0xfd, 0x91, 0xfd, 0xd1, 0xfd, 0x55, 0xfe, 0x54, 0xfe, 0x12, 0xfe, 0x11, 0xfe, 0x10, 0xfe, 0x72, 0xfe, 0x72, 0xfe, 0xd3, 0xfe, 0xf3, 0xfe, 0x14, 0xff, 0x34, 0xff, 0x33, 0xff, 0xb2, 0xb5, 0xe8, 0x08, 0xca, 0x21, 0xb2, 0x6b, 0x94, 0x94, 0xd1, 0x73, 0xa9, 0x18, 0xa8, 0x20, 0xc8, 0x08, 0x25, 0x08, 0x67, 0x18, 0x45, 0x00, 0x45, 0x18, 0xc7, 0x08, 0xcd, 0x09, 0xec, 0x70, 0x47, 0x51, 0x69, 0x9a, 0xab, 0xfb, 0x0c, 0xfb, 0x2b, 0xfc, 0x6a, 0xfc, 0xaa, 0xfc, 0x8c, 0xfc, 0xf2, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x2d, 0xe3, 0xca, 0xfb, 0x4c, 0xfc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xad, 0x0d, 0x02, 0x74, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2c, 0x43, 0x94, 0xfe, 0xd2, 0xfd, 0x55, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0xfe, 0xaf, 0xfc, 
-  0x31, 0x03, 0x5e, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0x94, 0x87, 0x08, 0x88, 0x10, 0xaa, 0x28, 0x4c, 0x49, 0xee, 0x61, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0xfd, 0x73, 0xfd, 0x78, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xdf, 0xd9, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xef, 0x17, 0x6d, 0xf1, 0x02, 0xf0, 0x12, 0x6d, 0x72, 0xaa, 0xf2, 0xf1, 0xfc, 0x7a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xbe, 0xb3, 0x33, 0x10, 0x43, 0xb0, 0x02, 0xb5, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xec, 0xb8, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x9c, 0x65, 0x08, 0x46, 0x08, 0x66, 0x08, 0xa6, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0xe6, 0x98, 0xce, 0x5d, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0xee, 0x71, 0xfd, 0xeb, 0xc3, 0x90, 0xfd, 0xb2, 0xfd, 0xb9, 0xf6, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x17, 0xff, 0x92, 0xfe, 0xb3, 0xfe, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xce, 0x70, 0x53, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xd6, 0x8a, 0x21, 0x85, 0x00, 0x08, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x62, 0xb8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xfb, 0x6c, 0xf2, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xdd, 0xab, 0xfa, 0xac, 0xea, 0x6b, 0xfb, 0x57, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x0c, 0x0a, 0xf3, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xee, 0x90, 0xfc, 0xf1, 0xfd, 0xd1, 0xfd, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0xfe, 0xaf, 0xfc, 
-  0x51, 0x03, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xef, 0x0f, 0x23, 0x87, 0x10, 0x88, 0x18, 0xaa, 0x28, 0xcb, 0x38, 0xec, 0x40, 0xb7, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xed, 0x71, 0xfc, 0x78, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x56, 0x8d, 0xf1, 0x02, 0xb3, 0x0b, 0xb3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x5b, 0x0c, 0x02, 0x95, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x63, 0xa8, 0x08, 0x65, 0x08, 0x66, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0xf1, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xef, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1a, 0xff, 0x50, 0xfd, 0x6f, 0xfd, 0xd2, 0xfd, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xf3, 0xfe, 0x35, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xb5, 0x46, 0x08, 0x29, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xdb, 0x99, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0xfb, 0xec, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0x94, 0x6b, 0xfa, 0x6d, 0xf2, 0x2c, 0xfb, 0x51, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x2b, 0x6d, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x39, 0xfe, 0xd3, 0xfc, 0x91, 0xfc, 0xd4, 0xfd, 0xf4, 0xfd, 0xd4, 0xfd, 0x31, 0xfd, 0xaf, 0xfc, 
-  0x51, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xcf, 0x2a, 0x11, 0x87, 0x10, 0x88, 0x18, 0x89, 0x20, 0xaa, 0x30, 0xca, 0x30, 0x11, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0xd5, 0x31, 0xcb, 0xd7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0xa5, 0x31, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfd, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xcc, 0x19, 0xd2, 0x5b, 0x3d, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xad, 0x67, 0x08, 0x66, 0x10, 0x86, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xfe, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe5, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0x31, 0xed, 0xb1, 0xfd, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xff, 0x55, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x10, 0x6a, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0xfb, 0x58, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xa2, 0xb2, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x63, 0x2e, 0x9a, 0xec, 0xea, 0x0c, 0xe2, 0x90, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x93, 0xed, 0xc9, 0x78, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x97, 0xfd, 0x6f, 0xfb, 0x70, 0xfc, 0xcf, 0xfc, 0xaf, 0xfc, 
-  0x52, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xef, 0xf2, 0x1b, 0x68, 0x10, 0x27, 0x08, 0xca, 0x40, 0x2a, 0x51, 0x67, 0x20, 0x34, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfd, 0x70, 0xbb, 0x30, 0xd3, 0xf8, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1a, 0xae, 0x6f, 0x1a, 0xb9, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xff, 0xfa, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xe7, 0x8b, 0x19, 0x6b, 0x09, 0x54, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x7c, 0x4a, 0x01, 0xb5, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xfd, 0xae, 0x99, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xce, 0x46, 0x10, 0x46, 0x10, 0x66, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xac, 0x55, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xd4, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfe, 0xf0, 0xec, 0x13, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0xe6, 0x72, 0xfe, 0x94, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xd7, 0xde, 0x73, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x95, 0xab, 0x19, 0xb8, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0x41, 0x4a, 0x11, 0x4f, 0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0xf3, 0x4e, 0xc9, 0xaf, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x12, 0x71, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xfd, 0xae, 0xfb, 0xca, 0xf2, 0x2c, 0xfa, 0x2f, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0xfd, 0x6e, 0xfb, 0xad, 0xfb, 0xd9, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0xf1, 0xfb, 0xee, 0xfb, 0xaf, 0xfc, 
-  0x52, 0x03, 0x7e, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0x84, 0x88, 0x18, 0xcc, 0x48, 0x2e, 0x69, 0xce, 0xa1, 0x53, 0xeb, 0x3d, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x56, 0xfd, 0x74, 0xfd, 0x6d, 0x89, 0x58, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x5b, 0x4d, 0x51, 0xaf, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x7b, 0xff, 0x15, 0xed, 0x56, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x37, 0xa5, 0x09, 0x09, 0xd5, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xff, 0x0b, 0xfc, 0xed, 0xfd, 0x97, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0x45, 0x10, 0x65, 0x08, 0x87, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0x84, 0x11, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x0e, 0xcc, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1a, 0xff, 0x71, 0xfd, 0xd6, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xff, 0x59, 0xff, 0xb8, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x09, 0xcf, 0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x21, 0x09, 0x01, 0xb1, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x7a, 0xea, 0x68, 0x2d, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xd2, 0x0c, 0xc9, 0x10, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x4b, 0x10, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x5c, 0xac, 0xb2, 0xad, 0xfa, 0x2c, 0xea, 0x90, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xfc, 0x4d, 0xfb, 0x0d, 0xfb, 0x0d, 0xfb, 0x90, 0xfb, 0xb9, 0xed, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x70, 0xfb, 0x6e, 0xfb, 
-  0x72, 0x03, 0x7b, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x35, 0x94, 0x4d, 0x49, 0xec, 0x50, 0x91, 0x9a, 0xdd, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x12, 0xec, 0x70, 0xeb, 0x52, 0xfd, 0xf7, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x92, 0xab, 0x70, 0xcc, 0x68, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x37, 0x9d, 0x09, 0x01, 0xd5, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfe, 0xcb, 0xfb, 0x0a, 0xfc, 0xb9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xe7, 0x46, 0x10, 0x45, 0x10, 0xa7, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xc4, 0x4b, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xfe, 0x52, 0xfc, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfe, 0x8a, 0x82, 0x17, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0x4d, 0x83, 0x0f, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0x19, 0x29, 0x01, 0x92, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x69, 0xa8, 0x08, 0x51, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xeb, 0x0c, 0xb1, 0xb3, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x8a, 0xea, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0x85, 0x30, 0x02, 0x4b, 0xea, 0x0e, 0xd2, 0x33, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xfb, 0xd4, 0xfc, 0x77, 0xfd, 0x77, 0xfd, 0x77, 0xfd, 0x92, 0xeb, 0x8e, 0xb9, 0x93, 0xdb, 0xfa, 0xed, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xfd, 0xee, 0xfa, 
-  0x71, 0x03, 0xd6, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xef, 0x4c, 0x41, 0xaa, 0x40, 0x76, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xff, 0x71, 0xdb, 0xf0, 0xda, 0x10, 0xfc, 0x39, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x69, 0xab, 0x50, 0xcc, 0x58, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xf6, 0x5b, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x39, 0xff, 0xb6, 0xfe, 0xf8, 0xf6, 0x73, 0x8c, 0x73, 0x84, 0x53, 0x84, 0xcf, 0x42, 0x2a, 0x09, 0xf6, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xfe, 0x69, 0xfb, 0xaa, 0xfb, 0xb9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xe7, 0x46, 0x18, 0x65, 0x08, 0xa7, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xfd, 0xca, 0xfb, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xd4, 0x0e, 0xab, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xd6, 0x35, 0xfd, 0x56, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x9b, 0xff, 0x5a, 0xf7, 0x78, 0xd6, 0x16, 0x8d, 0x37, 0x8d, 0xb5, 0x84, 0x4e, 0x0a, 0x11, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x19, 0x4d, 0x19, 0x94, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2d, 0x3a, 0x4b, 0x19, 0x4e, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0xec, 0x2b, 0xf3, 0xd4, 0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2e, 0x12, 0x4a, 0x21, 0x5b, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xd6, 0x8f, 0x0a, 0xcb, 0x01, 0xaa, 0x21, 0xf9, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0xae, 0xfa, 0x9b, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xfe, 0x4d, 0xb1, 0x2c, 0xb9, 0x0c, 0xb1, 0xef, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xfe, 0xee, 0xfa, 
-  0x72, 0x03, 0xb3, 0x13, 0x3d, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0xa5, 0x89, 0x20, 0xaa, 0x30, 0xee, 0x61, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0xe4, 0x51, 0xfc, 0x4e, 0xaa, 0x50, 0xdb, 0x57, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0x93, 0x8b, 0x58, 0x70, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x56, 0xbc, 0x97, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xd4, 0xfe, 0x31, 0xfe, 0x2d, 0xfd, 0x2b, 0x7b, 0xd5, 0x94, 0xab, 0x21, 0x09, 0x01, 0x8b, 0x01, 0x16, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xc6, 0x29, 0xfb, 0x2b, 0xea, 0x18, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x66, 0x18, 0x45, 0x18, 0x87, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0xfd, 0xa9, 0xfb, 0xf5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xf4, 0x51, 0x74, 0x5e, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xde, 0xed, 0xd9, 0x0f, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0xbc, 0x8d, 0xfc, 0xf1, 0xf4, 0xaa, 0x31, 0x34, 0x64, 0xb1, 0x5b, 0x6f, 0x0a, 0x2c, 0x52, 0x90, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x11, 0x2b, 0x09, 0xad, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0x3b, 0x4f, 0x0a, 0x8c, 0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xde, 0x6c, 0x6a, 0x98, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x09, 0x8b, 0x01, 0xf2, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x37, 0x85, 0x8f, 0x12, 0xf3, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0xfd, 0x6e, 0xea, 0x7b, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xee, 0x35, 0xcc, 0xf4, 0xc3, 0xda, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xfe, 0xee, 0xfa, 
-  0x72, 0x03, 0x72, 0x03, 0x37, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x62, 0x6f, 0x81, 0x2c, 0x71, 0xcd, 0x79, 0xd9, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf6, 0x11, 0xdb, 0x71, 0xfb, 0x94, 0xf4, 0x6d, 0x79, 0x35, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x17, 0xbd, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x4c, 0x59, 0xad, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xff, 0x9d, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xbc, 0xd6, 0xe8, 0x10, 0x74, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xeb, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xab, 0x31, 0x3a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0x97, 0xfd, 0x2e, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xff, 0x6c, 0xfd, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x1d, 0xf7, 0xed, 0xd1, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1b, 0xff, 0xba, 0xe6, 0xdc, 0xee, 0xff, 0xff, 0xdf, 0xff, 0x6e, 0xfc, 0x2f, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xad, 0x51, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x31, 0x43, 0x45, 0x00, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x22, 0xed, 0x01, 0x9b, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x90, 0xaa, 0x4e, 0xe2, 0x7b, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xec, 0xee, 0xfa, 
-  0x72, 0x03, 0x92, 0x03, 0xb2, 0x03, 0x3a, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xe7, 0xeb, 0x30, 0x0d, 0x61, 0x4e, 0x81, 0x50, 0xc2, 0xd6, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x6f, 0x9a, 0xaf, 0xa9, 0xd0, 0xc2, 0x8d, 0x79, 0x8b, 0x50, 0x35, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x37, 0xdd, 0xac, 0x58, 0x8a, 0x40, 0x15, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6b, 0xd6, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x54, 0xf9, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xd7, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3a, 0xee, 0x4a, 0xf2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xfe, 0x8e, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xff, 0x51, 0xdb, 0xb5, 0xfc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xce, 0x8c, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xad, 0xf0, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x43, 0x45, 0x08, 0xd6, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x22, 0x8b, 0x01, 0x0c, 0x22, 0x1d, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xef, 0x12, 0x6b, 0x50, 0x12, 0xce, 0x29, 0x7b, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xe6, 0xae, 0x99, 0x6e, 0xc9, 
-  0x72, 0x03, 0x92, 0x03, 0x92, 0x03, 0xd3, 0x0b, 0xbc, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0x8c, 0xcb, 0x30, 0xcb, 0x38, 0x0d, 0x51, 0x4e, 0x79, 0xd2, 0xba, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xb5, 0xf4, 0x91, 0xfc, 0x2b, 0x79, 0xec, 0x68, 0x8a, 0x40, 0x6a, 0x40, 0x35, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xf6, 0xf4, 0xd2, 0x90, 0xf2, 0x0f, 0xd2, 0xac, 0x50, 0x48, 0x38, 0x72, 0x8b, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x94, 0xfd, 0xed, 0xfc, 0xb6, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x5c, 0x3a, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xef, 0xb6, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xee, 0xac, 0xd9, 0xb8, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xfd, 0x4d, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0x6e, 0x3a, 0x8b, 0x9a, 0xce, 0xe3, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x9a, 0xe6, 0xcc, 0x12, 0xb2, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xae, 0xf3, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0x43, 0x4a, 0x09, 0x6f, 0x0a, 0x1d, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xef, 0xb6, 0x5c, 0xd4, 0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x22, 0x4a, 0x01, 0x4a, 0x01, 0x4b, 0x11, 0x74, 0x7c, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xad, 0xcf, 0x1a, 0x2e, 0x0a, 0x0e, 0x22, 0x0f, 0x0a, 0x5a, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0xaa, 0x94, 0xcb, 0xdd, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x35, 0xac, 0x6d, 0x59, 0x4b, 0x51, 0x6e, 0xa1, 
-  0x72, 0x03, 0x92, 0x03, 0xb2, 0x03, 0x92, 0x03, 0xf3, 0x13, 0x3a, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x8d, 0x49, 0x89, 0x20, 0xab, 0x28, 0xcc, 0x40, 0x2d, 0x59, 0x90, 0x91, 0xda, 0xed, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xf7, 0x33, 0xc3, 0xd1, 0xca, 0x30, 0xfc, 0x45, 0x28, 0x69, 0x38, 0x68, 0x18, 0x49, 0x30, 0x34, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0xfa, 0xd4, 0xfc, 0x35, 0xfd, 0x93, 0xfc, 0x6d, 0xb1, 0xee, 0xb0, 0x6e, 0xa8, 0xf0, 0xf9, 0x11, 0xf2, 0x28, 0x30, 0x8a, 0x38, 0x6e, 0xf4, 0xf6, 0xfe, 0x9a, 0xff, 0x18, 0xff, 0xb2, 0xfd, 0xf1, 0xfd, 0x0c, 0xfc, 0x0e, 0xfd, 0x0b, 0xfc, 0x8f, 0xfd, 0x2f, 0x02, 0xcc, 0x01, 0x2d, 0x02, 0x0d, 0x02, 0x2e, 0x02, 0xcc, 0x01, 0xf0, 0x02, 0xd0, 0x0a, 0x11, 0x0b, 0xad, 0x49, 0x4e, 0x0a, 0x2e, 0x0a, 0xed, 0x09, 0xf0, 0x0a, 0x34, 0x04, 0xca, 0x38, 0xeb, 0xa0, 0x88, 0x48, 0xca, 0x78, 0xea, 0x80, 0xeb, 0x98, 0x0b, 0xb1, 0x4a, 0xb9, 0x6c, 0xf2, 0x6b, 0xf2, 0x8b, 0xfc, 0x8b, 0xfc, 0xac, 0xfd, 0x0b, 0xfd, 0x2a, 0xc4, 0xca, 0xfc, 0xab, 0xfc, 0x4e, 0xf5, 0x2d, 0xe5, 0xf1, 0x12, 0x6f, 0x2b, 0x30, 0x3b, 0x0c, 0x0a, 0xea, 0x61, 0xf2, 0x42, 0x97, 0xb5, 0x95, 0xf5, 0xf2, 0x7b, 0xcc, 0xf3, 0xc7, 0xe2, 0x2b, 0x02, 0x50, 0x0b, 0x74, 0x1c, 0x92, 0x13, 0x72, 0x03, 0x31, 0x03, 0xb3, 0x03, 0xb3, 0x03, 0x92, 0x03, 0xf0, 0x0a, 0x4a, 0x09, 0xac, 0x01, 0x4b, 0x09, 0x2e, 0xc3, 0xcd, 0x09, 0x90, 0x42, 0xb0, 0x0a, 0x8f, 0x02, 0x70, 0x02, 0x93, 0x03, 0x14, 0x1c, 0x75, 0x44, 0xb1, 0x63, 0xd1, 0xfb, 0xf0, 0x1a, 0xf0, 0x02, 0xb0, 0x02, 0xb0, 0x02, 0xb0, 0x0a, 0xcc, 0x01, 0x6b, 0x01, 0xac, 0x09, 0x4a, 0x01, 0x2b, 0x29, 0x0e, 0xa1, 0x2e, 0x91, 0x93, 0xfb, 0x35, 0xfc, 0x58, 0xfd, 0x75, 0x64, 0x31, 0x3b, 0x8f, 0x12, 0x2e, 0x02, 0x0d, 0x0a, 0x0d, 0x02, 0xcc, 0x01, 0xcd, 0x09, 0x8e, 0x51, 0x0d, 0x91, 0x4f, 0x91, 0x6e, 0x89, 0x2e, 0x89, 0x2d, 0x69, 0x2c, 0x69, 0xaf, 0x91, 0x91, 0x9a, 0x33, 0xb3, 0x33, 0xa3, 0xce, 0x71, 0x6d, 0x59, 0x4d, 0x49, 0x4c, 0x39, 0x6e, 0x99, 
-  0x72, 0x03, 0x92, 0x03, 0xb2, 0x03, 0xb2, 0x03, 0xb3, 0x03, 0xb3, 0x03, 0xb5, 0x3c, 0x1d, 0xcf, 0x98, 0xad, 0x88, 0x10, 0x89, 0x10, 0x89, 0x18, 0xaa, 0x28, 0x89, 0x18, 0xca, 0x18, 0x4f, 0x72, 0x5e, 0xff, 0x38, 0xdd, 0x92, 0xfb, 0xed, 0x99, 0xa9, 0x38, 0x8a, 0x20, 0x89, 0x28, 0x88, 0x20, 0x68, 0x20, 0x0e, 0x5a, 0x3a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xb4, 0x4d, 0x89, 0x31, 0xfb, 0x51, 0xfb, 0x71, 0xfb, 0xf1, 0xfb, 0xae, 0xd1, 0x8d, 0x98, 0xed, 0xd0, 0x4f, 0xd9, 0xa8, 0x30, 0x70, 0xfd, 0xf0, 0xfd, 0x10, 0xfe, 0xb2, 0xfe, 0x71, 0xfe, 0x8b, 0xec, 0x6d, 0xfc, 0x0c, 0xfc, 0x6b, 0xfb, 0xcd, 0xfb, 0xaf, 0xed, 0x0f, 0x0a, 0x0e, 0x02, 0x8d, 0x0a, 0xac, 0x01, 0x0c, 0x02, 0xef, 0x02, 0x31, 0x03, 0xb0, 0x0a, 0x0e, 0x5a, 0x2f, 0xa2, 0xae, 0x61, 0xed, 0x01, 0xab, 0x09, 0xd3, 0x0b, 0xaa, 0x50, 0xcc, 0xa0, 0x0d, 0xb9, 0xaa, 0x78, 0xcb, 0x80, 0x0a, 0x81, 0xe9, 0x80, 0xea, 0x98, 0xec, 0xc9, 0x0c, 0xe2, 0xad, 0xfa, 0xac, 0xfc, 0x0b, 0xfd, 0x29, 0xe4, 0xaa, 0xf4, 0xe8, 0xeb, 0xaa, 0xf3, 0x2a, 0xfc, 0xef, 0xec, 0x10, 0x2b, 0xb4, 0x75, 0x70, 0x53, 0x50, 0x84, 0xf1, 0xbc, 0xed, 0x62, 0x29, 0x83, 0x8b, 0xc2, 0x8b, 0xe3, 0xaf, 0x2a, 0x4b, 0xd3, 0x8d, 0x83, 0x48, 0xdb, 0x72, 0x0b, 0x10, 0x03, 0xd4, 0x0b, 0xf3, 0x03, 0x92, 0x03, 0x72, 0x0b, 0xf0, 0x02, 0xec, 0x01, 0x08, 0x09, 0x4a, 0x11, 0x0a, 0x01, 0x8c, 0x21, 0x32, 0x0b, 0xd2, 0x02, 0xd0, 0x0a, 0xd3, 0x6b, 0xf1, 0x0a, 0xb3, 0x0b, 0x31, 0x03, 0x52, 0x03, 0xcc, 0x61, 0x52, 0xe3, 0x31, 0xf3, 0x0f, 0x73, 0x4e, 0x0a, 0xf1, 0x02, 0xf1, 0x02, 0x0d, 0x02, 0xcc, 0x01, 0x29, 0x01, 0x50, 0xa1, 0xce, 0xa8, 0xae, 0xa0, 0xf0, 0xe1, 0x51, 0xea, 0x0f, 0xda, 0xef, 0xe1, 0x0f, 0xe2, 0xcc, 0x11, 0x2e, 0x0a, 0x2e, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0d, 0x02, 0x0e, 0x02, 0x4e, 0x81, 0x2e, 0x91, 0xd0, 0x99, 0x6e, 0x79, 0x4d, 0x71, 0x2d, 0x61, 0x2d, 0x59, 0xec, 0x50, 0x4e, 0x69, 0x6d, 0x61, 0xae, 0x69, 0xae, 0x59, 0x8d, 0x51, 0x6d, 0x41, 0x6c, 0x39, 0x8e, 0x71, 
-  0x92, 0x03, 0x92, 0x03, 0xb2, 0x03, 0xb2, 0x03, 0xb3, 0x03, 0xb3, 0x03, 0xb3, 0x03, 0xd3, 0x0b, 0x13, 0x1c, 0xb3, 0x0b, 0x68, 0x10, 0xa9, 0x08, 0x88, 0x08, 0xa9, 0x08, 0xaa, 0x28, 0xed, 0x78, 0xcf, 0x91, 0x8f, 0xa1, 0x71, 0xba, 0x6a, 0x20, 0x68, 0x10, 0x67, 0x08, 0x87, 0x08, 0x67, 0x08, 0x88, 0x10, 0xb2, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x91, 0x11, 0xfa, 0x70, 0xfa, 0x50, 0xfa, 0x6e, 0xf2, 0x90, 0xfa, 0x90, 0xf4, 0x8a, 0x78, 0xed, 0x58, 0x0e, 0x59, 0xed, 0xe1, 0x0f, 0xfd, 0xcf, 0xfd, 0xaf, 0xfd, 0xd2, 0xfe, 0x33, 0xff, 0x92, 0xfe, 0x6b, 0xfb, 0x2d, 0xfc, 0xec, 0xfb, 0xcd, 0xfb, 0xce, 0xfd, 0x2f, 0x84, 0x4d, 0x12, 0xcd, 0x01, 0x0d, 0x02, 0x4e, 0x02, 0x10, 0x03, 0x2e, 0x02, 0x4e, 0x02, 0xf0, 0xc1, 0x10, 0xa2, 0xce, 0x51, 0x8b, 0x01, 0xcb, 0x09, 0x88, 0x38, 0xeb, 0x80, 0x2c, 0xa9, 0xea, 0x80, 0xca, 0x60, 0xc9, 0x78, 0xca, 0x88, 0xaa, 0x68, 0x8c, 0xa1, 0xcb, 0xd1, 0x8d, 0x3a, 0xd2, 0x3b, 0x4b, 0xfc, 0x2c, 0xfd, 0xc8, 0xbb, 0x69, 0xfc, 0x2b, 0xfd, 0x8a, 0xfc, 0x4c, 0xfd, 0x8d, 0xf5, 0x2d, 0x22, 0x0b, 0x83, 0x6a, 0xcb, 0xcb, 0x11, 0x67, 0xba, 0x8b, 0x8a, 0x92, 0x33, 0x10, 0x4c, 0xab, 0xab, 0x10, 0x74, 0xc8, 0x00, 0x6f, 0x0a, 0x52, 0x0b, 0xb3, 0x03, 0x14, 0x0c, 0x14, 0x04, 0xd3, 0x03, 0xf0, 0x02, 0xaf, 0x02, 0xcc, 0x09, 0x07, 0x09, 0xd3, 0x13, 0x15, 0x04, 0xb3, 0x03, 0x73, 0x03, 0xb3, 0x0b, 0x6f, 0x02, 0xb0, 0x0a, 0x11, 0x03, 0x32, 0x03, 0x53, 0x03, 0xcf, 0x11, 0x12, 0xeb, 0xf1, 0xea, 0x51, 0xfb, 0xf2, 0xda, 0x71, 0xcb, 0xf2, 0x02, 0xb0, 0x02, 0x2d, 0x02, 0xad, 0x21, 0xae, 0x98, 0xae, 0xa0, 0xef, 0x98, 0xce, 0x98, 0xcf, 0xc9, 0x8f, 0xc1, 0x8f, 0xc9, 0xb0, 0xc9, 0x2e, 0x99, 0x0f, 0x99, 0x90, 0x71, 0xcd, 0x11, 0x0e, 0x02, 0x2e, 0x02, 0x0e, 0x02, 0xae, 0x31, 0x90, 0xa1, 0x6f, 0x99, 0x8f, 0x81, 0x6f, 0x79, 0x6e, 0x71, 0x4d, 0x59, 0x2c, 0x49, 0x2c, 0x41, 0x2b, 0x31, 0x2a, 0x11, 0x6c, 0x39, 0x8d, 0x49, 0x8d, 0x49, 0x8d, 0x39, 0x8c, 0x31, 0x4b, 0x31, 
-  0x92, 0x03, 0x92, 0x03, 0xb2, 0x03, 0xb2, 0x03, 0xb3, 0x03, 0xb3, 0x03, 0xb3, 0x03, 0xb3, 0x03, 0xd2, 0x03, 0xf3, 0x03, 0xa8, 0x00, 0x87, 0x08, 0x89, 0x10, 0x89, 0x20, 0x69, 0x30, 0x69, 0x30, 0x6a, 0x30, 0x69, 0x20, 0x89, 0x10, 0x88, 0x08, 0x66, 0x08, 0x67, 0x08, 0x67, 0x08, 0x67, 0x08, 0xa8, 0x08, 0x92, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0xa9, 0xaf, 0x90, 0x91, 0xfa, 0x50, 0xfa, 0x30, 0xfa, 0x30, 0xfa, 0x2f, 0xf2, 0xee, 0xf3, 0xce, 0x89, 0x2b, 0x59, 0x2e, 0x71, 0x4f, 0xe2, 0x2e, 0xfd, 0x4e, 0xfd, 0xaf, 0xfd, 0x71, 0xfe, 0xb2, 0xfe, 0x34, 0xff, 0xed, 0xfb, 0x6d, 0xfc, 0xeb, 0xfa, 0xac, 0xfb, 0x6a, 0xf3, 0xef, 0xb4, 0xac, 0x01, 0x4e, 0x02, 0x8f, 0x02, 0x10, 0x03, 0xec, 0x01, 0x0d, 0x02, 0xef, 0x69, 0x50, 0xaa, 0x6d, 0x61, 0xcd, 0x39, 0xc7, 0x08, 0xc9, 0x40, 0x67, 0x40, 0xea, 0x70, 0xca, 0x78, 0xcc, 0x78, 0x33, 0x0c, 0x73, 0x14, 0xa9, 0x58, 0x2c, 0xa9, 0xb0, 0xb9, 0x0c, 0x02, 0x10, 0x13, 0xb0, 0x32, 0x6c, 0xfc, 0x69, 0xfb, 0xac, 0xf4, 0xaa, 0xca, 0x2d, 0x9b, 0x0e, 0xb4, 0x4d, 0xf5, 0x6d, 0xbc, 0xca, 0x41, 0xaf, 0xc5, 0x4a, 0x11, 0x72, 0xc5, 0x6a, 0x83, 0x2b, 0xec, 0xaf, 0x33, 0x8d, 0xc4, 0x11, 0x34, 0x33, 0x3c, 0xb5, 0x0c, 0x76, 0x0c, 0x55, 0x0c, 0x54, 0x0c, 0x54, 0x0c, 0xd3, 0x03, 0x11, 0x0b, 0xac, 0x01, 0xcc, 0x01, 0xd0, 0x12, 0xb2, 0x13, 0xf2, 0x03, 0xb4, 0x0b, 0xb4, 0x0b, 0xd0, 0x02, 0xb0, 0x02, 0xd0, 0x02, 0x11, 0x03, 0x32, 0x03, 0xce, 0x19, 0x0c, 0x41, 0xf1, 0xda, 0x32, 0xeb, 0x33, 0xf3, 0x52, 0xfb, 0x93, 0xfb, 0x32, 0xdb, 0x75, 0xc3, 0xcd, 0x11, 0xcf, 0xa8, 0xad, 0x78, 0x8d, 0x88, 0x0f, 0xa1, 0xef, 0xa0, 0x2f, 0xb1, 0x2f, 0xb1, 0x2f, 0xa9, 0x0e, 0x91, 0x2f, 0x89, 0x2f, 0x89, 0x2e, 0x81, 0x2d, 0x69, 0x4d, 0x51, 0x2e, 0x59, 0x2e, 0x71, 0x8f, 0x81, 0x8f, 0x99, 0x8e, 0x89, 0x8e, 0x71, 0x6e, 0x69, 0x6d, 0x59, 0x6e, 0x61, 0x4d, 0x49, 0x2c, 0x39, 0x4c, 0x31, 0x4a, 0x01, 0x6d, 0x31, 0x8c, 0x29, 0x6c, 0x39, 0x8d, 0x41, 0x8d, 0x39, 0x8c, 0x39, 
-  0x92, 0x03, 0xb2, 0x03, 0xb2, 0x03, 0xb2, 0x03, 0xb3, 0x03, 0x92, 0x03, 0x93, 0x0b, 0xb3, 0x0b, 0xd3, 0x03, 0x8d, 0x11, 0x89, 0x08, 0x89, 0x08, 0x89, 0x10, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x88, 0x00, 0x88, 0x00, 0x2a, 0x01, 0x87, 0x08, 0x66, 0x08, 0x87, 0x08, 0x67, 0x08, 0x87, 0x08, 0x88, 0x00, 0x0c, 0x3a, 0x54, 0x84, 0x53, 0x84, 0x53, 0x84, 0x54, 0x8c, 0x55, 0xa4, 0x74, 0x8c, 0x2d, 0x51, 0xcf, 0xb8, 0x30, 0xe1, 0xf0, 0xf1, 0x90, 0xfa, 0x70, 0xf2, 0x91, 0xfa, 0x0e, 0xea, 0x30, 0xfc, 0x51, 0xcb, 0x2e, 0x81, 0x0f, 0x51, 0xd5, 0x33, 0x0f, 0xfd, 0xcd, 0xfc, 0x4d, 0xfd, 0x51, 0xfe, 0x51, 0xfe, 0x2d, 0xfc, 0x4c, 0xfc, 0xee, 0xfc, 0x0c, 0xfb, 0x2b, 0xfc, 0x0e, 0xfd, 0x0c, 0x1a, 0x6e, 0x02, 0x8f, 0x02, 0xf0, 0x02, 0xed, 0x09, 0xac, 0x09, 0xec, 0x09, 0x51, 0xa2, 0xae, 0x69, 0xad, 0x59, 0x8c, 0x51, 0x29, 0x29, 0x6b, 0x51, 0xca, 0x60, 0xca, 0x70, 0xb0, 0x0a, 0x52, 0x03, 0xb3, 0x0b, 0xca, 0x40, 0x0b, 0x59, 0x86, 0x18, 0x6a, 0x09, 0xef, 0x42, 0x2d, 0x4b, 0x49, 0xe3, 0xc7, 0xf2, 0xcb, 0xfc, 0x87, 0xfb, 0x08, 0xeb, 0x6a, 0xeb, 0x09, 0xfd, 0x68, 0xf4, 0x67, 0xeb, 0x09, 0xeb, 0x27, 0xeb, 0xe8, 0xfb, 0x68, 0xfb, 0x09, 0xfc, 0x08, 0xf4, 0xce, 0x8b, 0xb1, 0x1b, 0xb3, 0x0b, 0x95, 0x0c, 0x77, 0x1d, 0x37, 0x15, 0x16, 0x05, 0x77, 0x15, 0xd5, 0x1c, 0x6a, 0x09, 0x8b, 0x11, 0x0d, 0x02, 0x4a, 0x09, 0x59, 0xfe, 0x12, 0x44, 0xd1, 0x0a, 0xd0, 0x02, 0xd0, 0x02, 0xf1, 0x02, 0x11, 0x03, 0xf1, 0x02, 0xeb, 0x38, 0x0c, 0x49, 0x0c, 0x39, 0xd1, 0xca, 0xf1, 0xda, 0xf1, 0xd2, 0x72, 0xb2, 0x73, 0xfb, 0x52, 0xfb, 0xd2, 0xd2, 0x0f, 0xa1, 0xae, 0x90, 0x50, 0xa1, 0x0f, 0x99, 0xcf, 0x90, 0xee, 0x88, 0xce, 0x78, 0xef, 0x90, 0xef, 0x88, 0xee, 0x90, 0x0f, 0x99, 0x6f, 0x79, 0x4d, 0x41, 0x6c, 0x41, 0x2c, 0x39, 0x2c, 0x31, 0x2c, 0x31, 0x2c, 0x31, 0x6d, 0x49, 0x2d, 0x49, 0x8e, 0x59, 0x6d, 0x49, 0x6d, 0x41, 0x4c, 0x31, 0x6c, 0x29, 0x4c, 0x29, 0x4c, 0x29, 0x4a, 0x09, 0x6d, 0x29, 0x6c, 0x29, 0x4b, 0x21, 0x6d, 0x31, 0x8d, 0x41, 0x6d, 0x49, 
-  0x72, 0x03, 0x93, 0x03, 0xb2, 0x03, 0xb2, 0x03, 0xb3, 0x03, 0xb3, 0x03, 0xd3, 0x03, 0x6f, 0x0a, 0x89, 0x08, 0x88, 0x10, 0x89, 0x10, 0xa9, 0x10, 0x88, 0x10, 0x88, 0x00, 0xa8, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x2b, 0x01, 0x88, 0x08, 0x67, 0x08, 0x87, 0x00, 0x88, 0x08, 0x88, 0x00, 0x87, 0x00, 0x87, 0x08, 0x87, 0x00, 0x87, 0x08, 0x87, 0x08, 0x88, 0x10, 0x89, 0x20, 0x88, 0x20, 0x68, 0x18, 0x6d, 0x68, 0x6c, 0x80, 0xf2, 0xf1, 0xf0, 0xa8, 0x30, 0xda, 0xef, 0xf1, 0x10, 0xf2, 0x70, 0xfa, 0x90, 0xfb, 0xd0, 0xfb, 0x0a, 0x61, 0x50, 0x32, 0x51, 0x2a, 0x12, 0xed, 0x0b, 0xfc, 0x4e, 0xfd, 0x10, 0xfe, 0xaf, 0xfd, 0xb3, 0xfe, 0x2b, 0xfc, 0xee, 0xfc, 0x4c, 0xf3, 0x6c, 0xeb, 0xce, 0xfd, 0x0e, 0x0a, 0xae, 0x02, 0xaf, 0x02, 0xcc, 0x01, 0xac, 0x01, 0xcc, 0x01, 0x0f, 0x7a, 0xef, 0x71, 0xae, 0x71, 0x0f, 0x7a, 0x8c, 0x49, 0x4b, 0x49, 0xad, 0x69, 0x6d, 0x71, 0xaf, 0x0a, 0xaf, 0x0a, 0x72, 0x0b, 0x8b, 0x19, 0xea, 0x28, 0x84, 0x00, 0x44, 0x00, 0x07, 0x09, 0x4f, 0x2b, 0x90, 0x33, 0xa7, 0xfa, 0x2a, 0xdb, 0x07, 0xfc, 0xcf, 0xdc, 0xc8, 0xf3, 0x68, 0xf3, 0x88, 0xec, 0xe5, 0xc9, 0x09, 0x32, 0x2e, 0x1b, 0xeb, 0xd2, 0x6e, 0x0a, 0xcf, 0x0a, 0x18, 0x4d, 0xab, 0x5a, 0x11, 0x03, 0x37, 0x15, 0xd5, 0x0c, 0x77, 0x1d, 0x36, 0x0d, 0x37, 0x0d, 0x16, 0x0d, 0xb8, 0x0d, 0x13, 0x1c, 0xac, 0x09, 0xcc, 0x09, 0x0b, 0x42, 0x3a, 0xcd, 0x59, 0xfe, 0x5a, 0xfe, 0x19, 0xb5, 0xb0, 0x02, 0x32, 0x03, 0xf1, 0x0a, 0x0b, 0x29, 0x2d, 0x51, 0x2c, 0x29, 0x4e, 0x51, 0x91, 0xba, 0xb1, 0xca, 0xb1, 0xba, 0x11, 0x9a, 0xd2, 0xc2, 0x11, 0xfb, 0xae, 0x90, 0xef, 0x90, 0x0f, 0x99, 0xee, 0x88, 0xee, 0x80, 0xed, 0x78, 0xcd, 0x70, 0xee, 0x78, 0xed, 0x60, 0x8c, 0x60, 0x6e, 0x59, 0x0b, 0x39, 0x2c, 0x39, 0x2b, 0x31, 0x4d, 0x39, 0x2c, 0x31, 0x2b, 0x11, 0x2b, 0x09, 0x4b, 0x01, 0x2a, 0x01, 0x4c, 0x21, 0x4d, 0x39, 0x4d, 0x31, 0x4d, 0x39, 0x4c, 0x39, 0x6c, 0x29, 0x2a, 0x09, 0x2a, 0x01, 0x6b, 0x09, 0x6d, 0x21, 0x6c, 0x29, 0x6c, 0x21, 0x6c, 0x21, 0x8d, 0x39, 0x6e, 0x51, 
-  0x72, 0x13, 0x52, 0x03, 0xb3, 0x03, 0xb2, 0x03, 0xd3, 0x03, 0xf2, 0x03, 0xaa, 0x08, 0x88, 0x08, 0x88, 0x08, 0x89, 0x08, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0x87, 0x08, 0x87, 0x08, 0x87, 0x00, 0xa8, 0x00, 0x0b, 0x09, 0x88, 0x00, 0x0a, 0x09, 0x67, 0x00, 0x87, 0x00, 0xa8, 0x00, 0x66, 0x00, 0x87, 0x08, 0x67, 0x08, 0xa7, 0x00, 0x67, 0x00, 0x87, 0x08, 0x87, 0x08, 0x68, 0x10, 0x67, 0x08, 0xab, 0x40, 0x8d, 0x88, 0x6b, 0x48, 0x6b, 0x50, 0x6a, 0x68, 0xb0, 0xf1, 0x2f, 0xc9, 0xb0, 0xd1, 0xb0, 0xd9, 0xf0, 0xe1, 0x11, 0xfa, 0xd0, 0xfa, 0xd2, 0xf3, 0x6c, 0x09, 0x0b, 0x11, 0xf3, 0xb2, 0x0d, 0xfd, 0x6d, 0xfd, 0xcf, 0xfd, 0xf0, 0xfd, 0xf3, 0xfe, 0x2f, 0xfd, 0x6c, 0xf2, 0x6c, 0xfb, 0x6d, 0xf3, 0x4e, 0xdd, 0xec, 0x09, 0xed, 0x01, 0x0d, 0x02, 0x2d, 0x0a, 0xcc, 0x01, 0xcc, 0x29, 0xce, 0x69, 0xce, 0x61, 0x2f, 0x7a, 0x6c, 0x41, 0x4a, 0x29, 0xac, 0x41, 0xcd, 0x81, 0x91, 0x72, 0x2d, 0x0a, 0x30, 0x03, 0x10, 0x03, 0x08, 0x11, 0xaf, 0x12, 0xe8, 0x00, 0x8a, 0x01, 0xca, 0x11, 0xd0, 0x73, 0x91, 0xdd, 0x6b, 0xdc, 0x66, 0xeb, 0x49, 0xf4, 0xeb, 0xca, 0x8c, 0xfc, 0x88, 0xca, 0xca, 0x6a, 0xee, 0xbc, 0x8d, 0x6b, 0xd2, 0x2b, 0x0b, 0x12, 0x12, 0x1c, 0x78, 0x2d, 0xc6, 0x10, 0xb0, 0x02, 0x12, 0x13, 0xf9, 0x15, 0xb8, 0x15, 0x37, 0x0d, 0x78, 0x15, 0x36, 0x0d, 0xf6, 0x0c, 0x17, 0x25, 0xcc, 0x01, 0x30, 0x7b, 0x99, 0xfd, 0xbb, 0xc4, 0xf8, 0xf5, 0x1a, 0xfe, 0x7a, 0xd4, 0xbb, 0xc4, 0xee, 0x11, 0x0a, 0x31, 0xea, 0x20, 0xcb, 0x30, 0x0b, 0x29, 0xab, 0x20, 0x94, 0x73, 0x17, 0x2d, 0xd2, 0xb2, 0xb2, 0xba, 0x16, 0xd3, 0xae, 0x90, 0x0f, 0x99, 0xcd, 0x78, 0xed, 0x78, 0xee, 0x80, 0xee, 0x80, 0x0f, 0x99, 0x6f, 0x91, 0x2d, 0x51, 0x30, 0xa1, 0x2c, 0x41, 0x2c, 0x31, 0xeb, 0x18, 0x0b, 0x19, 0x0b, 0x19, 0x0a, 0x11, 0x2b, 0x09, 0x4a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x4b, 0x01, 0x6b, 0x01, 0x4b, 0x11, 0x2b, 0x19, 0x6c, 0x19, 0x6d, 0x31, 0x4d, 0x29, 0x4b, 0x09, 0x2a, 0x09, 0x4b, 0x11, 0x6d, 0x29, 0x4c, 0x29, 0x6c, 0x21, 0x6c, 0x29, 0x6c, 0x39, 0x6d, 0x39, 
-  0xad, 0x60, 0x6f, 0x49, 0xb2, 0x0b, 0xb3, 0x03, 0xd0, 0x0a, 0xa9, 0x10, 0xa9, 0x20, 0x8b, 0x40, 0xab, 0x40, 0x8c, 0x48, 0x4c, 0x78, 0x46, 0x08, 0x68, 0x08, 0xa8, 0x00, 0xc9, 0x08, 0x87, 0x00, 0x88, 0x00, 0xea, 0x08, 0x87, 0x00, 0x4c, 0x09, 0x87, 0x08, 0x87, 0x00, 0xea, 0x00, 0x66, 0x00, 0xc9, 0x00, 0x67, 0x08, 0xa7, 0x00, 0x66, 0x08, 0x87, 0x08, 0x88, 0x08, 0x87, 0x08, 0x89, 0x18, 0xab, 0x30, 0xcb, 0x38, 0xab, 0x50, 0x89, 0x20, 0xec, 0x40, 0xab, 0x30, 0x2b, 0x58, 0x53, 0xea, 0xf0, 0xb0, 0x30, 0xc1, 0xf2, 0xd9, 0xb0, 0xe9, 0xb0, 0xf1, 0xb2, 0xfb, 0x2c, 0x11, 0xaf, 0x79, 0xee, 0x51, 0x2d, 0xfd, 0xae, 0xfd, 0x6e, 0xfd, 0x6f, 0xfd, 0x51, 0xfe, 0x6d, 0xeb, 0xcc, 0xfa, 0xac, 0xfb, 0x0d, 0xfc, 0xab, 0x21, 0xcc, 0x09, 0xec, 0x01, 0x0d, 0x02, 0x2d, 0x02, 0xcc, 0x01, 0xef, 0x71, 0xee, 0x71, 0xcd, 0x71, 0xed, 0x41, 0x0f, 0x72, 0x4b, 0x39, 0xce, 0x81, 0xee, 0x71, 0xee, 0x71, 0xaf, 0x0a, 0x6e, 0x0a, 0x91, 0x0b, 0xd0, 0x02, 0x30, 0x03, 0xe7, 0x08, 0x65, 0x08, 0x11, 0x0b, 0x71, 0x03, 0x0c, 0x9c, 0x4a, 0xbb, 0xf0, 0x13, 0x2a, 0xfd, 0xe5, 0xe3, 0x85, 0xeb, 0x47, 0xf4, 0x6a, 0xeb, 0xae, 0x11, 0x4c, 0x6a, 0xeb, 0x7a, 0xb2, 0xb4, 0x95, 0x0c, 0x19, 0x16, 0xf0, 0x0a, 0xf0, 0x0a, 0x72, 0x03, 0x98, 0x1d, 0x18, 0x0e, 0x98, 0x15, 0x77, 0x15, 0x78, 0x1d, 0x95, 0x24, 0x52, 0x9b, 0xd8, 0xfd, 0x1b, 0xdd, 0xfa, 0xd4, 0xfc, 0xcc, 0xdc, 0xbc, 0xbb, 0xc4, 0xfe, 0xac, 0x19, 0xa4, 0xeb, 0x48, 0xeb, 0x40, 0xb3, 0x63, 0xf4, 0x33, 0xd4, 0x0b, 0x74, 0x0b, 0x12, 0x03, 0x4f, 0x12, 0x50, 0xa9, 0x0f, 0x99, 0xee, 0x90, 0x0e, 0x79, 0x50, 0x91, 0x2f, 0x89, 0x0e, 0x79, 0x2f, 0x71, 0xcc, 0x58, 0xec, 0x48, 0x0e, 0x79, 0xec, 0x58, 0x0c, 0x51, 0x0b, 0x29, 0x0a, 0x11, 0x2a, 0x01, 0x2a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x2a, 0x01, 0x4a, 0x01, 0x2a, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0x4b, 0x09, 0x6c, 0x09, 0x8d, 0x21, 0x4b, 0x09, 0x4c, 0x11, 0x2b, 0x11, 0x4c, 0x21, 0x6d, 0x29, 0x6c, 0x21, 0x8d, 0x31, 0x6c, 0x39, 0x4c, 0x31, 
-  0x8c, 0x58, 0xac, 0x58, 0xad, 0x80, 0x0d, 0x59, 0x4b, 0x50, 0x8a, 0x28, 0xaa, 0x28, 0x6a, 0x38, 0x8b, 0x40, 0x8c, 0x48, 0x8c, 0x70, 0xa8, 0x08, 0xa8, 0x00, 0xa8, 0x00, 0x0b, 0x01, 0x67, 0x08, 0x09, 0x01, 0x87, 0x00, 0xa8, 0x08, 0x4c, 0x09, 0xe9, 0x08, 0x87, 0x00, 0x88, 0x00, 0xe9, 0x08, 0x88, 0x08, 0xa8, 0x00, 0x86, 0x08, 0x67, 0x08, 0x88, 0x00, 0x87, 0x08, 0x88, 0x00, 0xaa, 0x28, 0x0e, 0x71, 0xea, 0x08, 0x0c, 0x59, 0xc9, 0x10, 0x8b, 0x38, 0xd0, 0xd0, 0xcb, 0x58, 0xeb, 0x30, 0xcc, 0x78, 0x2e, 0x79, 0x6f, 0xb1, 0xf0, 0xe1, 0x51, 0xfa, 0x90, 0xd9, 0x53, 0xfb, 0xae, 0x49, 0x2c, 0x09, 0x8f, 0x59, 0x51, 0xc5, 0x10, 0xbd, 0xcf, 0xfd, 0x4f, 0xfd, 0xb2, 0xfe, 0x33, 0xf5, 0xac, 0xfa, 0x6d, 0xf3, 0x6d, 0xec, 0x2c, 0xfc, 0xca, 0x21, 0x8c, 0x01, 0x8b, 0x09, 0x4d, 0x59, 0xad, 0x71, 0xef, 0x71, 0x4b, 0x51, 0xee, 0x69, 0xae, 0x71, 0x8e, 0x81, 0xad, 0x51, 0x4a, 0x39, 0xd0, 0x79, 0x8f, 0x92, 0x6e, 0x0a, 0xab, 0x01, 0x8e, 0x0a, 0xe7, 0x00, 0x64, 0x00, 0x8a, 0x01, 0x69, 0x01, 0x9a, 0x35, 0xd0, 0x33, 0x55, 0x54, 0x30, 0x13, 0x0b, 0x9b, 0x6b, 0xfd, 0xef, 0xfd, 0x6b, 0xe4, 0x0f, 0x1b, 0xf4, 0x5c, 0x56, 0x1c, 0xaf, 0x22, 0x97, 0x15, 0xd5, 0x2c, 0xd8, 0x1d, 0xdb, 0x06, 0xb6, 0x24, 0x11, 0x03, 0x14, 0x0c, 0xd8, 0x0d, 0xf9, 0x15, 0xf9, 0x05, 0x96, 0x14, 0x18, 0xfe, 0x19, 0xfe, 0x3a, 0xfe, 0xbc, 0xcc, 0x7d, 0xd4, 0x9d, 0xb4, 0xbd, 0xac, 0xbc, 0xb4, 0x3a, 0x94, 0x3d, 0xa4, 0xda, 0x9b, 0xeb, 0x40, 0x56, 0x1c, 0x53, 0x13, 0xae, 0x01, 0x30, 0x02, 0xee, 0x01, 0x10, 0xa9, 0xcf, 0x98, 0xee, 0x88, 0x0e, 0x79, 0x2e, 0x79, 0x0e, 0x71, 0xee, 0x60, 0x0d, 0x59, 0xea, 0x20, 0xec, 0x50, 0xec, 0x40, 0x0d, 0x49, 0x2c, 0x39, 0x4b, 0x21, 0x0a, 0x11, 0x0a, 0x11, 0xe9, 0x00, 0xea, 0x00, 0x2a, 0x01, 0x0a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x6b, 0x01, 0x6b, 0x01, 0x6b, 0x01, 0x4b, 0x09, 0x4b, 0x09, 0x2b, 0x01, 0x4c, 0x11, 0x0b, 0x11, 0x4b, 0x11, 0x6c, 0x21, 0x6d, 0x31, 0x8d, 0x39, 0x6c, 0x39, 0x6d, 0x39, 
-  0x8c, 0x50, 0x8c, 0x50, 0x8c, 0x58, 0xcc, 0x40, 0x8c, 0x50, 0x8b, 0x40, 0x8a, 0x30, 0x8a, 0x28, 0x8b, 0x40, 0x8c, 0x58, 0x67, 0x08, 0x68, 0x00, 0x88, 0x00, 0xea, 0x00, 0xea, 0x00, 0x87, 0x00, 0x8d, 0x01, 0xa8, 0x08, 0xa8, 0x00, 0xc9, 0x00, 0x4c, 0x09, 0xa9, 0x00, 0x88, 0x00, 0x8e, 0x01, 0x88, 0x00, 0x88, 0x00, 0x66, 0x08, 0xa8, 0x08, 0x87, 0x00, 0x87, 0x00, 0x88, 0x08, 0x89, 0x10, 0xcc, 0x50, 0x8e, 0x88, 0xa8, 0x18, 0xa9, 0x08, 0x8a, 0x30, 0x6b, 0x58, 0xee, 0xb0, 0xea, 0x18, 0x2a, 0x11, 0x4b, 0x11, 0x90, 0x89, 0xef, 0xb0, 0x6f, 0xc1, 0x8f, 0xc9, 0x11, 0xea, 0x12, 0xeb, 0x4c, 0x09, 0xca, 0x30, 0x90, 0x0a, 0x0f, 0x03, 0x30, 0x13, 0x73, 0x23, 0x32, 0xfe, 0x93, 0xfe, 0xf6, 0xfe, 0xac, 0xfa, 0x2c, 0xda, 0xcb, 0xea, 0x8c, 0xfb, 0x8d, 0xfc, 0x8f, 0xfd, 0x90, 0xfe, 0x12, 0xff, 0x15, 0xce, 0x6b, 0x51, 0x6d, 0x69, 0x8d, 0x71, 0x6c, 0x61, 0xcf, 0x79, 0x2f, 0x9a, 0xaf, 0xd2, 0x91, 0xd2, 0x50, 0xa2, 0xcb, 0x01, 0xa7, 0x00, 0x86, 0x08, 0x49, 0x09, 0x6a, 0x09, 0x69, 0x09, 0xfa, 0x2d, 0x75, 0x0c, 0x89, 0x01, 0x53, 0x44, 0x94, 0x3c, 0x4f, 0x2b, 0x8d, 0x93, 0xd0, 0x8c, 0x9b, 0x1d, 0x39, 0x46, 0xd1, 0x53, 0xd0, 0x02, 0xf7, 0x2c, 0x75, 0x14, 0xb5, 0x14, 0x95, 0x14, 0x1a, 0x1e, 0x72, 0x13, 0x32, 0x0b, 0x78, 0x0d, 0x37, 0x96, 0x57, 0xfe, 0x57, 0xfe, 0x57, 0xfe, 0x19, 0xfe, 0x5b, 0xcc, 0x5d, 0xbc, 0x5e, 0xac, 0x7c, 0xa4, 0xd1, 0x61, 0xbe, 0xbc, 0x1d, 0x8c, 0xfd, 0x93, 0x1d, 0x94, 0x72, 0x2b, 0xd4, 0x1b, 0x12, 0x0b, 0x6c, 0x09, 0x8d, 0x01, 0x2e, 0x51, 0x10, 0x99, 0x2f, 0x89, 0x2f, 0x79, 0xee, 0x68, 0x0d, 0x61, 0x4d, 0x41, 0x0c, 0x21, 0x2b, 0x21, 0x2d, 0x59, 0x2c, 0x39, 0x2a, 0x11, 0x4b, 0x29, 0x2a, 0x19, 0x4b, 0x11, 0x09, 0x09, 0x0a, 0x09, 0xc8, 0x00, 0xe9, 0x08, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x4a, 0x01, 0x2a, 0x01, 0x2a, 0x09, 0x4a, 0x01, 0x6b, 0x01, 0x6b, 0x01, 0x8b, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0x2b, 0x01, 0x2b, 0x01, 0x2b, 0x09, 0x4c, 0x11, 0x6c, 0x09, 0x4c, 0x19, 0x6d, 0x39, 0x8d, 0x39, 0x6d, 0x39, 
-  0x8c, 0x48, 0x8c, 0x48, 0x8c, 0x48, 0x8c, 0x40, 0xac, 0x40, 0x8c, 0x40, 0x8b, 0x38, 0x6b, 0x30, 0x8c, 0x48, 0x88, 0x08, 0x89, 0x00, 0xa8, 0x00, 0x67, 0x08, 0x88, 0x00, 0xa8, 0x00, 0xc9, 0x00, 0x8e, 0x01, 0x66, 0x08, 0xa9, 0x00, 0xc9, 0x08, 0xcb, 0x00, 0xe9, 0x00, 0xc8, 0x00, 0xea, 0x00, 0x2b, 0x09, 0x87, 0x08, 0x87, 0x08, 0xa8, 0x08, 0x67, 0x00, 0x87, 0x00, 0x88, 0x08, 0xa9, 0x10, 0xab, 0x28, 0xed, 0x58, 0x88, 0x18, 0x87, 0x08, 0xaa, 0x18, 0xca, 0x38, 0xab, 0x48, 0x2e, 0x79, 0x0f, 0x0a, 0x8d, 0x09, 0xd2, 0x02, 0xaf, 0x78, 0x30, 0x89, 0x0f, 0xb1, 0x2e, 0xb9, 0xef, 0xd9, 0xb3, 0xf2, 0x4d, 0x19, 0xed, 0x01, 0xce, 0x09, 0x32, 0x0b, 0x31, 0x0b, 0x3a, 0x1d, 0x32, 0xcd, 0x71, 0xfe, 0xad, 0xcb, 0x2e, 0xdb, 0x0f, 0xeb, 0xeb, 0xfa, 0xab, 0xe2, 0x6c, 0xfc, 0x4d, 0xfd, 0x50, 0xfe, 0x91, 0xfe, 0x71, 0xfe, 0x13, 0xff, 0xf3, 0xdd, 0x8a, 0x49, 0xad, 0x71, 0x6f, 0xba, 0x0e, 0xa2, 0xcf, 0xca, 0xce, 0x79, 0x0f, 0x62, 0xc7, 0x10, 0xc7, 0x00, 0x6a, 0x09, 0x8a, 0x01, 0xeb, 0x01, 0xd5, 0x14, 0x54, 0x14, 0x12, 0x04, 0x0e, 0x4b, 0x8e, 0x0a, 0x36, 0x35, 0x6e, 0x12, 0xb5, 0x0c, 0x77, 0x45, 0x96, 0x24, 0xf6, 0x14, 0xb5, 0x0c, 0xf4, 0x0b, 0xf6, 0x44, 0xb5, 0x2c, 0xae, 0x32, 0x19, 0xfe, 0xb6, 0xe5, 0x76, 0xfe, 0x97, 0xfe, 0x37, 0xfe, 0x37, 0xfe, 0xf7, 0xfd, 0x9a, 0xcc, 0xdc, 0xcc, 0x1d, 0xac, 0x9c, 0xbc, 0xfe, 0xd4, 0x30, 0x51, 0xac, 0x40, 0x5d, 0x9c, 0x9d, 0x7b, 0x9a, 0x54, 0x3a, 0x35, 0x15, 0x1c, 0x70, 0x02, 0x2f, 0x0a, 0x6c, 0x01, 0x6f, 0x69, 0x4f, 0x89, 0x0e, 0x79, 0x0e, 0x69, 0xed, 0x58, 0x2c, 0x39, 0xce, 0x09, 0xaf, 0x09, 0x4c, 0x01, 0x90, 0x69, 0xec, 0x48, 0xeb, 0x28, 0xea, 0x20, 0x2a, 0x11, 0x2a, 0x09, 0x2a, 0x01, 0xe9, 0x08, 0xe9, 0x00, 0xc8, 0x00, 0x2a, 0x09, 0x2a, 0x01, 0xc8, 0x00, 0x09, 0x01, 0xe9, 0x00, 0x4b, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0x6b, 0x01, 0x2a, 0x01, 0x4b, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x4b, 0x01, 0x6c, 0x09, 0x6c, 0x09, 0x6c, 0x01, 0x6d, 0x21, 0x6d, 0x39, 0x6d, 0x39, 
-  0xac, 0x48, 0x8c, 0x48, 0x8c, 0x48, 0xac, 0x40, 0xcb, 0x28, 0xac, 0x40, 0x8c, 0x38, 0x6a, 0x20, 0xa8, 0x00, 0x88, 0x08, 0xa9, 0x00, 0xa9, 0x00, 0x4c, 0x09, 0xa9, 0x00, 0x87, 0x08, 0xa8, 0x08, 0x4b, 0x09, 0x2b, 0x09, 0xa9, 0x00, 0x88, 0x08, 0x0a, 0x01, 0xea, 0x00, 0x68, 0x00, 0xc9, 0x00, 0xcd, 0x01, 0x87, 0x00, 0x0a, 0x09, 0x87, 0x00, 0x88, 0x00, 0x87, 0x00, 0x88, 0x00, 0x88, 0x00, 0xaa, 0x20, 0xcc, 0x60, 0x67, 0x08, 0x67, 0x08, 0x89, 0x08, 0xa9, 0x20, 0xec, 0x48, 0xaa, 0x48, 0xaf, 0x90, 0x8f, 0x11, 0xac, 0x01, 0x2b, 0x01, 0x32, 0x1a, 0x0e, 0x51, 0xef, 0xa0, 0x0f, 0xb9, 0xb0, 0xd9, 0xb2, 0xfa, 0xc9, 0x10, 0xa8, 0x10, 0xcb, 0x01, 0x6b, 0x01, 0xf8, 0x24, 0xd4, 0x13, 0x93, 0x75, 0x8e, 0xfd, 0x0c, 0xda, 0x8e, 0xd2, 0xea, 0xb9, 0x8f, 0xfb, 0xad, 0xea, 0xed, 0xfb, 0x6f, 0xfd, 0x71, 0xfe, 0xce, 0xfd, 0x8e, 0xfd, 0x8f, 0xfd, 0x72, 0xfe, 0xed, 0x8a, 0x2f, 0xb2, 0xee, 0x99, 0xb0, 0xca, 0xee, 0x89, 0x09, 0x11, 0x4b, 0x29, 0x8f, 0x02, 0xfa, 0x2d, 0xec, 0x01, 0xf0, 0x02, 0x0b, 0x02, 0x4c, 0x02, 0x2c, 0x02, 0x91, 0x1b, 0x10, 0x1b, 0x0f, 0x83, 0x18, 0x45, 0xb7, 0x35, 0x11, 0x13, 0xaf, 0x0a, 0xf4, 0x13, 0x12, 0x2c, 0x38, 0xfe, 0xd7, 0xe4, 0xda, 0xfd, 0x77, 0xfd, 0xd8, 0xfd, 0x39, 0xfe, 0xb8, 0xfd, 0xf7, 0xfd, 0xb9, 0xfd, 0x59, 0xf5, 0xba, 0xd4, 0x1c, 0xa4, 0x7a, 0xac, 0x5d, 0x93, 0x9d, 0xbc, 0x1c, 0x9c, 0xe8, 0x20, 0xaa, 0x28, 0x6f, 0x49, 0x39, 0x74, 0x93, 0x13, 0x12, 0x0b, 0x53, 0x0b, 0xac, 0x01, 0x4b, 0x09, 0x8f, 0x81, 0xef, 0x88, 0x0e, 0x61, 0x0d, 0x51, 0xcf, 0x29, 0x50, 0x0a, 0x90, 0x02, 0x4c, 0x09, 0x4b, 0x01, 0x6f, 0x69, 0x2e, 0x61, 0x0b, 0x21, 0x0c, 0x39, 0x2b, 0x11, 0xc9, 0x00, 0xe9, 0x00, 0x2a, 0x09, 0xe8, 0x00, 0xe9, 0x00, 0xc9, 0x08, 0x2a, 0x01, 0x0a, 0x01, 0xc9, 0x00, 0x2a, 0x01, 0xc8, 0x00, 0x2a, 0x09, 0x2b, 0x01, 0x2a, 0x01, 0x4b, 0x01, 0x6b, 0x09, 0x2a, 0x01, 0x4b, 0x01, 0x0a, 0x01, 0x2a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x4b, 0x09, 0x2b, 0x01, 0x6b, 0x01, 0x4b, 0x01, 0x2c, 0x19, 0x2c, 0x29, 
-  0xac, 0x40, 0xab, 0x28, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0x69, 0x08, 0xab, 0x18, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x08, 0xc9, 0x00, 0xc9, 0x00, 0x0b, 0x01, 0xa8, 0x08, 0x6d, 0x09, 0x0a, 0x01, 0xc9, 0x08, 0x4c, 0x01, 0x87, 0x00, 0x88, 0x08, 0xc9, 0x00, 0x67, 0x00, 0xcf, 0x09, 0xc9, 0x00, 0xad, 0x01, 0xa8, 0x08, 0x0a, 0x01, 0x88, 0x00, 0x87, 0x08, 0x87, 0x08, 0x87, 0x08, 0x88, 0x08, 0xc9, 0x10, 0xcb, 0x38, 0x88, 0x10, 0xa9, 0x18, 0xc9, 0x10, 0x89, 0x10, 0x8a, 0x28, 0xec, 0x48, 0x89, 0x30, 0xb1, 0xc1, 0xac, 0x58, 0xb1, 0x79, 0x0b, 0x11, 0x91, 0x0a, 0xd2, 0x22, 0x4f, 0x69, 0xee, 0xa0, 0x2d, 0xa1, 0x2f, 0xc1, 0x4a, 0x51, 0x29, 0x01, 0xe8, 0x00, 0x90, 0x02, 0xb0, 0x12, 0x13, 0x1c, 0x2c, 0xfd, 0x10, 0xfe, 0x2d, 0xfd, 0xaf, 0xeb, 0x8e, 0xe2, 0x8c, 0xda, 0xed, 0xf2, 0x4b, 0xf3, 0x6d, 0xfd, 0xce, 0xfd, 0x72, 0xfe, 0x8c, 0xfc, 0x8f, 0xfd, 0x71, 0xfe, 0x16, 0xff, 0xcc, 0x99, 0x2e, 0xaa, 0xef, 0x81, 0x09, 0x21, 0x29, 0x21, 0x8b, 0x11, 0xae, 0x02, 0xae, 0x02, 0x95, 0x14, 0x91, 0x13, 0xb7, 0x2c, 0x34, 0x04, 0x72, 0x1b, 0xd0, 0x02, 0xce, 0x11, 0xac, 0x51, 0x0e, 0x3a, 0x50, 0x13, 0xb3, 0x9c, 0xf7, 0xfd, 0x57, 0xfd, 0xb7, 0xdc, 0x78, 0xfd, 0x37, 0xfd, 0x97, 0xe4, 0xf9, 0xfc, 0xd7, 0xec, 0x78, 0xfd, 0x3a, 0xc4, 0x1a, 0xac, 0x1b, 0xed, 0x5a, 0xf5, 0xdc, 0xe4, 0x3b, 0xbc, 0x9b, 0xe4, 0xfd, 0xa3, 0x0c, 0x29, 0xe9, 0x28, 0x30, 0x0a, 0x12, 0x13, 0x94, 0x13, 0x93, 0x03, 0x0e, 0x02, 0xad, 0x01, 0x4b, 0x09, 0x6f, 0x81, 0x4f, 0x71, 0xec, 0x50, 0xcc, 0x48, 0x8d, 0x19, 0xae, 0x01, 0x0b, 0x01, 0x8d, 0x09, 0xcd, 0x01, 0x4d, 0x49, 0x2d, 0x39, 0x0d, 0x51, 0xeb, 0x28, 0x2c, 0x31, 0x2b, 0x11, 0xa8, 0x00, 0xe9, 0x00, 0x2a, 0x09, 0xe9, 0x00, 0x2a, 0x09, 0x0a, 0x09, 0x09, 0x01, 0x6b, 0x01, 0xe9, 0x00, 0x2a, 0x01, 0xc9, 0x00, 0x2b, 0x09, 0x09, 0x09, 0x0a, 0x01, 0x0a, 0x09, 0x2a, 0x01, 0x2a, 0x01, 0x4b, 0x09, 0x2a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x4a, 0x01, 0x2a, 0x01, 0x0a, 0x01, 0x4c, 0x11, 
-  0xaa, 0x18, 0x89, 0x08, 0xa8, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xca, 0x08, 0xab, 0x20, 0x88, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0x88, 0x00, 0xa8, 0x00, 0xea, 0x00, 0xe9, 0x00, 0xcf, 0x09, 0xc8, 0x00, 0xa8, 0x00, 0xca, 0x00, 0x8d, 0x09, 0x87, 0x08, 0xcf, 0x09, 0xc8, 0x08, 0xcf, 0x09, 0x88, 0x00, 0x8e, 0x01, 0x2b, 0x01, 0xc8, 0x00, 0xae, 0x11, 0x0a, 0x09, 0x67, 0x10, 0x87, 0x00, 0x87, 0x08, 0xc9, 0x08, 0xaa, 0x20, 0xaa, 0x20, 0x4c, 0x19, 0xa8, 0x00, 0x4c, 0x01, 0xc9, 0x08, 0xca, 0x20, 0xee, 0x70, 0xaa, 0x28, 0xcb, 0x40, 0xca, 0x28, 0xcd, 0x80, 0x50, 0x02, 0xee, 0x09, 0xef, 0x21, 0x2d, 0x41, 0x0d, 0x81, 0x4f, 0x99, 0xf1, 0xb8, 0x72, 0xda, 0xea, 0x08, 0x0d, 0x02, 0x8c, 0x09, 0xd3, 0x13, 0x54, 0xb5, 0xee, 0xfc, 0x30, 0xf6, 0xae, 0xfc, 0x30, 0xfe, 0xad, 0xda, 0x2c, 0xca, 0x4d, 0xfb, 0x4c, 0xfb, 0x0c, 0xfd, 0x8e, 0xfd, 0x71, 0xfe, 0xcc, 0xfc, 0x8e, 0xfd, 0x10, 0xfe, 0x52, 0xfe, 0x30, 0xa5, 0x08, 0x29, 0xa7, 0x10, 0x4a, 0x29, 0x49, 0x11, 0x0c, 0x0a, 0xaa, 0x01, 0x6e, 0x0a, 0x2f, 0x4a, 0x10, 0x53, 0x2d, 0x43, 0xf1, 0x63, 0x2f, 0x6a, 0xab, 0x41, 0x2c, 0x2a, 0x6a, 0x29, 0x36, 0xdd, 0x96, 0xfd, 0x18, 0xcc, 0xba, 0xfd, 0x37, 0xf5, 0x17, 0xfd, 0x97, 0xdc, 0x78, 0xe4, 0x7a, 0xfd, 0xba, 0xe4, 0x5c, 0xc4, 0x5b, 0xb4, 0x9b, 0x83, 0x7a, 0xdc, 0x5a, 0xd4, 0x79, 0xcc, 0x1b, 0x94, 0xbd, 0xdc, 0xf1, 0x31, 0x0a, 0x11, 0xc8, 0x10, 0xd1, 0x12, 0xf1, 0x02, 0x32, 0x13, 0x2f, 0x02, 0x8c, 0x01, 0xcf, 0x49, 0x4f, 0x89, 0x0d, 0x61, 0x2d, 0x49, 0x2a, 0x29, 0x4c, 0x11, 0x71, 0x0a, 0xcd, 0x01, 0x2f, 0x12, 0x4c, 0x11, 0x0b, 0x09, 0x0c, 0x39, 0x2c, 0x41, 0x0c, 0x31, 0xeb, 0x20, 0x0b, 0x19, 0x2b, 0x19, 0xc8, 0x00, 0xe9, 0x00, 0x09, 0x01, 0x09, 0x01, 0xe9, 0x08, 0x6b, 0x01, 0x6b, 0x09, 0x6c, 0x01, 0xc9, 0x00, 0x2b, 0x09, 0xe9, 0x00, 0xc9, 0x00, 0xc8, 0x08, 0xe9, 0x00, 0x09, 0x01, 0xe9, 0x08, 0x2a, 0x09, 0x0a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x0a, 0x01, 0x2b, 0x09, 
-  0x89, 0x08, 0xc8, 0x00, 0xa8, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0x88, 0x00, 0x88, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa9, 0x00, 0xa8, 0x00, 0x88, 0x00, 0xea, 0x00, 0xea, 0x00, 0x2b, 0x01, 0xa7, 0x00, 0xca, 0x00, 0x8e, 0x01, 0x88, 0x00, 0xef, 0x01, 0x87, 0x00, 0x6d, 0x09, 0xa9, 0x00, 0xa9, 0x00, 0xca, 0x00, 0x67, 0x00, 0xae, 0x01, 0x68, 0x08, 0x6d, 0x09, 0x46, 0x00, 0xa8, 0x08, 0xa8, 0x08, 0xc9, 0x08, 0xea, 0x18, 0xc9, 0x08, 0xad, 0x09, 0x8c, 0x09, 0xc8, 0x00, 0xc9, 0x08, 0xea, 0x20, 0x0e, 0x69, 0xad, 0x50, 0xa9, 0x10, 0x6d, 0x11, 0x90, 0x81, 0x6f, 0x12, 0x4e, 0x0a, 0xce, 0x09, 0xd3, 0x02, 0xec, 0x68, 0x0d, 0x79, 0xcd, 0x68, 0x50, 0xc1, 0x28, 0x01, 0x2b, 0x09, 0xcf, 0x02, 0x98, 0x45, 0xa9, 0xfc, 0xcc, 0xfc, 0x72, 0xfe, 0xcc, 0xfc, 0xb2, 0xfe, 0xcb, 0xba, 0xee, 0xfa, 0x6d, 0xf3, 0x2b, 0xfc, 0xec, 0xfc, 0x6e, 0xfd, 0x72, 0xfe, 0x13, 0xff, 0xed, 0xfc, 0xee, 0xfc, 0x10, 0xfe, 0x14, 0xff, 0x0d, 0x6b, 0x2a, 0x31, 0x68, 0x21, 0x8b, 0x09, 0x48, 0x11, 0x6d, 0x51, 0xee, 0x59, 0xad, 0x49, 0x2f, 0x2a, 0xd3, 0xcb, 0xf5, 0xf5, 0x12, 0xed, 0x33, 0xf5, 0xd6, 0xec, 0xb7, 0xcb, 0xb8, 0xdc, 0x78, 0xed, 0x98, 0xfd, 0x77, 0xd4, 0x19, 0xfd, 0x98, 0xdc, 0x3a, 0xcc, 0x7a, 0xec, 0x9b, 0xc4, 0x59, 0xbc, 0x99, 0xc4, 0xda, 0xfc, 0x3b, 0xd4, 0xd9, 0x9b, 0xda, 0xab, 0x9e, 0xa5, 0xd6, 0x1b, 0x2f, 0x0a, 0xa8, 0x08, 0x12, 0x0b, 0x50, 0x0a, 0xb0, 0x02, 0x0f, 0x0a, 0x6c, 0x11, 0x4f, 0x81, 0x0d, 0x59, 0x0c, 0x51, 0xeb, 0x40, 0x0e, 0x0a, 0x92, 0x0a, 0x0f, 0x02, 0xef, 0x09, 0x8c, 0x01, 0xec, 0x38, 0xea, 0x10, 0x6c, 0x19, 0x0b, 0x29, 0x0b, 0x31, 0x2b, 0x11, 0x0a, 0x01, 0x2b, 0x11, 0x2b, 0x09, 0xc9, 0x00, 0x09, 0x01, 0xe9, 0x00, 0x0a, 0x01, 0x4b, 0x09, 0x2b, 0x01, 0x2a, 0x09, 0x0b, 0x01, 0xa8, 0x00, 0x0b, 0x01, 0xa8, 0x00, 0x0a, 0x09, 0x09, 0x09, 0x0a, 0x01, 0xa9, 0x08, 0x2a, 0x01, 0x0a, 0x01, 0x09, 0x09, 0xe9, 0x00, 0x0a, 0x01, 0x0b, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x2b, 0x09, 
-  0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa9, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xea, 0x00, 0xca, 0x00, 0xae, 0x01, 0x87, 0x00, 0xa9, 0x00, 0x2c, 0x01, 0xad, 0x09, 0x4d, 0x01, 0xc8, 0x08, 0x2b, 0x09, 0xc9, 0x00, 0x8c, 0x09, 0xc9, 0x00, 0x87, 0x08, 0xa8, 0x08, 0x09, 0x01, 0xe9, 0x00, 0x6b, 0x09, 0xc9, 0x00, 0x88, 0x00, 0xa8, 0x08, 0xc9, 0x08, 0xa8, 0x00, 0x8c, 0x09, 0x0a, 0x01, 0x8c, 0x01, 0xc9, 0x10, 0x88, 0x10, 0x4d, 0x19, 0x0d, 0x19, 0xae, 0x11, 0xce, 0x09, 0x4d, 0x21, 0xec, 0x60, 0x2f, 0x71, 0x0f, 0x02, 0xe9, 0x00, 0x0f, 0x0a, 0x2b, 0x11, 0xcb, 0x48, 0xcc, 0x60, 0xcc, 0x70, 0x6d, 0x51, 0x4f, 0x12, 0x75, 0x14, 0x56, 0x8d, 0x6b, 0xfc, 0xab, 0xfc, 0x30, 0xfe, 0x4e, 0xfd, 0x2e, 0xfd, 0x2f, 0xfe, 0x91, 0xf5, 0xcb, 0xfb, 0x2b, 0xfc, 0x0d, 0xfd, 0xcf, 0xfd, 0x50, 0xfe, 0xb2, 0xfe, 0x4b, 0xfc, 0x0e, 0xfd, 0x8f, 0xfd, 0x11, 0xfe, 0x92, 0xfe, 0x05, 0x21, 0xe8, 0x10, 0xcb, 0x51, 0x0e, 0x8b, 0xd0, 0x62, 0xf3, 0xf4, 0x6f, 0x83, 0xb1, 0xdc, 0x51, 0xa3, 0x11, 0xd4, 0x16, 0xf5, 0x36, 0xcc, 0xf8, 0xb3, 0xd9, 0xa3, 0xf7, 0xa3, 0x99, 0xfd, 0xd7, 0xfc, 0x3a, 0xfd, 0xb7, 0xdc, 0x58, 0x8c, 0x17, 0x64, 0x78, 0x5c, 0x9b, 0xac, 0xd9, 0x94, 0x35, 0x53, 0xf3, 0x12, 0x53, 0x13, 0xb4, 0x13, 0x90, 0x1a, 0x33, 0x1b, 0x4a, 0x09, 0xd1, 0x02, 0xcd, 0x01, 0xac, 0x01, 0x6b, 0x01, 0x4e, 0x59, 0x0d, 0x59, 0xeb, 0x48, 0xca, 0x38, 0xea, 0x30, 0x2a, 0x19, 0x0e, 0x02, 0x8d, 0x09, 0x2f, 0x0a, 0x6c, 0x09, 0x2c, 0x21, 0xca, 0x18, 0xce, 0x09, 0x2c, 0x11, 0xea, 0x18, 0x2c, 0x11, 0xea, 0x00, 0x8c, 0x09, 0x2a, 0x01, 0xea, 0x00, 0x4a, 0x01, 0xe9, 0x00, 0x0a, 0x01, 0xe9, 0x00, 0x6c, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0xea, 0x00, 0xc9, 0x00, 0x0b, 0x01, 0xc9, 0x00, 0x2b, 0x09, 0xe9, 0x08, 0xc8, 0x00, 0x2b, 0x09, 0x0a, 0x01, 0xe9, 0x00, 0x2a, 0x09, 0xe9, 0x00, 0x0a, 0x01, 0x0a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x2a, 0x01, 0x2b, 0x09, 
-  0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa9, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0x88, 0x08, 0x0b, 0x01, 0xc9, 0x00, 0xea, 0x08, 0xed, 0x00, 0x89, 0x08, 0x88, 0x00, 0x0b, 0x01, 0x30, 0x02, 0xa7, 0x08, 0xeb, 0x00, 0xce, 0x01, 0x67, 0x08, 0x6e, 0x01, 0xc9, 0x08, 0x65, 0x08, 0x88, 0x00, 0xc9, 0x00, 0x0b, 0x01, 0x0f, 0x02, 0x2c, 0x01, 0x87, 0x08, 0x4c, 0x09, 0x87, 0x08, 0x67, 0x00, 0xe9, 0x00, 0x8c, 0x09, 0x4b, 0x01, 0xe8, 0x08, 0x4c, 0x01, 0xe9, 0x00, 0x2b, 0x11, 0xed, 0x11, 0xcd, 0x01, 0x0f, 0x0a, 0xcd, 0x09, 0xaa, 0x18, 0x6e, 0x59, 0x0e, 0x0a, 0x6f, 0x0a, 0x2e, 0x02, 0x0b, 0x01, 0x2b, 0x19, 0xab, 0x40, 0xcb, 0x50, 0xf0, 0x59, 0x73, 0x0b, 0x76, 0x14, 0xcc, 0xeb, 0x8e, 0x5b, 0x55, 0x1c, 0xaf, 0xfd, 0x8e, 0xed, 0xac, 0xfc, 0x0e, 0xf5, 0xef, 0xfd, 0x4b, 0xfc, 0x8b, 0xfc, 0x8b, 0xfc, 0xcc, 0xfc, 0x8e, 0xfd, 0x51, 0xfe, 0x71, 0xfe, 0xcf, 0xfc, 0xee, 0xfc, 0x50, 0xfd, 0x31, 0xfd, 0x92, 0xfd, 0x92, 0xfd, 0x71, 0xdc, 0x4d, 0x9b, 0x52, 0x83, 0xf1, 0xe4, 0x74, 0xfd, 0x90, 0xcc, 0x51, 0xdc, 0x18, 0xed, 0x95, 0xd4, 0xf7, 0xe4, 0xf7, 0xdc, 0x77, 0xc4, 0x99, 0xc4, 0xd3, 0x53, 0x91, 0x12, 0xd2, 0x22, 0xee, 0x01, 0xac, 0x01, 0xb1, 0x12, 0xf2, 0x1a, 0xcc, 0x01, 0xf1, 0x02, 0x33, 0x13, 0x50, 0x0a, 0xd1, 0x02, 0x0e, 0x0a, 0xee, 0x01, 0x2f, 0x0a, 0xcd, 0x09, 0x4a, 0x01, 0x6c, 0x29, 0x4d, 0x49, 0x0b, 0x39, 0x0b, 0x39, 0x2c, 0x21, 0x6c, 0x11, 0x2f, 0x0a, 0x2f, 0x0a, 0x2d, 0x11, 0x0f, 0x0a, 0xae, 0x09, 0xee, 0x01, 0x2c, 0x01, 0xed, 0x01, 0x6b, 0x01, 0x6b, 0x01, 0x2b, 0x09, 0x2c, 0x09, 0xe9, 0x00, 0x4b, 0x01, 0xea, 0x00, 0xe8, 0x00, 0x2b, 0x01, 0x0a, 0x09, 0x4a, 0x01, 0xea, 0x00, 0x6b, 0x01, 0x0a, 0x01, 0xc9, 0x00, 0x2b, 0x01, 0xc8, 0x00, 0x4b, 0x09, 0x8c, 0x01, 0xe9, 0x00, 0xe9, 0x08, 0x2a, 0x01, 0x2c, 0x01, 0x0a, 0x01, 0xc9, 0x00, 0xa8, 0x00, 0xc8, 0x00, 0x2a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 
-  0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0x88, 0x00, 0x88, 0x00, 0xea, 0x00, 0xc9, 0x00, 0xa8, 0x00, 0xca, 0x00, 0xc9, 0x00, 0xa8, 0x08, 0xc9, 0x08, 0x8d, 0x09, 0xa8, 0x00, 0xeb, 0x00, 0x4c, 0x01, 0xea, 0x00, 0xe9, 0x08, 0x2b, 0x01, 0x8c, 0x01, 0x86, 0x00, 0xeb, 0x08, 0x8d, 0x09, 0x6b, 0x01, 0xc8, 0x00, 0x87, 0x00, 0x8e, 0x01, 0x66, 0x00, 0x88, 0x00, 0xc8, 0x00, 0x0a, 0x01, 0x4c, 0x01, 0xa7, 0x00, 0x6c, 0x01, 0x0e, 0x0a, 0x0a, 0x01, 0x8d, 0x01, 0x2b, 0x01, 0x8d, 0x01, 0x2b, 0x01, 0x8c, 0x09, 0xea, 0x10, 0x2b, 0x09, 0xee, 0x09, 0xcd, 0x01, 0xee, 0x09, 0x4b, 0x01, 0x4e, 0x0a, 0x4a, 0x09, 0x2b, 0x11, 0x6d, 0x41, 0x11, 0x0b, 0xac, 0x09, 0xcc, 0x01, 0x93, 0x0b, 0xd3, 0x0b, 0x6c, 0x22, 0xb2, 0xb4, 0x4e, 0x12, 0x8c, 0x42, 0xad, 0xfd, 0x8e, 0xed, 0xad, 0x83, 0x0c, 0xfd, 0x4e, 0xfd, 0xad, 0xfd, 0xee, 0xfd, 0xf1, 0xfd, 0x30, 0xec, 0x6f, 0xf4, 0xb0, 0xfc, 0xd1, 0xfc, 0x32, 0xed, 0x54, 0xf5, 0x51, 0xdc, 0xb3, 0xfd, 0xd0, 0xdb, 0x14, 0xf5, 0xb3, 0xdc, 0x93, 0xe4, 0x15, 0xe5, 0xb4, 0xdc, 0x15, 0xb4, 0x52, 0x5b, 0xb7, 0x84, 0xd5, 0x23, 0xcd, 0x09, 0x29, 0x09, 0x93, 0x0b, 0x95, 0x03, 0x6f, 0x02, 0xed, 0x01, 0x73, 0x0b, 0x52, 0x0b, 0xd4, 0x13, 0x10, 0x1b, 0xb0, 0x02, 0xcd, 0x09, 0xac, 0x09, 0x4f, 0x02, 0xee, 0x01, 0x2b, 0x09, 0xae, 0x31, 0xea, 0x20, 0xea, 0x10, 0xcd, 0x09, 0xad, 0x09, 0x2a, 0x01, 0xae, 0x09, 0x0d, 0x29, 0x2b, 0x11, 0xcf, 0x09, 0xae, 0x01, 0x6b, 0x01, 0x8d, 0x01, 0x2f, 0x02, 0x6c, 0x09, 0x2a, 0x09, 0xcd, 0x01, 0xed, 0x01, 0x4c, 0x09, 0xad, 0x01, 0x4c, 0x01, 0xc8, 0x00, 0x0a, 0x01, 0x0a, 0x01, 0xc8, 0x00, 0x2b, 0x01, 0x8c, 0x09, 0x4b, 0x01, 0x09, 0x01, 0xc9, 0x00, 0xe9, 0x00, 0x09, 0x01, 0x6c, 0x09, 0xc9, 0x00, 0x0a, 0x01, 0xa8, 0x00, 0x8d, 0x09, 0xe9, 0x00, 0x0a, 0x01, 0xe9, 0x00, 0xe9, 0x00, 0x2a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x2a, 0x01, 0xea, 0x00, 
-  0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0x88, 0x00, 0xa9, 0x08, 0xea, 0x00, 0xa8, 0x00, 0x88, 0x08, 0x0b, 0x09, 0x6c, 0x09, 0x4b, 0x01, 0xc8, 0x00, 0xc9, 0x08, 0x6c, 0x09, 0xa8, 0x00, 0x87, 0x00, 0x6c, 0x01, 0xc8, 0x00, 0x6f, 0x09, 0x89, 0x08, 0xc9, 0x00, 0x0a, 0x01, 0x4b, 0x01, 0xe8, 0x08, 0x4c, 0x09, 0x2b, 0x01, 0x92, 0x12, 0xa7, 0x00, 0x0a, 0x09, 0xc9, 0x00, 0xc9, 0x08, 0xce, 0x11, 0xa7, 0x00, 0x4b, 0x09, 0x0e, 0x12, 0x2b, 0x01, 0xea, 0x00, 0x4a, 0x01, 0x0e, 0x02, 0x0a, 0x01, 0x50, 0x12, 0xac, 0x01, 0x6c, 0x01, 0xcd, 0x01, 0x6b, 0x01, 0xed, 0x09, 0xcc, 0x01, 0x4a, 0x01, 0x6b, 0x01, 0xcc, 0x11, 0xcc, 0x09, 0x6a, 0x09, 0xac, 0x09, 0x0d, 0x0a, 0xee, 0x1a, 0x6d, 0x1a, 0x53, 0x0b, 0x8e, 0x02, 0xcc, 0x09, 0x6c, 0x32, 0x14, 0x3c, 0xec, 0x09, 0xcb, 0xfc, 0xb2, 0x9c, 0xab, 0x42, 0x2f, 0xfd, 0xcf, 0xdc, 0xef, 0xfc, 0x91, 0xe4, 0xd3, 0xe4, 0x12, 0xe5, 0x12, 0xfd, 0x33, 0xfd, 0x13, 0xfd, 0xf3, 0xfc, 0x93, 0xe4, 0xf3, 0xf4, 0x70, 0xa3, 0x8f, 0x7b, 0xd3, 0xa3, 0x75, 0xa4, 0x6c, 0x19, 0x8b, 0x01, 0xad, 0x09, 0x4f, 0x02, 0x0d, 0x02, 0x4e, 0x02, 0xcd, 0x01, 0x6a, 0x01, 0xb0, 0x0a, 0xf1, 0x0a, 0x8b, 0x09, 0x4e, 0x02, 0x90, 0x02, 0x6f, 0x02, 0xcc, 0x01, 0xed, 0x09, 0xf0, 0x02, 0xad, 0x09, 0xcd, 0x01, 0xcd, 0x09, 0x2b, 0x01, 0x4b, 0x11, 0xca, 0x08, 0xac, 0x01, 0x4b, 0x09, 0xed, 0x01, 0xad, 0x09, 0x0e, 0x0a, 0xad, 0x01, 0xee, 0x01, 0x09, 0x09, 0x8c, 0x01, 0xcd, 0x09, 0x6b, 0x01, 0x09, 0x01, 0x8d, 0x01, 0x2a, 0x01, 0x8c, 0x09, 0xc9, 0x00, 0x0b, 0x01, 0xae, 0x01, 0x4c, 0x09, 0x0a, 0x01, 0xea, 0x08, 0xa9, 0x00, 0xce, 0x01, 0xc9, 0x00, 0x0b, 0x01, 0xc8, 0x08, 0xa8, 0x00, 0xa8, 0x00, 0x2b, 0x01, 0x4b, 0x01, 0xa8, 0x00, 0x0b, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0xea, 0x00, 0xea, 0x00, 0xe9, 0x00, 0x4b, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0b, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x2a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 
-  0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xc9, 0x00, 0xa8, 0x00, 0x88, 0x00, 0x6c, 0x09, 0xca, 0x00, 0xca, 0x00, 0xa9, 0x08, 0xca, 0x00, 0x2c, 0x01, 0xea, 0x00, 0x88, 0x00, 0xc9, 0x00, 0xcb, 0x08, 0xea, 0x00, 0x88, 0x00, 0x0b, 0x01, 0xc9, 0x08, 0xea, 0x08, 0xad, 0x09, 0xc8, 0x08, 0xc8, 0x08, 0xc9, 0x08, 0x2e, 0x02, 0xa8, 0x08, 0xe9, 0x08, 0x8d, 0x01, 0x67, 0x00, 0x88, 0x00, 0xe9, 0x00, 0xc8, 0x00, 0x0b, 0x01, 0xc8, 0x00, 0xa8, 0x00, 0x4b, 0x09, 0xce, 0x09, 0xc9, 0x00, 0x0b, 0x01, 0x0f, 0x0a, 0x0a, 0x09, 0xad, 0x01, 0x0e, 0x02, 0x4a, 0x01, 0x2f, 0x0a, 0xcd, 0x09, 0xcc, 0x09, 0x29, 0x01, 0x8b, 0x01, 0xad, 0x01, 0xca, 0x08, 0x08, 0x09, 0x8a, 0x01, 0x8a, 0x01, 0x49, 0x09, 0xcc, 0x11, 0x4e, 0x02, 0xcf, 0x02, 0x11, 0x0b, 0x8b, 0x11, 0x12, 0x23, 0xec, 0x19, 0xf0, 0x0a, 0x0b, 0x1a, 0x2f, 0x0a, 0x69, 0x09, 0x0e, 0xcd, 0xec, 0x11, 0x2c, 0x22, 0x72, 0xed, 0x12, 0xc4, 0x50, 0xe4, 0xb1, 0xfc, 0x70, 0xf4, 0x13, 0xfd, 0x51, 0xe4, 0xd4, 0xdc, 0xd1, 0xec, 0x55, 0xfd, 0x94, 0xcc, 0x51, 0x83, 0xaa, 0x19, 0x6b, 0x11, 0x29, 0x09, 0xcc, 0x01, 0x09, 0x01, 0xf0, 0x02, 0x8f, 0x0a, 0x0e, 0x0a, 0xcc, 0x01, 0xec, 0x01, 0xcc, 0x01, 0xcf, 0x02, 0xed, 0x01, 0xac, 0x09, 0xab, 0x09, 0x0d, 0x0a, 0xce, 0x09, 0xab, 0x01, 0x6b, 0x01, 0x2a, 0x01, 0x09, 0x01, 0xac, 0x09, 0x8d, 0x09, 0xce, 0x09, 0x0a, 0x01, 0xee, 0x01, 0x8c, 0x09, 0x6b, 0x01, 0xcd, 0x01, 0xed, 0x01, 0x6c, 0x09, 0xe9, 0x00, 0x8c, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0xae, 0x01, 0x0a, 0x01, 0xac, 0x09, 0x0a, 0x09, 0x8b, 0x01, 0x0e, 0x0a, 0x6c, 0x01, 0x09, 0x01, 0xe9, 0x00, 0xea, 0x00, 0x0b, 0x01, 0x2b, 0x01, 0xc9, 0x00, 0xe9, 0x00, 0xc8, 0x00, 0x6c, 0x09, 0x4c, 0x01, 0x0a, 0x01, 0x2a, 0x01, 0xea, 0x00, 0xe9, 0x08, 0x4c, 0x01, 0xc8, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0x2b, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0b, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 
-  0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0x88, 0x08, 0xa9, 0x00, 0x0b, 0x09, 0xea, 0x00, 0xc9, 0x08, 0xa9, 0x00, 0xc9, 0x08, 0x2b, 0x01, 0xaa, 0x00, 0xc8, 0x00, 0xca, 0x00, 0xc9, 0x00, 0x6d, 0x09, 0xa8, 0x08, 0xca, 0x08, 0xa8, 0x00, 0xa8, 0x00, 0x6c, 0x01, 0xc9, 0x00, 0x87, 0x08, 0xe9, 0x00, 0x6c, 0x09, 0x2a, 0x09, 0x87, 0x08, 0x0a, 0x09, 0x2a, 0x09, 0xa9, 0x00, 0x2a, 0x01, 0x8c, 0x09, 0x6b, 0x11, 0x2b, 0x01, 0x87, 0x00, 0xa7, 0x00, 0x4c, 0x01, 0x6c, 0x01, 0xad, 0x01, 0x8d, 0x01, 0xac, 0x01, 0x8d, 0x09, 0x8c, 0x01, 0x0a, 0x01, 0x4a, 0x01, 0x6e, 0x02, 0x6b, 0x09, 0xe8, 0x00, 0x0a, 0x09, 0x8c, 0xf1, 0x92, 0xc3, 0xa8, 0x08, 0x09, 0x09, 0x48, 0x11, 0x28, 0x09, 0x8a, 0x09, 0x2a, 0x09, 0x4a, 0x09, 0x8f, 0x12, 0xac, 0x11, 0xe9, 0x08, 0xcb, 0x09, 0x6b, 0x01, 0x6f, 0x0a, 0xf1, 0x0a, 0xe6, 0x00, 0x28, 0x01, 0xb1, 0x0b, 0x4a, 0x11, 0xad, 0x4a, 0x07, 0x01, 0xb1, 0x9c, 0x8e, 0xfc, 0xae, 0xfc, 0xef, 0xfc, 0xd3, 0xdc, 0x52, 0xe4, 0x70, 0xec, 0x6f, 0xec, 0x0d, 0x0a, 0x69, 0x09, 0xaa, 0x09, 0x2e, 0x02, 0xab, 0x01, 0xac, 0x11, 0x8f, 0x02, 0xaf, 0x0a, 0xec, 0x11, 0x6e, 0x12, 0x2c, 0x02, 0x6e, 0x02, 0x8c, 0x11, 0x0e, 0x0a, 0x6a, 0x09, 0xac, 0x01, 0xce, 0x09, 0x4a, 0x09, 0xac, 0x01, 0x49, 0x09, 0xe9, 0x40, 0x6f, 0xca, 0x0c, 0x01, 0x90, 0xdb, 0x4b, 0x19, 0x09, 0x01, 0x4a, 0x01, 0x2b, 0x09, 0x8c, 0x01, 0xcd, 0x09, 0x2a, 0x09, 0x8b, 0x01, 0x0a, 0x01, 0x4a, 0x09, 0x6b, 0x01, 0x09, 0x01, 0x8c, 0x09, 0x2b, 0x01, 0x2a, 0x01, 0xc8, 0x00, 0x4b, 0x01, 0x0a, 0x01, 0x6c, 0x01, 0x0a, 0x01, 0x09, 0x01, 0xc9, 0x00, 0x0a, 0x01, 0x4b, 0x01, 0x2b, 0x01, 0x0a, 0x09, 0xc8, 0x00, 0xad, 0x09, 0xad, 0x01, 0x0a, 0x01, 0xe9, 0x00, 0x0a, 0x09, 0x4b, 0x01, 0xe9, 0x08, 0x0a, 0x01, 0x4c, 0x01, 0xa8, 0x08, 0x2b, 0x01, 0x2b, 0x01, 0x0b, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 
-  0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xca, 0x00, 0x0b, 0x11, 0xa8, 0x08, 0x88, 0x10, 0x87, 0x08, 0x66, 0x00, 0xa7, 0x08, 0x67, 0x08, 0x2b, 0x11, 0x87, 0x08, 0xa7, 0x00, 0xc9, 0x08, 0x2a, 0x09, 0xa8, 0x00, 0x86, 0x00, 0x87, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0x0a, 0x01, 0xea, 0x00, 0x8a, 0x08, 0x4d, 0x01, 0xa8, 0x00, 0xa9, 0x08, 0xce, 0x09, 0xc8, 0x08, 0x0a, 0x01, 0x2b, 0x09, 0x6c, 0x01, 0x86, 0x00, 0xa7, 0x00, 0x4a, 0x01, 0xe8, 0x08, 0x09, 0x01, 0x29, 0x01, 0x2a, 0x01, 0x4b, 0x01, 0xed, 0x09, 0x4a, 0x09, 0x8a, 0x11, 0x29, 0x09, 0xcc, 0x01, 0xe8, 0x08, 0x4c, 0x71, 0xc9, 0x60, 0xeb, 0x78, 0xe9, 0x70, 0x4c, 0xb1, 0x8a, 0x81, 0x2b, 0x79, 0x0d, 0xd2, 0x6e, 0xd2, 0xe8, 0x08, 0x08, 0x01, 0xc6, 0x00, 0x8b, 0x01, 0xac, 0x09, 0x0d, 0x0a, 0xee, 0x32, 0x09, 0x09, 0x29, 0x01, 0xeb, 0x09, 0x90, 0xe3, 0x08, 0x29, 0xcd, 0xc1, 0x89, 0x21, 0x48, 0x29, 0x69, 0x01, 0xee, 0x11, 0xec, 0xf3, 0xc7, 0x68, 0x0a, 0xb1, 0xec, 0xe1, 0x4f, 0xfc, 0xee, 0x7a, 0x49, 0x09, 0xac, 0x09, 0xaa, 0x09, 0x66, 0x08, 0x6d, 0xa2, 0xb0, 0xbb, 0x09, 0x09, 0x28, 0x01, 0xcc, 0x09, 0x8a, 0x09, 0xed, 0x11, 0x09, 0x09, 0xcd, 0xc9, 0x8b, 0x51, 0x6b, 0x09, 0xcc, 0x09, 0x09, 0x09, 0x6a, 0x09, 0x29, 0x01, 0x87, 0x08, 0x6a, 0x80, 0xea, 0x68, 0x2b, 0xd1, 0x6f, 0xfb, 0xcb, 0xa0, 0xcd, 0x99, 0x09, 0x01, 0x6a, 0x01, 0xea, 0x10, 0x4b, 0x11, 0x08, 0x19, 0x2d, 0x1a, 0xc9, 0x00, 0x4b, 0x09, 0xef, 0x99, 0x90, 0xb2, 0x4b, 0x01, 0x88, 0x10, 0x6c, 0x09, 0x6b, 0x09, 0x0a, 0x01, 0x6b, 0x01, 0xe9, 0x00, 0x4b, 0x01, 0x2b, 0x01, 0xa7, 0x00, 0xed, 0x09, 0x0b, 0x01, 0xc9, 0x00, 0xc9, 0x00, 0xc9, 0x00, 0x6c, 0x01, 0x6c, 0x09, 0x0a, 0x01, 0xc9, 0x08, 0x0a, 0x01, 0xea, 0x00, 0xc9, 0x00, 0xae, 0x09, 0x0b, 0x09, 0x09, 0x01, 0x2b, 0x01, 0x2b, 0x01, 0x0b, 0x01, 0x0b, 0x01, 0x0b, 0x01, 0x0b, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 
-  0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xea, 0x00, 0xc9, 0x00, 0xca, 0x00, 0xca, 0x08, 0xaa, 0x00, 0xca, 0x08, 0xca, 0x00, 0xaa, 0x00, 0xaa, 0x08, 0x89, 0x10, 0x89, 0x10, 0x89, 0x10, 0x89, 0x08, 0x89, 0x08, 0x68, 0x08, 0x88, 0x08, 0x68, 0x10, 0x68, 0x10, 0x68, 0x18, 0x88, 0x10, 0x88, 0x10, 0x88, 0x18, 0x88, 0x18, 0x88, 0x18, 0x88, 0x18, 0x88, 0x18, 0x88, 0x20, 0x88, 0x20, 0x88, 0x28, 0x88, 0x28, 0x88, 0x30, 0x88, 0x38, 0xa8, 0x40, 0xc8, 0x50, 0xe8, 0x58, 0xe8, 0x60, 0xe9, 0x70, 0x29, 0x81, 0x4a, 0x91, 0x6a, 0xa1, 0xea, 0xb1, 0x0b, 0xc2, 0x0b, 0xca, 0x4b, 0xd2, 0xab, 0xda, 0xcc, 0xea, 0x6d, 0xe3, 0x0c, 0xf3, 0x4d, 0xfb, 0x4b, 0xfb, 0x4c, 0xfc, 0xce, 0xfb, 0x2d, 0xfc, 0xcc, 0xfb, 0xad, 0xfb, 0xed, 0xfb, 0x2e, 0xfc, 0x2d, 0xfc, 0x0e, 0xfc, 0x0c, 0xfc, 0xee, 0xfb, 0x2e, 0xfc, 0x4d, 0xfc, 0xcc, 0xfb, 0x0e, 0xfc, 0x2e, 0xfc, 0x4d, 0xfc, 0xad, 0xfb, 0x8a, 0xba, 0x8d, 0xfb, 0x6e, 0xe3, 0x6b, 0xfb, 0xac, 0xda, 0x8c, 0xc2, 0xac, 0xf2, 0xca, 0xa9, 0x2d, 0xeb, 0x6d, 0xfb, 0x2f, 0xfc, 0x8d, 0xeb, 0x6c, 0xf3, 0x8d, 0xe2, 0xca, 0xb1, 0x89, 0xa2, 0xaa, 0x9a, 0x2e, 0xfc, 0x0c, 0xf4, 0xaa, 0xd2, 0xcb, 0xc2, 0x27, 0x59, 0x8b, 0xb2, 0xce, 0xd3, 0x4d, 0xc3, 0xeb, 0x9a, 0xab, 0x8a, 0xce, 0xb3, 0x49, 0xd2, 0x8e, 0xf3, 0x4f, 0xf3, 0x2e, 0xeb, 0xce, 0xf2, 0xed, 0xea, 0xcd, 0xd2, 0x6e, 0xeb, 0x6c, 0xfb, 0x69, 0x49, 0x6a, 0x39, 0xee, 0x99, 0x0b, 0x71, 0x29, 0x29, 0x2b, 0x81, 0xab, 0x90, 0x8c, 0x88, 0xaf, 0xb9, 0x4b, 0x90, 0xab, 0x80, 0x0c, 0x31, 0xc9, 0x10, 0x2b, 0x09, 0x0b, 0x09, 0xc9, 0x08, 0xca, 0x08, 0xc9, 0x08, 0x0a, 0x01, 0xe9, 0x00, 0xc9, 0x00, 0xea, 0x08, 0xea, 0x08, 0x2b, 0x01, 0x2c, 0x09, 0xea, 0x08, 0xca, 0x08, 0x6d, 0x09, 0x2b, 0x09, 0xeb, 0x08, 0x0b, 0x01, 0x0a, 0x01, 0x2a, 0x01, 0x0a, 0x01, 0x0b, 0x01, 0x0b, 0x01, 0x0b, 0x01, 0x0b, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 
-  0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xaa, 0x00, 0xca, 0x08, 0xcb, 0x10, 0xab, 0x18, 0xab, 0x28, 0xab, 0x28, 0x8a, 0x30, 0x6a, 0x40, 0x8b, 0x40, 0x8a, 0x38, 0xab, 0x40, 0xab, 0x40, 0x8b, 0x48, 0x8b, 0x48, 0x8b, 0x48, 0x8c, 0x50, 0x8c, 0x50, 0x8c, 0x50, 0x8c, 0x50, 0x8b, 0x50, 0x8b, 0x50, 0xac, 0x50, 0xcc, 0x50, 0xcc, 0x58, 0xcc, 0x58, 0xcc, 0x60, 0xad, 0x60, 0xad, 0x68, 0xcd, 0x68, 0xad, 0x68, 0xcd, 0x70, 0xcd, 0x70, 0xcd, 0x70, 0xad, 0x78, 0xad, 0x80, 0xcd, 0x80, 0xcd, 0x88, 0xcd, 0x88, 0xed, 0x88, 0xed, 0x88, 0xec, 0x88, 0xec, 0x88, 0x0c, 0x91, 0xec, 0x90, 0xec, 0x90, 0x0c, 0x99, 0x2c, 0x99, 0x2c, 0x91, 0x2c, 0x99, 0x4c, 0x99, 0x4c, 0x99, 0x6c, 0xa1, 0x8b, 0xa1, 0x8b, 0xa1, 0xcb, 0xa9, 0xec, 0xa9, 0x2c, 0xb2, 0x0b, 0xb2, 0x2c, 0xb2, 0x0b, 0xba, 0x2c, 0xc2, 0x0c, 0xba, 0x2a, 0xca, 0x0b, 0xca, 0x0c, 0xda, 0xc9, 0xc9, 0xea, 0xb1, 0xa9, 0x89, 0x0c, 0xaa, 0xea, 0xa9, 0xac, 0xb1, 0xac, 0xa1, 0xca, 0x91, 0xec, 0xa9, 0x0c, 0xb2, 0x4d, 0xba, 0x2c, 0xba, 0xec, 0xa1, 0xeb, 0xb1, 0x4c, 0xba, 0xad, 0xba, 0x0c, 0xba, 0xae, 0xba, 0x4d, 0xd2, 0x8d, 0xc2, 0x2c, 0xba, 0x4d, 0xba, 0x0c, 0xb2, 0xcd, 0xb1, 0x0d, 0xaa, 0x8c, 0xa9, 0xcc, 0xa9, 0xec, 0xa9, 0xac, 0xa1, 0xad, 0xa1, 0x8c, 0xa1, 0xab, 0xa1, 0x8b, 0xa1, 0x8b, 0xa1, 0x8c, 0xa9, 0x6c, 0xa1, 0x6c, 0xa1, 0x6c, 0x99, 0x2c, 0xa1, 0x2c, 0x91, 0x6c, 0x91, 0x2c, 0x91, 0x6c, 0x89, 0x2c, 0x89, 0x2d, 0x91, 0x0c, 0x99, 0x0d, 0x99, 0x0d, 0x99, 0x0c, 0xa1, 0x0c, 0x99, 0x0c, 0x99, 0x2c, 0x99, 0x2c, 0x91, 0x0d, 0x91, 0x2d, 0x91, 0xcd, 0x98, 0xee, 0x98, 0x0e, 0x99, 0xed, 0xa0, 0x0c, 0xa1, 0x4c, 0x91, 0x2c, 0x89, 0x2c, 0x89, 0x0b, 0x89, 0x0c, 0x79, 0x2b, 0x71, 0x2b, 0x61, 0x2b, 0x51, 0x0a, 0x11, 0x2c, 0x09, 0x0b, 0x09, 0x0b, 0x01, 0xeb, 0x08, 0x2b, 0x01, 0x0a, 0x01, 0x0b, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0xea, 0x00, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 
-  0xa9, 0x00, 0x88, 0x00, 0x88, 0x08, 0x88, 0x08, 0xa8, 0x00, 0x88, 0x08, 0x88, 0x08, 0x88, 0x08, 0xa9, 0x08, 0xaa, 0x08, 0xa9, 0x08, 0xaa, 0x10, 0xca, 0x18, 0xaa, 0x28, 0xca, 0x30, 0xaa, 0x38, 0xaa, 0x40, 0xaa, 0x40, 0xaa, 0x40, 0xaa, 0x48, 0xcb, 0x50, 0xcb, 0x50, 0xcb, 0x50, 0xab, 0x50, 0xab, 0x50, 0x8b, 0x50, 0xab, 0x50, 0xab, 0x58, 0x8c, 0x60, 0x8c, 0x60, 0x8c, 0x68, 0x8c, 0x68, 0xad, 0x68, 0xad, 0x70, 0xad, 0x78, 0xae, 0x80, 0xae, 0x80, 0xae, 0x88, 0xee, 0x80, 0xee, 0x80, 0xec, 0x88, 0xeb, 0x88, 0xec, 0x80, 0xed, 0x80, 0xec, 0x80, 0x0c, 0x81, 0x2c, 0x89, 0x2d, 0x91, 0x2d, 0x99, 0x4d, 0xa1, 0x4c, 0xa1, 0x4d, 0xa9, 0x4c, 0xb1, 0xac, 0xc1, 0xec, 0xc9, 0x4d, 0xd2, 0x4c, 0xda, 0x8d, 0xe2, 0x8c, 0xe2, 0xad, 0xe2, 0xed, 0xe2, 0xac, 0xea, 0xed, 0xf2, 0x0d, 0xf3, 0x2d, 0xe3, 0x0c, 0xe3, 0x4c, 0xf3, 0x8c, 0xf3, 0x8c, 0xfb, 0x6b, 0xfb, 0xed, 0xeb, 0x2d, 0x93, 0x88, 0x11, 0xac, 0x62, 0x2b, 0x3a, 0xc9, 0x29, 0x8d, 0xe4, 0xac, 0x21, 0x0d, 0x2a, 0xb0, 0xec, 0xee, 0xfc, 0x0e, 0xbb, 0x4d, 0x92, 0x4f, 0xc3, 0x50, 0xd4, 0xb1, 0xdc, 0xcb, 0x01, 0x29, 0x11, 0x0b, 0x6a, 0x28, 0x01, 0x4e, 0x92, 0x2d, 0xaa, 0xe5, 0x08, 0x4a, 0x01, 0xab, 0x11, 0xcb, 0x69, 0x08, 0x09, 0x6b, 0x09, 0xab, 0x01, 0x8b, 0x09, 0x8a, 0x01, 0x2a, 0x09, 0xe8, 0x00, 0x08, 0x01, 0xe9, 0x08, 0x08, 0x01, 0xae, 0x71, 0x6d, 0x51, 0xad, 0x89, 0x6e, 0xb2, 0xec, 0x81, 0x29, 0x19, 0xe8, 0x00, 0x29, 0x01, 0x8a, 0x01, 0x2e, 0x62, 0x0c, 0xa2, 0x4e, 0xb2, 0x2e, 0xc2, 0x8c, 0xca, 0x6c, 0xca, 0x4c, 0xca, 0x4c, 0xca, 0x0c, 0xca, 0x2c, 0xc2, 0x0b, 0xc2, 0xca, 0xb9, 0xca, 0xa1, 0xea, 0xa1, 0xaa, 0x89, 0x89, 0x89, 0x89, 0x81, 0x8a, 0x89, 0x6a, 0x89, 0x6a, 0x81, 0x8a, 0x81, 0x8a, 0x81, 0x8a, 0x71, 0x8a, 0x71, 0x6a, 0x61, 0x8a, 0x51, 0x6a, 0x51, 0x4b, 0x49, 0x6b, 0x49, 0x6b, 0x49, 0x2a, 0x49, 0x4b, 0x41, 0x0a, 0x09, 0x0b, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 
-  0xa9, 0x00, 0xa9, 0x00, 0xc9, 0x18, 0xe9, 0x28, 0xea, 0x28, 0xea, 0x38, 0xea, 0x38, 0xea, 0x40, 0xea, 0x48, 0x0c, 0x71, 0x4a, 0x79, 0x6b, 0x89, 0x6c, 0xa1, 0x6b, 0xa9, 0xac, 0xb9, 0xac, 0xc9, 0xac, 0xc9, 0xcc, 0xc9, 0xec, 0xc1, 0xec, 0xc1, 0xec, 0xc1, 0xcc, 0xb9, 0xac, 0xb9, 0xcc, 0xc1, 0xac, 0xb9, 0xac, 0xb1, 0xcc, 0xb1, 0xcc, 0xa9, 0xab, 0xb1, 0x8b, 0xb1, 0x6b, 0xa9, 0x8b, 0xa9, 0x6b, 0xa9, 0x8b, 0xa9, 0xab, 0xa9, 0xab, 0xb1, 0xab, 0xb1, 0xcb, 0xb9, 0xcc, 0xb9, 0xcc, 0xb9, 0xcb, 0xc1, 0x2c, 0xca, 0x2c, 0xca, 0x0c, 0xca, 0x4c, 0xd2, 0x6b, 0xd2, 0x2b, 0xca, 0x0c, 0xd2, 0xcb, 0xc9, 0xcb, 0xc1, 0xeb, 0xc1, 0xeb, 0xc1, 0x0c, 0xca, 0xeb, 0xb1, 0x8a, 0x99, 0x8a, 0x91, 0xaa, 0x89, 0xca, 0x81, 0x0b, 0x8a, 0xaa, 0xa1, 0xaa, 0x99, 0x68, 0x99, 0xcd, 0xc2, 0x8b, 0x89, 0x8a, 0xa2, 0xad, 0xba, 0x8e, 0xd3, 0xae, 0xc3, 0x8f, 0xdc, 0x6e, 0xcc, 0x2e, 0xf5, 0x70, 0xed, 0x90, 0xfd, 0x4e, 0xfd, 0xcd, 0xfc, 0x0d, 0xfd, 0xea, 0xe2, 0x0e, 0xfc, 0x30, 0xfd, 0xd0, 0xfc, 0x6f, 0xec, 0x70, 0xf4, 0x11, 0xfd, 0xd0, 0xfc, 0x50, 0xec, 0xb0, 0xfc, 0xd1, 0x8b, 0x30, 0x43, 0x2d, 0x02, 0x2d, 0x02, 0xab, 0x01, 0x0c, 0x02, 0x4a, 0x09, 0x2d, 0x0a, 0xed, 0x01, 0x2d, 0x02, 0x6e, 0x02, 0x2d, 0x0a, 0xab, 0x01, 0xcd, 0x01, 0xcc, 0x01, 0xcc, 0x01, 0x8b, 0x01, 0x2d, 0x0a, 0x8b, 0x01, 0x09, 0x09, 0xc8, 0x08, 0x90, 0xaa, 0xe8, 0x08, 0xad, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0xed, 0x09, 0xac, 0x01, 0x2b, 0x01, 0xad, 0x09, 0x6d, 0x29, 0x6d, 0x21, 0x8d, 0x09, 0x6d, 0x41, 0x4d, 0x29, 0xae, 0x09, 0x8c, 0x09, 0x6a, 0x29, 0x4a, 0x39, 0x6b, 0x49, 0x8b, 0x49, 0x8b, 0x51, 0xac, 0x59, 0xaa, 0x69, 0xeb, 0x79, 0x0c, 0x7a, 0x0c, 0x7a, 0x0b, 0x7a, 0xcc, 0x71, 0xcc, 0x71, 0xab, 0x69, 0xab, 0x59, 0x8b, 0x51, 0x6b, 0x49, 0x6b, 0x39, 0x6b, 0x41, 0x2b, 0x09, 0xc9, 0x00, 0xc9, 0x00, 0x0a, 0x01, 0x2b, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 
-  0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xaa, 0x00, 0xaa, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xcb, 0x20, 0xaa, 0x08, 0xaa, 0x08, 0x89, 0x08, 0x89, 0x00, 0xaa, 0x00, 0xcb, 0x00, 0xaa, 0x00, 0x2d, 0x09, 0xaa, 0x00, 0x0b, 0x01, 0xca, 0x00, 0xca, 0x00, 0xeb, 0x00, 0xeb, 0x00, 0xca, 0x08, 0xa9, 0x08, 0xca, 0x08, 0xaa, 0x10, 0xeb, 0x10, 0x2b, 0x11, 0x2b, 0x21, 0x0a, 0x29, 0x09, 0x29, 0xe9, 0x20, 0xea, 0x20, 0xea, 0x28, 0x0c, 0x31, 0xeb, 0x30, 0x2b, 0x31, 0x6b, 0x31, 0x8b, 0x39, 0x8c, 0x49, 0xec, 0x61, 0xaa, 0x59, 0xca, 0x69, 0xab, 0x81, 0xec, 0x99, 0xcb, 0x91, 0x0b, 0x92, 0x0b, 0x92, 0x4d, 0x9a, 0x2c, 0xa2, 0x2b, 0xb2, 0x6c, 0xb2, 0xad, 0xc2, 0xcd, 0xca, 0xed, 0xca, 0xec, 0xc2, 0x8f, 0xbb, 0x4c, 0xaa, 0x0b, 0xfb, 0xc9, 0xe2, 0x0a, 0xeb, 0x0e, 0xe5, 0x29, 0x22, 0xac, 0x09, 0x50, 0x6b, 0xd0, 0xa4, 0x2b, 0xb3, 0x2d, 0x83, 0xcb, 0xfb, 0x2d, 0xfd, 0xac, 0xfc, 0xaf, 0xfd, 0x6c, 0xf4, 0x0b, 0xfc, 0x6a, 0xfc, 0x8c, 0xfc, 0x2e, 0xfd, 0xce, 0xfc, 0xaf, 0xfc, 0xaf, 0xfc, 0xf0, 0xfc, 0x32, 0xfd, 0x30, 0xdc, 0x73, 0xfd, 0xf1, 0xc3, 0x14, 0xf5, 0x52, 0xb4, 0xae, 0x2a, 0x4e, 0x1a, 0xb0, 0x0a, 0xf0, 0x0a, 0x8f, 0x0a, 0x8f, 0x12, 0xad, 0x09, 0xab, 0x01, 0x6e, 0x02, 0x6e, 0x02, 0xcc, 0x09, 0xaf, 0x0a, 0xb0, 0x02, 0xed, 0x09, 0x70, 0x0a, 0xd0, 0x02, 0x2e, 0x02, 0xcc, 0x01, 0x6b, 0x01, 0xad, 0x01, 0x8d, 0x01, 0xed, 0x09, 0x8d, 0x11, 0x8c, 0x01, 0xcd, 0x01, 0x0e, 0x02, 0x8d, 0x09, 0x0e, 0x02, 0x2b, 0x09, 0x8f, 0x59, 0x8e, 0x29, 0x6e, 0x51, 0x6d, 0x39, 0x8d, 0x19, 0x8d, 0x01, 0x8c, 0x01, 0x4b, 0x01, 0x0a, 0x01, 0x4b, 0x01, 0x4b, 0x01, 0x2b, 0x01, 0xe9, 0x00, 0x0b, 0x09, 0xec, 0x28, 0xeb, 0x10, 0x6b, 0x01, 0x0a, 0x01, 0x2b, 0x01, 0xe9, 0x00, 0xc8, 0x00, 0xe9, 0x00, 0x4b, 0x01, 0x0a, 0x01, 0x2b, 0x01, 0xc9, 0x00, 0xe9, 0x00, 0x0a, 0x01, 0x0b, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0xea, 0x00, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 
-  0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xc9, 0x00, 0xa9, 0x00, 0xaa, 0x20, 0x8a, 0x10, 0xa9, 0x08, 0xa9, 0x00, 0xa9, 0x00, 0xc9, 0x00, 0xeb, 0x00, 0xea, 0x08, 0x89, 0x00, 0xeb, 0x08, 0xc9, 0x08, 0xea, 0x00, 0x4c, 0x01, 0x6d, 0x01, 0xca, 0x00, 0xea, 0x00, 0xca, 0x00, 0x0b, 0x01, 0x4c, 0x01, 0x4d, 0x11, 0x6d, 0x21, 0x0b, 0x19, 0x0c, 0x11, 0x89, 0x08, 0xa9, 0x00, 0x0a, 0x01, 0x4c, 0x01, 0xad, 0x09, 0x4c, 0x09, 0x4c, 0x29, 0x4e, 0x49, 0x4f, 0x69, 0x6b, 0x09, 0x6d, 0x21, 0x6e, 0x39, 0x4d, 0x51, 0x6c, 0x31, 0x0f, 0x02, 0xae, 0x01, 0x0f, 0x02, 0xad, 0x01, 0x8d, 0x11, 0x6d, 0x21, 0xaf, 0x49, 0x2a, 0x01, 0xcc, 0x01, 0xad, 0x09, 0x0f, 0x0a, 0x2f, 0x63, 0x2a, 0xeb, 0x6a, 0xfb, 0x4d, 0xfc, 0x4e, 0xfd, 0x8a, 0xc2, 0x0e, 0x0b, 0x0d, 0xe4, 0x6d, 0xfc, 0x6c, 0xfc, 0x8c, 0xfc, 0xac, 0xfc, 0xec, 0xfc, 0x30, 0xfe, 0xcc, 0xfc, 0x0b, 0xfd, 0x8d, 0xfd, 0x6d, 0xb4, 0x8b, 0x52, 0x29, 0x11, 0x4a, 0x01, 0x52, 0xdc, 0xb2, 0xec, 0x31, 0xfd, 0xee, 0xcb, 0xae, 0x72, 0x57, 0xfd, 0x15, 0xf5, 0x12, 0xc4, 0xce, 0xa2, 0xd0, 0xbb, 0x34, 0xc4, 0x17, 0xf5, 0x35, 0xbc, 0xb3, 0x03, 0xb3, 0x13, 0x4f, 0x02, 0x53, 0x13, 0x53, 0x1b, 0x32, 0x13, 0xf5, 0x2b, 0x33, 0x0b, 0xd6, 0x43, 0xf1, 0x12, 0xd1, 0x0a, 0xad, 0x01, 0x0e, 0x0a, 0x2e, 0x02, 0x93, 0x0b, 0xf1, 0x02, 0x4e, 0x02, 0xcc, 0x09, 0xac, 0x09, 0x4c, 0x29, 0x6d, 0x39, 0x6c, 0x21, 0x4c, 0x11, 0x6c, 0x01, 0xcd, 0x01, 0xef, 0x09, 0xad, 0x09, 0x2b, 0x31, 0x6e, 0x41, 0x6c, 0x19, 0x4e, 0x51, 0x4e, 0x49, 0x6e, 0x31, 0x4d, 0x19, 0x4c, 0x11, 0x4c, 0x01, 0x4b, 0x01, 0x2b, 0x01, 0x0a, 0x01, 0x0a, 0x11, 0x2b, 0x11, 0xeb, 0x30, 0x6b, 0x01, 0xc9, 0x00, 0x0a, 0x01, 0x0b, 0x01, 0x2b, 0x09, 0xe9, 0x00, 0x2b, 0x09, 0x0a, 0x01, 0xc9, 0x08, 0x0a, 0x01, 0x2b, 0x01, 0x0a, 0x01, 0xea, 0x00, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 
-  0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x08, 0xaa, 0x18, 0xaa, 0x18, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0x0b, 0x09, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xc9, 0x00, 0x0b, 0x01, 0xea, 0x08, 0x0b, 0x01, 0xca, 0x00, 0xab, 0x18, 0x2b, 0x01, 0x2c, 0x01, 0x8d, 0x01, 0x0b, 0x01, 0x0a, 0x01, 0xea, 0x08, 0xeb, 0x10, 0x2c, 0x29, 0xea, 0x08, 0x2b, 0x01, 0x4c, 0x01, 0x4c, 0x11, 0x4d, 0x31, 0x4e, 0x51, 0x4f, 0x79, 0x2c, 0x41, 0x6d, 0x39, 0x8e, 0x49, 0xd0, 0x71, 0x4b, 0x01, 0xd1, 0x02, 0x6c, 0x01, 0x6c, 0x11, 0x4d, 0x29, 0x6c, 0x31, 0x4d, 0x51, 0x4d, 0x59, 0x8b, 0x01, 0x8c, 0x01, 0x4e, 0x0a, 0x6f, 0x02, 0x51, 0x1b, 0x8b, 0xfb, 0x0c, 0xfc, 0xcc, 0xfc, 0xf0, 0xfd, 0xea, 0xea, 0xab, 0xfb, 0xcc, 0xeb, 0xac, 0xfc, 0x28, 0xfb, 0x4b, 0xfc, 0x6e, 0xfd, 0xcf, 0xfd, 0xcc, 0xfc, 0x4d, 0xfd, 0xef, 0xfd, 0xd1, 0xc4, 0x8b, 0x29, 0xab, 0x39, 0x8b, 0x39, 0xcc, 0x29, 0x0c, 0x0a, 0x6a, 0x09, 0xed, 0x69, 0x0f, 0x5a, 0xf2, 0xb3, 0x4d, 0x62, 0x4e, 0x83, 0x14, 0xed, 0x70, 0x9b, 0xd3, 0xdc, 0xd2, 0xf4, 0x33, 0xcc, 0x54, 0xcc, 0x14, 0xf5, 0xd5, 0xd4, 0xb5, 0xf4, 0xb6, 0xec, 0x97, 0xcc, 0x77, 0xfd, 0x7a, 0x8b, 0xbb, 0xbb, 0x58, 0x93, 0xbb, 0x8b, 0x38, 0x5b, 0x98, 0x53, 0x92, 0x0a, 0x33, 0x1b, 0x52, 0x0b, 0xb1, 0x02, 0x70, 0x0a, 0x90, 0x02, 0x90, 0x02, 0xee, 0x01, 0xcd, 0x01, 0x6c, 0x09, 0x4d, 0x49, 0x4d, 0x39, 0x8d, 0x29, 0x4c, 0x19, 0x4b, 0x01, 0x2b, 0x01, 0x0e, 0x02, 0x2b, 0x09, 0x2f, 0x71, 0x6e, 0x31, 0x6d, 0x19, 0x2b, 0x11, 0x6f, 0x51, 0x6d, 0x31, 0x6c, 0x19, 0x4c, 0x09, 0x4b, 0x01, 0x2a, 0x01, 0xe9, 0x00, 0xcb, 0x28, 0xeb, 0x20, 0x2b, 0x01, 0xe9, 0x00, 0x0a, 0x01, 0x0a, 0x01, 0x0b, 0x01, 0x0b, 0x01, 0x0a, 0x09, 0xea, 0x00, 0xa8, 0x00, 0x2b, 0x01, 0x2b, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 
-  0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0x89, 0x10, 0x8a, 0x10, 0x88, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xca, 0x00, 0xa8, 0x00, 0x0a, 0x09, 0x2b, 0x09, 0xa8, 0x00, 0xc8, 0x00, 0xeb, 0x10, 0xeb, 0x20, 0x2c, 0x19, 0x0c, 0x21, 0xc9, 0x00, 0x2b, 0x09, 0xca, 0x10, 0x0e, 0x51, 0x8e, 0x39, 0x0a, 0x01, 0x2b, 0x01, 0x2c, 0x11, 0x4d, 0x31, 0x8f, 0x49, 0x70, 0x79, 0xd1, 0xa1, 0x4e, 0x59, 0x90, 0x79, 0x4b, 0x09, 0x10, 0x02, 0x91, 0x02, 0x6d, 0x19, 0x4c, 0x31, 0x6d, 0x49, 0x6e, 0x59, 0x8f, 0x89, 0x0a, 0x09, 0x8c, 0x01, 0xcd, 0x09, 0x4f, 0x02, 0xb0, 0x02, 0x32, 0x0b, 0xad, 0xdc, 0x6c, 0xfd, 0xaf, 0xfd, 0x2a, 0xdb, 0x2c, 0xfb, 0x8a, 0xfb, 0x8b, 0xfc, 0xce, 0xed, 0x69, 0xfb, 0x2c, 0xfd, 0xec, 0xfc, 0x6d, 0xfd, 0xae, 0xfd, 0x91, 0xfe, 0x48, 0x39, 0x6b, 0x41, 0xcf, 0x69, 0x2f, 0x6a, 0xcd, 0x61, 0x0d, 0x5a, 0xac, 0x39, 0x2d, 0x2a, 0xf1, 0x0a, 0xf0, 0x02, 0x2e, 0x83, 0x71, 0x9b, 0xf2, 0xd4, 0x94, 0xcc, 0xae, 0x7a, 0xb2, 0xdc, 0x36, 0xe5, 0x55, 0xf5, 0x51, 0x9b, 0x76, 0xe4, 0xd5, 0xdc, 0x57, 0xf5, 0x76, 0xd4, 0xd7, 0xd4, 0x76, 0xed, 0x75, 0xfd, 0x95, 0xec, 0xb7, 0xfd, 0x98, 0xd4, 0x3a, 0xc4, 0xf9, 0xb3, 0xda, 0x93, 0xf9, 0xab, 0x3c, 0xb4, 0xdd, 0xa4, 0x7c, 0x7c, 0x73, 0x0b, 0x2f, 0x02, 0xed, 0x01, 0xd1, 0x02, 0x2f, 0x02, 0xd1, 0x02, 0x2f, 0x02, 0x8c, 0x09, 0x6f, 0x69, 0x6d, 0x41, 0x4c, 0x29, 0x4c, 0x19, 0x4b, 0x09, 0x4c, 0x01, 0xae, 0x09, 0x0a, 0x01, 0x8e, 0x51, 0x4d, 0x31, 0x4c, 0x11, 0x2e, 0x61, 0x4d, 0x31, 0x4c, 0x19, 0x4c, 0x09, 0x2b, 0x01, 0x0a, 0x09, 0xea, 0x18, 0x2a, 0x01, 0x6c, 0x01, 0x4c, 0x01, 0xea, 0x00, 0xe9, 0x00, 0x4b, 0x09, 0x0a, 0x01, 0xa8, 0x08, 0xc8, 0x00, 0x0a, 0x09, 0x0b, 0x01, 0x2a, 0x01, 0xea, 0x00, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 
-  0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0x68, 0x08, 0x89, 0x00, 0x88, 0x00, 0xa9, 0x00, 0xa8, 0x00, 0xa9, 0x00, 0xa8, 0x00, 0xa9, 0x00, 0xea, 0x00, 0x2b, 0x09, 0x88, 0x00, 0x88, 0x00, 0xa9, 0x00, 0xcc, 0x48, 0xcc, 0x40, 0x88, 0x00, 0xc9, 0x00, 0xeb, 0x10, 0xab, 0x18, 0xed, 0x60, 0xc9, 0x08, 0x0b, 0x01, 0x2c, 0x11, 0x4d, 0x29, 0x4e, 0x49, 0x4e, 0x61, 0x2f, 0x81, 0x0e, 0x59, 0xb1, 0x89, 0xef, 0x09, 0xef, 0x09, 0x4b, 0x19, 0x2c, 0x31, 0x4d, 0x49, 0x6d, 0x51, 0x8f, 0x71, 0xb0, 0xa9, 0x8d, 0x19, 0x0c, 0x11, 0x6c, 0x09, 0x91, 0x02, 0xd2, 0x0a, 0x33, 0x13, 0xf4, 0x1b, 0x6c, 0xfc, 0x4b, 0xda, 0xea, 0xf2, 0x6a, 0xfb, 0x8c, 0xfc, 0x6d, 0xfd, 0xcb, 0xf3, 0xcb, 0xfb, 0xad, 0xfd, 0x29, 0x42, 0xaa, 0x49, 0x69, 0x31, 0x4a, 0x31, 0xed, 0x69, 0x8c, 0x59, 0x4a, 0x41, 0xac, 0x59, 0x0e, 0x6a, 0xce, 0x81, 0x0f, 0x8a, 0xcc, 0x59, 0x2e, 0x6a, 0x10, 0x13, 0xf1, 0x02, 0x2e, 0x5a, 0xd2, 0xcc, 0x51, 0x8b, 0x10, 0xc4, 0x31, 0xa3, 0xf4, 0xd4, 0x36, 0xf5, 0xb2, 0x93, 0x73, 0xed, 0xd6, 0xfd, 0xf5, 0xfd, 0xf4, 0xcc, 0xf6, 0xfd, 0xd7, 0xfd, 0x97, 0xfd, 0xd8, 0xf4, 0x37, 0xf5, 0xb7, 0xfd, 0x35, 0xfd, 0x79, 0xfd, 0x7a, 0xc4, 0xdb, 0xa3, 0x5a, 0xbc, 0xf9, 0xa3, 0xba, 0xc4, 0x9c, 0x93, 0x3b, 0xbc, 0xb2, 0x0a, 0x91, 0x0a, 0xee, 0x09, 0xac, 0x01, 0xcd, 0x09, 0x2b, 0x09, 0x33, 0x03, 0xcd, 0x09, 0x8f, 0x79, 0x6e, 0x59, 0x4d, 0x41, 0x4c, 0x29, 0x4c, 0x21, 0x2b, 0x09, 0xce, 0x09, 0x8d, 0x01, 0xea, 0x08, 0x6e, 0x41, 0x4f, 0x51, 0x2d, 0x41, 0x4c, 0x21, 0x2b, 0x11, 0x2b, 0x09, 0x0a, 0x01, 0xec, 0x48, 0x2b, 0x01, 0x2c, 0x19, 0xa9, 0x00, 0xa8, 0x00, 0xea, 0x00, 0x2b, 0x01, 0xe9, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0x0a, 0x01, 0x0a, 0x01, 0xea, 0x00, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 
-  0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa8, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0x89, 0x00, 0xa9, 0x08, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0x0b, 0x01, 0xea, 0x00, 0x87, 0x00, 0x88, 0x08, 0xa9, 0x00, 0x89, 0x18, 0x8c, 0x40, 0xa9, 0x08, 0x8a, 0x10, 0xab, 0x20, 0xcc, 0x38, 0x2f, 0x79, 0xca, 0x00, 0x0b, 0x09, 0x2b, 0x21, 0x4d, 0x31, 0x2e, 0x59, 0x10, 0x99, 0xcd, 0x70, 0x10, 0xa1, 0x8d, 0x09, 0x0b, 0x21, 0x0c, 0x31, 0x2d, 0x49, 0x2d, 0x51, 0x2e, 0x69, 0x4f, 0x79, 0xd0, 0xb1, 0xeb, 0x20, 0x4d, 0x31, 0x8d, 0x11, 0x4e, 0x12, 0xd2, 0x0a, 0x94, 0x13, 0xb1, 0x4b, 0x8a, 0xfc, 0x4d, 0xfc, 0x4b, 0xfb, 0x4d, 0xfc, 0xae, 0xfd, 0x6a, 0xda, 0xab, 0xfb, 0xac, 0xfc, 0xcf, 0xfd, 0xad, 0x73, 0x8e, 0x79, 0x2f, 0x92, 0x0f, 0x82, 0x8d, 0x69, 0xed, 0x71, 0xce, 0x71, 0x8f, 0x89, 0x2e, 0x62, 0x0e, 0x7a, 0x70, 0x9a, 0x71, 0xaa, 0xae, 0x71, 0xce, 0x59, 0x2e, 0x72, 0xd0, 0x69, 0x74, 0xfd, 0xf1, 0xfc, 0x0a, 0x6a, 0xf4, 0xec, 0x0d, 0x93, 0xd0, 0x8a, 0x72, 0xe4, 0xf2, 0xfc, 0x8d, 0x4a, 0xce, 0x01, 0x70, 0x73, 0x96, 0xfe, 0x95, 0xed, 0x56, 0xf5, 0x76, 0xfd, 0x17, 0xfe, 0xd7, 0xfd, 0xb7, 0xfd, 0x17, 0xf5, 0x76, 0xfd, 0x99, 0xfd, 0x9b, 0xdc, 0x79, 0xcc, 0x7a, 0xcc, 0x5c, 0xbc, 0x5b, 0xbc, 0x5a, 0xc4, 0x99, 0xa3, 0xfc, 0xdc, 0xb2, 0x0a, 0x90, 0x0a, 0x4f, 0x02, 0xcd, 0x01, 0xad, 0x01, 0xee, 0x09, 0x0f, 0x02, 0xac, 0x09, 0x6f, 0x71, 0x6e, 0x49, 0x8d, 0x39, 0x6c, 0x31, 0x2b, 0x29, 0x0b, 0x19, 0x8d, 0x01, 0x6c, 0x01, 0x8e, 0x51, 0x2d, 0x41, 0x2c, 0x31, 0x2b, 0x11, 0x2b, 0x09, 0x0b, 0x11, 0x0c, 0x31, 0x0b, 0x21, 0x88, 0x08, 0xc8, 0x00, 0xc9, 0x00, 0xe9, 0x00, 0x0a, 0x01, 0xea, 0x00, 0xea, 0x00, 0x0a, 0x01, 0xea, 0x00, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0xea, 0x00, 0xea, 0x00, 0xea, 0x00, 0xea, 0x00, 0xea, 0x00, 
-  0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa9, 0x00, 0xa9, 0x00, 0x89, 0x00, 0xa9, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0x88, 0x00, 0x88, 0x08, 0x88, 0x08, 0xea, 0x00, 0x0b, 0x09, 0x88, 0x00, 0x88, 0x08, 0x88, 0x00, 0x48, 0x10, 0x8a, 0x20, 0xab, 0x38, 0xa9, 0x08, 0x8b, 0x38, 0xcc, 0x38, 0xcb, 0x28, 0xca, 0x08, 0x0b, 0x11, 0x0b, 0x21, 0x2d, 0x39, 0xee, 0x68, 0xed, 0x78, 0xcf, 0x90, 0xaa, 0x28, 0xcc, 0x40, 0x0d, 0x49, 0xed, 0x60, 0xee, 0x68, 0x0e, 0x79, 0x0e, 0x89, 0x11, 0xc2, 0xec, 0x38, 0x0b, 0x31, 0x6c, 0x31, 0x0f, 0x0a, 0x32, 0x13, 0x94, 0x0b, 0xcd, 0xfb, 0x8d, 0xfc, 0x8b, 0xfb, 0xeb, 0xfb, 0xce, 0xfc, 0x0b, 0xfc, 0x6a, 0xfb, 0x0d, 0xfd, 0x6f, 0x9c, 0x0f, 0x33, 0x0d, 0x0a, 0x8b, 0x09, 0xed, 0x91, 0x8c, 0x61, 0x6b, 0x51, 0x2f, 0x92, 0x0f, 0x8a, 0xce, 0x81, 0x8d, 0x71, 0xee, 0x79, 0xef, 0x91, 0xee, 0x99, 0x30, 0xa2, 0xcd, 0x71, 0x0f, 0x8a, 0x2f, 0x82, 0x71, 0xe4, 0x31, 0xcc, 0xb2, 0xc4, 0x54, 0xed, 0x72, 0xdc, 0x32, 0xdc, 0x52, 0xac, 0x51, 0x13, 0x8c, 0x0a, 0xaf, 0x0a, 0xb2, 0x23, 0x33, 0x0c, 0xf0, 0x12, 0x2f, 0x13, 0xf7, 0xf5, 0xf5, 0xfd, 0x57, 0xfd, 0xb8, 0xfd, 0xf7, 0xfd, 0xd8, 0xfd, 0x54, 0xac, 0xf8, 0xfd, 0xd8, 0xfd, 0xb9, 0xf5, 0x19, 0xdd, 0x7a, 0xcc, 0xba, 0xe4, 0x9b, 0xcc, 0x9a, 0xe4, 0x9b, 0xcc, 0xb7, 0x53, 0xd2, 0x02, 0x32, 0x0b, 0x0f, 0x02, 0xce, 0x01, 0x0e, 0x0a, 0x8d, 0x09, 0x2e, 0x02, 0x8e, 0x01, 0x6e, 0x29, 0x4f, 0x71, 0x4f, 0x61, 0x2d, 0x49, 0x2c, 0x39, 0x0b, 0x29, 0x0b, 0x21, 0x0b, 0x21, 0xec, 0x48, 0x0c, 0x31, 0x0b, 0x21, 0xea, 0x18, 0xcb, 0x20, 0xec, 0x50, 0xa8, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0xe9, 0x00, 0xe9, 0x00, 0xea, 0x00, 0xea, 0x00, 0x0a, 0x01, 0xea, 0x00, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0x0a, 0x01, 0xe9, 0x00, 0xe9, 0x00, 0xe9, 0x00, 0xe9, 0x00, 0xe9, 0x00, 0xe9, 0x00, 0xe9, 0x00, 0xe9, 0x00, 0xe9, 0x00, 0xe9, 0x00, 
+// 160x80, 22991 bytes (25600 raw)
+const uint8_t Boot_img[] PROGMEM = {
+  0x4f, 0x4d, 0x01, 0x10, 0xa0, 0x00, 0x50, 0x00, 0x00, 0xcc, 0x01, 0x81, 0xec, 0x01, 0x2d, 0x0c, 0x02, 0x0d, 0x02, 0x4e, 0x02, 0x8b, 0x09, 0xec, 0x01, 0x0c, 0x02, 0x2d, 0x02, 0x8e, 0x02, 0x2d,
+  0x02, 0xf0, 0x02, 0x6a, 0x01, 0xcb, 0x01, 0x2d, 0x02, 0x6e, 0x02, 0xcf, 0x02, 0xab, 0x01, 0x2d, 0x02, 0x6e, 0x02, 0x10, 0x03, 0xab, 0x01, 0x2d, 0x02, 0xaa, 0x01, 0xcb, 0x01, 0xae, 0x02, 0x6e,
+  0x02, 0x31, 0x03, 0x72, 0x13, 0x8a, 0x01, 0xec, 0x01, 0x6d, 0x02, 0x4d, 0x02, 0x0d, 0x02, 0x6e, 0x02, 0xcf, 0x0a, 0x4d, 0x02, 0xef, 0x02, 0x91, 0x0b, 0xeb, 0x01, 0xcb, 0x01, 0xec, 0x01, 0x2d,
+  0x02, 0x4d, 0x02, 0xcf, 0x02, 0x2d, 0x02, 0x2d, 0x0a, 0x0c, 0x02, 0x8a, 0x2d, 0x02, 0x83, 0x4d, 0x02, 0x02, 0x6d, 0x02, 0x8e, 0x02, 0x8e, 0x0a, 0x81, 0x6d, 0x02, 0x81, 0x8e, 0x02, 0x04, 0xae,
+  0x02, 0x4d, 0x0a, 0xae, 0x12, 0x8e, 0x02, 0x8d, 0x02, 0x83, 0x8e, 0x02, 0x81, 0xae, 0x02, 0x82, 0x8e, 0x02, 0x02, 0x8d, 0x02, 0x6d, 0x02, 0x8d, 0x0a, 0x81, 0x2c, 0x02, 0x0f, 0x10, 0x94, 0x0c,
+  0x0a, 0x2c, 0x0a, 0xcb, 0x01, 0xeb, 0x01, 0x0b, 0x02, 0x0b, 0x0a, 0x0b, 0x12, 0x2c, 0x22, 0x4c, 0x2a, 0x2c, 0x32, 0x0b, 0x22, 0x2c, 0x32, 0x2c, 0x3a, 0x2c, 0x32, 0x2c, 0x3a, 0x82, 0x2c, 0x42,
+  0x14, 0x4c, 0x4a, 0x4c, 0x52, 0x8d, 0x6a, 0xad, 0x7a, 0x8c, 0x72, 0x6d, 0x6a, 0x2b, 0x62, 0x8d, 0x7a, 0x8d, 0x72, 0x2b, 0x52, 0x4d, 0x6a, 0x6c, 0x7a, 0x6c, 0x72, 0x6c, 0x62, 0x4c, 0x7a, 0x8d,
+  0x8a, 0x4c, 0x6a, 0x6c, 0x6a, 0x6b, 0x72, 0x6c, 0x72, 0x4c, 0x7a, 0x81, 0x6c, 0x7a, 0x04, 0x6c, 0x82, 0x6b, 0x82, 0x8c, 0x8a, 0x6c, 0x7a, 0x4c, 0x7a, 0x81, 0x6c, 0x7a, 0x00, 0x8c, 0x82, 0x83,
+  0x6c, 0x7a, 0x00, 0x8c, 0x7a, 0x81, 0x6c, 0x82, 0x05, 0x8c, 0x7a, 0x6c, 0x7a, 0x8c, 0x82, 0x8d, 0x82, 0x8c, 0x82, 0x6c, 0x82, 0x81, 0x8c, 0x7a, 0x84, 0x8c, 0x82, 0x00, 0xcc, 0x01, 0x81, 0xec,
+  0x01, 0x2c, 0x0c, 0x02, 0x0d, 0x02, 0x6e, 0x0a, 0x8a, 0x01, 0xcb, 0x01, 0xec, 0x01, 0x2d, 0x02, 0x8e, 0x02, 0x2d, 0x02, 0xcf, 0x0a, 0x6a, 0x01, 0xcb, 0x01, 0x2d, 0x02, 0x8f, 0x02, 0xf0, 0x02,
+  0x31, 0x03, 0xec, 0x01, 0x4e, 0x0a, 0xef, 0x02, 0x6b, 0x01, 0xeb, 0x01, 0xab, 0x01, 0x2d, 0x0a, 0xaf, 0x0a, 0x4e, 0x02, 0xef, 0x02, 0xd3, 0x13, 0x8a, 0x01, 0xec, 0x01, 0x0d, 0x02, 0xcf, 0x02,
+  0x6e, 0x0a, 0x31, 0x0b, 0x10, 0x03, 0xaf, 0x12, 0xcf, 0x02, 0x72, 0x03, 0xcb, 0x09, 0x8a, 0x01, 0x0c, 0x02, 0x8e, 0x02, 0xd0, 0x02, 0x31, 0x03, 0x8e, 0x02, 0x2d, 0x02, 0x84, 0x4d, 0x02, 0x83,
+  0x6d, 0x02, 0x81, 0x6e, 0x02, 0x85, 0x8e, 0x02, 0x02, 0xaf, 0x0a, 0xf2, 0x5b, 0xcf, 0x0a, 0x82, 0xae, 0x02, 0x02, 0xd1, 0x02, 0xd0, 0x02, 0x8e, 0x02, 0x83, 0xae, 0x02, 0x84, 0xce, 0x02, 0x82,
+  0xae, 0x02, 0x06, 0xae, 0x12, 0x4d, 0x02, 0x6d, 0x0a, 0x4c, 0x02, 0x6e, 0x02, 0x4e, 0x12, 0xeb, 0x01, 0x81, 0x0b, 0x02, 0x03, 0x0c, 0x02, 0x2c, 0x0a, 0x2c, 0x12, 0x2c, 0x22, 0x81, 0x4c, 0x2a,
+  0x19, 0x2c, 0x2a, 0x4c, 0x3a, 0x6c, 0x42, 0x2c, 0x32, 0x2c, 0x42, 0x6d, 0x52, 0x8d, 0x62, 0xce, 0x7a, 0x4c, 0x6a, 0x6d, 0x72, 0xce, 0x82, 0xee, 0x8a, 0x0e, 0x93, 0xae, 0x82, 0x6c, 0x6a, 0xae,
+  0x72, 0x8c, 0x82, 0xce, 0x8a, 0x8d, 0x7a, 0x6c, 0x7a, 0xce, 0x8a, 0x0b, 0x5a, 0x6d, 0x62, 0x4d, 0x6a, 0x6d, 0x7a, 0xad, 0x82, 0x81, 0x8c, 0x7a, 0x00, 0xac, 0x82, 0x81, 0xac, 0x8a, 0x02, 0x8c,
+  0x8a, 0x8d, 0x8a, 0xad, 0x82, 0x81, 0x8c, 0x8a, 0x02, 0x8c, 0x82, 0x6c, 0x82, 0x8d, 0x82, 0x81, 0x8c, 0x8a, 0x02, 0xac, 0x8a, 0x8c, 0x8a, 0xac, 0x92, 0x8e, 0x8c, 0x8a, 0x82, 0xcc, 0x01, 0x2b,
+  0x0c, 0x02, 0x0d, 0x02, 0x2d, 0x02, 0x8e, 0x02, 0x0d, 0x02, 0xec, 0x01, 0x0c, 0x02, 0x2d, 0x02, 0x8f, 0x0a, 0xcc, 0x01, 0x0c, 0x02, 0x2d, 0x02, 0x6e, 0x02, 0x8e, 0x02, 0xf0, 0x02, 0x51, 0x03,
+  0xd3, 0x1b, 0x2d, 0x0a, 0x8f, 0x02, 0x11, 0x03, 0xd0, 0x0a, 0x8a, 0x01, 0x4d, 0x02, 0x8e, 0x02, 0x10, 0x03, 0xaf, 0x02, 0xb2, 0x1b, 0x2d, 0x02, 0x0c, 0x02, 0x0d, 0x0a, 0xec, 0x01, 0x8e, 0x02,
+  0xf0, 0x02, 0x71, 0x03, 0x6e, 0x0a, 0x6f, 0x0a, 0x31, 0x0b, 0x8a, 0x09, 0xcb, 0x01, 0x2d, 0x02, 0x8e, 0x02, 0xf0, 0x02, 0x10, 0x03, 0x92, 0x1b, 0x82, 0x6d, 0x02, 0x06, 0x6e, 0x02, 0x8e, 0x02,
+  0x6e, 0x02, 0xad, 0x0a, 0xaf, 0x02, 0xae, 0x02, 0x8e, 0x12, 0x81, 0xae, 0x0a, 0x05, 0xaf, 0x0a, 0xae, 0x02, 0x8e, 0x02, 0xae, 0x02, 0xaf, 0x02, 0xcf, 0x0a, 0x81, 0xae, 0x02, 0x01, 0xcf, 0x02,
+  0xce, 0x02, 0x81, 0xcf, 0x02, 0x01, 0xce, 0x02, 0xcf, 0x02, 0x81, 0xce, 0x02, 0x82, 0xcf, 0x02, 0x2b, 0xee, 0x0a, 0xef, 0x0a, 0x0f, 0x0b, 0xef, 0x02, 0xee, 0x12, 0xee, 0x0a, 0xae, 0x02, 0xae,
+  0x0a, 0x6d, 0x0a, 0x6c, 0x02, 0x6d, 0x12, 0x4c, 0x02, 0x2c, 0x0a, 0xeb, 0x01, 0x2c, 0x0a, 0x0c, 0x02, 0x2c, 0x1a, 0xce, 0x42, 0xae, 0x5a, 0xf0, 0x62, 0x4c, 0x3a, 0x2c, 0x1a, 0x4c, 0x2a, 0x4c,
+  0x32, 0x6d, 0x4a, 0x4c, 0x3a, 0x6d, 0x4a, 0xce, 0x6a, 0xae, 0x72, 0x8d, 0x6a, 0x8d, 0x7a, 0xad, 0x82, 0x6d, 0x72, 0x8d, 0x72, 0xad, 0x7a, 0xee, 0x9a, 0x2e, 0x9b, 0xed, 0x8a, 0x6c, 0x72, 0xad,
+  0x7a, 0x0f, 0xa3, 0x8c, 0x82, 0x8d, 0x72, 0x8d, 0x7a, 0x81, 0x8d, 0x82, 0x81, 0xad, 0x8a, 0x0a, 0xad, 0x92, 0xcd, 0x8a, 0xad, 0x92, 0x8c, 0x82, 0xcc, 0x92, 0xcc, 0xa2, 0x6c, 0x82, 0xac, 0x8a,
+  0x8c, 0x92, 0xad, 0x92, 0xad, 0x8a, 0x81, 0xac, 0x92, 0x81, 0xac, 0x9a, 0x03, 0xcd, 0x9a, 0xcc, 0x92, 0x8c, 0x8a, 0xcd, 0x92, 0x83, 0xac, 0x92, 0x01, 0xad, 0x92, 0xac, 0x92, 0x81, 0xad, 0x92,
+  0x81, 0xac, 0x92, 0x81, 0xad, 0x92, 0x02, 0xac, 0x92, 0xac, 0x8a, 0x8c, 0x8a, 0x82, 0xcc, 0x01, 0x2e, 0xec, 0x01, 0x0c, 0x02, 0x2d, 0x02, 0x4e, 0x0a, 0xd0, 0x0a, 0xab, 0x01, 0xcc, 0x01, 0x2d,
+  0x02, 0x4d, 0x02, 0x6e, 0x02, 0xf0, 0x0a, 0x2d, 0x02, 0xaf, 0x0a, 0x2d, 0x02, 0xd0, 0x02, 0xf0, 0x02, 0x51, 0x13, 0x0d, 0x02, 0xaf, 0x02, 0xf1, 0x02, 0xd3, 0x0b, 0x8a, 0x01, 0x2d, 0x02, 0xaf,
+  0x02, 0xf0, 0x02, 0x71, 0x03, 0x14, 0x24, 0x31, 0x0b, 0xd2, 0x0b, 0xcb, 0x01, 0x0c, 0x02, 0x4d, 0x02, 0xcf, 0x02, 0xd0, 0x02, 0x31, 0x0b, 0x10, 0x13, 0xcf, 0x02, 0x31, 0x0b, 0xcb, 0x01, 0x2d,
+  0x0a, 0xaf, 0x02, 0xcf, 0x02, 0x10, 0x03, 0xd2, 0x03, 0xec, 0x11, 0x2d, 0x02, 0xae, 0x02, 0x81, 0x8e, 0x02, 0x07, 0xae, 0x02, 0x8f, 0x12, 0xcd, 0x0a, 0x2f, 0xf3, 0x8f, 0x0a, 0x6b, 0x2a, 0x10,
+  0x95, 0xad, 0x02, 0x87, 0xcf, 0x02, 0x00, 0xef, 0x0a, 0x82, 0xef, 0x02, 0x00, 0xcf, 0x02, 0x85, 0xef, 0x02, 0x06, 0x2f, 0x13, 0x2f, 0x03, 0x0f, 0x03, 0xf0, 0x0a, 0xef, 0x0a, 0xce, 0x0a, 0x8d,
+  0x02, 0x81, 0x6d, 0x0a, 0x38, 0x6c, 0x02, 0xae, 0x12, 0x0b, 0x02, 0x2c, 0x02, 0x2c, 0x1a, 0x8e, 0x4a, 0x8e, 0x52, 0x8d, 0x4a, 0x6d, 0x52, 0x8e, 0x62, 0xce, 0x72, 0xad, 0x7a, 0x2f, 0x8b, 0x8d,
+  0x5a, 0x2c, 0x42, 0xae, 0x5a, 0x8d, 0x62, 0xad, 0x72, 0xee, 0x8a, 0x50, 0xa3, 0xad, 0x6a, 0xad, 0x62, 0x8d, 0x6a, 0x2c, 0x62, 0xae, 0x6a, 0xcf, 0x82, 0x4c, 0x62, 0x6b, 0x5a, 0x8d, 0x5a, 0x8e,
+  0x6a, 0xcd, 0x72, 0xac, 0x7a, 0xad, 0x7a, 0xad, 0x82, 0xad, 0x8a, 0xcc, 0x9a, 0xed, 0x9a, 0x8c, 0x8a, 0xcd, 0x92, 0x0c, 0x93, 0xcd, 0xba, 0xed, 0xaa, 0x6b, 0x82, 0xac, 0x9a, 0x8c, 0x8a, 0xac,
+  0x8a, 0xcd, 0x92, 0xcc, 0x92, 0xcc, 0xaa, 0xed, 0xaa, 0xcd, 0xaa, 0xac, 0x9a, 0xcd, 0x9a, 0xcd, 0xa2, 0xac, 0xa2, 0xac, 0x9a, 0xcd, 0xa2, 0x81, 0xac, 0xa2, 0x83, 0xcd, 0xa2, 0x03, 0xac, 0x9a,
+  0xcc, 0xa2, 0xac, 0x92, 0x8c, 0x92, 0x84, 0xac, 0x92, 0x82, 0xcc, 0x01, 0x81, 0xec, 0x01, 0x35, 0x0d, 0x02, 0x2e, 0x02, 0x4e, 0x0a, 0xcb, 0x01, 0xab, 0x01, 0xec, 0x01, 0x2d, 0x02, 0x6e, 0x02,
+  0xd0, 0x02, 0x72, 0x0b, 0xcc, 0x01, 0x4d, 0x02, 0x8e, 0x02, 0xd0, 0x0a, 0x4e, 0x0a, 0x0c, 0x02, 0x6e, 0x02, 0xaf, 0x02, 0x31, 0x0b, 0x8b, 0x01, 0xec, 0x01, 0x2d, 0x02, 0xd0, 0x02, 0x31, 0x03,
+  0xf3, 0x13, 0x31, 0x13, 0x53, 0x24, 0x54, 0x54, 0xeb, 0x09, 0x0c, 0x02, 0x6e, 0x0a, 0xf0, 0x02, 0x92, 0x03, 0x72, 0x1b, 0x8f, 0x02, 0x72, 0x03, 0xab, 0x01, 0x0d, 0x02, 0xcf, 0x02, 0x10, 0x03,
+  0x11, 0x0b, 0x92, 0x13, 0xec, 0x01, 0x4c, 0x02, 0x0c, 0x0a, 0x6d, 0x0a, 0x0e, 0x53, 0xac, 0x0a, 0x0d, 0x0a, 0xec, 0x01, 0xae, 0x0a, 0x69, 0xaa, 0xcd, 0x12, 0x8f, 0x0a, 0x84, 0xef, 0x02, 0x03,
+  0xd0, 0x02, 0x51, 0x0b, 0x12, 0x54, 0x10, 0x03, 0x87, 0x0f, 0x03, 0x02, 0x30, 0x03, 0x0f, 0x03, 0x2f, 0x03, 0x82, 0x30, 0x03, 0x0f, 0x6f, 0x2b, 0x31, 0x03, 0xae, 0x0a, 0x8d, 0x0a, 0x8e, 0x12,
+  0x6d, 0x02, 0xae, 0x12, 0x4c, 0x0a, 0x2c, 0x0a, 0xae, 0x42, 0x6d, 0x4a, 0x4c, 0x42, 0x6d, 0x4a, 0x8d, 0x52, 0xad, 0x6a, 0xce, 0x72, 0x81, 0xce, 0x7a, 0x33, 0x0e, 0x8b, 0xee, 0x82, 0x2e, 0x8b,
+  0xcd, 0x7a, 0xee, 0x8a, 0x4f, 0xa3, 0xad, 0x82, 0xce, 0x9a, 0x2e, 0xa3, 0x6f, 0xb3, 0xad, 0x82, 0xca, 0x31, 0x2b, 0x4a, 0x6d, 0x62, 0x8d, 0x6a, 0xad, 0x6a, 0x8d, 0x72, 0x8d, 0x7a, 0xad, 0x7a,
+  0xad, 0x82, 0xcd, 0x8a, 0xcd, 0x9a, 0x0d, 0xab, 0xac, 0x92, 0xed, 0x92, 0x0d, 0xb3, 0xcd, 0xa2, 0x8c, 0x82, 0xed, 0xa2, 0xed, 0xaa, 0x8c, 0x92, 0xcd, 0x92, 0xcc, 0x9a, 0xec, 0xa2, 0xed, 0xb2,
+  0xed, 0xaa, 0xec, 0xa2, 0xec, 0x9a, 0xcd, 0xa2, 0xcd, 0xaa, 0xed, 0xaa, 0xac, 0xaa, 0xcd, 0xb2, 0xed, 0xaa, 0xac, 0xa2, 0xcd, 0xaa, 0xed, 0xb2, 0xcd, 0xaa, 0xcd, 0xa2, 0xcc, 0x9a, 0xac, 0x9a,
+  0xcc, 0x9a, 0x84, 0xac, 0x9a, 0x00, 0xad, 0x9a, 0x81, 0xac, 0x92, 0x06, 0xcc, 0x01, 0x2e, 0x02, 0x0d, 0x02, 0x2e, 0x02, 0x8b, 0x01, 0xcc, 0x01, 0x0d, 0x02, 0x81, 0xcb, 0x01, 0x09, 0xab, 0x01,
+  0xcc, 0x01, 0xec, 0x01, 0x4e, 0x02, 0xae, 0x02, 0xf1, 0x02, 0xf0, 0x12, 0x4d, 0x0a, 0x2d, 0x02, 0x8e, 0x0a, 0x81, 0xaf, 0x02, 0x28, 0x0d, 0x02, 0x8f, 0x02, 0x4d, 0x0a, 0x31, 0x03, 0xd0, 0x0a,
+  0xab, 0x01, 0xed, 0x09, 0x6e, 0x02, 0x11, 0x03, 0xb3, 0x0b, 0x74, 0x3c, 0x74, 0x4c, 0xb5, 0x64, 0x8d, 0x12, 0xec, 0x09, 0x6e, 0x02, 0xf0, 0x02, 0x11, 0x03, 0xf3, 0x1b, 0x51, 0x03, 0xaa, 0x09,
+  0x0d, 0x02, 0xaf, 0x02, 0x6e, 0x02, 0x30, 0x03, 0x92, 0x13, 0x91, 0x0b, 0xef, 0x22, 0xca, 0x01, 0x4d, 0x02, 0x90, 0x12, 0x92, 0x4b, 0x4a, 0x09, 0x0c, 0x02, 0xae, 0x02, 0xd0, 0x02, 0xcf, 0x0a,
+  0xef, 0x02, 0x0f, 0x0b, 0x31, 0x03, 0x6e, 0x3b, 0x81, 0x0f, 0x03, 0x03, 0x30, 0x0b, 0xef, 0x02, 0x0f, 0x0b, 0x30, 0x03, 0x81, 0x0f, 0x03, 0x82, 0x2f, 0x03, 0x00, 0x0f, 0x03, 0x81, 0x2f, 0x03,
+  0x01, 0x51, 0x03, 0x2f, 0x1b, 0x81, 0x50, 0x03, 0x00, 0x90, 0x03, 0x81, 0x50, 0x03, 0x44, 0x2f, 0x03, 0x8d, 0x02, 0xae, 0x1a, 0x8d, 0x02, 0x8d, 0x12, 0x8d, 0x0a, 0x4c, 0x12, 0x6d, 0x52, 0xce,
+  0x5a, 0xce, 0x62, 0xce, 0x72, 0xce, 0x7a, 0x2f, 0x93, 0xef, 0x82, 0x8e, 0x62, 0xce, 0x6a, 0xcf, 0x7a, 0x0f, 0x93, 0x4f, 0xa3, 0xad, 0x8a, 0x0e, 0x93, 0x0f, 0x8b, 0xad, 0x82, 0xcc, 0x82, 0x2e,
+  0xb3, 0x0d, 0xab, 0x0d, 0x9b, 0x6f, 0xb3, 0xf1, 0xdb, 0x6c, 0x42, 0x8c, 0x5a, 0x8d, 0x6a, 0xad, 0x6a, 0xad, 0x7a, 0xce, 0x82, 0xad, 0x8a, 0x0e, 0x93, 0xcc, 0x92, 0x6c, 0x82, 0xed, 0x9a, 0xac,
+  0x9a, 0xec, 0x92, 0xcd, 0x9a, 0x0d, 0xb3, 0xac, 0x9a, 0x4e, 0xbb, 0xec, 0xb2, 0xed, 0xba, 0x2d, 0xc3, 0x6d, 0xcb, 0xec, 0xb2, 0xed, 0xa2, 0x0d, 0xc3, 0xec, 0xaa, 0xed, 0xaa, 0xcc, 0xb2, 0xec,
+  0xba, 0xec, 0xaa, 0xec, 0xa2, 0x0d, 0xab, 0xcc, 0xa2, 0xcd, 0xaa, 0xcc, 0xaa, 0xcd, 0xaa, 0xec, 0xb2, 0xed, 0xaa, 0xcc, 0xa2, 0xcc, 0xaa, 0xed, 0xaa, 0x81, 0xac, 0xa2, 0x82, 0xcc, 0xa2, 0x09,
+  0xac, 0xa2, 0xcc, 0x9a, 0xcd, 0x9a, 0xec, 0x01, 0x2d, 0x02, 0x6e, 0x02, 0x8f, 0x0a, 0x8e, 0x0a, 0xab, 0x01, 0xec, 0x01, 0x82, 0xab, 0x01, 0x81, 0xcc, 0x01, 0x03, 0x4d, 0x02, 0x6e, 0x02, 0x10,
+  0x03, 0x0d, 0x02, 0x81, 0xcc, 0x01, 0x26, 0x2d, 0x02, 0xcf, 0x02, 0x51, 0x03, 0xd3, 0x13, 0xab, 0x01, 0x2d, 0x02, 0x10, 0x03, 0x93, 0x0b, 0x34, 0x2c, 0xcb, 0x01, 0x4d, 0x02, 0x11, 0x03, 0x92,
+  0x0b, 0x12, 0x1c, 0x75, 0x54, 0xb5, 0x64, 0x54, 0x34, 0x53, 0x44, 0xb5, 0x64, 0x8e, 0x02, 0x11, 0x0b, 0xb2, 0x13, 0x4d, 0x02, 0xcf, 0x02, 0xcb, 0x01, 0xae, 0x02, 0x2d, 0x02, 0xaf, 0x02, 0x51,
+  0x03, 0xd2, 0x23, 0xd2, 0x1b, 0xca, 0x09, 0x2c, 0x02, 0xcf, 0x02, 0x10, 0x0b, 0xab, 0x01, 0x4d, 0x02, 0xae, 0x02, 0xef, 0x02, 0x81, 0xf0, 0x02, 0x03, 0x30, 0x03, 0xf1, 0x0a, 0x2f, 0x03, 0x0f,
+  0x03, 0x81, 0x2f, 0x03, 0x01, 0x30, 0x0b, 0x0f, 0x0b, 0x81, 0x2f, 0x03, 0x81, 0x50, 0x03, 0x44, 0x2f, 0x0b, 0x10, 0x6c, 0x30, 0x03, 0x2f, 0x03, 0x30, 0x03, 0x51, 0x03, 0x30, 0x0b, 0x90, 0x03,
+  0x70, 0x03, 0x50, 0x0b, 0xb2, 0x03, 0x70, 0x03, 0x4e, 0x0a, 0xae, 0x02, 0xcf, 0x0a, 0xce, 0x0a, 0x6d, 0x0a, 0x8d, 0x0a, 0xae, 0x3a, 0x6d, 0x42, 0xae, 0x52, 0xee, 0x5a, 0xce, 0x6a, 0xef, 0x7a,
+  0x2f, 0x8b, 0x0f, 0x9b, 0x6e, 0xbb, 0x11, 0xcc, 0x2f, 0x93, 0xae, 0x62, 0xad, 0x6a, 0xad, 0x7a, 0xee, 0x82, 0xce, 0x8a, 0xed, 0x8a, 0xed, 0x92, 0x6f, 0xb3, 0x6f, 0xc3, 0xaf, 0xc3, 0x8e, 0xcb,
+  0x8e, 0xd3, 0xef, 0xdb, 0x8c, 0x6a, 0x4c, 0x62, 0x6d, 0x6a, 0xce, 0x8a, 0x8e, 0x7a, 0xcd, 0x72, 0xac, 0x92, 0x2e, 0xa3, 0x0d, 0xbb, 0xed, 0xa2, 0x2d, 0xc3, 0xec, 0xa2, 0xec, 0x9a, 0x0d, 0xc3,
+  0xec, 0xba, 0x8f, 0xd3, 0xec, 0xb2, 0xed, 0x9a, 0xed, 0xa2, 0xec, 0xb2, 0x2c, 0xd3, 0x0d, 0xc3, 0x0d, 0xbb, 0x2d, 0xc3, 0x2d, 0xbb, 0xcc, 0xaa, 0x0d, 0xbb, 0x81, 0x0c, 0xc3, 0x0d, 0xec, 0xb2,
+  0x0c, 0xc3, 0xec, 0xca, 0xed, 0xb2, 0xcc, 0xa2, 0xed, 0xb2, 0x0d, 0xb3, 0xec, 0xb2, 0xec, 0xba, 0xcc, 0xaa, 0xcd, 0xb2, 0xcd, 0xaa, 0xed, 0xaa, 0xcd, 0xaa, 0x81, 0xcd, 0xa2, 0x81, 0xcc, 0xa2,
+  0x06, 0x0c, 0x02, 0x4e, 0x02, 0x8f, 0x02, 0xaf, 0x0a, 0xb0, 0x0a, 0x8a, 0x01, 0xab, 0x01, 0x81, 0x8b, 0x01, 0x02, 0xec, 0x01, 0xac, 0x01, 0xec, 0x01, 0x81, 0x6e, 0x02, 0x25, 0xd0, 0x02, 0xec,
+  0x01, 0xcb, 0x09, 0x0d, 0x02, 0x4e, 0x02, 0x8e, 0x02, 0x72, 0x03, 0xb2, 0x0b, 0xec, 0x09, 0x4d, 0x02, 0xd0, 0x02, 0x31, 0x03, 0x55, 0x2c, 0xcb, 0x01, 0x4e, 0x02, 0xf0, 0x02, 0x92, 0x13, 0x74,
+  0x44, 0x71, 0x23, 0xb3, 0x0b, 0x53, 0x24, 0x94, 0x64, 0xd3, 0x74, 0x59, 0xa6, 0xd0, 0x02, 0x51, 0x03, 0xec, 0x01, 0xd0, 0x0a, 0x51, 0x0b, 0x2c, 0x02, 0x4d, 0x0a, 0x8d, 0x12, 0xf1, 0x02, 0x73,
+  0x3c, 0x30, 0x03, 0x8a, 0x01, 0x4d, 0x02, 0xce, 0x02, 0x81, 0xab, 0x01, 0x02, 0x2c, 0x02, 0x8e, 0x0a, 0xcf, 0x02, 0x81, 0x30, 0x03, 0x0d, 0x31, 0x03, 0x6d, 0x02, 0x4f, 0x0b, 0x0f, 0x03, 0x30,
+  0x03, 0x50, 0x03, 0x2f, 0x03, 0xef, 0x0a, 0x0d, 0x02, 0x4d, 0x0a, 0x30, 0x03, 0x50, 0x03, 0x6e, 0x0b, 0x6f, 0x03, 0x81, 0x50, 0x03, 0x0d, 0x50, 0x0b, 0x8f, 0x03, 0xb1, 0x0b, 0xb1, 0x03, 0x91,
+  0x0b, 0x90, 0x23, 0x91, 0x0b, 0xaf, 0x0b, 0x70, 0x0b, 0x2d, 0xe4, 0x4f, 0xb4, 0x50, 0x74, 0xae, 0x0a, 0xad, 0x12, 0x81, 0x6d, 0x2a, 0x30, 0x6d, 0x32, 0xae, 0x4a, 0x0f, 0x73, 0xef, 0x7a, 0xce,
+  0x72, 0xee, 0x72, 0xae, 0x6a, 0x0f, 0x73, 0xee, 0x7a, 0x2f, 0x83, 0xcd, 0x6a, 0xee, 0x72, 0xce, 0x7a, 0xee, 0x7a, 0x4f, 0xa3, 0xee, 0x9a, 0x4e, 0xbb, 0x6e, 0xc3, 0xae, 0xc3, 0xae, 0xd3, 0xef,
+  0xdb, 0x0f, 0xec, 0xb1, 0xfc, 0xcd, 0x82, 0xee, 0x9a, 0x4f, 0xab, 0xee, 0x9a, 0x6c, 0x6a, 0xae, 0x8a, 0xec, 0x9a, 0xed, 0xb2, 0x8d, 0xdb, 0x2f, 0xc3, 0x6e, 0xd3, 0x4d, 0xd3, 0x30, 0xe4, 0xec,
+  0xa2, 0x4d, 0xab, 0xed, 0xb2, 0xec, 0xba, 0x6d, 0xd3, 0x0c, 0xbb, 0x6e, 0xdb, 0xcc, 0xba, 0x0d, 0xcb, 0x2d, 0xcb, 0x2d, 0xd3, 0x2c, 0xd3, 0x4c, 0xd3, 0x81, 0x2c, 0xd3, 0x01, 0x2d, 0xc3, 0xed,
+  0xba, 0x82, 0x0d, 0xc3, 0x05, 0x0c, 0xcb, 0xec, 0xc2, 0x0c, 0xcb, 0xec, 0xba, 0xed, 0xba, 0xcc, 0xba, 0x81, 0xed, 0xba, 0x00, 0xcd, 0xb2, 0x81, 0xcd, 0xaa, 0x0e, 0xcc, 0xaa, 0xcc, 0xa2, 0xec,
+  0x01, 0x2d, 0x02, 0x8f, 0x02, 0xd0, 0x0a, 0x6e, 0x02, 0x2d, 0x02, 0x6e, 0x02, 0x6f, 0x0a, 0xab, 0x01, 0xab, 0x09, 0x6a, 0x01, 0xec, 0x01, 0x4d, 0x02, 0x81, 0x6e, 0x02, 0x2f, 0x11, 0x0b, 0x72,
+  0x13, 0xcc, 0x01, 0x8e, 0x02, 0x11, 0x03, 0x52, 0x03, 0xb3, 0x03, 0x51, 0x2b, 0x2d, 0x02, 0xd0, 0x02, 0x72, 0x03, 0x31, 0x03, 0xd4, 0x2b, 0xcf, 0x02, 0xf0, 0x02, 0xb2, 0x0b, 0x34, 0x3c, 0xf5,
+  0x7c, 0x71, 0x0b, 0xd2, 0x13, 0x95, 0x5c, 0xd4, 0x7c, 0xf3, 0xa4, 0x6d, 0x02, 0x72, 0x03, 0x70, 0x23, 0x6e, 0x0a, 0x51, 0x0b, 0xec, 0x01, 0x8e, 0x0a, 0x4d, 0x02, 0x31, 0x0b, 0x4c, 0x12, 0x8a,
+  0x01, 0x2d, 0x02, 0x0c, 0x0a, 0x6d, 0x0a, 0xcd, 0x83, 0x32, 0x95, 0x2c, 0x12, 0x0c, 0x02, 0x6d, 0x02, 0x2c, 0x02, 0xae, 0x02, 0xcf, 0x02, 0x2e, 0x1b, 0x0f, 0x03, 0x10, 0x03, 0x81, 0x50, 0x03,
+  0x0c, 0x50, 0x0b, 0x0c, 0x02, 0x4d, 0x02, 0x8e, 0x02, 0xce, 0x02, 0x50, 0x03, 0x6f, 0x13, 0x70, 0x13, 0x70, 0x03, 0x71, 0x03, 0x70, 0x03, 0xb2, 0x03, 0xb1, 0x03, 0x81, 0xd1, 0x03, 0x35, 0xb1,
+  0x0b, 0xb1, 0x03, 0xcd, 0x02, 0x6d, 0x0a, 0x6c, 0x0a, 0x2d, 0x1b, 0xee, 0x0a, 0xee, 0x02, 0xae, 0x1a, 0x6d, 0x1a, 0x8d, 0x2a, 0xad, 0x3a, 0xad, 0x4a, 0x8d, 0x5a, 0xad, 0x5a, 0xce, 0x62, 0xce,
+  0x72, 0xce, 0x6a, 0x0e, 0x73, 0x2f, 0xa3, 0x0f, 0xf4, 0x4f, 0xfc, 0x50, 0xc4, 0xf0, 0x72, 0x0d, 0x9b, 0xee, 0x9a, 0x2f, 0x9b, 0x0e, 0xab, 0x6e, 0xcb, 0xee, 0xeb, 0x2f, 0xfc, 0x4f, 0xfc, 0x6f,
+  0xfc, 0xb0, 0xfc, 0x4d, 0x9b, 0xcd, 0x8a, 0x0d, 0x9b, 0x2d, 0xab, 0x6d, 0xc3, 0x8e, 0xcb, 0xae, 0xd3, 0x0c, 0xcb, 0xaf, 0xdb, 0xed, 0xaa, 0x0d, 0xb3, 0x0e, 0xbb, 0x0d, 0xbb, 0x2e, 0xbb, 0x2c,
+  0xd3, 0xce, 0xeb, 0xca, 0xc2, 0x4d, 0xd3, 0x0c, 0xc3, 0x6e, 0xcb, 0x81, 0x6d, 0xdb, 0x03, 0x8d, 0xe3, 0x6c, 0xe3, 0xad, 0xe3, 0x6c, 0xdb, 0x81, 0x2d, 0xc3, 0x00, 0x4c, 0xd3, 0x81, 0x2c, 0xd3,
+  0x05, 0x4d, 0xdb, 0x0d, 0xc3, 0xcc, 0xaa, 0xec, 0xba, 0x0c, 0xcb, 0x0c, 0xc3, 0x81, 0xec, 0xca, 0x00, 0xec, 0xc2, 0x82, 0xec, 0xba, 0x05, 0xec, 0xb2, 0xcc, 0xb2, 0xcd, 0xaa, 0x0c, 0x02, 0x4e,
+  0x0a, 0x4e, 0x02, 0x81, 0xd0, 0x0a, 0x42, 0x6d, 0x02, 0x8f, 0x02, 0xb0, 0x02, 0x51, 0x0b, 0xec, 0x09, 0x8b, 0x01, 0xcc, 0x01, 0xec, 0x01, 0x4e, 0x02, 0xaf, 0x02, 0x32, 0x0b, 0xd3, 0x13, 0xd3,
+  0x3b, 0x2d, 0x02, 0x11, 0x0b, 0x71, 0x03, 0x34, 0x24, 0xab, 0x01, 0x4e, 0x02, 0xf0, 0x02, 0x92, 0x0b, 0x51, 0x03, 0xf4, 0x23, 0x2d, 0x02, 0xf0, 0x02, 0x71, 0x03, 0x34, 0x34, 0x95, 0x64, 0x91,
+  0x13, 0xd2, 0x2b, 0xd2, 0x1b, 0x53, 0x44, 0xb4, 0x7c, 0x14, 0x9d, 0x55, 0xa5, 0x93, 0x0b, 0x94, 0x64, 0x37, 0x85, 0xab, 0x01, 0xae, 0x02, 0x10, 0x03, 0x92, 0x03, 0xec, 0x01, 0x48, 0x11, 0x70,
+  0xc4, 0xcf, 0xa3, 0x8b, 0xf3, 0xcf, 0x12, 0x51, 0x03, 0x34, 0x1c, 0x8a, 0x01, 0x2d, 0x02, 0xef, 0x0a, 0x2d, 0x02, 0xad, 0x22, 0xce, 0x02, 0x0f, 0x0b, 0xae, 0x0a, 0x89, 0x09, 0xcb, 0x09, 0x2c,
+  0x0a, 0x6d, 0x02, 0xef, 0x0a, 0x50, 0x03, 0x0e, 0x03, 0x2f, 0x0b, 0x51, 0x03, 0x81, 0x70, 0x03, 0x81, 0x91, 0x03, 0x01, 0xb0, 0x43, 0x70, 0x1b, 0x81, 0xf2, 0x03, 0x34, 0x92, 0x0b, 0xd4, 0x64,
+  0x4d, 0x02, 0xce, 0x02, 0xae, 0x02, 0x0e, 0x23, 0x8e, 0x2a, 0xee, 0x32, 0x10, 0x5b, 0xf0, 0x6a, 0xae, 0x62, 0x6c, 0x42, 0x6d, 0x4a, 0x8d, 0x4a, 0x8e, 0x4a, 0xce, 0x5a, 0xad, 0x6a, 0xee, 0x82,
+  0x6e, 0xb3, 0xee, 0xdb, 0x30, 0xf4, 0x2f, 0xfc, 0xd0, 0xfc, 0x71, 0xfd, 0xad, 0x82, 0xce, 0x72, 0x0f, 0x7b, 0xee, 0x8a, 0xec, 0x8a, 0x4e, 0xbb, 0xef, 0xdb, 0x0e, 0xec, 0xb0, 0xfc, 0xef, 0xfc,
+  0x51, 0xf5, 0x0e, 0x9b, 0x6e, 0xc3, 0x4d, 0xcb, 0x6e, 0xcb, 0xae, 0xdb, 0xcf, 0xdb, 0xec, 0xb2, 0x0c, 0xbb, 0x2d, 0xcb, 0x4c, 0xd3, 0x2c, 0xd3, 0x8e, 0xdb, 0x4d, 0xcb, 0x2c, 0xd3, 0x6d, 0xdb,
+  0x6d, 0xd3, 0x0c, 0xcb, 0x6d, 0xdb, 0x81, 0x8d, 0xeb, 0x02, 0x8c, 0xeb, 0xad, 0xeb, 0x2c, 0xcb, 0x81, 0x6c, 0xdb, 0x0b, 0x6c, 0xe3, 0x6c, 0xeb, 0x4c, 0xd3, 0x0c, 0xcb, 0x4d, 0xc3, 0x4d, 0xcb,
+  0x0d, 0xcb, 0x2c, 0xd3, 0x4c, 0xdb, 0x2c, 0xcb, 0x0d, 0xcb, 0x0d, 0xd3, 0x81, 0x0c, 0xcb, 0x00, 0xec, 0xc2, 0x81, 0xed, 0xc2, 0x0e, 0xed, 0xba, 0xcc, 0xba, 0xcd, 0xb2, 0x0c, 0x02, 0x2d, 0x02,
+  0x4e, 0x02, 0x8f, 0x02, 0x6e, 0x02, 0xaf, 0x0a, 0x6e, 0x02, 0xf0, 0x02, 0x51, 0x03, 0xac, 0x01, 0x6a, 0x01, 0xcc, 0x01, 0x81, 0x2d, 0x02, 0x39, 0x8f, 0x02, 0x31, 0x03, 0xb3, 0x13, 0x14, 0x24,
+  0x93, 0x0b, 0xb2, 0x13, 0xf1, 0x0a, 0x34, 0x1c, 0xcb, 0x01, 0x6f, 0x02, 0x6e, 0x02, 0x51, 0x03, 0x31, 0x13, 0x71, 0x0b, 0xaf, 0x12, 0xaf, 0x02, 0x10, 0x03, 0xb2, 0x13, 0xf3, 0x2b, 0x54, 0x44,
+  0xb3, 0x0b, 0x93, 0x5c, 0xf1, 0x0b, 0xb4, 0x54, 0x35, 0x95, 0x94, 0xad, 0xd1, 0x03, 0x53, 0x4c, 0x35, 0x8d, 0xca, 0x09, 0x8e, 0x02, 0x91, 0x03, 0xb2, 0x03, 0x33, 0x34, 0xae, 0x0a, 0xcd, 0x0a,
+  0xed, 0x01, 0x2e, 0x53, 0x8e, 0x0a, 0x30, 0x03, 0x92, 0x03, 0x6d, 0x0a, 0x6d, 0x02, 0x0f, 0x03, 0xcf, 0x02, 0x30, 0x03, 0x51, 0x03, 0xef, 0x0a, 0xcb, 0x01, 0x6d, 0x0a, 0x8e, 0x0a, 0x2d, 0x0a,
+  0xce, 0x02, 0x10, 0x03, 0x92, 0x0b, 0x2f, 0x03, 0x71, 0x03, 0x90, 0x03, 0x81, 0x91, 0x03, 0x08, 0xb1, 0x03, 0xd1, 0x03, 0xb2, 0x03, 0xf2, 0x0b, 0x6b, 0xc3, 0xcd, 0xc3, 0x34, 0x8d, 0xf2, 0x0b,
+  0xad, 0x02, 0x81, 0xce, 0x02, 0x41, 0xad, 0x0a, 0xce, 0x3a, 0xce, 0x52, 0x10, 0x73, 0x6c, 0x3a, 0xae, 0x4a, 0xad, 0x5a, 0x6d, 0x42, 0x6d, 0x52, 0xce, 0x6a, 0xee, 0x82, 0x2e, 0x8b, 0x4e, 0xa3,
+  0x6e, 0xab, 0x8f, 0xbb, 0xcf, 0xd3, 0xaf, 0xfc, 0x10, 0xfd, 0x0f, 0xfd, 0x71, 0xfd, 0xed, 0x7a, 0xee, 0x8a, 0x0e, 0x93, 0x0d, 0xa3, 0x4d, 0xbb, 0x8e, 0xcb, 0xce, 0xdb, 0xef, 0xe3, 0x6f, 0xf4,
+  0xb1, 0xfd, 0x0e, 0xab, 0xce, 0xcb, 0x8b, 0xe3, 0x70, 0xf4, 0x6e, 0xcb, 0x4e, 0xdb, 0x2d, 0xdb, 0x8d, 0xdb, 0xaf, 0xe3, 0x4c, 0xcb, 0x0c, 0xd3, 0x0c, 0xcb, 0xec, 0xc2, 0x4d, 0xeb, 0xad, 0xeb,
+  0x4d, 0xdb, 0x6d, 0xeb, 0x8d, 0xeb, 0xad, 0xf3, 0xcd, 0xfb, 0x6c, 0xeb, 0xad, 0xf3, 0x6c, 0xeb, 0x8c, 0xeb, 0x8d, 0xeb, 0xcd, 0xeb, 0x4c, 0xdb, 0x6c, 0xe3, 0x6d, 0xe3, 0x6c, 0xe3, 0x8d, 0xe3,
+  0x8d, 0xeb, 0x6d, 0xdb, 0x0c, 0xc3, 0x4d, 0xdb, 0x2c, 0xdb, 0x81, 0x2c, 0xd3, 0x0a, 0x0c, 0xcb, 0x2c, 0xcb, 0x0c, 0xcb, 0xec, 0xca, 0xed, 0xc2, 0xec, 0xba, 0xcd, 0xba, 0x2d, 0x02, 0x0d, 0x02,
+  0x4e, 0x02, 0x8e, 0x02, 0x81, 0x6e, 0x02, 0x46, 0x8e, 0x02, 0xd0, 0x02, 0x51, 0x03, 0xab, 0x01, 0x8a, 0x01, 0xab, 0x01, 0xec, 0x01, 0x8e, 0x02, 0x0c, 0x02, 0xd0, 0x02, 0x31, 0x03, 0xb3, 0x0b,
+  0x34, 0x24, 0x75, 0x3c, 0x37, 0x65, 0xd3, 0x13, 0xcb, 0x09, 0x8f, 0x02, 0x4f, 0x0a, 0x52, 0x03, 0x6e, 0x02, 0x10, 0x03, 0xf0, 0x02, 0xaf, 0x12, 0xaf, 0x02, 0x51, 0x0b, 0xb2, 0x03, 0x55, 0x34,
+  0x33, 0x34, 0xb1, 0x1b, 0x95, 0x34, 0x74, 0x4c, 0x94, 0x4c, 0x15, 0x85, 0xf5, 0x74, 0x73, 0x3c, 0x32, 0x5c, 0xf1, 0x63, 0x4d, 0x02, 0xf0, 0x0a, 0xd2, 0x03, 0x74, 0x4c, 0x4d, 0x02, 0x51, 0x03,
+  0x12, 0x04, 0x69, 0x01, 0x2d, 0x02, 0x10, 0x03, 0x31, 0x03, 0x14, 0x3c, 0x6d, 0x02, 0xef, 0x02, 0x30, 0x03, 0x51, 0x0b, 0xd1, 0x0b, 0xab, 0x01, 0x4c, 0x0a, 0xf0, 0x0a, 0x71, 0x0b, 0x2c, 0x02,
+  0x6e, 0x0a, 0x0f, 0x03, 0x71, 0x03, 0xb2, 0x0b, 0x70, 0x0b, 0x90, 0x03, 0xb1, 0x03, 0xb0, 0x03, 0xf2, 0x03, 0xf1, 0x03, 0xf2, 0x0b, 0x81, 0x12, 0x04, 0x35, 0x4f, 0x5c, 0x13, 0x0c, 0x33, 0x0c,
+  0xad, 0x02, 0xee, 0x02, 0xce, 0x0a, 0xcf, 0x42, 0xef, 0x52, 0x4c, 0x32, 0xcd, 0x2a, 0x8d, 0x42, 0xef, 0x72, 0x51, 0x9b, 0x90, 0xbb, 0x0f, 0x8b, 0x8d, 0x5a, 0xee, 0x72, 0x0e, 0x83, 0x2e, 0x9b,
+  0x4e, 0xb3, 0x8f, 0xcb, 0xce, 0xdb, 0xb0, 0xfc, 0x4f, 0xec, 0xcf, 0xfc, 0xd0, 0xfd, 0xf4, 0xed, 0xce, 0x72, 0x0e, 0x8b, 0x2e, 0xa3, 0x4e, 0xbb, 0x8d, 0xc3, 0xee, 0xdb, 0xcd, 0xeb, 0x6e, 0xf4,
+  0xd0, 0xfc, 0xcb, 0xc2, 0xec, 0x92, 0x8d, 0x4a, 0xad, 0x52, 0xad, 0x5a, 0x2e, 0x9b, 0x2e, 0xcb, 0x4e, 0xbb, 0x2d, 0xd3, 0x8d, 0xf3, 0x0c, 0xd3, 0x6c, 0xeb, 0xcd, 0xfb, 0x4c, 0xd3, 0x8d, 0xe3,
+  0x8c, 0xeb, 0xad, 0xf3, 0xac, 0xf3, 0x81, 0xcd, 0xf3, 0x06, 0xad, 0xf3, 0x8d, 0xf3, 0xcd, 0xeb, 0x0c, 0xd3, 0x8d, 0xeb, 0x8c, 0xeb, 0xad, 0xf3, 0x82, 0x4c, 0xdb, 0x04, 0x6c, 0xe3, 0x6d, 0xe3,
+  0x6c, 0xdb, 0x4d, 0xe3, 0x4d, 0xdb, 0x81, 0x4c, 0xdb, 0x00, 0x2c, 0xdb, 0x81, 0x2c, 0xd3, 0x00, 0x0c, 0xd3, 0x81, 0x0c, 0xcb, 0x81, 0xec, 0xc2, 0x00, 0x0d, 0x02, 0x81, 0x2d, 0x02, 0x0b, 0x4e,
+  0x02, 0xaf, 0x02, 0x4e, 0x02, 0x6e, 0x0a, 0xd0, 0x02, 0x32, 0x03, 0x10, 0x03, 0x4e, 0x0a, 0xcc, 0x01, 0xab, 0x01, 0x4d, 0x02, 0xcf, 0x0a, 0x81, 0xaf, 0x02, 0x6f, 0x52, 0x03, 0xd3, 0x0b, 0x54,
+  0x2c, 0xd6, 0x5c, 0x73, 0x2c, 0x17, 0x75, 0x4e, 0x02, 0xf0, 0x0a, 0xd0, 0x02, 0x0c, 0x02, 0x6e, 0x02, 0x32, 0x0b, 0xd3, 0x0b, 0xce, 0x1a, 0x4e, 0x02, 0xf1, 0x0a, 0xb2, 0x03, 0x34, 0x2c, 0xf6,
+  0x64, 0x92, 0x0b, 0x75, 0x2c, 0x95, 0x54, 0x77, 0x75, 0x90, 0x13, 0xb5, 0x4c, 0x93, 0x54, 0x75, 0x95, 0xae, 0x1a, 0x71, 0x03, 0x54, 0x1c, 0x95, 0x3c, 0xee, 0x0a, 0x91, 0x2b, 0x53, 0x0c, 0xcb,
+  0x09, 0x8e, 0x02, 0xf0, 0x02, 0x71, 0x03, 0x33, 0x14, 0xef, 0x1a, 0xae, 0x02, 0x30, 0x03, 0x91, 0x03, 0x13, 0x1c, 0xae, 0x02, 0x30, 0x03, 0x71, 0x0b, 0x51, 0x0b, 0x31, 0x1b, 0x4d, 0x0a, 0xae,
+  0x02, 0x70, 0x0b, 0x91, 0x03, 0xb1, 0x0b, 0x90, 0x03, 0xd1, 0x0b, 0x90, 0x13, 0x13, 0x9d, 0xf2, 0x03, 0x12, 0x0c, 0x12, 0x04, 0xf1, 0x03, 0x32, 0x0c, 0xf1, 0x0b, 0x6f, 0x0b, 0xef, 0x32, 0xef,
+  0x4a, 0xae, 0x0a, 0xce, 0x02, 0x8d, 0x02, 0x8d, 0x1a, 0xce, 0x62, 0xce, 0x7a, 0x0f, 0x8b, 0x2e, 0x9b, 0x6f, 0xab, 0xaf, 0xbb, 0xef, 0xd3, 0xcf, 0xdb, 0x32, 0xdc, 0xcf, 0xcb, 0xed, 0x92, 0x0d,
+  0x9b, 0x8e, 0xab, 0xcf, 0xcb, 0x0f, 0xdc, 0x2f, 0xe4, 0xd0, 0xfc, 0x50, 0xfd, 0xcd, 0x82, 0x0f, 0x9b, 0x6e, 0xb3, 0x6e, 0xcb, 0xee, 0xe3, 0x0e, 0xe4, 0xce, 0xe3, 0x6f, 0xf4, 0x8f, 0xfc, 0x4b,
+  0x52, 0x8c, 0x62, 0xad, 0x72, 0xcd, 0x82, 0x0d, 0x93, 0x0d, 0xa3, 0x0c, 0xb3, 0x6c, 0xe3, 0xad, 0xfb, 0x6c, 0xe3, 0x8d, 0xfb, 0x4c, 0xeb, 0x6c, 0xeb, 0x8d, 0xf3, 0x81, 0xcd, 0xfb, 0x03, 0xed,
+  0xfb, 0x2e, 0xfc, 0x8c, 0xf3, 0xad, 0xfb, 0x81, 0x6c, 0xe3, 0x06, 0x8d, 0xf3, 0xcd, 0xfb, 0x2b, 0xe3, 0x8c, 0xeb, 0xad, 0xf3, 0xee, 0xfb, 0x4b, 0xe3, 0x81, 0xce, 0xf3, 0x00, 0x6c, 0xeb, 0x81,
+  0x6d, 0xeb, 0x00, 0x6d, 0xe3, 0x81, 0x4c, 0xe3, 0x81, 0x4c, 0xdb, 0x03, 0x2c, 0xdb, 0x2c, 0xd3, 0x0c, 0xd3, 0x0c, 0xcb, 0x81, 0xec, 0xca, 0x01, 0x2d, 0x02, 0x4d, 0x02, 0x81, 0x4e, 0x02, 0x0a,
+  0x8f, 0x02, 0x2d, 0x02, 0x4e, 0x02, 0xaf, 0x02, 0xf0, 0x02, 0x51, 0x03, 0x52, 0x03, 0x14, 0x24, 0x8b, 0x01, 0x2d, 0x02, 0x8f, 0x02, 0x81, 0xf0, 0x02, 0x2c, 0x6f, 0x02, 0x51, 0x03, 0xf4, 0x1b,
+  0x33, 0x34, 0x54, 0x3c, 0xf5, 0x84, 0xaf, 0x0a, 0x8f, 0x02, 0x8f, 0x0a, 0xf0, 0x0a, 0xd3, 0x13, 0xf0, 0x02, 0x91, 0x03, 0x8b, 0xca, 0x8c, 0x52, 0x6f, 0x0a, 0x10, 0x03, 0x92, 0x03, 0x13, 0x24,
+  0xb3, 0x23, 0xb2, 0x03, 0x53, 0x2c, 0x16, 0x75, 0x30, 0x03, 0x13, 0x1c, 0xd5, 0x44, 0xf5, 0x6c, 0x4d, 0x0a, 0x51, 0x03, 0xb2, 0x13, 0xf3, 0x03, 0x74, 0x3c, 0xb4, 0x64, 0x14, 0x7d, 0x54, 0xc5,
+  0x14, 0x95, 0x8e, 0x0a, 0xaf, 0x02, 0xd4, 0x03, 0x13, 0x44, 0x6d, 0x02, 0x0f, 0x0b, 0x10, 0x0b, 0xd3, 0x13, 0xef, 0x02, 0x81, 0xb1, 0x03, 0x08, 0x10, 0x1b, 0xaf, 0x02, 0x2f, 0x03, 0xf3, 0x0b,
+  0x30, 0x0b, 0x71, 0x03, 0x53, 0x3c, 0xd0, 0x03, 0xf1, 0x03, 0x82, 0x12, 0x04, 0x2c, 0x32, 0x04, 0x52, 0x04, 0x2f, 0x03, 0x50, 0x03, 0x70, 0x03, 0x30, 0x33, 0x8d, 0x0a, 0xce, 0x02, 0xef, 0x02,
+  0xad, 0x02, 0xaf, 0x4a, 0xce, 0x62, 0xee, 0x72, 0xee, 0x82, 0x2f, 0x93, 0x2e, 0x9b, 0x6f, 0xab, 0xaf, 0xbb, 0xce, 0xd3, 0x0f, 0xe4, 0xee, 0xeb, 0x90, 0xc3, 0x0e, 0x8b, 0x4e, 0xa3, 0x8e, 0xb3,
+  0xce, 0xd3, 0x2f, 0xec, 0x6f, 0xfc, 0xcf, 0xfc, 0x10, 0xfd, 0x0b, 0x9b, 0x0d, 0x9b, 0x0c, 0x9b, 0x2d, 0xab, 0x6d, 0xb3, 0x8e, 0xcb, 0xce, 0xdb, 0x4f, 0xec, 0x70, 0xd4, 0xad, 0x6a, 0xcc, 0x72,
+  0x0d, 0x8b, 0xec, 0x9a, 0x2d, 0xab, 0x0f, 0xf4, 0x81, 0xcd, 0xfb, 0x16, 0xcd, 0xf3, 0xcd, 0xfb, 0x6c, 0xf3, 0xad, 0xfb, 0xcd, 0xfb, 0xed, 0xfb, 0x0d, 0xfc, 0x2e, 0xfc, 0xad, 0xf3, 0xad, 0xfb,
+  0xce, 0xfb, 0x8d, 0xf3, 0xcd, 0xfb, 0xed, 0xfb, 0xac, 0xf3, 0xee, 0xfb, 0xed, 0xfb, 0x4c, 0xeb, 0xce, 0xfb, 0xcd, 0xfb, 0x8c, 0xf3, 0xad, 0xf3, 0xcd, 0xf3, 0x82, 0xad, 0xf3, 0x81, 0x8d, 0xeb,
+  0x82, 0x6d, 0xe3, 0x05, 0x4d, 0xdb, 0x4c, 0xdb, 0x2c, 0xdb, 0x2c, 0xd3, 0x0c, 0xd3, 0xec, 0xca, 0x81, 0x4e, 0x02, 0x81, 0x6e, 0x02, 0x09, 0xaf, 0x02, 0x8e, 0x02, 0x0c, 0x02, 0x4e, 0x02, 0x8f,
+  0x02, 0x10, 0x03, 0x52, 0x03, 0xd3, 0x0b, 0xb7, 0x4c, 0xcc, 0x09, 0x81, 0x4e, 0x02, 0x37, 0xd0, 0x0a, 0x72, 0x0b, 0xf3, 0x13, 0x57, 0x65, 0x52, 0x03, 0xd6, 0x54, 0x75, 0x44, 0x71, 0x23, 0x92,
+  0x03, 0x54, 0x2c, 0xd6, 0x44, 0xf0, 0x0a, 0x51, 0x0b, 0x65, 0x00, 0x0c, 0xfb, 0x6e, 0xfc, 0xcb, 0x09, 0xf0, 0x0a, 0x4e, 0x02, 0x31, 0x03, 0xf3, 0x13, 0x72, 0x0b, 0xf3, 0x0b, 0x95, 0x44, 0xaf,
+  0x02, 0xb2, 0x03, 0x34, 0x1c, 0xb5, 0x44, 0x2d, 0x02, 0x10, 0x0b, 0xf3, 0x13, 0x13, 0x1c, 0xf2, 0x13, 0x95, 0x44, 0xb3, 0x5c, 0x74, 0xad, 0xd4, 0xe5, 0x8e, 0x0a, 0x33, 0x2c, 0x35, 0x9d, 0x16,
+  0xde, 0x2b, 0x1a, 0x8c, 0x09, 0x6d, 0x02, 0x2f, 0x03, 0x70, 0x13, 0xf3, 0x33, 0x74, 0x34, 0xcb, 0x01, 0x8e, 0x0a, 0x10, 0x03, 0x71, 0x03, 0x91, 0x13, 0xb1, 0x1b, 0x12, 0x2c, 0xf1, 0x03, 0x81,
+  0x11, 0x04, 0x03, 0x32, 0x04, 0x31, 0x04, 0x12, 0x04, 0x70, 0x03, 0x81, 0x90, 0x03, 0x2c, 0x70, 0x0b, 0xad, 0x02, 0x8d, 0x12, 0xef, 0x4a, 0xce, 0x62, 0x0e, 0x73, 0xee, 0x7a, 0x2e, 0x83, 0x4e,
+  0x93, 0x0d, 0x9b, 0x2e, 0xa3, 0x4e, 0xab, 0x6f, 0xbb, 0xaf, 0xcb, 0xcf, 0xdb, 0x0f, 0xec, 0x2e, 0xf4, 0x0e, 0xf4, 0x70, 0xf4, 0x0d, 0xa3, 0x8e, 0xbb, 0xee, 0xd3, 0x2e, 0xf4, 0x6f, 0xfc, 0xd0,
+  0xfc, 0x10, 0xfd, 0x0d, 0x83, 0xab, 0x62, 0x8d, 0x6a, 0xae, 0x72, 0xed, 0x82, 0x2e, 0xa3, 0x8f, 0xc3, 0x4f, 0xd3, 0x2c, 0x2a, 0x6d, 0x32, 0xed, 0x8a, 0xad, 0xeb, 0xad, 0xfb, 0x4d, 0xfc, 0xac,
+  0xfb, 0x0d, 0xfc, 0xd0, 0xfc, 0x4f, 0xfc, 0xac, 0xfb, 0x81, 0xed, 0xfb, 0x07, 0x2d, 0xfc, 0x4e, 0xfc, 0xad, 0xfb, 0xed, 0xfb, 0x2e, 0xfc, 0xcd, 0xfb, 0x0e, 0xfc, 0xed, 0xfb, 0x83, 0x0e, 0xfc,
+  0x81, 0xed, 0xfb, 0x00, 0xcd, 0xfb, 0x83, 0xed, 0xfb, 0x82, 0xcd, 0xf3, 0x01, 0xad, 0xf3, 0xad, 0xeb, 0x81, 0x8d, 0xeb, 0x81, 0x6d, 0xe3, 0x04, 0x6c, 0xe3, 0x4c, 0xdb, 0x2c, 0xdb, 0x2c, 0xd3,
+  0x0c, 0xd3, 0x81, 0x6e, 0x02, 0x78, 0xaf, 0x02, 0x2d, 0x02, 0x8f, 0x02, 0xaf, 0x02, 0xec, 0x01, 0x0d, 0x02, 0xaf, 0x0a, 0xf0, 0x02, 0x52, 0x03, 0xd3, 0x0b, 0xf3, 0x23, 0xcc, 0x01, 0xaf, 0x0a,
+  0x72, 0x13, 0x6e, 0x02, 0x52, 0x0b, 0x34, 0x24, 0x74, 0x3c, 0xf0, 0x12, 0x11, 0x03, 0xb2, 0x0b, 0x34, 0x34, 0xf3, 0x1b, 0x54, 0x34, 0x74, 0x3c, 0x17, 0x65, 0x09, 0x01, 0x26, 0x08, 0xec, 0xfa,
+  0x6d, 0xfc, 0xf4, 0xe5, 0x2d, 0x0a, 0x11, 0x0b, 0x52, 0x1b, 0x10, 0x0b, 0x52, 0x0b, 0xf3, 0x0b, 0x91, 0x03, 0x13, 0x14, 0xd3, 0x23, 0x92, 0x03, 0x54, 0x1c, 0xb4, 0x3c, 0x76, 0x85, 0xb5, 0xad,
+  0x4f, 0x0b, 0xb4, 0x4c, 0x91, 0x13, 0x13, 0x0c, 0xd4, 0x6c, 0x75, 0xd5, 0xf5, 0x84, 0x58, 0xce, 0xd3, 0x64, 0x74, 0xbd, 0x93, 0xf5, 0xef, 0x3a, 0xef, 0x02, 0xd2, 0x0b, 0x33, 0x3c, 0x53, 0x3c,
+  0x56, 0x7d, 0x2c, 0x02, 0x8d, 0x02, 0x51, 0x03, 0x71, 0x03, 0xf2, 0x13, 0xd1, 0x0b, 0x93, 0x64, 0x11, 0x04, 0x73, 0x0c, 0x12, 0x04, 0xcf, 0x0b, 0xf1, 0x1b, 0xf2, 0x03, 0xb0, 0x03, 0x50, 0x0b,
+  0x33, 0x44, 0x0f, 0x13, 0xce, 0x2a, 0xae, 0x42, 0xce, 0x5a, 0xef, 0x72, 0xce, 0x5a, 0x8c, 0x4a, 0xad, 0x5a, 0xad, 0x6a, 0xce, 0x7a, 0xef, 0x82, 0xef, 0x92, 0x0d, 0xa3, 0x2f, 0xb3, 0xaf, 0xcb,
+  0x8e, 0xdb, 0x8d, 0xdb, 0x0e, 0xfc, 0x4e, 0xfc, 0x70, 0xfc, 0x2f, 0xe4, 0xcf, 0xeb, 0x4f, 0xfc, 0xcf, 0xfc, 0x30, 0xfd, 0x71, 0xfd, 0xad, 0x72, 0xee, 0x82, 0x0e, 0x9b, 0x6d, 0xb3, 0xed, 0xe3,
+  0xac, 0xeb, 0xec, 0xfb, 0x4c, 0xfc, 0x0d, 0xdb, 0xee, 0xfb, 0x6d, 0xfb, 0xed, 0xfb, 0xac, 0xfb, 0xcd, 0xfb, 0x8e, 0xfc, 0x0e, 0xfc, 0xcd, 0xfb, 0x81, 0xac, 0xfb, 0x00, 0x4e, 0xfc, 0x81, 0xcd,
+  0xfb, 0x03, 0x0d, 0xfc, 0x2d, 0xfc, 0xcc, 0xfb, 0x2e, 0xfc, 0x81, 0x4e, 0xfc, 0x81, 0xed, 0xfb, 0x81, 0x2e, 0xfc, 0x01, 0x2d, 0xfc, 0x4e, 0xfc, 0x84, 0x2e, 0xfc, 0x81, 0x0d, 0xfc, 0x81, 0xed,
+  0xfb, 0x81, 0xcd, 0xf3, 0x81, 0xad, 0xf3, 0x81, 0x8d, 0xeb, 0x04, 0x6d, 0xe3, 0x4c, 0xe3, 0x4c, 0xdb, 0x2c, 0xdb, 0x0c, 0xdb, 0x81, 0x6e, 0x02, 0x7c, 0x4d, 0x02, 0x4e, 0x02, 0x8f, 0x02, 0xb0,
+  0x02, 0xef, 0x02, 0xed, 0x09, 0x8f, 0x02, 0xd0, 0x0a, 0x31, 0x03, 0xb3, 0x1b, 0x51, 0x0b, 0xf3, 0x13, 0xf7, 0x54, 0x92, 0x1b, 0x75, 0x34, 0x92, 0x1b, 0xd3, 0x13, 0x13, 0x24, 0xaf, 0x02, 0x31,
+  0x03, 0xf0, 0x0a, 0x52, 0x03, 0x14, 0x24, 0x95, 0x3c, 0x16, 0x65, 0xec, 0x11, 0x64, 0x08, 0x66, 0x08, 0x2a, 0xb2, 0x0e, 0xfc, 0x90, 0xfd, 0xae, 0x6b, 0x11, 0x03, 0x15, 0x1c, 0x2d, 0x02, 0xaf,
+  0x02, 0x31, 0x0b, 0xcf, 0x02, 0xd3, 0x03, 0x90, 0x23, 0x91, 0x23, 0xd2, 0x03, 0xd5, 0x44, 0x35, 0x7d, 0x55, 0xa5, 0xb6, 0xad, 0x13, 0x0c, 0xb3, 0x74, 0x33, 0xa5, 0xd6, 0xb5, 0x12, 0x14, 0x15,
+  0x95, 0x56, 0xb5, 0xf1, 0x1b, 0x54, 0xa5, 0x73, 0xcd, 0xf0, 0x73, 0xcf, 0x0a, 0xd2, 0x03, 0x33, 0x14, 0x13, 0x2c, 0x13, 0x4c, 0x50, 0x03, 0x8d, 0x02, 0x71, 0x03, 0x50, 0x03, 0xd1, 0x13, 0x70,
+  0x03, 0x13, 0x44, 0xb3, 0x74, 0x36, 0xad, 0x51, 0x14, 0x54, 0x0c, 0x32, 0x14, 0xb0, 0x0b, 0xee, 0x02, 0x2f, 0x0b, 0xd1, 0x2b, 0x31, 0x3c, 0x73, 0x6c, 0xed, 0x0a, 0xee, 0x02, 0x10, 0x0b, 0x6d,
+  0x22, 0xad, 0x52, 0xad, 0x6a, 0xad, 0x7a, 0xce, 0x7a, 0xee, 0x8a, 0x4e, 0xa3, 0x50, 0xa3, 0xed, 0x7a, 0x10, 0xdc, 0x0d, 0xf4, 0xce, 0xeb, 0xae, 0xdb, 0x6f, 0xdb, 0xf0, 0xf3, 0xae, 0xeb, 0xce,
+  0xf3, 0x6f, 0xfc, 0x8f, 0xfc, 0x30, 0xfd, 0xd0, 0xfd, 0xef, 0x7a, 0x6c, 0x62, 0xcd, 0x6a, 0xee, 0x72, 0xce, 0x82, 0xee, 0x82, 0xcc, 0x82, 0xad, 0xfb, 0x0b, 0xfb, 0x2e, 0xfc, 0x8c, 0xfb, 0x0e,
+  0xfc, 0xed, 0xf3, 0x6c, 0xf3, 0x6c, 0xfb, 0xac, 0xfb, 0x4d, 0xfc, 0x6e, 0xfc, 0xed, 0xfb, 0x0e, 0xfc, 0xed, 0xfb, 0x83, 0x2d, 0xfc, 0x02, 0x8e, 0xfc, 0x2d, 0xfc, 0x4e, 0xfc, 0x81, 0x6e, 0xfc,
+  0x02, 0x8e, 0xfc, 0xaf, 0xfc, 0x4e, 0xfc, 0x82, 0x6e, 0xfc, 0x82, 0x4e, 0xfc, 0x81, 0x2e, 0xfc, 0x81, 0x0d, 0xfc, 0x81, 0xed, 0xfb, 0x81, 0xcd, 0xf3, 0x04, 0xad, 0xf3, 0xad, 0xeb, 0x8d, 0xeb,
+  0x6d, 0xe3, 0x4d, 0xe3, 0x81, 0x2c, 0xdb, 0x81, 0x8f, 0x02, 0x47, 0xf0, 0x02, 0x4d, 0x02, 0x6e, 0x02, 0xb0, 0x02, 0xd0, 0x02, 0x0d, 0x02, 0x4e, 0x02, 0x8f, 0x02, 0xf1, 0x02, 0x92, 0x0b, 0xb2,
+  0x1b, 0x74, 0x44, 0xb2, 0x13, 0x14, 0x1c, 0x94, 0x44, 0xb5, 0x74, 0x57, 0x85, 0x75, 0x2c, 0xd5, 0x54, 0x8f, 0x02, 0xcf, 0x02, 0xb3, 0x13, 0xb2, 0x13, 0xf3, 0x13, 0xb5, 0x4c, 0x66, 0x08, 0x46,
+  0x08, 0x46, 0x00, 0x67, 0x61, 0x4a, 0xfb, 0x8f, 0xfd, 0x8e, 0xfd, 0x8e, 0x0a, 0x91, 0x0b, 0xf0, 0x02, 0x92, 0x13, 0x6e, 0x02, 0xaf, 0x02, 0x53, 0x24, 0xb3, 0x0b, 0x53, 0x24, 0x91, 0x13, 0x74,
+  0x2c, 0xd4, 0x4c, 0xf4, 0x94, 0x8d, 0x22, 0x51, 0x0b, 0x33, 0x34, 0xf4, 0x7c, 0xd5, 0xbd, 0xb2, 0x03, 0x93, 0x5c, 0x55, 0x8d, 0x53, 0x9d, 0x78, 0xf6, 0xf5, 0x84, 0x56, 0xd6, 0xae, 0x02, 0x71,
+  0x03, 0xb2, 0x03, 0xb4, 0x3c, 0x30, 0x03, 0xef, 0x0a, 0x2f, 0x03, 0xd2, 0x0b, 0xd1, 0x03, 0x53, 0x34, 0x70, 0x03, 0x33, 0x1c, 0x73, 0x64, 0xf2, 0xb4, 0x0d, 0x23, 0x81, 0x8d, 0x02, 0x3b, 0xce,
+  0x0a, 0x0e, 0x03, 0x70, 0x03, 0xf1, 0x1b, 0x12, 0x2c, 0x32, 0x6c, 0x6f, 0x2b, 0x0e, 0x0b, 0x0f, 0x03, 0xce, 0x72, 0xee, 0x82, 0x0e, 0x8b, 0x2e, 0xa3, 0x4e, 0xab, 0x6f, 0xc3, 0x8f, 0xcb, 0x6e,
+  0xcb, 0xce, 0xe3, 0xce, 0xf3, 0x30, 0xfc, 0x4d, 0xd3, 0x6d, 0xeb, 0xad, 0xfb, 0xed, 0xfb, 0x0e, 0xfc, 0x4d, 0xfc, 0x8f, 0xfc, 0x11, 0xfd, 0x0f, 0xfd, 0xee, 0x7a, 0xcd, 0x72, 0x8c, 0x6a, 0x8d,
+  0x62, 0xcd, 0x6a, 0x4d, 0xb3, 0xcd, 0xfb, 0x4f, 0xfc, 0xab, 0xfb, 0x4c, 0xfb, 0x2e, 0xfc, 0x8b, 0xf3, 0xcd, 0xfb, 0xac, 0xfb, 0x2d, 0xfc, 0x4d, 0xfc, 0xcd, 0xfb, 0xed, 0xfb, 0x0d, 0xfc, 0x4d,
+  0xfc, 0x2d, 0xfc, 0x8e, 0xfc, 0x2d, 0xfc, 0x6e, 0xfc, 0x2d, 0xfc, 0x6e, 0xfc, 0x8e, 0xfc, 0xae, 0xfc, 0xce, 0xfc, 0xcf, 0xfc, 0xef, 0xfc, 0x81, 0xae, 0xfc, 0x00, 0xaf, 0xfc, 0x81, 0x8f, 0xfc,
+  0x81, 0x8e, 0xfc, 0x82, 0x6e, 0xfc, 0x00, 0x4e, 0xfc, 0x81, 0x2e, 0xfc, 0x00, 0x0e, 0xfc, 0x81, 0xed, 0xfb, 0x81, 0xcd, 0xfb, 0x81, 0xad, 0xf3, 0x01, 0x8d, 0xeb, 0x6d, 0xeb, 0x81, 0x4c, 0xe3,
+  0x81, 0x8f, 0x02, 0x77, 0xaf, 0x02, 0x8f, 0x02, 0xaf, 0x02, 0xcf, 0x02, 0x11, 0x03, 0xed, 0x09, 0x2e, 0x02, 0x6e, 0x02, 0xd1, 0x02, 0x72, 0x0b, 0x72, 0x03, 0x13, 0x14, 0xb6, 0x4c, 0xd3, 0x13,
+  0x94, 0x3c, 0x77, 0x9d, 0xfa, 0xbd, 0x55, 0x24, 0x15, 0x6d, 0xce, 0x12, 0xf1, 0x0a, 0xb2, 0x0b, 0x54, 0x24, 0x73, 0x0b, 0x29, 0x09, 0x65, 0x08, 0x45, 0x00, 0x85, 0x00, 0x45, 0x08, 0xcb, 0xfa,
+  0xed, 0xfc, 0xcd, 0xfc, 0x51, 0xe5, 0x0d, 0x0a, 0x10, 0x03, 0xd2, 0x13, 0xb5, 0x4c, 0x4e, 0x0a, 0x71, 0x03, 0x13, 0x24, 0x36, 0x7d, 0x91, 0x0b, 0x14, 0x65, 0x75, 0xa5, 0xb4, 0x5c, 0x94, 0xcd,
+  0xf4, 0x9c, 0xb2, 0x0b, 0x92, 0x34, 0xf4, 0x7c, 0x0f, 0x13, 0xf2, 0x13, 0x73, 0x44, 0x34, 0x8d, 0x75, 0xa5, 0x93, 0xfd, 0xf5, 0xcd, 0x32, 0x14, 0xf5, 0x6c, 0x70, 0x0b, 0x54, 0x24, 0xf0, 0x0a,
+  0x8d, 0x02, 0x0f, 0x0b, 0x70, 0x03, 0x33, 0x1c, 0xae, 0x0a, 0xd1, 0x03, 0x52, 0x14, 0x93, 0x6c, 0x13, 0xad, 0xf4, 0x9c, 0x2e, 0x4b, 0x6d, 0x02, 0x30, 0x03, 0x12, 0x34, 0x2f, 0x0b, 0xd0, 0x0b,
+  0xf1, 0x2b, 0xd1, 0x3b, 0xed, 0x02, 0x2f, 0x03, 0xae, 0x52, 0xad, 0x72, 0xee, 0x7a, 0x2e, 0x9b, 0x2d, 0xb3, 0xaf, 0xcb, 0xed, 0xaa, 0x4e, 0xc3, 0x6e, 0xd3, 0xae, 0xeb, 0x2d, 0xd3, 0x4d, 0xdb,
+  0xee, 0xf3, 0x4d, 0xc3, 0x2d, 0xc3, 0xae, 0xe3, 0x8c, 0xfb, 0x70, 0xfc, 0x0f, 0xd4, 0x70, 0xd4, 0x51, 0xc4, 0x8d, 0x4a, 0x4b, 0x5a, 0xee, 0x9a, 0xaf, 0xfb, 0x2b, 0xfb, 0x8b, 0xfb, 0xed, 0xfb,
+  0xac, 0xfb, 0x0e, 0xfc, 0x6b, 0xfb, 0xcd, 0xfb, 0xac, 0xfb, 0x0d, 0xfc, 0x4d, 0xfc, 0xec, 0xfb, 0x8e, 0xfc, 0x2d, 0xfc, 0x81, 0x8e, 0xfc, 0x06, 0x6e, 0xfc, 0x6d, 0xfc, 0xae, 0xfc, 0x8e, 0xfc,
+  0xcf, 0xfc, 0xae, 0xfc, 0xce, 0xfc, 0x83, 0xef, 0xfc, 0x81, 0x0f, 0xfd, 0x02, 0xef, 0xfc, 0xcf, 0xfc, 0xae, 0xfc, 0x82, 0xaf, 0xfc, 0x01, 0x8f, 0xfc, 0x8e, 0xfc, 0x81, 0x6e, 0xfc, 0x00, 0x4e,
+  0xfc, 0x81, 0x2e, 0xfc, 0x00, 0x0e, 0xfc, 0x81, 0x0d, 0xfc, 0x07, 0xed, 0xfb, 0xcd, 0xfb, 0xcd, 0xf3, 0xac, 0xf3, 0x8c, 0xeb, 0x6d, 0xeb, 0x4c, 0xe3, 0x8f, 0x02, 0x81, 0xaf, 0x02, 0x58, 0xcf,
+  0x02, 0xaf, 0x02, 0xcf, 0x02, 0x31, 0x0b, 0x0d, 0x02, 0x2d, 0x02, 0x6f, 0x02, 0xb0, 0x02, 0x32, 0x0b, 0x11, 0x03, 0xb3, 0x13, 0x74, 0x24, 0xb6, 0x4c, 0x74, 0x34, 0x74, 0x4c, 0x76, 0x75, 0x32,
+  0x34, 0xb6, 0x44, 0x95, 0x5c, 0xd1, 0x02, 0xd3, 0x03, 0xb3, 0x0b, 0x8a, 0x09, 0x65, 0x08, 0x67, 0x08, 0x66, 0x00, 0x65, 0x08, 0x65, 0x10, 0xce, 0xf4, 0x8b, 0xfc, 0x0c, 0xdc, 0x4e, 0xfd, 0xee,
+  0x6b, 0xf1, 0x02, 0xf3, 0x0b, 0x53, 0x34, 0x54, 0x44, 0x91, 0x03, 0x54, 0x1c, 0xb4, 0x44, 0x56, 0x9d, 0x35, 0x6d, 0x14, 0xde, 0x35, 0x65, 0x75, 0xa5, 0x94, 0xc5, 0x75, 0xfe, 0x93, 0x03, 0xd2,
+  0x03, 0xf2, 0x1b, 0x53, 0x34, 0x32, 0x24, 0x94, 0x2c, 0x34, 0x8d, 0xb3, 0xd5, 0x54, 0xfe, 0x92, 0x3c, 0xf4, 0x5c, 0x11, 0x34, 0xd2, 0x0b, 0x50, 0x23, 0x0f, 0x0b, 0x90, 0x03, 0xd4, 0x3c, 0x0e,
+  0x13, 0x2f, 0x03, 0xf1, 0x03, 0x53, 0x24, 0xf3, 0x64, 0xd2, 0x74, 0xf2, 0x6c, 0x32, 0xbd, 0x8d, 0x1a, 0xef, 0x02, 0x12, 0x2c, 0xd0, 0x33, 0x14, 0x8d, 0x4f, 0x0b, 0xee, 0x0a, 0x0e, 0x03, 0x0e,
+  0x4b, 0x2d, 0x83, 0x4e, 0xa3, 0x6f, 0xb3, 0xd0, 0xab, 0xcd, 0xa2, 0x2d, 0xbb, 0x6d, 0xd3, 0xae, 0xe3, 0x81, 0xee, 0xf3, 0x0b, 0x0c, 0xc3, 0x2d, 0xc3, 0x4d, 0xcb, 0x6d, 0xdb, 0xae, 0xe3, 0x4d,
+  0xab, 0x0d, 0xa3, 0x0d, 0xbb, 0x4e, 0xe3, 0x2c, 0xf3, 0x6c, 0xfb, 0x8d, 0xfb, 0x81, 0xed, 0xfb, 0x0f, 0x2d, 0xf4, 0x8c, 0xfb, 0x2d, 0xfc, 0x4d, 0xfc, 0xae, 0xfc, 0x0c, 0xfc, 0x2d, 0xfc, 0x2c,
+  0xfc, 0x4d, 0xfc, 0x2c, 0xfc, 0xae, 0xfc, 0x4d, 0xfc, 0x8d, 0xfc, 0xad, 0xfc, 0x8d, 0xfc, 0x8e, 0xfc, 0x81, 0xce, 0xfc, 0x06, 0x0f, 0xfd, 0xef, 0xfc, 0x0f, 0xfd, 0x2f, 0xfd, 0x4f, 0xfd, 0x30,
+  0xfd, 0x50, 0xfd, 0x82, 0x70, 0xfd, 0x05, 0xb2, 0xfd, 0x50, 0xfd, 0x30, 0xfd, 0x0f, 0xfd, 0xef, 0xfc, 0xcf, 0xfc, 0x82, 0xaf, 0xfc, 0x00, 0x8e, 0xfc, 0x81, 0x6e, 0xfc, 0x81, 0x4e, 0xfc, 0x00,
+  0x2e, 0xfc, 0x81, 0x0d, 0xfc, 0x81, 0xed, 0xfb, 0x04, 0xcd, 0xfb, 0xad, 0xf3, 0x8c, 0xf3, 0x8d, 0xeb, 0x6c, 0xeb, 0x82, 0xaf, 0x02, 0x00, 0xcf, 0x02, 0x82, 0xf0, 0x02, 0x09, 0xaf, 0x0a, 0xed,
+  0x01, 0x2e, 0x02, 0xed, 0x01, 0x8f, 0x02, 0x11, 0x03, 0xb3, 0x03, 0xb2, 0x03, 0x75, 0x34, 0x91, 0x0b, 0x81, 0x96, 0x3c, 0x6b, 0xb8, 0x85, 0x75, 0x24, 0x34, 0x3c, 0xb0, 0x0a, 0x12, 0x03, 0x87,
+  0x00, 0x45, 0x08, 0x66, 0x08, 0x66, 0x00, 0x46, 0x10, 0x65, 0x10, 0xa9, 0x40, 0x2d, 0xfd, 0x6c, 0xec, 0x0b, 0xa3, 0x0e, 0xfd, 0x30, 0xfd, 0x8f, 0x02, 0x52, 0x03, 0x13, 0x24, 0x51, 0x2b, 0x71,
+  0x0b, 0x13, 0x0c, 0x94, 0x2c, 0x16, 0x7d, 0xb4, 0x54, 0x54, 0x9d, 0x72, 0x54, 0xf7, 0xb5, 0x73, 0xc5, 0xd4, 0xd5, 0x8e, 0x0a, 0xd4, 0x03, 0x34, 0x24, 0xf3, 0x03, 0x53, 0x1c, 0x56, 0x8d, 0x72,
+  0x3c, 0x13, 0x95, 0x95, 0xb5, 0xf5, 0xfd, 0xf2, 0x2b, 0x32, 0x34, 0x15, 0x5d, 0x91, 0x03, 0x92, 0x24, 0xb0, 0x23, 0x12, 0x04, 0x33, 0x24, 0x56, 0x8d, 0x72, 0x3c, 0xd1, 0x0b, 0x73, 0x54, 0xcf,
+  0x0b, 0x72, 0x6c, 0x32, 0xad, 0x76, 0xe6, 0xb1, 0x13, 0xf2, 0x13, 0x32, 0x4c, 0xb2, 0x7c, 0xad, 0x32, 0xae, 0x5a, 0xcd, 0x62, 0xed, 0x72, 0x0e, 0x7b, 0xee, 0x72, 0x2f, 0xb3, 0x6e, 0xc3, 0xae,
+  0xd3, 0xae, 0xe3, 0x8d, 0xeb, 0x0d, 0xf4, 0x0f, 0xdc, 0xad, 0xba, 0x2c, 0xd3, 0x8d, 0xdb, 0xcb, 0x9a, 0xac, 0x8a, 0x8e, 0xc3, 0xae, 0xeb, 0xeb, 0xe2, 0x6e, 0xfb, 0xcd, 0xfb, 0x6c, 0xfb, 0xed,
+  0xfb, 0x6b, 0xfb, 0x2d, 0xfc, 0xcc, 0xfb, 0x4d, 0xf4, 0xac, 0xfb, 0xec, 0xfb, 0xcc, 0xfb, 0x2d, 0xfc, 0x4d, 0xfc, 0x8e, 0xfc, 0x6d, 0xfc, 0xef, 0xfc, 0x0e, 0xfd, 0xee, 0xfc, 0x0e, 0xfd, 0x2f,
+  0xfd, 0xee, 0xfc, 0x0e, 0xfd, 0x2f, 0xfd, 0x4f, 0xfd, 0x6f, 0xfd, 0x4f, 0xfd, 0x82, 0x70, 0xfd, 0x00, 0x90, 0xfd, 0x81, 0xb0, 0xfd, 0x81, 0xd1, 0xfd, 0x04, 0x90, 0xfd, 0x26, 0x00, 0x6a, 0xfc,
+  0x70, 0xfd, 0x50, 0xfd, 0x81, 0x10, 0xfd, 0x00, 0xef, 0xfc, 0x81, 0xcf, 0xfc, 0x03, 0xaf, 0xfc, 0x8f, 0xfc, 0x8e, 0xfc, 0x6e, 0xfc, 0x81, 0x4e, 0xfc, 0x00, 0x2e, 0xfc, 0x81, 0x0d, 0xfc, 0x00,
+  0xed, 0xfb, 0x81, 0xcd, 0xfb, 0x03, 0xad, 0xf3, 0x8c, 0xf3, 0x6c, 0xeb, 0xaf, 0x02, 0x81, 0xd0, 0x02, 0x83, 0xf0, 0x02, 0x11, 0xd0, 0x02, 0x4e, 0x02, 0x4a, 0x01, 0xac, 0x01, 0x2e, 0x02, 0xd0,
+  0x02, 0x11, 0x03, 0xd4, 0x13, 0xb3, 0x0b, 0xb6, 0x34, 0xb3, 0x1b, 0xf3, 0x23, 0x34, 0x14, 0x95, 0x24, 0x18, 0x4d, 0xaf, 0x0a, 0xa7, 0x00, 0x66, 0x10, 0x81, 0x66, 0x08, 0x36, 0x67, 0x08, 0x86,
+  0x00, 0x0a, 0x81, 0xa9, 0x50, 0x6b, 0xfc, 0x2c, 0xa3, 0x88, 0x51, 0xae, 0xfc, 0x0d, 0xfd, 0x0d, 0x63, 0x10, 0x03, 0xd3, 0x0b, 0xf3, 0x2b, 0x30, 0x03, 0xd2, 0x03, 0x74, 0x1c, 0xf4, 0x54, 0x52,
+  0x1c, 0xf5, 0x5c, 0xb4, 0x4c, 0x96, 0xb5, 0xd5, 0x6c, 0x34, 0x95, 0x35, 0x8d, 0x37, 0xe6, 0x92, 0x0b, 0x8f, 0x0a, 0xd2, 0x03, 0xd4, 0x44, 0x36, 0x65, 0x93, 0x2c, 0xf5, 0x84, 0x4d, 0x02, 0xf0,
+  0x02, 0x11, 0x03, 0x12, 0x3c, 0xad, 0x02, 0xb2, 0x0b, 0xf2, 0x2b, 0xb1, 0x0b, 0x52, 0x44, 0x52, 0x34, 0x33, 0x85, 0x16, 0xee, 0x12, 0x2c, 0x73, 0x14, 0xd3, 0x8c, 0x93, 0xdd, 0x72, 0xcd, 0xb2,
+  0x7c, 0xb0, 0x13, 0x2e, 0x1b, 0x70, 0x73, 0x0f, 0x73, 0x0e, 0x73, 0x81, 0xee, 0x72, 0x0e, 0x0e, 0x83, 0xee, 0xb2, 0x8e, 0xcb, 0xae, 0xe3, 0x0f, 0xec, 0xaf, 0xcb, 0x2c, 0xa3, 0x0c, 0xa3, 0x0d,
+  0xb3, 0x2d, 0xc3, 0x2c, 0xcb, 0xae, 0xfb, 0xad, 0xfb, 0x4f, 0xfc, 0x4b, 0xeb, 0x81, 0xed, 0xfb, 0x11, 0x6c, 0xfb, 0xed, 0xfb, 0xcd, 0xfb, 0x4d, 0xfc, 0x2c, 0xfc, 0x2d, 0xfc, 0x4c, 0xfc, 0xae,
+  0xfc, 0x6e, 0xfc, 0x4d, 0xfc, 0x6d, 0xfc, 0x8d, 0xfc, 0xad, 0xfc, 0xce, 0xfc, 0x0e, 0xfd, 0x4f, 0xfd, 0x6f, 0xfd, 0x4f, 0xfd, 0x81, 0x6f, 0xfd, 0x01, 0x8f, 0xfd, 0x90, 0xfd, 0x82, 0xb0, 0xfd,
+  0x00, 0xd1, 0xfd, 0x81, 0xf1, 0xfd, 0x82, 0x11, 0xfe, 0x81, 0x31, 0xfe, 0x0a, 0x11, 0xfe, 0x48, 0x39, 0x04, 0x10, 0xc7, 0xfb, 0x8b, 0xfc, 0x70, 0xfd, 0x4f, 0xfd, 0x50, 0xfd, 0x2f, 0xfd, 0x0f,
+  0xfd, 0xef, 0xfc, 0x81, 0xcf, 0xfc, 0x81, 0xaf, 0xfc, 0x02, 0x8f, 0xfc, 0x6e, 0xfc, 0x4e, 0xfc, 0x81, 0x2e, 0xfc, 0x03, 0x0e, 0xfc, 0x0d, 0xfc, 0xed, 0xfb, 0xcd, 0xfb, 0x81, 0xac, 0xf3, 0x00,
+  0xd0, 0x02, 0x81, 0xf0, 0x02, 0x83, 0x10, 0x03, 0x18, 0xf0, 0x02, 0x8b, 0x01, 0x6b, 0x01, 0xcc, 0x01, 0x6f, 0x02, 0xb0, 0x02, 0x8f, 0x0a, 0x72, 0x03, 0x76, 0x2c, 0xb3, 0x0b, 0x14, 0x2c, 0x73,
+  0x0b, 0xd3, 0x0b, 0x34, 0x14, 0x51, 0x23, 0x45, 0x10, 0x45, 0x08, 0x46, 0x08, 0x66, 0x08, 0x86, 0x00, 0x67, 0x08, 0x66, 0x08, 0xed, 0xa8, 0xac, 0x88, 0x0b, 0xf2, 0x81, 0x45, 0x08, 0x3f, 0xec,
+  0xfb, 0x2e, 0xf5, 0x0e, 0xfd, 0xad, 0x32, 0xf1, 0x02, 0xb4, 0x03, 0xb2, 0x13, 0x71, 0x0b, 0x13, 0x0c, 0xb4, 0x2c, 0xd5, 0x3c, 0xd1, 0x03, 0xd6, 0x44, 0xf4, 0x64, 0x77, 0x8d, 0x34, 0x1c, 0x14,
+  0x7d, 0x34, 0x9d, 0xf4, 0xdd, 0x8e, 0x02, 0x92, 0x03, 0x32, 0x14, 0x53, 0x14, 0x93, 0x44, 0x10, 0x0b, 0x13, 0x0c, 0x74, 0x3c, 0xf4, 0x74, 0xd4, 0xe5, 0x13, 0xfe, 0x78, 0xde, 0x8e, 0x0a, 0xd0,
+  0x13, 0x10, 0x0b, 0xd3, 0x0b, 0x93, 0x3c, 0xf3, 0x8c, 0x94, 0xd5, 0x56, 0x95, 0x72, 0x7c, 0x92, 0x64, 0x33, 0xb5, 0xf5, 0xd5, 0x90, 0x23, 0x0e, 0x6b, 0x2e, 0x9b, 0x4e, 0xb3, 0x6e, 0xc3, 0xcf,
+  0xdb, 0x2f, 0xf4, 0x50, 0xfc, 0xae, 0xe3, 0x4e, 0xc3, 0xee, 0x82, 0xec, 0x92, 0x0d, 0x93, 0x0c, 0x9b, 0x4d, 0xcb, 0xee, 0xf3, 0xcd, 0xf3, 0x0e, 0xfc, 0x8d, 0xfb, 0x0e, 0xfc, 0x8c, 0xfb, 0x81,
+  0xed, 0xfb, 0x08, 0xcc, 0xfb, 0x2e, 0xfc, 0x2d, 0xfc, 0x4e, 0xfc, 0xce, 0xfc, 0xae, 0xfc, 0xad, 0xfc, 0x6d, 0xfc, 0xce, 0xf4, 0x81, 0xce, 0xfc, 0x02, 0xee, 0xfc, 0x0f, 0xfd, 0x2f, 0xfd, 0x82,
+  0x6f, 0xfd, 0x01, 0x90, 0xfd, 0xd0, 0xfd, 0x81, 0xf1, 0xfd, 0x81, 0xf0, 0xfd, 0x01, 0xf1, 0xfd, 0x11, 0xfe, 0x81, 0x32, 0xfe, 0x81, 0x52, 0xfe, 0x82, 0x72, 0xfe, 0x08, 0x91, 0xfe, 0xd2, 0xd5,
+  0x08, 0x69, 0x67, 0x18, 0x24, 0x00, 0x67, 0xfb, 0xe8, 0xfb, 0x6e, 0xfd, 0xb0, 0xfd, 0x81, 0x70, 0xfd, 0x03, 0x50, 0xfd, 0x30, 0xfd, 0x0f, 0xfd, 0xef, 0xfc, 0x81, 0xcf, 0xfc, 0x02, 0xaf, 0xfc,
+  0x8f, 0xfc, 0x8e, 0xfc, 0x81, 0x4e, 0xfc, 0x05, 0x2e, 0xfc, 0x2d, 0xfc, 0x0d, 0xfc, 0xed, 0xfb, 0xcd, 0xfb, 0xad, 0xf3, 0x81, 0xf0, 0x02, 0x81, 0x10, 0x03, 0x00, 0x11, 0x03, 0x81, 0x31, 0x03,
+  0x0e, 0x6e, 0x0a, 0x29, 0x01, 0x4b, 0x01, 0xac, 0x01, 0x0d, 0x02, 0x6f, 0x02, 0x11, 0x03, 0xd3, 0x13, 0x55, 0x2c, 0x31, 0x03, 0xf4, 0x1b, 0x8e, 0x0a, 0xc8, 0x08, 0xc7, 0x00, 0x45, 0x08, 0x82,
+  0x66, 0x08, 0x41, 0x67, 0x08, 0x46, 0x08, 0xcb, 0x38, 0x88, 0x28, 0xed, 0x88, 0x0e, 0xa1, 0xeb, 0x78, 0x26, 0x08, 0x45, 0x10, 0x66, 0x71, 0xcb, 0xf3, 0x0c, 0xfd, 0x4e, 0xfd, 0x6c, 0x1a, 0x32,
+  0x0b, 0x93, 0x03, 0x72, 0x13, 0x91, 0x03, 0x31, 0x0b, 0x34, 0x0c, 0xf6, 0x4c, 0x54, 0x0c, 0xb4, 0x2c, 0x15, 0x55, 0x94, 0x3c, 0xb4, 0x44, 0x34, 0x9d, 0xf4, 0xed, 0x90, 0x2b, 0x75, 0x5c, 0x96,
+  0x85, 0x51, 0x0b, 0x72, 0x0b, 0x74, 0x24, 0xf1, 0x03, 0x92, 0x4c, 0x93, 0x3c, 0xb5, 0xcd, 0x13, 0xfe, 0x74, 0xfe, 0x11, 0x64, 0xf3, 0xbc, 0xf4, 0xfd, 0x91, 0x6c, 0x14, 0x8d, 0xf3, 0x64, 0xd3,
+  0x7c, 0x53, 0xa5, 0xd1, 0x94, 0x93, 0x64, 0xd2, 0x8c, 0x74, 0xdd, 0x4e, 0x0b, 0x12, 0x74, 0x2f, 0x93, 0xaf, 0xcb, 0x6f, 0xc3, 0x4d, 0xbb, 0x6e, 0xcb, 0xcf, 0xa3, 0xed, 0x7a, 0x0e, 0x83, 0xcd,
+  0x82, 0xac, 0x92, 0xae, 0xeb, 0x0e, 0xfc, 0x81, 0x2e, 0xfc, 0x10, 0x8c, 0xfb, 0x2e, 0xfc, 0x4c, 0xfb, 0xad, 0xfb, 0xed, 0xfb, 0xcd, 0xfb, 0xed, 0xfb, 0x0d, 0xfc, 0x4e, 0xfc, 0x8d, 0xfc, 0x8e,
+  0xfc, 0xce, 0xfc, 0x4f, 0xfd, 0xef, 0xfc, 0xf3, 0x9c, 0x10, 0xed, 0x4e, 0xf5, 0x81, 0xb0, 0xfd, 0x00, 0x90, 0xfd, 0x81, 0xb0, 0xfd, 0x00, 0xd1, 0xfd, 0x81, 0x11, 0xfe, 0x01, 0x31, 0xfe, 0x11,
+  0xfe, 0x81, 0x31, 0xfe, 0x81, 0x52, 0xfe, 0x00, 0x72, 0xfe, 0x81, 0x92, 0xfe, 0x82, 0xb2, 0xfe, 0x00, 0x92, 0xfe, 0x81, 0xd2, 0xfe, 0x09, 0x44, 0x10, 0x65, 0x08, 0x45, 0x08, 0x03, 0x10, 0x47,
+  0xfb, 0xe5, 0xfa, 0x8b, 0xfc, 0xf1, 0xfd, 0xd1, 0xfd, 0x90, 0xfd, 0x81, 0x70, 0xfd, 0x02, 0x2f, 0xfd, 0x0f, 0xfd, 0xef, 0xfc, 0x81, 0xcf, 0xfc, 0x81, 0xaf, 0xfc, 0x08, 0x8f, 0xfc, 0x6e, 0xfc,
+  0x4e, 0xfc, 0x2e, 0xfc, 0x2d, 0xfc, 0x0d, 0xfc, 0xed, 0xfb, 0xcd, 0xfb, 0xf0, 0x02, 0x81, 0x10, 0x03, 0x00, 0x11, 0x03, 0x82, 0x31, 0x03, 0x0c, 0xe9, 0x00, 0x2a, 0x01, 0x4b, 0x01, 0x8b, 0x01,
+  0x0d, 0x02, 0x4f, 0x02, 0xf1, 0x02, 0xb3, 0x0b, 0xd6, 0x34, 0x31, 0x03, 0xea, 0x00, 0xe9, 0x00, 0xc8, 0x00, 0x81, 0x45, 0x08, 0x81, 0x66, 0x08, 0x09, 0x67, 0x08, 0x66, 0x08, 0xa8, 0x08, 0x8b,
+  0x48, 0xca, 0x30, 0x0c, 0x29, 0x87, 0x08, 0x26, 0x10, 0x66, 0x08, 0x26, 0x18, 0x81, 0x86, 0x18, 0x35, 0xce, 0xfc, 0xcd, 0xfc, 0x6d, 0xfd, 0x6e, 0x12, 0xcf, 0x12, 0x92, 0x13, 0xf3, 0x33, 0x90,
+  0xfc, 0x94, 0x2c, 0xf6, 0x44, 0x92, 0x03, 0x33, 0x0c, 0xb4, 0x44, 0x15, 0x6d, 0x53, 0x0c, 0xd5, 0x54, 0x18, 0xb6, 0x13, 0x0c, 0xb4, 0x4c, 0x55, 0x95, 0x36, 0xee, 0xb3, 0x03, 0xf6, 0x44, 0x70,
+  0x0b, 0x94, 0x34, 0x73, 0x3c, 0x53, 0x95, 0x95, 0xd5, 0x12, 0xfe, 0xd5, 0xfe, 0x93, 0x74, 0x92, 0xf5, 0xd4, 0xc5, 0x93, 0x7c, 0xf3, 0xf5, 0x53, 0x54, 0x33, 0x95, 0x92, 0xdd, 0xf2, 0x3b, 0x52,
+  0x2c, 0xb2, 0xa4, 0x70, 0x2b, 0x70, 0x73, 0xae, 0x9b, 0x91, 0x9b, 0x2d, 0x5a, 0x8e, 0x62, 0xce, 0x72, 0x2e, 0x8b, 0x0e, 0xb3, 0x4d, 0xbb, 0x6d, 0xf3, 0xce, 0xfb, 0x0e, 0xfc, 0x82, 0xcd, 0xfb,
+  0x0a, 0x4c, 0xfb, 0x0e, 0xfc, 0xcd, 0xfb, 0x0d, 0xfc, 0x4d, 0xfc, 0x6d, 0xfc, 0x8e, 0xfc, 0xae, 0xfc, 0x0e, 0xfd, 0x2f, 0xfd, 0x0f, 0xfd, 0x81, 0x2f, 0xfd, 0x01, 0x4d, 0x32, 0xf0, 0x83, 0x81,
+  0x2f, 0xfd, 0x07, 0x90, 0xfd, 0xb0, 0xfd, 0xf1, 0xfd, 0x11, 0xfe, 0x31, 0xfe, 0x51, 0xfe, 0x52, 0xfe, 0x71, 0xfe, 0x81, 0x72, 0xfe, 0x82, 0x92, 0xfe, 0x00, 0xb3, 0xfe, 0x81, 0xd3, 0xfe, 0x81,
+  0xf3, 0xfe, 0x12, 0x13, 0xff, 0x34, 0xff, 0xf3, 0xfe, 0xd3, 0xfe, 0x0b, 0x6b, 0x23, 0x08, 0x45, 0x00, 0x65, 0x10, 0x66, 0x08, 0xaa, 0xe2, 0x27, 0xfb, 0x48, 0xfc, 0x6a, 0xfc, 0x31, 0xfe, 0xf1,
+  0xfd, 0xb1, 0xfd, 0x90, 0xfd, 0x70, 0xfd, 0x50, 0xfd, 0x81, 0x0f, 0xfd, 0x01, 0xef, 0xfc, 0xcf, 0xfc, 0x81, 0xaf, 0xfc, 0x01, 0x8e, 0xfc, 0x6e, 0xfc, 0x81, 0x4e, 0xfc, 0x03, 0x2e, 0xfc, 0x0d,
+  0xfc, 0xed, 0xfb, 0x10, 0x03, 0x81, 0x11, 0x03, 0x81, 0x31, 0x03, 0x59, 0x52, 0x03, 0x51, 0x03, 0x0a, 0x01, 0x2a, 0x01, 0x4b, 0x01, 0x8b, 0x01, 0xcc, 0x01, 0x2e, 0x02, 0x8f, 0x02, 0x52, 0x03,
+  0x34, 0x24, 0xac, 0x01, 0x2a, 0x01, 0x09, 0x01, 0x46, 0x08, 0x65, 0x08, 0x66, 0x08, 0x46, 0x08, 0x66, 0x08, 0x67, 0x08, 0x66, 0x08, 0x8a, 0x28, 0xca, 0x30, 0xca, 0x00, 0xc9, 0x00, 0x67, 0x08,
+  0x66, 0x00, 0xcb, 0x48, 0xeb, 0x48, 0x88, 0x10, 0xca, 0x92, 0x8d, 0xfc, 0xce, 0xfc, 0xec, 0xfc, 0x6e, 0xfd, 0x0f, 0xd5, 0x48, 0x29, 0x67, 0x08, 0xec, 0xfa, 0x10, 0xd5, 0xd5, 0x95, 0x10, 0x2b,
+  0x72, 0x03, 0x33, 0x14, 0xf6, 0x44, 0x98, 0x65, 0xf3, 0x0b, 0xae, 0x02, 0xd2, 0x03, 0x94, 0x54, 0xf5, 0x84, 0xd0, 0x7b, 0xca, 0xf3, 0xf3, 0x03, 0xd5, 0x3c, 0xb4, 0x3c, 0x93, 0x14, 0x94, 0xa5,
+  0xd5, 0x94, 0xf3, 0xed, 0xd5, 0xfe, 0x71, 0x7c, 0xd3, 0xed, 0x94, 0xfe, 0x17, 0xff, 0x12, 0xbd, 0xd5, 0xb5, 0x93, 0x6c, 0x11, 0xa5, 0x4e, 0x2b, 0xd2, 0x0b, 0x72, 0x3c, 0xb0, 0x7b, 0x8e, 0x93,
+  0xf1, 0xb3, 0xef, 0xcb, 0x0f, 0xe4, 0xca, 0x31, 0xaa, 0x39, 0x2a, 0xfb, 0xcf, 0xfb, 0x6d, 0xfb, 0x2e, 0xfc, 0xec, 0xfb, 0x4e, 0xfc, 0x6e, 0xfc, 0xcd, 0xfb, 0x8c, 0xfb, 0xed, 0xfb, 0x0d, 0xfc,
+  0x81, 0x2d, 0xfc, 0x0c, 0xae, 0xfc, 0xed, 0xfc, 0x4f, 0xfd, 0xee, 0xfc, 0xce, 0xfc, 0xb2, 0xfd, 0xcc, 0x6a, 0x48, 0x09, 0x0c, 0x22, 0xd2, 0xf5, 0xb0, 0xfd, 0xd1, 0xfd, 0xf1, 0xfd, 0x81, 0x11,
+  0xfe, 0x00, 0x31, 0xfe, 0x81, 0x72, 0xfe, 0x07, 0xb3, 0xfe, 0x92, 0xfe, 0xc8, 0x8a, 0x92, 0xfe, 0xb3, 0xfe, 0xd2, 0xfe, 0xd3, 0xfe, 0xf3, 0xfe, 0x81, 0x13, 0xff, 0x81, 0x14, 0xff, 0x01, 0x34,
+  0xff, 0x55, 0xff, 0x81, 0x54, 0xff, 0x00, 0x50, 0x8c, 0x81, 0x44, 0x08, 0x81, 0x45, 0x08, 0x0e, 0x44, 0x08, 0x43, 0x20, 0x48, 0xe3, 0xe9, 0xfb, 0x09, 0xfc, 0x6b, 0xfc, 0x10, 0xfe, 0xf2, 0xfd,
+  0xf0, 0xfd, 0x90, 0xfd, 0x70, 0xfd, 0x50, 0xfd, 0x30, 0xfd, 0x10, 0xfd, 0xef, 0xfc, 0x81, 0xcf, 0xfc, 0x07, 0xaf, 0xfc, 0x8f, 0xfc, 0x6e, 0xfc, 0x4e, 0xfc, 0x2e, 0xfc, 0x2d, 0xfc, 0x0d, 0xfc,
+  0x10, 0x03, 0x83, 0x31, 0x03, 0x0d, 0x51, 0x03, 0x31, 0x03, 0xf0, 0x0a, 0x09, 0x01, 0x0a, 0x01, 0x4a, 0x01, 0x6b, 0x09, 0xac, 0x01, 0x6f, 0x02, 0x4f, 0x02, 0x0a, 0x01, 0x6c, 0x01, 0xe9, 0x00,
+  0x0a, 0x01, 0x83, 0x66, 0x08, 0x45, 0x88, 0x08, 0x66, 0x08, 0x89, 0x10, 0x47, 0x08, 0x88, 0x20, 0xea, 0x00, 0x67, 0x00, 0x66, 0x08, 0x67, 0x10, 0x89, 0x28, 0x48, 0x20, 0x88, 0x18, 0xad, 0xfc,
+  0x2b, 0xf4, 0x8d, 0xfc, 0x8b, 0xfc, 0x0e, 0xfd, 0x45, 0x08, 0x47, 0x08, 0x67, 0x08, 0x8b, 0xda, 0x0b, 0xfb, 0x6e, 0x6b, 0x35, 0x75, 0x92, 0x0b, 0x95, 0x3c, 0x34, 0x0c, 0xb3, 0x3c, 0xce, 0x1a,
+  0xcf, 0x02, 0xb2, 0x03, 0x12, 0x14, 0xf1, 0x23, 0x64, 0x18, 0x49, 0xfb, 0xd3, 0x64, 0xf3, 0x1b, 0x53, 0x3c, 0x93, 0x54, 0x33, 0x9d, 0x56, 0xd6, 0x32, 0xa5, 0xf7, 0xfe, 0x11, 0x44, 0xd2, 0xa4,
+  0xb2, 0xf5, 0x52, 0xfe, 0x12, 0x95, 0xf4, 0x9c, 0x73, 0xa5, 0x15, 0xd6, 0x13, 0xa5, 0x37, 0xde, 0x74, 0x74, 0xaf, 0xbb, 0xae, 0xd3, 0x2e, 0xdc, 0x0f, 0xcc, 0xee, 0xd3, 0x0e, 0xf4, 0xaf, 0xfb,
+  0xf1, 0x3a, 0xaa, 0x09, 0x49, 0x29, 0x4f, 0xfc, 0x4e, 0xfc, 0xce, 0xfc, 0x2e, 0xfc, 0xed, 0xfb, 0x4e, 0xfc, 0x81, 0xce, 0xfc, 0x0a, 0x8e, 0xfc, 0xae, 0xfc, 0xef, 0xfc, 0x4f, 0xfd, 0x71, 0xf5,
+  0xc8, 0x49, 0xc9, 0x10, 0x28, 0x01, 0x2d, 0x22, 0x11, 0xbd, 0xcf, 0xfd, 0x81, 0xf1, 0xfd, 0x0d, 0x11, 0xfe, 0x31, 0xfe, 0x51, 0xfe, 0x52, 0xfe, 0x92, 0xfe, 0xb2, 0xfe, 0xd3, 0xfe, 0xf3, 0xfe,
+  0xb0, 0xa4, 0x47, 0xc2, 0x0a, 0xf4, 0xf3, 0xfe, 0x13, 0xff, 0x14, 0xff, 0x82, 0x34, 0xff, 0x82, 0x55, 0xff, 0x81, 0x75, 0xff, 0x02, 0x69, 0x52, 0x45, 0x08, 0x44, 0x08, 0x82, 0x45, 0x08, 0x10,
+  0x44, 0x08, 0x84, 0x10, 0x89, 0xfb, 0x48, 0xfb, 0x69, 0xfb, 0x09, 0xfc, 0x4a, 0xfc, 0xcf, 0xfd, 0xf1, 0xfd, 0xd1, 0xfd, 0xb1, 0xfd, 0x90, 0xfd, 0x50, 0xfd, 0x30, 0xfd, 0x10, 0xfd, 0x0f, 0xfd,
+  0xcf, 0xfc, 0x81, 0xaf, 0xfc, 0x01, 0x8f, 0xfc, 0x6e, 0xfc, 0x81, 0x4e, 0xfc, 0x01, 0x0d, 0xfc, 0x10, 0x03, 0x82, 0x31, 0x03, 0x65, 0x51, 0x03, 0x52, 0x03, 0x71, 0x03, 0x72, 0x0b, 0xb3, 0x23,
+  0x10, 0x53, 0xd6, 0xa4, 0xfa, 0xcd, 0x1a, 0xc6, 0x57, 0xa5, 0x14, 0x74, 0x8f, 0x3a, 0xad, 0x09, 0xea, 0x00, 0xc9, 0x00, 0x66, 0x08, 0x46, 0x08, 0x66, 0x08, 0x88, 0x08, 0x87, 0x08, 0x66, 0x08,
+  0xa9, 0x10, 0x65, 0x00, 0xa9, 0x08, 0x0a, 0x01, 0x45, 0x08, 0x66, 0x08, 0x87, 0x08, 0x67, 0x10, 0x68, 0x10, 0x6d, 0xe4, 0x6d, 0xfc, 0x6b, 0xfb, 0x0a, 0xfb, 0xaa, 0xfb, 0x0b, 0xfc, 0x24, 0x10,
+  0x26, 0x00, 0x46, 0x08, 0xc7, 0x48, 0x6b, 0xfa, 0x8c, 0xfa, 0xb0, 0x3a, 0xb6, 0x4c, 0x34, 0x1c, 0xf5, 0x4c, 0x13, 0x0c, 0x91, 0x2b, 0xf0, 0x02, 0x92, 0x03, 0x14, 0x0c, 0x25, 0x08, 0xe7, 0x91,
+  0x4a, 0xfc, 0xae, 0xfd, 0x72, 0x34, 0x50, 0x13, 0x73, 0x24, 0xb3, 0x5c, 0xd4, 0xcd, 0x13, 0x4d, 0x93, 0xdd, 0xb2, 0x7c, 0x93, 0x6c, 0x13, 0xb5, 0xd2, 0xf5, 0xf2, 0xfd, 0x13, 0xa5, 0x72, 0x4c,
+  0x30, 0xd5, 0xb3, 0x74, 0x53, 0xad, 0x31, 0xb4, 0x70, 0xdc, 0xce, 0xd3, 0x4c, 0xd3, 0xad, 0xe3, 0xac, 0xfb, 0x4c, 0xfb, 0x0e, 0xfc, 0x0e, 0xf4, 0xae, 0xf3, 0x6e, 0x12, 0xca, 0x09, 0xcb, 0x09,
+  0x06, 0x21, 0x31, 0xfd, 0x30, 0xfd, 0xcf, 0xfc, 0xce, 0xfc, 0x0f, 0xfd, 0x2f, 0xfd, 0x50, 0xfd, 0xcd, 0x93, 0x6a, 0x11, 0x8a, 0x01, 0x8b, 0x11, 0x8b, 0x09, 0x8e, 0x7b, 0xd0, 0xfd, 0xf2, 0xfd,
+  0x11, 0xfe, 0x81, 0x31, 0xfe, 0x00, 0x52, 0xfe, 0x81, 0x72, 0xfe, 0x08, 0xb3, 0xfe, 0xd3, 0xfe, 0xf3, 0xfe, 0x33, 0xff, 0x15, 0xf7, 0x66, 0x08, 0xe8, 0xe2, 0xc8, 0xfb, 0xee, 0xfd, 0x81, 0x54,
+  0xff, 0x0b, 0x55, 0xff, 0x75, 0xff, 0xb5, 0xff, 0x55, 0xff, 0x54, 0xff, 0x96, 0xff, 0x95, 0xff, 0x8f, 0x73, 0xa9, 0x18, 0x45, 0x08, 0x44, 0x08, 0x25, 0x08, 0x81, 0x86, 0x08, 0x02, 0x25, 0x08,
+  0xc5, 0x28, 0x4a, 0xfb, 0x81, 0x08, 0xfb, 0x0b, 0x29, 0xfb, 0xea, 0xfb, 0xaa, 0xfc, 0xab, 0xfc, 0x52, 0xfe, 0xf1, 0xfd, 0xb0, 0xfd, 0x90, 0xfd, 0x70, 0xfd, 0x2f, 0xfd, 0x0f, 0xfd, 0xef, 0xfc,
+  0x81, 0xcf, 0xfc, 0x05, 0xaf, 0xfc, 0x8f, 0xfc, 0x6e, 0xfc, 0x4e, 0xfc, 0x2e, 0xfc, 0x11, 0x03, 0x81, 0x31, 0x03, 0x81, 0x51, 0x03, 0x03, 0x31, 0x03, 0x14, 0x34, 0xd9, 0x9d, 0x7e, 0xf7, 0x86,
+  0xff, 0xff, 0x41, 0x5d, 0xf7, 0xf4, 0x6b, 0x87, 0x10, 0x46, 0x08, 0x86, 0x08, 0x88, 0x08, 0x87, 0x08, 0x46, 0x08, 0x67, 0x08, 0x66, 0x08, 0x45, 0x08, 0xe9, 0x08, 0x2b, 0x01, 0x45, 0x08, 0x67,
+  0x08, 0x47, 0x08, 0x67, 0x10, 0xa6, 0x51, 0xae, 0xfc, 0x6b, 0xfc, 0x8e, 0xfd, 0xe9, 0xfa, 0x8b, 0xfb, 0x6b, 0xfa, 0xec, 0xfb, 0x88, 0x10, 0x66, 0x08, 0x67, 0x08, 0xeb, 0x88, 0x8b, 0x80, 0xeb,
+  0x50, 0x50, 0x0b, 0x54, 0x14, 0xd5, 0x4c, 0x33, 0x1c, 0x54, 0x3c, 0xef, 0x02, 0x51, 0x03, 0x46, 0x00, 0x45, 0x08, 0x84, 0x28, 0x49, 0xfc, 0x0d, 0xfd, 0xaf, 0xf5, 0x50, 0x13, 0x33, 0x1c, 0x14,
+  0x85, 0xf5, 0x8c, 0xb4, 0x2c, 0x12, 0x95, 0xb3, 0xed, 0x74, 0xfe, 0xb2, 0x84, 0xd3, 0x8c, 0x72, 0xd5, 0xf2, 0xed, 0x73, 0xfe, 0xf0, 0x53, 0x51, 0x54, 0xf1, 0x7c, 0xf1, 0xed, 0x4e, 0xc3, 0xef,
+  0xeb, 0x4d, 0xeb, 0xad, 0xf3, 0x0e, 0xfc, 0x81, 0x6d, 0xfb, 0x15, 0xac, 0xfb, 0xad, 0xfb, 0x4e, 0xfc, 0x2f, 0xf4, 0x51, 0x84, 0x6d, 0x02, 0x4a, 0x11, 0xcf, 0x9b, 0xb1, 0xed, 0x2b, 0x52, 0x0d,
+  0xfd, 0x70, 0xfd, 0xa6, 0x08, 0xac, 0x11, 0x6a, 0x09, 0x70, 0x73, 0x91, 0xe5, 0xd1, 0xfd, 0xf0, 0xfd, 0x12, 0xfe, 0x31, 0xfe, 0x51, 0xfe, 0x81, 0x72, 0xfe, 0x81, 0x92, 0xfe, 0x04, 0xb3, 0xfe,
+  0xf3, 0xfe, 0x13, 0xff, 0x34, 0xff, 0x55, 0xff, 0x81, 0x66, 0x08, 0x25, 0xc8, 0xf2, 0xc8, 0xfb, 0xa9, 0xfc, 0x33, 0xff, 0x75, 0xff, 0x96, 0xff, 0xb6, 0xff, 0xb5, 0xff, 0x05, 0x19, 0x16, 0xef,
+  0x0f, 0x84, 0x09, 0x11, 0xa7, 0x00, 0xc8, 0x08, 0x89, 0x10, 0x25, 0x08, 0x45, 0x08, 0x45, 0x10, 0x88, 0x28, 0x24, 0x10, 0xc5, 0x48, 0xe8, 0xfa, 0x28, 0xfb, 0x48, 0xf2, 0x68, 0xfa, 0x49, 0xfb,
+  0x8a, 0xfc, 0x2b, 0xfc, 0xea, 0xfb, 0x11, 0xfe, 0xf1, 0xfd, 0xb0, 0xfd, 0x90, 0xfd, 0x50, 0xfd, 0x30, 0xfd, 0x10, 0xfd, 0xef, 0xfc, 0xcf, 0xfc, 0x81, 0xaf, 0xfc, 0x02, 0x8f, 0xfc, 0x6e, 0xfc,
+  0x4e, 0xfc, 0x81, 0x31, 0x03, 0x81, 0x51, 0x03, 0x02, 0x72, 0x03, 0x37, 0x6d, 0xbf, 0xf7, 0x8a, 0xff, 0xff, 0x03, 0x39, 0xc6, 0x2a, 0x21, 0x88, 0x00, 0x88, 0x08, 0x81, 0x67, 0x08, 0x1d, 0xa8,
+  0x08, 0x67, 0x08, 0x66, 0x08, 0xe9, 0x00, 0x0a, 0x01, 0x66, 0x08, 0x67, 0x00, 0x45, 0x08, 0x67, 0x18, 0x90, 0x6b, 0x0d, 0xfc, 0x4e, 0xfc, 0x30, 0xfd, 0x0a, 0xfb, 0xcd, 0xfb, 0xe9, 0xf9, 0x6c,
+  0xfb, 0xec, 0xfa, 0xc9, 0x69, 0x66, 0x10, 0x2b, 0x61, 0xec, 0x70, 0x0c, 0x59, 0x0b, 0x49, 0xb3, 0x2b, 0x74, 0x0c, 0xb4, 0x2c, 0xf5, 0x44, 0x57, 0x65, 0x0d, 0x0a, 0x81, 0x45, 0x08, 0x2f, 0x66,
+  0x08, 0xeb, 0xdb, 0x6d, 0xfd, 0x4d, 0xfd, 0x32, 0x14, 0x55, 0x4d, 0x73, 0x2c, 0x73, 0x24, 0x31, 0x2c, 0x93, 0x4c, 0x33, 0xa5, 0xb3, 0xdd, 0x13, 0xfe, 0xf7, 0xfe, 0x92, 0x7c, 0x92, 0xe5, 0x72,
+  0xfe, 0xf4, 0xb5, 0xd3, 0x7c, 0x73, 0xfe, 0xf1, 0xc4, 0xf3, 0xfd, 0x0d, 0xdb, 0x8c, 0xeb, 0xae, 0xf3, 0xcd, 0xfb, 0x2e, 0xfc, 0xad, 0xfb, 0x2e, 0xfc, 0xed, 0xfb, 0x4e, 0xfc, 0x2d, 0xfc, 0x6d,
+  0xfc, 0x8e, 0xfc, 0x90, 0xfc, 0x2f, 0x94, 0x71, 0x4b, 0xcb, 0x09, 0xcf, 0x5b, 0xcf, 0x12, 0xc7, 0x10, 0x70, 0xfd, 0x8f, 0xfd, 0xf0, 0xfd, 0x11, 0xfe, 0x31, 0xfe, 0x32, 0xfe, 0x92, 0xfe, 0x81,
+  0x52, 0xfe, 0x81, 0x72, 0xfe, 0x13, 0x92, 0xfe, 0xd3, 0xfe, 0xf3, 0xfe, 0x14, 0xff, 0x35, 0xff, 0x94, 0xff, 0x27, 0x42, 0xa7, 0x10, 0x66, 0x08, 0xa7, 0xa1, 0xc8, 0xf3, 0x49, 0xfc, 0x6a, 0xf4,
+  0x96, 0xff, 0xb6, 0xff, 0xb5, 0xff, 0x6d, 0x63, 0x89, 0x00, 0xc9, 0x08, 0x0b, 0x31, 0x81, 0x09, 0x09, 0x16, 0xe9, 0x08, 0xe9, 0x10, 0xa7, 0x10, 0x44, 0x08, 0x44, 0x00, 0x66, 0x10, 0x87, 0x30,
+  0xc9, 0x58, 0x48, 0xfb, 0x0a, 0xe2, 0x4a, 0xc1, 0x69, 0xe9, 0x6a, 0xfb, 0xe9, 0xfb, 0x2a, 0xfc, 0x0a, 0xfc, 0x0b, 0xfc, 0x11, 0xfe, 0xf0, 0xfd, 0xb1, 0xfd, 0x90, 0xfd, 0x50, 0xfd, 0x0f, 0xfd,
+  0x81, 0xef, 0xfc, 0x00, 0xcf, 0xfc, 0x81, 0xaf, 0xfc, 0x01, 0x8e, 0xfc, 0x6e, 0xfc, 0x81, 0x31, 0x03, 0x02, 0x51, 0x03, 0x72, 0x03, 0x3a, 0x9e, 0x8d, 0xff, 0xff, 0x01, 0x5d, 0xef, 0x0d, 0x3a,
+  0x81, 0x67, 0x08, 0x05, 0xa8, 0x08, 0xa8, 0x00, 0xc8, 0x08, 0xc8, 0x00, 0x6c, 0x09, 0xc9, 0x00, 0x81, 0x66, 0x08, 0x16, 0x46, 0x08, 0x26, 0x00, 0x52, 0x13, 0xd1, 0x12, 0xd1, 0x0a, 0x50, 0x02,
+  0x0d, 0xfd, 0xac, 0xec, 0x2e, 0xfb, 0x0c, 0xea, 0x4a, 0xfa, 0x4b, 0xf3, 0x2a, 0xfa, 0x4d, 0xfc, 0xa9, 0x60, 0x0b, 0x59, 0xeb, 0x38, 0xa9, 0x28, 0x4a, 0x11, 0x94, 0x0c, 0xf5, 0x34, 0xb5, 0x44,
+  0x65, 0x08, 0x82, 0x45, 0x08, 0x1d, 0x45, 0x49, 0x6a, 0xfc, 0x6e, 0xfd, 0x10, 0xfe, 0x73, 0x14, 0x32, 0x24, 0x33, 0x04, 0xb4, 0x3c, 0x11, 0x04, 0xb3, 0x94, 0x93, 0xb5, 0x13, 0xb5, 0xd2, 0xed,
+  0xb6, 0xd6, 0x13, 0x9d, 0xb2, 0xe5, 0x96, 0xee, 0x53, 0x3c, 0x31, 0xc5, 0x92, 0x7c, 0xd3, 0xe5, 0xee, 0xdb, 0xee, 0xfb, 0x6c, 0xfb, 0xce, 0xfb, 0x0e, 0xfc, 0xcd, 0xfb, 0x6e, 0xfc, 0x4e, 0xfc,
+  0x2e, 0xfc, 0x81, 0x2d, 0xfc, 0x22, 0x4e, 0xfc, 0xcf, 0xfc, 0xad, 0xfc, 0x8d, 0x93, 0x6d, 0x3a, 0x08, 0x11, 0x6a, 0x09, 0xcc, 0x5a, 0x31, 0xd5, 0xb0, 0xfd, 0xd0, 0xfd, 0xf1, 0xfd, 0x32, 0xfe,
+  0x52, 0xfe, 0x4f, 0xfe, 0xd0, 0xf5, 0x72, 0xfe, 0x93, 0xfe, 0x72, 0xfe, 0xd3, 0xfe, 0xf3, 0xfe, 0x34, 0xff, 0x55, 0xff, 0x74, 0xff, 0x11, 0xad, 0x45, 0x08, 0x66, 0x08, 0x45, 0x08, 0xa6, 0x18,
+  0x89, 0xfc, 0xca, 0xeb, 0x48, 0xfc, 0xb6, 0xff, 0xf6, 0xff, 0xf0, 0x7b, 0x81, 0xe9, 0x08, 0x0b, 0xc8, 0x08, 0xe8, 0x00, 0xca, 0x28, 0x0a, 0x19, 0x2a, 0x09, 0x2a, 0x11, 0xe9, 0x10, 0x66, 0x10,
+  0x65, 0x08, 0x25, 0x08, 0x88, 0x40, 0xcc, 0x88, 0x81, 0x4b, 0xc1, 0x14, 0xeb, 0x70, 0x0a, 0x81, 0xea, 0x99, 0x69, 0xfb, 0x29, 0xfc, 0xe9, 0xfb, 0x0b, 0xfc, 0x4a, 0xfa, 0x4d, 0xfc, 0x11, 0xfe,
+  0xb0, 0xfd, 0x90, 0xfd, 0x50, 0xfd, 0x30, 0xfd, 0x10, 0xfd, 0xef, 0xfc, 0xcf, 0xfc, 0xaf, 0xfc, 0x8f, 0xfc, 0x6e, 0xfc, 0x30, 0x03, 0x81, 0x51, 0x03, 0x00, 0x98, 0x7d, 0x8f, 0xff, 0xff, 0x02,
+  0xdc, 0xde, 0x8a, 0x29, 0xc6, 0x00, 0x81, 0xa8, 0x08, 0x1c, 0x88, 0x08, 0x6b, 0x01, 0x8c, 0x09, 0xc8, 0x00, 0x66, 0x08, 0x67, 0x08, 0xc8, 0x08, 0x4f, 0x0a, 0x52, 0x03, 0x11, 0x0b, 0x4f, 0x0a,
+  0x6e, 0x0a, 0xae, 0xfc, 0x2c, 0xfc, 0xa7, 0xf9, 0xab, 0xf2, 0x0c, 0xfa, 0xaa, 0xfa, 0x29, 0xfa, 0x0b, 0xfb, 0xa9, 0xe9, 0x51, 0xec, 0xea, 0x38, 0x47, 0x18, 0x05, 0x10, 0x46, 0x10, 0x25, 0x08,
+  0x44, 0x08, 0x44, 0x00, 0x82, 0x45, 0x08, 0x27, 0xa7, 0x61, 0xe8, 0xfb, 0x4b, 0xfc, 0x4c, 0xfd, 0x50, 0xbd, 0xb4, 0x2c, 0x90, 0x0b, 0x73, 0x0c, 0x55, 0x65, 0x5a, 0xce, 0x57, 0xfe, 0x59, 0xff,
+  0xd9, 0xee, 0x1a, 0xff, 0x9a, 0xce, 0xb9, 0xe6, 0x3a, 0xf7, 0xf5, 0x5c, 0x31, 0xcd, 0x72, 0x5c, 0x51, 0xdd, 0x56, 0xfe, 0x76, 0xdd, 0x96, 0xe5, 0xf7, 0xfd, 0x17, 0xfe, 0xd6, 0xfd, 0x17, 0xfe,
+  0xd6, 0xfd, 0xb5, 0xfd, 0x0d, 0xfc, 0x4e, 0xfc, 0x6e, 0xfc, 0xae, 0xfc, 0x0f, 0xfd, 0x50, 0xfd, 0xee, 0xfc, 0xb1, 0xf5, 0x90, 0xfd, 0xb2, 0xfd, 0x81, 0xf1, 0xfd, 0x81, 0x32, 0xfe, 0x00, 0x52,
+  0xfe, 0x81, 0x72, 0xfe, 0x0f, 0x92, 0xfe, 0xb2, 0xfe, 0xd3, 0xfe, 0xf3, 0xfe, 0x14, 0xff, 0x34, 0xff, 0x55, 0xff, 0x96, 0xff, 0x34, 0xce, 0x45, 0x08, 0x46, 0x08, 0x45, 0x08, 0x46, 0x08, 0x84,
+  0x18, 0xa9, 0xfb, 0xab, 0x92, 0x81, 0x8a, 0xfc, 0x01, 0x8c, 0xcc, 0xc7, 0x00, 0x81, 0xe9, 0x08, 0x1d, 0xe8, 0x08, 0xa7, 0x08, 0x87, 0x08, 0x0b, 0x39, 0x2a, 0x09, 0x4a, 0x01, 0xf0, 0x62, 0x34,
+  0x9c, 0xf6, 0xa4, 0xf9, 0xc5, 0x37, 0xbd, 0x75, 0xc4, 0x31, 0xbb, 0x4b, 0xa9, 0x2b, 0x69, 0xab, 0x29, 0x8b, 0x31, 0xc6, 0x08, 0x6a, 0xfb, 0xa9, 0xfb, 0xcb, 0xfa, 0x8f, 0xfb, 0x18, 0xfe, 0xdb,
+  0xfe, 0x5c, 0xff, 0x1a, 0xff, 0xf4, 0xfd, 0x50, 0xfd, 0xb3, 0xfd, 0x98, 0xfe, 0x81, 0x78, 0xfe, 0x04, 0x52, 0xfd, 0x8f, 0xfc, 0x31, 0x03, 0x51, 0x03, 0x95, 0x44, 0x91, 0xff, 0xff, 0x1f, 0xf9,
+  0xcd, 0xab, 0x20, 0xc9, 0x00, 0xea, 0x00, 0x2b, 0x09, 0x6b, 0x01, 0x4b, 0x09, 0xea, 0x00, 0xa8, 0x08, 0xa8, 0x00, 0xc9, 0x00, 0xb0, 0x02, 0x52, 0x03, 0x8f, 0x0a, 0x2d, 0x02, 0xb4, 0x0b, 0x8e,
+  0xb3, 0x8d, 0xfc, 0x6b, 0xfb, 0xa9, 0xc1, 0x6d, 0xfa, 0x4c, 0xfb, 0x0a, 0xea, 0x2c, 0xf2, 0xab, 0xfa, 0x4d, 0xfa, 0xab, 0x40, 0x67, 0x10, 0x65, 0x08, 0x85, 0x08, 0x66, 0x10, 0x24, 0x08, 0x81,
+  0x45, 0x08, 0x0a, 0x45, 0x10, 0xe7, 0x50, 0xa8, 0xaa, 0xa9, 0xfb, 0x88, 0xfb, 0xec, 0xfc, 0x4b, 0xfd, 0x8f, 0xe5, 0x12, 0x14, 0x72, 0x24, 0xf6, 0x54, 0x87, 0xff, 0xff, 0x04, 0x3a, 0xff, 0x52,
+  0x6c, 0xd4, 0xbd, 0xf2, 0xa4, 0xbd, 0xff, 0x86, 0xff, 0xff, 0x11, 0x7d, 0xff, 0x2e, 0xfc, 0x8e, 0xfc, 0xce, 0xfc, 0x0f, 0xfd, 0x2f, 0xfd, 0x70, 0xfd, 0x90, 0xfd, 0xb0, 0xfd, 0xce, 0xd4, 0x8d,
+  0xcc, 0xf2, 0xfd, 0x31, 0xfe, 0x52, 0xfe, 0x93, 0xfe, 0xb3, 0xfe, 0x93, 0xfe, 0xb2, 0xfe, 0x81, 0xd3, 0xfe, 0x02, 0xf3, 0xfe, 0x14, 0xff, 0x54, 0xff, 0x81, 0x75, 0xff, 0x01, 0xd8, 0xff, 0x67,
+  0x10, 0x81, 0x65, 0x08, 0x10, 0x66, 0x08, 0x87, 0x08, 0x44, 0x08, 0xab, 0xfb, 0x67, 0x08, 0x09, 0xf4, 0x8b, 0xfc, 0x0b, 0xfd, 0xae, 0xfd, 0xe9, 0x00, 0x8b, 0x09, 0x6b, 0x01, 0x09, 0x01, 0xe8,
+  0x08, 0xa6, 0x08, 0xcd, 0x49, 0x7b, 0xd6, 0x86, 0xff, 0xff, 0x07, 0x9e, 0xff, 0xd2, 0x63, 0xac, 0x21, 0xab, 0x29, 0xa9, 0x09, 0xab, 0x01, 0x2d, 0x8b, 0xf7, 0xfd, 0x85, 0xff, 0xff, 0x01, 0xb8,
+  0xfe, 0x98, 0xfe, 0x82, 0xff, 0xff, 0x04, 0x16, 0xfe, 0xaf, 0xfc, 0x51, 0x03, 0x71, 0x0b, 0xfc, 0xc6, 0x92, 0xff, 0xff, 0x08, 0xd4, 0x9a, 0xa9, 0x08, 0xea, 0x00, 0x6c, 0x01, 0x6c, 0x09, 0x2a,
+  0x01, 0xc8, 0x08, 0xc9, 0x08, 0x4e, 0x02, 0x81, 0x2e, 0x02, 0x20, 0x8f, 0x0a, 0xb0, 0x0a, 0x92, 0x03, 0x73, 0x03, 0x32, 0x1b, 0xeb, 0xfb, 0xed, 0xfb, 0x6b, 0xf3, 0x6a, 0xfa, 0x6d, 0xfb, 0x0e,
+  0xfc, 0x0c, 0xea, 0x2c, 0xfa, 0x4d, 0xfa, 0x0a, 0x61, 0x64, 0x08, 0xec, 0x09, 0x90, 0x33, 0x2f, 0x9c, 0x44, 0x08, 0x67, 0x08, 0x46, 0x08, 0x66, 0x08, 0x2c, 0xb9, 0x89, 0xfb, 0xa9, 0xfb, 0x29,
+  0xfb, 0xcb, 0xfb, 0xcb, 0xfc, 0x6c, 0xfd, 0xad, 0xfd, 0x72, 0xed, 0xca, 0x41, 0x87, 0xff, 0xff, 0x03, 0x5c, 0xff, 0x35, 0xbe, 0xd5, 0x64, 0x15, 0xf6, 0x87, 0xff, 0xff, 0x09, 0x9e, 0xff, 0xae,
+  0xfc, 0xcf, 0xfc, 0xef, 0xfc, 0x50, 0xfd, 0x90, 0xfd, 0xb0, 0xfd, 0x70, 0xfd, 0xb0, 0xfd, 0xf1, 0xfd, 0x81, 0x32, 0xfe, 0x05, 0x52, 0xfe, 0x72, 0xfe, 0x92, 0xfe, 0xb3, 0xfe, 0xd2, 0xfe, 0xf3,
+  0xfe, 0x81, 0x13, 0xff, 0x14, 0x34, 0xff, 0x54, 0xff, 0x75, 0xff, 0x76, 0xff, 0x74, 0xce, 0x67, 0x08, 0x46, 0x08, 0x66, 0x08, 0x87, 0x08, 0xc8, 0x08, 0xc8, 0x00, 0x09, 0x01, 0xa9, 0x60, 0x87,
+  0x08, 0xcb, 0xdb, 0x49, 0xfc, 0x29, 0xfc, 0x6c, 0xfd, 0xad, 0xfd, 0x0a, 0x3a, 0xab, 0x01, 0x81, 0x29, 0x01, 0x01, 0x0c, 0x2a, 0x7e, 0xef, 0x89, 0xff, 0xff, 0x01, 0x34, 0x7c, 0xab, 0x09, 0x81,
+  0xcb, 0x01, 0x00, 0xdc, 0xc6, 0x87, 0xff, 0xff, 0x00, 0xbe, 0xff, 0x82, 0xff, 0xff, 0x03, 0x16, 0xfe, 0xaf, 0xfc, 0x51, 0x03, 0x75, 0x44, 0x93, 0xff, 0xff, 0x07, 0xdc, 0xf6, 0xb1, 0xfc, 0x16,
+  0xfe, 0x28, 0x21, 0x8c, 0x09, 0x0a, 0x09, 0x09, 0x01, 0x6b, 0x01, 0x81, 0x2e, 0x02, 0x03, 0xed, 0x01, 0x6e, 0x0a, 0xb3, 0x03, 0x52, 0x0b, 0x81, 0x93, 0x03, 0x1c, 0xed, 0x7a, 0x0b, 0xfb, 0x0c,
+  0xfc, 0xcb, 0xfb, 0x2b, 0xea, 0xcb, 0xfa, 0x2c, 0xea, 0xec, 0xc0, 0x0d, 0xf2, 0x8c, 0x99, 0x31, 0x0b, 0x93, 0x0b, 0xb0, 0x02, 0xcf, 0xc4, 0x6e, 0xac, 0x26, 0x08, 0x88, 0x08, 0xcb, 0x70, 0x0a,
+  0x99, 0x2a, 0xfb, 0xaa, 0xfb, 0x0b, 0xea, 0x09, 0xfb, 0x2a, 0xfc, 0xeb, 0xf2, 0x4b, 0xfb, 0x65, 0x00, 0x08, 0x21, 0x53, 0x8c, 0x87, 0xff, 0xff, 0x02, 0x93, 0xc5, 0xd4, 0x74, 0x57, 0xde, 0x86,
+  0xff, 0xff, 0x05, 0x7d, 0xff, 0xf5, 0xf5, 0xce, 0xfc, 0x10, 0xfd, 0x50, 0xfd, 0x71, 0xfd, 0x81, 0xb1, 0xfd, 0x03, 0xd1, 0xfd, 0x4f, 0xed, 0xf1, 0xfd, 0x31, 0xfe, 0x81, 0x52, 0xfe, 0x1e, 0xb3,
+  0xfe, 0xd3, 0xfe, 0xf3, 0xfe, 0x13, 0xff, 0x53, 0xff, 0x36, 0xff, 0x37, 0xff, 0x75, 0xff, 0x76, 0xff, 0xb6, 0xff, 0xb7, 0xff, 0x86, 0x08, 0xe7, 0x10, 0x89, 0x28, 0x89, 0x20, 0xca, 0x28, 0xca,
+  0x30, 0x4b, 0x39, 0x0a, 0x19, 0x8a, 0x10, 0x85, 0x08, 0x84, 0x08, 0x2a, 0xfc, 0x48, 0xfc, 0xaa, 0xfb, 0x2a, 0xfd, 0x6d, 0xfd, 0xcd, 0xbc, 0x4a, 0x09, 0x29, 0x09, 0xbc, 0xd6, 0x83, 0xff, 0xff,
+  0x02, 0x7c, 0xff, 0xd7, 0xfe, 0xbd, 0xff, 0x84, 0xff, 0xff, 0x02, 0x8e, 0x2a, 0x0c, 0x02, 0x71, 0x43, 0x84, 0xff, 0xff, 0x02, 0x3d, 0xff, 0x19, 0xff, 0x7c, 0xff, 0x84, 0xff, 0xff, 0x03, 0x16,
+  0xfe, 0xaf, 0xfc, 0x51, 0x03, 0x1a, 0x9e, 0x87, 0xff, 0xff, 0x04, 0x98, 0xb5, 0x8f, 0x5a, 0x0e, 0x5a, 0xf4, 0x93, 0x5e, 0xf7, 0x86, 0xff, 0xff, 0x18, 0xdf, 0xff, 0x52, 0xe4, 0x33, 0xfd, 0xd4,
+  0xfd, 0x4a, 0x19, 0xe9, 0x08, 0x2a, 0x09, 0xed, 0x09, 0x8b, 0x01, 0xd1, 0x0a, 0x72, 0x33, 0xd3, 0x43, 0x55, 0x44, 0x11, 0x0b, 0x32, 0x03, 0x52, 0x03, 0xd1, 0x12, 0x09, 0xfa, 0x49, 0xf2, 0x6b,
+  0xfb, 0x2e, 0xfc, 0x90, 0xfc, 0x91, 0xfc, 0x4f, 0xeb, 0xaf, 0x72, 0x81, 0x31, 0x0b, 0x11, 0xd1, 0x02, 0xaf, 0x02, 0x8f, 0x0a, 0xea, 0xf4, 0x6e, 0xfd, 0x89, 0x28, 0x89, 0x60, 0x8c, 0xc1, 0x2a,
+  0xfb, 0x4d, 0xda, 0x95, 0xf4, 0x94, 0xfd, 0xf0, 0xfb, 0xab, 0xfa, 0x47, 0x18, 0x66, 0x00, 0x65, 0x08, 0xa7, 0x10, 0x87, 0xff, 0xff, 0x02, 0x76, 0xe6, 0x31, 0x34, 0xd9, 0xe6, 0x82, 0xff, 0xff,
+  0x00, 0xdf, 0xff, 0x82, 0xff, 0xff, 0x00, 0xba, 0xfe, 0x81, 0x0f, 0xfd, 0x08, 0x4f, 0xfd, 0x90, 0xfd, 0x91, 0xfd, 0xd1, 0xfd, 0x55, 0xfe, 0x54, 0xfe, 0x12, 0xfe, 0x11, 0xfe, 0x10, 0xfe, 0x81,
+  0x72, 0xfe, 0x1d, 0xd3, 0xfe, 0xf3, 0xfe, 0x14, 0xff, 0x34, 0xff, 0x33, 0xff, 0xb2, 0xb5, 0xe8, 0x08, 0xca, 0x21, 0xb2, 0x6b, 0x94, 0x94, 0xd1, 0x73, 0xa9, 0x18, 0xa8, 0x20, 0xc8, 0x08, 0x25,
+  0x08, 0x67, 0x18, 0x45, 0x00, 0x45, 0x18, 0xc7, 0x08, 0xcd, 0x09, 0xec, 0x70, 0x47, 0x51, 0x69, 0x9a, 0xab, 0xfb, 0x0c, 0xfb, 0x2b, 0xfc, 0x6a, 0xfc, 0xaa, 0xfc, 0x8c, 0xfc, 0xf2, 0xf5, 0x83,
+  0xff, 0xff, 0x04, 0xbf, 0xff, 0x2d, 0xe3, 0xca, 0xfb, 0x4c, 0xfc, 0xdf, 0xff, 0x83, 0xff, 0xff, 0x02, 0xf9, 0xad, 0x0d, 0x02, 0x74, 0x6c, 0x84, 0xff, 0xff, 0x03, 0x2c, 0x43, 0x94, 0xfe, 0xd2,
+  0xfd, 0x55, 0xfe, 0x83, 0xff, 0xff, 0x03, 0x36, 0xfe, 0xaf, 0xfc, 0x31, 0x03, 0x5e, 0xdf, 0x86, 0xff, 0xff, 0x06, 0x95, 0x94, 0x87, 0x08, 0x88, 0x10, 0xaa, 0x28, 0x4c, 0x49, 0xee, 0x61, 0x7e,
+  0xf7, 0x86, 0xff, 0xff, 0x02, 0x95, 0xfd, 0x73, 0xfd, 0x78, 0xfe, 0x83, 0xff, 0xff, 0x01, 0x5e, 0xdf, 0xd9, 0xa5, 0x82, 0xff, 0xff, 0x07, 0xbf, 0xef, 0x17, 0x6d, 0xf1, 0x02, 0xf0, 0x12, 0x6d,
+  0x72, 0xaa, 0xf2, 0xf1, 0xfc, 0x7a, 0xfe, 0x83, 0xff, 0xff, 0x04, 0xbc, 0xbe, 0xb3, 0x33, 0x10, 0x43, 0xb0, 0x02, 0xb5, 0x74, 0x83, 0xff, 0xff, 0x01, 0x34, 0xec, 0xb8, 0xfd, 0x83, 0xff, 0xff,
+  0x04, 0xd5, 0x9c, 0x65, 0x08, 0x46, 0x08, 0x66, 0x08, 0xa6, 0x10, 0x82, 0xff, 0xff, 0x00, 0x7c, 0xff, 0x83, 0xff, 0xff, 0x02, 0x98, 0xe6, 0x98, 0xce, 0x5d, 0xd7, 0x81, 0xff, 0xff, 0x81, 0xbe,
+  0xff, 0x82, 0xff, 0xff, 0x06, 0x78, 0xee, 0x71, 0xfd, 0xeb, 0xc3, 0x90, 0xfd, 0xb2, 0xfd, 0xb9, 0xf6, 0xde, 0xff, 0x82, 0xff, 0xff, 0x04, 0xde, 0xff, 0x17, 0xff, 0x92, 0xfe, 0xb3, 0xfe, 0x15,
+  0xff, 0x83, 0xff, 0xff, 0x02, 0x9b, 0xce, 0x70, 0x53, 0xdf, 0xff, 0x82, 0xff, 0xff, 0x03, 0xbb, 0xd6, 0x8a, 0x21, 0x85, 0x00, 0x08, 0x29, 0x84, 0xff, 0xff, 0x01, 0x2f, 0x62, 0xb8, 0xfe, 0x84,
+  0xff, 0xff, 0x02, 0x8c, 0xfb, 0x6c, 0xf2, 0x7d, 0xff, 0x83, 0xff, 0xff, 0x04, 0x57, 0xdd, 0xab, 0xfa, 0xac, 0xea, 0x6b, 0xfb, 0x57, 0xfe, 0x83, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x0c, 0x0a, 0xf3,
+  0x5b, 0x84, 0xff, 0xff, 0x04, 0x59, 0xee, 0x90, 0xfc, 0xf1, 0xfd, 0xd1, 0xfd, 0x7c, 0xff, 0x82, 0xff, 0xff, 0x03, 0x36, 0xfe, 0xaf, 0xfc, 0x51, 0x03, 0xdf, 0xff, 0x85, 0xff, 0xff, 0x07, 0xbf,
+  0xef, 0x0f, 0x23, 0x87, 0x10, 0x88, 0x18, 0xaa, 0x28, 0xcb, 0x38, 0xec, 0x40, 0xb7, 0xac, 0x86, 0xff, 0xff, 0x02, 0xb8, 0xed, 0x71, 0xfc, 0x78, 0xfe, 0x8a, 0xff, 0xff, 0x03, 0x56, 0x8d, 0xf1,
+  0x02, 0xb3, 0x0b, 0xb3, 0xfc, 0x87, 0xff, 0xff, 0x02, 0xf3, 0x5b, 0x0c, 0x02, 0x95, 0x74, 0x83, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x85, 0xff, 0xff, 0x03, 0x0f, 0x63, 0xa8, 0x08, 0x65, 0x08, 0x66,
+  0x08, 0x82, 0xff, 0xff, 0x00, 0xd8, 0xfe, 0x83, 0xff, 0xff, 0x01, 0x9d, 0xff, 0xf1, 0xcc, 0x82, 0xff, 0xff, 0x01, 0x1b, 0xef, 0xbe, 0xff, 0x82, 0xff, 0xff, 0x04, 0x1a, 0xff, 0x50, 0xfd, 0x6f,
+  0xfd, 0xd2, 0xfd, 0xde, 0xff, 0x86, 0xff, 0xff, 0x02, 0x9b, 0xff, 0xf3, 0xfe, 0x35, 0xff, 0x84, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x84, 0xff, 0xff, 0x02, 0xb8, 0xb5, 0x46, 0x08, 0x29, 0x29, 0x84,
+  0xff, 0xff, 0x01, 0xcf, 0xdb, 0x99, 0xfe, 0x84, 0xff, 0xff, 0x01, 0x4c, 0xfb, 0xec, 0xfa, 0x84, 0xff, 0xff, 0x04, 0x14, 0x94, 0x6b, 0xfa, 0x6d, 0xf2, 0x2c, 0xfb, 0x51, 0xfc, 0x84, 0xff, 0xff,
+  0x01, 0x0f, 0x2b, 0x6d, 0x3a, 0x85, 0xff, 0xff, 0x09, 0xdf, 0xff, 0x39, 0xfe, 0xd3, 0xfc, 0x91, 0xfc, 0xd4, 0xfd, 0xf4, 0xfd, 0xd4, 0xfd, 0x31, 0xfd, 0xaf, 0xfc, 0x51, 0x03, 0x86, 0xff, 0xff,
+  0x07, 0x1d, 0xcf, 0x2a, 0x11, 0x87, 0x10, 0x88, 0x18, 0x89, 0x20, 0xaa, 0x30, 0xca, 0x30, 0x11, 0x7b, 0x86, 0xff, 0xff, 0x02, 0x17, 0xd5, 0x31, 0xcb, 0xd7, 0xfd, 0x8b, 0xff, 0xff, 0x01, 0x54,
+  0xa5, 0x31, 0x2b, 0x83, 0xff, 0xff, 0x01, 0xdf, 0xff, 0xfd, 0xde, 0x82, 0xff, 0xff, 0x03, 0xdf, 0xff, 0xcc, 0x19, 0xd2, 0x5b, 0x3d, 0xe7, 0x89, 0xff, 0xff, 0x03, 0x77, 0xad, 0x67, 0x08, 0x66,
+  0x10, 0x86, 0x10, 0x82, 0xff, 0xff, 0x01, 0x15, 0xfe, 0xbe, 0xff, 0x83, 0xff, 0xff, 0x00, 0x75, 0x9d, 0x82, 0xff, 0xff, 0x01, 0xf6, 0xe5, 0x9e, 0xff, 0x82, 0xff, 0xff, 0x03, 0xfb, 0xfe, 0x31,
+  0xed, 0xb1, 0xfd, 0x9d, 0xff, 0x83, 0xff, 0xff, 0x00, 0xbd, 0xff, 0x83, 0xff, 0xff, 0x02, 0x79, 0xff, 0x55, 0xff, 0xfe, 0xff, 0x8a, 0xff, 0xff, 0x01, 0x87, 0x10, 0x6a, 0x21, 0x84, 0xff, 0xff,
+  0x01, 0x71, 0xfb, 0x58, 0xfe, 0x84, 0xff, 0xff, 0x01, 0x6f, 0xa2, 0xb2, 0x33, 0x84, 0xff, 0xff, 0x04, 0xd4, 0x63, 0x2e, 0x9a, 0xec, 0xea, 0x0c, 0xe2, 0x90, 0xf3, 0x84, 0xff, 0xff, 0x02, 0xf2,
+  0x93, 0xed, 0xc9, 0x78, 0xed, 0x87, 0xff, 0xff, 0x06, 0xbf, 0xff, 0x97, 0xfd, 0x6f, 0xfb, 0x70, 0xfc, 0xcf, 0xfc, 0xaf, 0xfc, 0x52, 0x03, 0x86, 0xff, 0xff, 0x07, 0x9e, 0xef, 0xf2, 0x1b, 0x68,
+  0x10, 0x27, 0x08, 0xca, 0x40, 0x2a, 0x51, 0x67, 0x20, 0x34, 0x8c, 0x86, 0xff, 0xff, 0x03, 0xf7, 0xfd, 0x70, 0xbb, 0x30, 0xd3, 0xf8, 0xfd, 0x83, 0xff, 0xff, 0x02, 0x1a, 0xae, 0x6f, 0x1a, 0xb9,
+  0x9d, 0x83, 0xff, 0xff, 0x01, 0x39, 0xff, 0xfa, 0xee, 0x82, 0xff, 0xff, 0x03, 0x3d, 0xe7, 0x8b, 0x19, 0x6b, 0x09, 0x54, 0x6c, 0x82, 0xff, 0xff, 0x02, 0x54, 0x7c, 0x4a, 0x01, 0xb5, 0x8c, 0x83,
+  0xff, 0xff, 0x02, 0xd2, 0xfd, 0xae, 0x99, 0x5e, 0xff, 0x82, 0xff, 0xff, 0x00, 0x5a, 0xce, 0x81, 0x46, 0x10, 0x00, 0x66, 0x10, 0x82, 0xff, 0xff, 0x01, 0x93, 0xac, 0x55, 0xcd, 0x83, 0xff, 0xff,
+  0x00, 0xbe, 0xff, 0x82, 0xff, 0xff, 0x01, 0xd3, 0xd4, 0x9e, 0xff, 0x82, 0xff, 0xff, 0x02, 0xdb, 0xfe, 0xf0, 0xec, 0x13, 0xfe, 0x83, 0xff, 0xff, 0x02, 0x35, 0xe6, 0x72, 0xfe, 0x94, 0xfe, 0x82,
+  0xff, 0xff, 0x02, 0xfe, 0xff, 0xd7, 0xde, 0x73, 0x83, 0x83, 0xff, 0xff, 0x02, 0x16, 0x95, 0xab, 0x19, 0xb8, 0xad, 0x83, 0xff, 0xff, 0x02, 0x6a, 0x41, 0x4a, 0x11, 0x4f, 0x42, 0x83, 0xff, 0xff,
+  0x02, 0x91, 0xf3, 0x4e, 0xc9, 0xaf, 0xfc, 0x83, 0xff, 0xff, 0x01, 0xd0, 0x12, 0x71, 0xa4, 0x84, 0xff, 0xff, 0x04, 0x13, 0xfd, 0xae, 0xfb, 0xca, 0xf2, 0x2c, 0xfa, 0x2f, 0xeb, 0x84, 0xff, 0xff,
+  0x03, 0x54, 0xfd, 0x6e, 0xfb, 0xad, 0xfb, 0xd9, 0xf5, 0x88, 0xff, 0xff, 0x05, 0x5d, 0xff, 0xf1, 0xfb, 0xee, 0xfb, 0xaf, 0xfc, 0x52, 0x03, 0x7e, 0xdf, 0x86, 0xff, 0xff, 0x06, 0x33, 0x84, 0x88,
+  0x18, 0xcc, 0x48, 0x2e, 0x69, 0xce, 0xa1, 0x53, 0xeb, 0x3d, 0xf7, 0x86, 0xff, 0xff, 0x03, 0x56, 0xfd, 0x74, 0xfd, 0x6d, 0x89, 0x58, 0xdd, 0x83, 0xff, 0xff, 0x02, 0x0f, 0x5b, 0x4d, 0x51, 0xaf,
+  0x89, 0x83, 0xff, 0xff, 0x01, 0x9b, 0xff, 0xbc, 0xff, 0x82, 0xff, 0xff, 0x03, 0xde, 0xff, 0x7b, 0xff, 0x15, 0xed, 0x56, 0xcd, 0x82, 0xff, 0xff, 0x02, 0x37, 0xa5, 0x09, 0x09, 0xd5, 0x8c, 0x82,
+  0xff, 0xff, 0x03, 0x1b, 0xff, 0x0b, 0xfc, 0xed, 0xfd, 0x97, 0xc5, 0x82, 0xff, 0xff, 0x03, 0xfc, 0xde, 0x45, 0x10, 0x65, 0x08, 0x87, 0x18, 0x82, 0xff, 0xff, 0x01, 0x32, 0x84, 0x11, 0xfd, 0x86,
+  0xff, 0xff, 0x02, 0x9e, 0xff, 0x0e, 0xcc, 0x7e, 0xf7, 0x82, 0xff, 0xff, 0x02, 0x1a, 0xff, 0x71, 0xfd, 0xd6, 0xe5, 0x83, 0xff, 0xff, 0x81, 0x59, 0xff, 0x00, 0xb8, 0xe6, 0x83, 0xff, 0xff, 0x01,
+  0xeb, 0x09, 0xcf, 0x42, 0x83, 0xff, 0xff, 0x02, 0xec, 0x21, 0x09, 0x01, 0xb1, 0x5b, 0x83, 0xff, 0xff, 0x02, 0x2f, 0x7a, 0xea, 0x68, 0x2d, 0x4a, 0x83, 0xff, 0xff, 0x02, 0xd1, 0xd2, 0x0c, 0xc9,
+  0x10, 0xdb, 0x83, 0xff, 0xff, 0x01, 0x11, 0x4b, 0x10, 0x5b, 0x84, 0xff, 0xff, 0x04, 0x96, 0x5c, 0xac, 0xb2, 0xad, 0xfa, 0x2c, 0xea, 0x90, 0xfb, 0x84, 0xff, 0xff, 0x01, 0xb3, 0xfc, 0x4d, 0xfb,
+  0x81, 0x0d, 0xfb, 0x02, 0x90, 0xfb, 0xb9, 0xed, 0xdf, 0xff, 0x86, 0xff, 0xff, 0x04, 0x9e, 0xff, 0x70, 0xfb, 0x6e, 0xfb, 0x72, 0x03, 0x7b, 0xae, 0x86, 0xff, 0xff, 0x05, 0xdf, 0xff, 0x35, 0x94,
+  0x4d, 0x49, 0xec, 0x50, 0x91, 0x9a, 0xdd, 0xf6, 0x86, 0xff, 0xff, 0x04, 0xdf, 0xff, 0x12, 0xec, 0x70, 0xeb, 0x52, 0xfd, 0xf7, 0xcc, 0x83, 0xff, 0xff, 0x03, 0x6c, 0x92, 0xab, 0x70, 0xcc, 0x68,
+  0x7e, 0xf7, 0x82, 0xff, 0xff, 0x01, 0x1d, 0xff, 0x9c, 0xff, 0x89, 0xff, 0xff, 0x02, 0x37, 0x9d, 0x09, 0x01, 0xd5, 0x8c, 0x82, 0xff, 0xff, 0x03, 0xfa, 0xfe, 0xcb, 0xfb, 0x0a, 0xfc, 0xb9, 0xfe,
+  0x82, 0xff, 0xff, 0x03, 0x1d, 0xe7, 0x46, 0x10, 0x45, 0x10, 0xa7, 0x20, 0x82, 0xff, 0xff, 0x01, 0xf4, 0xc4, 0x4b, 0xfc, 0x86, 0xff, 0xff, 0x02, 0x7a, 0xfe, 0x52, 0xfc, 0x7e, 0xff, 0x82, 0xff,
+  0xff, 0x02, 0xfa, 0xfe, 0x8a, 0x82, 0x17, 0xf6, 0x89, 0xff, 0xff, 0x02, 0xbf, 0xf7, 0x4d, 0x83, 0x0f, 0x3b, 0x83, 0xff, 0xff, 0x02, 0xab, 0x19, 0x29, 0x01, 0x92, 0x53, 0x83, 0xff, 0xff, 0x02,
+  0xef, 0x69, 0xa8, 0x08, 0x51, 0xcb, 0x83, 0xff, 0xff, 0x02, 0xf2, 0xeb, 0x0c, 0xb1, 0xb3, 0x73, 0x83, 0xff, 0xff, 0x01, 0xed, 0x8a, 0xea, 0xfa, 0x84, 0xff, 0xff, 0x04, 0x58, 0x85, 0x30, 0x02,
+  0x4b, 0xea, 0x0e, 0xd2, 0x33, 0xf4, 0x84, 0xff, 0xff, 0x01, 0xd1, 0xfb, 0xd4, 0xfc, 0x82, 0x77, 0xfd, 0x04, 0x92, 0xeb, 0x8e, 0xb9, 0x93, 0xdb, 0xfa, 0xed, 0xdf, 0xff, 0x84, 0xff, 0xff, 0x03,
+  0x97, 0xfd, 0xee, 0xfa, 0x71, 0x03, 0xd6, 0x4c, 0x87, 0xff, 0xff, 0x03, 0x5e, 0xef, 0x4c, 0x41, 0xaa, 0x40, 0x76, 0xac, 0x87, 0xff, 0xff, 0x04, 0x1d, 0xff, 0x71, 0xdb, 0xf0, 0xda, 0x10, 0xfc,
+  0x39, 0xfe, 0x83, 0xff, 0xff, 0x03, 0x4d, 0x69, 0xab, 0x50, 0xcc, 0x58, 0xbf, 0xff, 0x82, 0xff, 0xff, 0x01, 0x7c, 0xf6, 0x5b, 0xfe, 0x82, 0xff, 0xff, 0x09, 0xbd, 0xff, 0x39, 0xff, 0xb6, 0xfe,
+  0xf8, 0xf6, 0x73, 0x8c, 0x73, 0x84, 0x53, 0x84, 0xcf, 0x42, 0x2a, 0x09, 0xf6, 0x8c, 0x82, 0xff, 0xff, 0x03, 0xba, 0xfe, 0x69, 0xfb, 0xaa, 0xfb, 0xb9, 0xfe, 0x82, 0xff, 0xff, 0x03, 0x1d, 0xe7,
+  0x46, 0x18, 0x65, 0x08, 0xa7, 0x18, 0x82, 0xff, 0xff, 0x02, 0xf5, 0xfd, 0xca, 0xfb, 0xfb, 0xfe, 0x85, 0xff, 0xff, 0x02, 0xb2, 0xd4, 0x0e, 0xab, 0x5e, 0xff, 0x82, 0xff, 0xff, 0x02, 0x5a, 0xd6,
+  0x35, 0xfd, 0x56, 0xd5, 0x83, 0xff, 0xff, 0x08, 0x7b, 0xff, 0x9b, 0xff, 0x5a, 0xf7, 0x78, 0xd6, 0x16, 0x8d, 0x37, 0x8d, 0xb5, 0x84, 0x4e, 0x0a, 0x11, 0x4b, 0x83, 0xff, 0xff, 0x02, 0x8a, 0x19,
+  0x4d, 0x19, 0x94, 0x9b, 0x83, 0xff, 0xff, 0x02, 0x2d, 0x3a, 0x4b, 0x19, 0x4e, 0x32, 0x83, 0xff, 0xff, 0x02, 0x32, 0xec, 0x2b, 0xf3, 0xd4, 0x43, 0x83, 0xff, 0xff, 0x02, 0x2e, 0x12, 0x4a, 0x21,
+  0x5b, 0xc6, 0x83, 0xff, 0xff, 0x04, 0xfc, 0xd6, 0x8f, 0x0a, 0xcb, 0x01, 0xaa, 0x21, 0xf9, 0xd5, 0x83, 0xff, 0xff, 0x02, 0x9e, 0xff, 0xae, 0xfa, 0x9b, 0xfe, 0x82, 0xff, 0xff, 0x04, 0x9b, 0xfe,
+  0x4d, 0xb1, 0x2c, 0xb9, 0x0c, 0xb1, 0xef, 0xb1, 0x84, 0xff, 0xff, 0x04, 0xbb, 0xfe, 0xee, 0xfa, 0x72, 0x03, 0xb3, 0x13, 0x3d, 0xd7, 0x86, 0xff, 0xff, 0x04, 0x36, 0xa5, 0x89, 0x20, 0xaa, 0x30,
+  0xee, 0x61, 0xdf, 0xff, 0x86, 0xff, 0xff, 0x04, 0x95, 0xe4, 0x51, 0xfc, 0x4e, 0xaa, 0x50, 0xdb, 0x57, 0xe5, 0x83, 0xff, 0xff, 0x02, 0x73, 0x93, 0x8b, 0x58, 0x70, 0x82, 0x83, 0xff, 0xff, 0x01,
+  0x56, 0xbc, 0x97, 0xd4, 0x82, 0xff, 0xff, 0x09, 0xde, 0xff, 0xd4, 0xfe, 0x31, 0xfe, 0x2d, 0xfd, 0x2b, 0x7b, 0xd5, 0x94, 0xab, 0x21, 0x09, 0x01, 0x8b, 0x01, 0x16, 0x8d, 0x82, 0xff, 0xff, 0x03,
+  0x7b, 0xc6, 0x29, 0xfb, 0x2b, 0xea, 0x18, 0xfe, 0x82, 0xff, 0xff, 0x03, 0x9e, 0xff, 0x66, 0x18, 0x45, 0x18, 0x87, 0x20, 0x82, 0xff, 0xff, 0x02, 0x35, 0xfd, 0xa9, 0xfb, 0xf5, 0xfd, 0x85, 0xff,
+  0xff, 0x02, 0x8c, 0xf4, 0x51, 0x74, 0x5e, 0xe7, 0x82, 0xff, 0xff, 0x02, 0x7b, 0xde, 0xed, 0xd9, 0x0f, 0x93, 0x83, 0xff, 0xff, 0x08, 0x51, 0xbc, 0x8d, 0xfc, 0xf1, 0xf4, 0xaa, 0x31, 0x34, 0x64,
+  0xb1, 0x5b, 0x6f, 0x0a, 0x2c, 0x52, 0x90, 0xdc, 0x83, 0xff, 0xff, 0x02, 0xcd, 0x11, 0x2b, 0x09, 0xad, 0x5a, 0x83, 0xff, 0xff, 0x02, 0x51, 0x3b, 0x4f, 0x0a, 0x8c, 0x6a, 0x83, 0xff, 0xff, 0x02,
+  0x7a, 0xde, 0x6c, 0x6a, 0x98, 0xa5, 0x83, 0xff, 0xff, 0x02, 0xed, 0x09, 0x8b, 0x01, 0xf2, 0x53, 0x84, 0xff, 0xff, 0x02, 0x37, 0x85, 0x8f, 0x12, 0xf3, 0x5b, 0x84, 0xff, 0xff, 0x02, 0x78, 0xfd,
+  0x6e, 0xea, 0x7b, 0xfe, 0x83, 0xff, 0xff, 0x03, 0x7c, 0xee, 0x35, 0xcc, 0xf4, 0xc3, 0xda, 0xe5, 0x84, 0xff, 0xff, 0x01, 0x9b, 0xfe, 0xee, 0xfa, 0x81, 0x72, 0x03, 0x00, 0x37, 0x5d, 0x86, 0xff,
+  0xff, 0x04, 0x6f, 0x62, 0x6f, 0x81, 0x2c, 0x71, 0xcd, 0x79, 0xd9, 0xcd, 0x85, 0xff, 0xff, 0x05, 0xfd, 0xf6, 0x11, 0xdb, 0x71, 0xfb, 0x94, 0xf4, 0x6d, 0x79, 0x35, 0xac, 0x83, 0xff, 0xff, 0x02,
+  0xbf, 0xff, 0x17, 0xbd, 0x7e, 0xf7, 0x82, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x4c, 0x59, 0xad, 0x71, 0x84, 0xff, 0xff, 0x06, 0x7a, 0xff, 0x9d, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xbc, 0xd6, 0xe8, 0x10,
+  0x74, 0x7c, 0x85, 0xff, 0xff, 0x01, 0xd2, 0xeb, 0xf9, 0xfd, 0x83, 0xff, 0xff, 0x02, 0xbe, 0xff, 0xab, 0x31, 0x3a, 0xce, 0x82, 0xff, 0xff, 0x02, 0x3d, 0xff, 0x97, 0xfd, 0x2e, 0xfc, 0x84, 0xff,
+  0xff, 0x02, 0x7b, 0xff, 0x6c, 0xfd, 0x5b, 0xff, 0x83, 0xff, 0xff, 0x03, 0xbf, 0xff, 0x1d, 0xf7, 0xed, 0xd1, 0x9e, 0xff, 0x83, 0xff, 0xff, 0x06, 0x1b, 0xff, 0xba, 0xe6, 0xdc, 0xee, 0xff, 0xff,
+  0xdf, 0xff, 0x6e, 0xfc, 0x2f, 0xe4, 0x85, 0xff, 0xff, 0x01, 0xb8, 0xad, 0x51, 0xe5, 0x84, 0xff, 0xff, 0x02, 0x31, 0x43, 0x45, 0x00, 0x9e, 0xf7, 0x8a, 0xff, 0xff, 0x02, 0x8f, 0x22, 0xed, 0x01,
+  0x9b, 0xce, 0x8a, 0xff, 0xff, 0x03, 0x9e, 0xf7, 0x90, 0xaa, 0x4e, 0xe2, 0x7b, 0xf6, 0x8c, 0xff, 0xff, 0x05, 0xb6, 0xec, 0xee, 0xfa, 0x72, 0x03, 0x92, 0x03, 0xb2, 0x03, 0x3a, 0x9e, 0x84, 0xff,
+  0xff, 0x05, 0x1d, 0xe7, 0xeb, 0x30, 0x0d, 0x61, 0x4e, 0x81, 0x50, 0xc2, 0xd6, 0xec, 0x84, 0xff, 0xff, 0x06, 0xbf, 0xff, 0x6f, 0x9a, 0xaf, 0xa9, 0xd0, 0xc2, 0x8d, 0x79, 0x8b, 0x50, 0x35, 0xa4,
+  0x89, 0xff, 0xff, 0x03, 0x37, 0xdd, 0xac, 0x58, 0x8a, 0x40, 0x15, 0xa4, 0x88, 0xff, 0xff, 0x01, 0x92, 0x6b, 0xd6, 0x7c, 0x85, 0xff, 0xff, 0x01, 0xb5, 0x54, 0xf9, 0xc5, 0x83, 0xff, 0xff, 0x01,
+  0xbe, 0xff, 0xd7, 0x3c, 0x84, 0xff, 0xff, 0x02, 0x3a, 0xee, 0x4a, 0xf2, 0xbf, 0xff, 0x83, 0xff, 0xff, 0x01, 0xd6, 0xfe, 0x8e, 0xfd, 0x85, 0xff, 0xff, 0x03, 0x5e, 0xff, 0x51, 0xdb, 0xb5, 0xfc,
+  0xdf, 0xff, 0x87, 0xff, 0xff, 0x01, 0x7a, 0xce, 0x8c, 0x4a, 0x85, 0xff, 0xff, 0x01, 0x77, 0xad, 0xf0, 0x5a, 0x84, 0xff, 0xff, 0x02, 0x11, 0x43, 0x45, 0x08, 0xd6, 0x8c, 0x85, 0xff, 0xff, 0x00,
+  0x3d, 0xdf, 0x83, 0xff, 0xff, 0x03, 0x6e, 0x22, 0x8b, 0x01, 0x0c, 0x22, 0x1d, 0xdf, 0x88, 0xff, 0xff, 0x04, 0x9e, 0xef, 0x12, 0x6b, 0x50, 0x12, 0xce, 0x29, 0x7b, 0xf6, 0x82, 0xff, 0xff, 0x00,
+  0x5b, 0xfe, 0x87, 0xff, 0xff, 0x03, 0x9c, 0xe6, 0xae, 0x99, 0x6e, 0xc9, 0x72, 0x03, 0x81, 0x92, 0x03, 0x01, 0xd3, 0x0b, 0xbc, 0xb6, 0x83, 0xff, 0xff, 0x06, 0x34, 0x8c, 0xcb, 0x30, 0xcb, 0x38,
+  0x0d, 0x51, 0x4e, 0x79, 0xd2, 0xba, 0x9e, 0xff, 0x82, 0xff, 0xff, 0x07, 0xbf, 0xff, 0xb5, 0xf4, 0x91, 0xfc, 0x2b, 0x79, 0xec, 0x68, 0x8a, 0x40, 0x6a, 0x40, 0x35, 0x9c, 0x83, 0xff, 0xff, 0x00,
+  0x7e, 0xff, 0x82, 0xff, 0xff, 0x07, 0xbd, 0xf6, 0xf4, 0xd2, 0x90, 0xf2, 0x0f, 0xd2, 0xac, 0x50, 0x48, 0x38, 0x72, 0x8b, 0x9e, 0xff, 0x84, 0xff, 0xff, 0x03, 0x7d, 0xff, 0x94, 0xfd, 0xed, 0xfc,
+  0xb6, 0x7c, 0x85, 0xff, 0xff, 0x01, 0xb5, 0x5c, 0x3a, 0xae, 0x83, 0xff, 0xff, 0x01, 0x9e, 0xef, 0xb6, 0x44, 0x84, 0xff, 0xff, 0x02, 0x5b, 0xee, 0xac, 0xd9, 0xb8, 0xf5, 0x83, 0xff, 0xff, 0x01,
+  0xd1, 0xfd, 0x4d, 0xfd, 0x85, 0xff, 0xff, 0x04, 0x7e, 0xef, 0x6e, 0x3a, 0x8b, 0x9a, 0xce, 0xe3, 0x3c, 0xff, 0x84, 0xff, 0xff, 0x03, 0xbf, 0xff, 0x9a, 0xe6, 0xcc, 0x12, 0xb2, 0x23, 0x85, 0xff,
+  0xff, 0x01, 0xbc, 0xae, 0xf3, 0xf5, 0x84, 0xff, 0xff, 0x03, 0x71, 0x43, 0x4a, 0x09, 0x6f, 0x0a, 0x1d, 0xc7, 0x82, 0xff, 0xff, 0x02, 0x9f, 0xef, 0xb6, 0x5c, 0xd4, 0x43, 0x83, 0xff, 0xff, 0x00,
+  0x8f, 0x22, 0x81, 0x4a, 0x01, 0x02, 0x4b, 0x11, 0x74, 0x7c, 0xdf, 0xff, 0x85, 0xff, 0xff, 0x05, 0xfa, 0xad, 0xcf, 0x1a, 0x2e, 0x0a, 0x0e, 0x22, 0x0f, 0x0a, 0x5a, 0xbe, 0x82, 0xff, 0xff, 0x02,
+  0x71, 0xaa, 0x94, 0xcb, 0xdd, 0xf6, 0x83, 0xff, 0xff, 0x0a, 0x9e, 0xff, 0x35, 0xac, 0x6d, 0x59, 0x4b, 0x51, 0x6e, 0xa1, 0x72, 0x03, 0x92, 0x03, 0xb2, 0x03, 0x92, 0x03, 0xf3, 0x13, 0x3a, 0x9e,
+  0x81, 0xff, 0xff, 0x07, 0xdf, 0xff, 0x8d, 0x49, 0x89, 0x20, 0xab, 0x28, 0xcc, 0x40, 0x2d, 0x59, 0x90, 0x91, 0xda, 0xed, 0x81, 0xff, 0xff, 0x08, 0x5e, 0xf7, 0x33, 0xc3, 0xd1, 0xca, 0x30, 0xfc,
+  0x45, 0x28, 0x69, 0x38, 0x68, 0x18, 0x49, 0x30, 0x34, 0x9c, 0x83, 0xff, 0xff, 0x2d, 0x2f, 0xfa, 0xd4, 0xfc, 0x35, 0xfd, 0x93, 0xfc, 0x6d, 0xb1, 0xee, 0xb0, 0x6e, 0xa8, 0xf0, 0xf9, 0x11, 0xf2,
+  0x28, 0x30, 0x8a, 0x38, 0x6e, 0xf4, 0xf6, 0xfe, 0x9a, 0xff, 0x18, 0xff, 0xb2, 0xfd, 0xf1, 0xfd, 0x0c, 0xfc, 0x0e, 0xfd, 0x0b, 0xfc, 0x8f, 0xfd, 0x2f, 0x02, 0xcc, 0x01, 0x2d, 0x02, 0x0d, 0x02,
+  0x2e, 0x02, 0xcc, 0x01, 0xf0, 0x02, 0xd0, 0x0a, 0x11, 0x0b, 0xad, 0x49, 0x4e, 0x0a, 0x2e, 0x0a, 0xed, 0x09, 0xf0, 0x0a, 0x34, 0x04, 0xca, 0x38, 0xeb, 0xa0, 0x88, 0x48, 0xca, 0x78, 0xea, 0x80,
+  0xeb, 0x98, 0x0b, 0xb1, 0x4a, 0xb9, 0x6c, 0xf2, 0x6b, 0xf2, 0x81, 0x8b, 0xfc, 0x17, 0xac, 0xfd, 0x0b, 0xfd, 0x2a, 0xc4, 0xca, 0xfc, 0xab, 0xfc, 0x4e, 0xf5, 0x2d, 0xe5, 0xf1, 0x12, 0x6f, 0x2b,
+  0x30, 0x3b, 0x0c, 0x0a, 0xea, 0x61, 0xf2, 0x42, 0x97, 0xb5, 0x95, 0xf5, 0xf2, 0x7b, 0xcc, 0xf3, 0xc7, 0xe2, 0x2b, 0x02, 0x50, 0x0b, 0x74, 0x1c, 0x92, 0x13, 0x72, 0x03, 0x31, 0x03, 0x81, 0xb3,
+  0x03, 0x11, 0x92, 0x03, 0xf0, 0x0a, 0x4a, 0x09, 0xac, 0x01, 0x4b, 0x09, 0x2e, 0xc3, 0xcd, 0x09, 0x90, 0x42, 0xb0, 0x0a, 0x8f, 0x02, 0x70, 0x02, 0x93, 0x03, 0x14, 0x1c, 0x75, 0x44, 0xb1, 0x63,
+  0xd1, 0xfb, 0xf0, 0x1a, 0xf0, 0x02, 0x81, 0xb0, 0x02, 0x24, 0xb0, 0x0a, 0xcc, 0x01, 0x6b, 0x01, 0xac, 0x09, 0x4a, 0x01, 0x2b, 0x29, 0x0e, 0xa1, 0x2e, 0x91, 0x93, 0xfb, 0x35, 0xfc, 0x58, 0xfd,
+  0x75, 0x64, 0x31, 0x3b, 0x8f, 0x12, 0x2e, 0x02, 0x0d, 0x0a, 0x0d, 0x02, 0xcc, 0x01, 0xcd, 0x09, 0x8e, 0x51, 0x0d, 0x91, 0x4f, 0x91, 0x6e, 0x89, 0x2e, 0x89, 0x2d, 0x69, 0x2c, 0x69, 0xaf, 0x91,
+  0x91, 0x9a, 0x33, 0xb3, 0x33, 0xa3, 0xce, 0x71, 0x6d, 0x59, 0x4d, 0x49, 0x4c, 0x39, 0x6e, 0x99, 0x72, 0x03, 0x92, 0x03, 0x81, 0xb2, 0x03, 0x81, 0xb3, 0x03, 0x14, 0xb5, 0x3c, 0x1d, 0xcf, 0x98,
+  0xad, 0x88, 0x10, 0x89, 0x10, 0x89, 0x18, 0xaa, 0x28, 0x89, 0x18, 0xca, 0x18, 0x4f, 0x72, 0x5e, 0xff, 0x38, 0xdd, 0x92, 0xfb, 0xed, 0x99, 0xa9, 0x38, 0x8a, 0x20, 0x89, 0x28, 0x88, 0x20, 0x68,
+  0x20, 0x0e, 0x5a, 0x3a, 0xd6, 0x83, 0xff, 0xff, 0x5c, 0x97, 0xb4, 0x4d, 0x89, 0x31, 0xfb, 0x51, 0xfb, 0x71, 0xfb, 0xf1, 0xfb, 0xae, 0xd1, 0x8d, 0x98, 0xed, 0xd0, 0x4f, 0xd9, 0xa8, 0x30, 0x70,
+  0xfd, 0xf0, 0xfd, 0x10, 0xfe, 0xb2, 0xfe, 0x71, 0xfe, 0x8b, 0xec, 0x6d, 0xfc, 0x0c, 0xfc, 0x6b, 0xfb, 0xcd, 0xfb, 0xaf, 0xed, 0x0f, 0x0a, 0x0e, 0x02, 0x8d, 0x0a, 0xac, 0x01, 0x0c, 0x02, 0xef,
+  0x02, 0x31, 0x03, 0xb0, 0x0a, 0x0e, 0x5a, 0x2f, 0xa2, 0xae, 0x61, 0xed, 0x01, 0xab, 0x09, 0xd3, 0x0b, 0xaa, 0x50, 0xcc, 0xa0, 0x0d, 0xb9, 0xaa, 0x78, 0xcb, 0x80, 0x0a, 0x81, 0xe9, 0x80, 0xea,
+  0x98, 0xec, 0xc9, 0x0c, 0xe2, 0xad, 0xfa, 0xac, 0xfc, 0x0b, 0xfd, 0x29, 0xe4, 0xaa, 0xf4, 0xe8, 0xeb, 0xaa, 0xf3, 0x2a, 0xfc, 0xef, 0xec, 0x10, 0x2b, 0xb4, 0x75, 0x70, 0x53, 0x50, 0x84, 0xf1,
+  0xbc, 0xed, 0x62, 0x29, 0x83, 0x8b, 0xc2, 0x8b, 0xe3, 0xaf, 0x2a, 0x4b, 0xd3, 0x8d, 0x83, 0x48, 0xdb, 0x72, 0x0b, 0x10, 0x03, 0xd4, 0x0b, 0xf3, 0x03, 0x92, 0x03, 0x72, 0x0b, 0xf0, 0x02, 0xec,
+  0x01, 0x08, 0x09, 0x4a, 0x11, 0x0a, 0x01, 0x8c, 0x21, 0x32, 0x0b, 0xd2, 0x02, 0xd0, 0x0a, 0xd3, 0x6b, 0xf1, 0x0a, 0xb3, 0x0b, 0x31, 0x03, 0x52, 0x03, 0xcc, 0x61, 0x52, 0xe3, 0x31, 0xf3, 0x0f,
+  0x73, 0x4e, 0x0a, 0x81, 0xf1, 0x02, 0x0d, 0x0d, 0x02, 0xcc, 0x01, 0x29, 0x01, 0x50, 0xa1, 0xce, 0xa8, 0xae, 0xa0, 0xf0, 0xe1, 0x51, 0xea, 0x0f, 0xda, 0xef, 0xe1, 0x0f, 0xe2, 0xcc, 0x11, 0x2e,
+  0x0a, 0x2e, 0x02, 0x82, 0x0d, 0x02, 0x10, 0x0e, 0x02, 0x4e, 0x81, 0x2e, 0x91, 0xd0, 0x99, 0x6e, 0x79, 0x4d, 0x71, 0x2d, 0x61, 0x2d, 0x59, 0xec, 0x50, 0x4e, 0x69, 0x6d, 0x61, 0xae, 0x69, 0xae,
+  0x59, 0x8d, 0x51, 0x6d, 0x41, 0x6c, 0x39, 0x8e, 0x71, 0x81, 0x92, 0x03, 0x81, 0xb2, 0x03, 0x82, 0xb3, 0x03, 0x12, 0xd3, 0x0b, 0x13, 0x1c, 0xb3, 0x0b, 0x68, 0x10, 0xa9, 0x08, 0x88, 0x08, 0xa9,
+  0x08, 0xaa, 0x28, 0xed, 0x78, 0xcf, 0x91, 0x8f, 0xa1, 0x71, 0xba, 0x6a, 0x20, 0x68, 0x10, 0x67, 0x08, 0x87, 0x08, 0x67, 0x08, 0x88, 0x10, 0xb2, 0x7b, 0x85, 0xff, 0xff, 0x7a, 0xb0, 0x91, 0x11,
+  0xfa, 0x70, 0xfa, 0x50, 0xfa, 0x6e, 0xf2, 0x90, 0xfa, 0x90, 0xf4, 0x8a, 0x78, 0xed, 0x58, 0x0e, 0x59, 0xed, 0xe1, 0x0f, 0xfd, 0xcf, 0xfd, 0xaf, 0xfd, 0xd2, 0xfe, 0x33, 0xff, 0x92, 0xfe, 0x6b,
+  0xfb, 0x2d, 0xfc, 0xec, 0xfb, 0xcd, 0xfb, 0xce, 0xfd, 0x2f, 0x84, 0x4d, 0x12, 0xcd, 0x01, 0x0d, 0x02, 0x4e, 0x02, 0x10, 0x03, 0x2e, 0x02, 0x4e, 0x02, 0xf0, 0xc1, 0x10, 0xa2, 0xce, 0x51, 0x8b,
+  0x01, 0xcb, 0x09, 0x88, 0x38, 0xeb, 0x80, 0x2c, 0xa9, 0xea, 0x80, 0xca, 0x60, 0xc9, 0x78, 0xca, 0x88, 0xaa, 0x68, 0x8c, 0xa1, 0xcb, 0xd1, 0x8d, 0x3a, 0xd2, 0x3b, 0x4b, 0xfc, 0x2c, 0xfd, 0xc8,
+  0xbb, 0x69, 0xfc, 0x2b, 0xfd, 0x8a, 0xfc, 0x4c, 0xfd, 0x8d, 0xf5, 0x2d, 0x22, 0x0b, 0x83, 0x6a, 0xcb, 0xcb, 0x11, 0x67, 0xba, 0x8b, 0x8a, 0x92, 0x33, 0x10, 0x4c, 0xab, 0xab, 0x10, 0x74, 0xc8,
+  0x00, 0x6f, 0x0a, 0x52, 0x0b, 0xb3, 0x03, 0x14, 0x0c, 0x14, 0x04, 0xd3, 0x03, 0xf0, 0x02, 0xaf, 0x02, 0xcc, 0x09, 0x07, 0x09, 0xd3, 0x13, 0x15, 0x04, 0xb3, 0x03, 0x73, 0x03, 0xb3, 0x0b, 0x6f,
+  0x02, 0xb0, 0x0a, 0x11, 0x03, 0x32, 0x03, 0x53, 0x03, 0xcf, 0x11, 0x12, 0xeb, 0xf1, 0xea, 0x51, 0xfb, 0xf2, 0xda, 0x71, 0xcb, 0xf2, 0x02, 0xb0, 0x02, 0x2d, 0x02, 0xad, 0x21, 0xae, 0x98, 0xae,
+  0xa0, 0xef, 0x98, 0xce, 0x98, 0xcf, 0xc9, 0x8f, 0xc1, 0x8f, 0xc9, 0xb0, 0xc9, 0x2e, 0x99, 0x0f, 0x99, 0x90, 0x71, 0xcd, 0x11, 0x0e, 0x02, 0x2e, 0x02, 0x0e, 0x02, 0xae, 0x31, 0x90, 0xa1, 0x6f,
+  0x99, 0x8f, 0x81, 0x6f, 0x79, 0x6e, 0x71, 0x4d, 0x59, 0x2c, 0x49, 0x2c, 0x41, 0x2b, 0x31, 0x2a, 0x11, 0x6c, 0x39, 0x81, 0x8d, 0x49, 0x02, 0x8d, 0x39, 0x8c, 0x31, 0x4b, 0x31, 0x81, 0x92, 0x03,
+  0x81, 0xb2, 0x03, 0x83, 0xb3, 0x03, 0x05, 0xd2, 0x03, 0xf3, 0x03, 0xa8, 0x00, 0x87, 0x08, 0x89, 0x10, 0x89, 0x20, 0x81, 0x69, 0x30, 0x04, 0x6a, 0x30, 0x69, 0x20, 0x89, 0x10, 0x88, 0x08, 0x66,
+  0x08, 0x82, 0x67, 0x08, 0x01, 0xa8, 0x08, 0x92, 0x73, 0x85, 0xff, 0xff, 0x03, 0x91, 0xa9, 0xaf, 0x90, 0x91, 0xfa, 0x50, 0xfa, 0x81, 0x30, 0xfa, 0x3e, 0x2f, 0xf2, 0xee, 0xf3, 0xce, 0x89, 0x2b,
+  0x59, 0x2e, 0x71, 0x4f, 0xe2, 0x2e, 0xfd, 0x4e, 0xfd, 0xaf, 0xfd, 0x71, 0xfe, 0xb2, 0xfe, 0x34, 0xff, 0xed, 0xfb, 0x6d, 0xfc, 0xeb, 0xfa, 0xac, 0xfb, 0x6a, 0xf3, 0xef, 0xb4, 0xac, 0x01, 0x4e,
+  0x02, 0x8f, 0x02, 0x10, 0x03, 0xec, 0x01, 0x0d, 0x02, 0xef, 0x69, 0x50, 0xaa, 0x6d, 0x61, 0xcd, 0x39, 0xc7, 0x08, 0xc9, 0x40, 0x67, 0x40, 0xea, 0x70, 0xca, 0x78, 0xcc, 0x78, 0x33, 0x0c, 0x73,
+  0x14, 0xa9, 0x58, 0x2c, 0xa9, 0xb0, 0xb9, 0x0c, 0x02, 0x10, 0x13, 0xb0, 0x32, 0x6c, 0xfc, 0x69, 0xfb, 0xac, 0xf4, 0xaa, 0xca, 0x2d, 0x9b, 0x0e, 0xb4, 0x4d, 0xf5, 0x6d, 0xbc, 0xca, 0x41, 0xaf,
+  0xc5, 0x4a, 0x11, 0x72, 0xc5, 0x6a, 0x83, 0x2b, 0xec, 0xaf, 0x33, 0x8d, 0xc4, 0x11, 0x34, 0x33, 0x3c, 0xb5, 0x0c, 0x76, 0x0c, 0x55, 0x0c, 0x81, 0x54, 0x0c, 0x06, 0xd3, 0x03, 0x11, 0x0b, 0xac,
+  0x01, 0xcc, 0x01, 0xd0, 0x12, 0xb2, 0x13, 0xf2, 0x03, 0x81, 0xb4, 0x0b, 0x13, 0xd0, 0x02, 0xb0, 0x02, 0xd0, 0x02, 0x11, 0x03, 0x32, 0x03, 0xce, 0x19, 0x0c, 0x41, 0xf1, 0xda, 0x32, 0xeb, 0x33,
+  0xf3, 0x52, 0xfb, 0x93, 0xfb, 0x32, 0xdb, 0x75, 0xc3, 0xcd, 0x11, 0xcf, 0xa8, 0xad, 0x78, 0x8d, 0x88, 0x0f, 0xa1, 0xef, 0xa0, 0x81, 0x2f, 0xb1, 0x01, 0x2f, 0xa9, 0x0e, 0x91, 0x81, 0x2f, 0x89,
+  0x16, 0x2e, 0x81, 0x2d, 0x69, 0x4d, 0x51, 0x2e, 0x59, 0x2e, 0x71, 0x8f, 0x81, 0x8f, 0x99, 0x8e, 0x89, 0x8e, 0x71, 0x6e, 0x69, 0x6d, 0x59, 0x6e, 0x61, 0x4d, 0x49, 0x2c, 0x39, 0x4c, 0x31, 0x4a,
+  0x01, 0x6d, 0x31, 0x8c, 0x29, 0x6c, 0x39, 0x8d, 0x41, 0x8d, 0x39, 0x8c, 0x39, 0x92, 0x03, 0x82, 0xb2, 0x03, 0x05, 0xb3, 0x03, 0x92, 0x03, 0x93, 0x0b, 0xb3, 0x0b, 0xd3, 0x03, 0x8d, 0x11, 0x81,
+  0x89, 0x08, 0x00, 0x89, 0x10, 0x82, 0x88, 0x08, 0x81, 0x88, 0x00, 0x08, 0x2a, 0x01, 0x87, 0x08, 0x66, 0x08, 0x87, 0x08, 0x67, 0x08, 0x87, 0x08, 0x88, 0x00, 0x0c, 0x3a, 0x54, 0x84, 0x81, 0x53,
+  0x84, 0x12, 0x54, 0x8c, 0x55, 0xa4, 0x74, 0x8c, 0x2d, 0x51, 0xcf, 0xb8, 0x30, 0xe1, 0xf0, 0xf1, 0x90, 0xfa, 0x70, 0xf2, 0x91, 0xfa, 0x0e, 0xea, 0x30, 0xfc, 0x51, 0xcb, 0x2e, 0x81, 0x0f, 0x51,
+  0xd5, 0x33, 0x0f, 0xfd, 0xcd, 0xfc, 0x4d, 0xfd, 0x81, 0x51, 0xfe, 0x3c, 0x2d, 0xfc, 0x4c, 0xfc, 0xee, 0xfc, 0x0c, 0xfb, 0x2b, 0xfc, 0x0e, 0xfd, 0x0c, 0x1a, 0x6e, 0x02, 0x8f, 0x02, 0xf0, 0x02,
+  0xed, 0x09, 0xac, 0x09, 0xec, 0x09, 0x51, 0xa2, 0xae, 0x69, 0xad, 0x59, 0x8c, 0x51, 0x29, 0x29, 0x6b, 0x51, 0xca, 0x60, 0xca, 0x70, 0xb0, 0x0a, 0x52, 0x03, 0xb3, 0x0b, 0xca, 0x40, 0x0b, 0x59,
+  0x86, 0x18, 0x6a, 0x09, 0xef, 0x42, 0x2d, 0x4b, 0x49, 0xe3, 0xc7, 0xf2, 0xcb, 0xfc, 0x87, 0xfb, 0x08, 0xeb, 0x6a, 0xeb, 0x09, 0xfd, 0x68, 0xf4, 0x67, 0xeb, 0x09, 0xeb, 0x27, 0xeb, 0xe8, 0xfb,
+  0x68, 0xfb, 0x09, 0xfc, 0x08, 0xf4, 0xce, 0x8b, 0xb1, 0x1b, 0xb3, 0x0b, 0x95, 0x0c, 0x77, 0x1d, 0x37, 0x15, 0x16, 0x05, 0x77, 0x15, 0xd5, 0x1c, 0x6a, 0x09, 0x8b, 0x11, 0x0d, 0x02, 0x4a, 0x09,
+  0x59, 0xfe, 0x12, 0x44, 0xd1, 0x0a, 0x81, 0xd0, 0x02, 0x1b, 0xf1, 0x02, 0x11, 0x03, 0xf1, 0x02, 0xeb, 0x38, 0x0c, 0x49, 0x0c, 0x39, 0xd1, 0xca, 0xf1, 0xda, 0xf1, 0xd2, 0x72, 0xb2, 0x73, 0xfb,
+  0x52, 0xfb, 0xd2, 0xd2, 0x0f, 0xa1, 0xae, 0x90, 0x50, 0xa1, 0x0f, 0x99, 0xcf, 0x90, 0xee, 0x88, 0xce, 0x78, 0xef, 0x90, 0xef, 0x88, 0xee, 0x90, 0x0f, 0x99, 0x6f, 0x79, 0x4d, 0x41, 0x6c, 0x41,
+  0x2c, 0x39, 0x82, 0x2c, 0x31, 0x06, 0x6d, 0x49, 0x2d, 0x49, 0x8e, 0x59, 0x6d, 0x49, 0x6d, 0x41, 0x4c, 0x31, 0x6c, 0x29, 0x81, 0x4c, 0x29, 0x08, 0x4a, 0x09, 0x6d, 0x29, 0x6c, 0x29, 0x4b, 0x21,
+  0x6d, 0x31, 0x8d, 0x41, 0x6d, 0x49, 0x72, 0x03, 0x93, 0x03, 0x81, 0xb2, 0x03, 0x81, 0xb3, 0x03, 0x08, 0xd3, 0x03, 0x6f, 0x0a, 0x89, 0x08, 0x88, 0x10, 0x89, 0x10, 0xa9, 0x10, 0x88, 0x10, 0x88,
+  0x00, 0xa8, 0x00, 0x82, 0x88, 0x00, 0x08, 0x2b, 0x01, 0x88, 0x08, 0x67, 0x08, 0x87, 0x00, 0x88, 0x08, 0x88, 0x00, 0x87, 0x00, 0x87, 0x08, 0x87, 0x00, 0x81, 0x87, 0x08, 0x29, 0x88, 0x10, 0x89,
+  0x20, 0x88, 0x20, 0x68, 0x18, 0x6d, 0x68, 0x6c, 0x80, 0xf2, 0xf1, 0xf0, 0xa8, 0x30, 0xda, 0xef, 0xf1, 0x10, 0xf2, 0x70, 0xfa, 0x90, 0xfb, 0xd0, 0xfb, 0x0a, 0x61, 0x50, 0x32, 0x51, 0x2a, 0x12,
+  0xed, 0x0b, 0xfc, 0x4e, 0xfd, 0x10, 0xfe, 0xaf, 0xfd, 0xb3, 0xfe, 0x2b, 0xfc, 0xee, 0xfc, 0x4c, 0xf3, 0x6c, 0xeb, 0xce, 0xfd, 0x0e, 0x0a, 0xae, 0x02, 0xaf, 0x02, 0xcc, 0x01, 0xac, 0x01, 0xcc,
+  0x01, 0x0f, 0x7a, 0xef, 0x71, 0xae, 0x71, 0x0f, 0x7a, 0x8c, 0x49, 0x4b, 0x49, 0xad, 0x69, 0x6d, 0x71, 0x81, 0xaf, 0x0a, 0x52, 0x72, 0x0b, 0x8b, 0x19, 0xea, 0x28, 0x84, 0x00, 0x44, 0x00, 0x07,
+  0x09, 0x4f, 0x2b, 0x90, 0x33, 0xa7, 0xfa, 0x2a, 0xdb, 0x07, 0xfc, 0xcf, 0xdc, 0xc8, 0xf3, 0x68, 0xf3, 0x88, 0xec, 0xe5, 0xc9, 0x09, 0x32, 0x2e, 0x1b, 0xeb, 0xd2, 0x6e, 0x0a, 0xcf, 0x0a, 0x18,
+  0x4d, 0xab, 0x5a, 0x11, 0x03, 0x37, 0x15, 0xd5, 0x0c, 0x77, 0x1d, 0x36, 0x0d, 0x37, 0x0d, 0x16, 0x0d, 0xb8, 0x0d, 0x13, 0x1c, 0xac, 0x09, 0xcc, 0x09, 0x0b, 0x42, 0x3a, 0xcd, 0x59, 0xfe, 0x5a,
+  0xfe, 0x19, 0xb5, 0xb0, 0x02, 0x32, 0x03, 0xf1, 0x0a, 0x0b, 0x29, 0x2d, 0x51, 0x2c, 0x29, 0x4e, 0x51, 0x91, 0xba, 0xb1, 0xca, 0xb1, 0xba, 0x11, 0x9a, 0xd2, 0xc2, 0x11, 0xfb, 0xae, 0x90, 0xef,
+  0x90, 0x0f, 0x99, 0xee, 0x88, 0xee, 0x80, 0xed, 0x78, 0xcd, 0x70, 0xee, 0x78, 0xed, 0x60, 0x8c, 0x60, 0x6e, 0x59, 0x0b, 0x39, 0x2c, 0x39, 0x2b, 0x31, 0x4d, 0x39, 0x2c, 0x31, 0x2b, 0x11, 0x2b,
+  0x09, 0x4b, 0x01, 0x2a, 0x01, 0x4c, 0x21, 0x4d, 0x39, 0x4d, 0x31, 0x4d, 0x39, 0x4c, 0x39, 0x6c, 0x29, 0x2a, 0x09, 0x2a, 0x01, 0x6b, 0x09, 0x6d, 0x21, 0x6c, 0x29, 0x81, 0x6c, 0x21, 0x08, 0x8d,
+  0x39, 0x6e, 0x51, 0x72, 0x13, 0x52, 0x03, 0xb3, 0x03, 0xb2, 0x03, 0xd3, 0x03, 0xf2, 0x03, 0xaa, 0x08, 0x81, 0x88, 0x08, 0x00, 0x89, 0x08, 0x82, 0x88, 0x08, 0x81, 0x87, 0x08, 0x0c, 0x87, 0x00,
+  0xa8, 0x00, 0x0b, 0x09, 0x88, 0x00, 0x0a, 0x09, 0x67, 0x00, 0x87, 0x00, 0xa8, 0x00, 0x66, 0x00, 0x87, 0x08, 0x67, 0x08, 0xa7, 0x00, 0x67, 0x00, 0x81, 0x87, 0x08, 0x61, 0x68, 0x10, 0x67, 0x08,
+  0xab, 0x40, 0x8d, 0x88, 0x6b, 0x48, 0x6b, 0x50, 0x6a, 0x68, 0xb0, 0xf1, 0x2f, 0xc9, 0xb0, 0xd1, 0xb0, 0xd9, 0xf0, 0xe1, 0x11, 0xfa, 0xd0, 0xfa, 0xd2, 0xf3, 0x6c, 0x09, 0x0b, 0x11, 0xf3, 0xb2,
+  0x0d, 0xfd, 0x6d, 0xfd, 0xcf, 0xfd, 0xf0, 0xfd, 0xf3, 0xfe, 0x2f, 0xfd, 0x6c, 0xf2, 0x6c, 0xfb, 0x6d, 0xf3, 0x4e, 0xdd, 0xec, 0x09, 0xed, 0x01, 0x0d, 0x02, 0x2d, 0x0a, 0xcc, 0x01, 0xcc, 0x29,
+  0xce, 0x69, 0xce, 0x61, 0x2f, 0x7a, 0x6c, 0x41, 0x4a, 0x29, 0xac, 0x41, 0xcd, 0x81, 0x91, 0x72, 0x2d, 0x0a, 0x30, 0x03, 0x10, 0x03, 0x08, 0x11, 0xaf, 0x12, 0xe8, 0x00, 0x8a, 0x01, 0xca, 0x11,
+  0xd0, 0x73, 0x91, 0xdd, 0x6b, 0xdc, 0x66, 0xeb, 0x49, 0xf4, 0xeb, 0xca, 0x8c, 0xfc, 0x88, 0xca, 0xca, 0x6a, 0xee, 0xbc, 0x8d, 0x6b, 0xd2, 0x2b, 0x0b, 0x12, 0x12, 0x1c, 0x78, 0x2d, 0xc6, 0x10,
+  0xb0, 0x02, 0x12, 0x13, 0xf9, 0x15, 0xb8, 0x15, 0x37, 0x0d, 0x78, 0x15, 0x36, 0x0d, 0xf6, 0x0c, 0x17, 0x25, 0xcc, 0x01, 0x30, 0x7b, 0x99, 0xfd, 0xbb, 0xc4, 0xf8, 0xf5, 0x1a, 0xfe, 0x7a, 0xd4,
+  0xbb, 0xc4, 0xee, 0x11, 0x0a, 0x31, 0xea, 0x20, 0xcb, 0x30, 0x0b, 0x29, 0xab, 0x20, 0x94, 0x73, 0x17, 0x2d, 0xd2, 0xb2, 0xb2, 0xba, 0x16, 0xd3, 0xae, 0x90, 0x0f, 0x99, 0xcd, 0x78, 0xed, 0x78,
+  0x81, 0xee, 0x80, 0x06, 0x0f, 0x99, 0x6f, 0x91, 0x2d, 0x51, 0x30, 0xa1, 0x2c, 0x41, 0x2c, 0x31, 0xeb, 0x18, 0x81, 0x0b, 0x19, 0x02, 0x0a, 0x11, 0x2b, 0x09, 0x4a, 0x01, 0x81, 0x2a, 0x01, 0x56,
+  0x4b, 0x01, 0x6b, 0x01, 0x4b, 0x11, 0x2b, 0x19, 0x6c, 0x19, 0x6d, 0x31, 0x4d, 0x29, 0x4b, 0x09, 0x2a, 0x09, 0x4b, 0x11, 0x6d, 0x29, 0x4c, 0x29, 0x6c, 0x21, 0x6c, 0x29, 0x6c, 0x39, 0x6d, 0x39,
+  0xad, 0x60, 0x6f, 0x49, 0xb2, 0x0b, 0xb3, 0x03, 0xd0, 0x0a, 0xa9, 0x10, 0xa9, 0x20, 0x8b, 0x40, 0xab, 0x40, 0x8c, 0x48, 0x4c, 0x78, 0x46, 0x08, 0x68, 0x08, 0xa8, 0x00, 0xc9, 0x08, 0x87, 0x00,
+  0x88, 0x00, 0xea, 0x08, 0x87, 0x00, 0x4c, 0x09, 0x87, 0x08, 0x87, 0x00, 0xea, 0x00, 0x66, 0x00, 0xc9, 0x00, 0x67, 0x08, 0xa7, 0x00, 0x66, 0x08, 0x87, 0x08, 0x88, 0x08, 0x87, 0x08, 0x89, 0x18,
+  0xab, 0x30, 0xcb, 0x38, 0xab, 0x50, 0x89, 0x20, 0xec, 0x40, 0xab, 0x30, 0x2b, 0x58, 0x53, 0xea, 0xf0, 0xb0, 0x30, 0xc1, 0xf2, 0xd9, 0xb0, 0xe9, 0xb0, 0xf1, 0xb2, 0xfb, 0x2c, 0x11, 0xaf, 0x79,
+  0xee, 0x51, 0x2d, 0xfd, 0xae, 0xfd, 0x6e, 0xfd, 0x6f, 0xfd, 0x51, 0xfe, 0x6d, 0xeb, 0xcc, 0xfa, 0xac, 0xfb, 0x0d, 0xfc, 0xab, 0x21, 0xcc, 0x09, 0xec, 0x01, 0x0d, 0x02, 0x2d, 0x02, 0xcc, 0x01,
+  0xef, 0x71, 0xee, 0x71, 0xcd, 0x71, 0xed, 0x41, 0x0f, 0x72, 0x4b, 0x39, 0xce, 0x81, 0x81, 0xee, 0x71, 0x16, 0xaf, 0x0a, 0x6e, 0x0a, 0x91, 0x0b, 0xd0, 0x02, 0x30, 0x03, 0xe7, 0x08, 0x65, 0x08,
+  0x11, 0x0b, 0x71, 0x03, 0x0c, 0x9c, 0x4a, 0xbb, 0xf0, 0x13, 0x2a, 0xfd, 0xe5, 0xe3, 0x85, 0xeb, 0x47, 0xf4, 0x6a, 0xeb, 0xae, 0x11, 0x4c, 0x6a, 0xeb, 0x7a, 0xb2, 0xb4, 0x95, 0x0c, 0x19, 0x16,
+  0x81, 0xf0, 0x0a, 0x26, 0x72, 0x03, 0x98, 0x1d, 0x18, 0x0e, 0x98, 0x15, 0x77, 0x15, 0x78, 0x1d, 0x95, 0x24, 0x52, 0x9b, 0xd8, 0xfd, 0x1b, 0xdd, 0xfa, 0xd4, 0xfc, 0xcc, 0xdc, 0xbc, 0xbb, 0xc4,
+  0xfe, 0xac, 0x19, 0xa4, 0xeb, 0x48, 0xeb, 0x40, 0xb3, 0x63, 0xf4, 0x33, 0xd4, 0x0b, 0x74, 0x0b, 0x12, 0x03, 0x4f, 0x12, 0x50, 0xa9, 0x0f, 0x99, 0xee, 0x90, 0x0e, 0x79, 0x50, 0x91, 0x2f, 0x89,
+  0x0e, 0x79, 0x2f, 0x71, 0xcc, 0x58, 0xec, 0x48, 0x0e, 0x79, 0xec, 0x58, 0x0c, 0x51, 0x0b, 0x29, 0x0a, 0x11, 0x81, 0x2a, 0x01, 0x81, 0x0a, 0x01, 0x02, 0x2a, 0x01, 0x4a, 0x01, 0x2a, 0x01, 0x83,
+  0x4b, 0x01, 0x17, 0x4b, 0x09, 0x6c, 0x09, 0x8d, 0x21, 0x4b, 0x09, 0x4c, 0x11, 0x2b, 0x11, 0x4c, 0x21, 0x6d, 0x29, 0x6c, 0x21, 0x8d, 0x31, 0x6c, 0x39, 0x4c, 0x31, 0x8c, 0x58, 0xac, 0x58, 0xad,
+  0x80, 0x0d, 0x59, 0x4b, 0x50, 0x8a, 0x28, 0xaa, 0x28, 0x6a, 0x38, 0x8b, 0x40, 0x8c, 0x48, 0x8c, 0x70, 0xa8, 0x08, 0x81, 0xa8, 0x00, 0x78, 0x0b, 0x01, 0x67, 0x08, 0x09, 0x01, 0x87, 0x00, 0xa8,
+  0x08, 0x4c, 0x09, 0xe9, 0x08, 0x87, 0x00, 0x88, 0x00, 0xe9, 0x08, 0x88, 0x08, 0xa8, 0x00, 0x86, 0x08, 0x67, 0x08, 0x88, 0x00, 0x87, 0x08, 0x88, 0x00, 0xaa, 0x28, 0x0e, 0x71, 0xea, 0x08, 0x0c,
+  0x59, 0xc9, 0x10, 0x8b, 0x38, 0xd0, 0xd0, 0xcb, 0x58, 0xeb, 0x30, 0xcc, 0x78, 0x2e, 0x79, 0x6f, 0xb1, 0xf0, 0xe1, 0x51, 0xfa, 0x90, 0xd9, 0x53, 0xfb, 0xae, 0x49, 0x2c, 0x09, 0x8f, 0x59, 0x51,
+  0xc5, 0x10, 0xbd, 0xcf, 0xfd, 0x4f, 0xfd, 0xb2, 0xfe, 0x33, 0xf5, 0xac, 0xfa, 0x6d, 0xf3, 0x6d, 0xec, 0x2c, 0xfc, 0xca, 0x21, 0x8c, 0x01, 0x8b, 0x09, 0x4d, 0x59, 0xad, 0x71, 0xef, 0x71, 0x4b,
+  0x51, 0xee, 0x69, 0xae, 0x71, 0x8e, 0x81, 0xad, 0x51, 0x4a, 0x39, 0xd0, 0x79, 0x8f, 0x92, 0x6e, 0x0a, 0xab, 0x01, 0x8e, 0x0a, 0xe7, 0x00, 0x64, 0x00, 0x8a, 0x01, 0x69, 0x01, 0x9a, 0x35, 0xd0,
+  0x33, 0x55, 0x54, 0x30, 0x13, 0x0b, 0x9b, 0x6b, 0xfd, 0xef, 0xfd, 0x6b, 0xe4, 0x0f, 0x1b, 0xf4, 0x5c, 0x56, 0x1c, 0xaf, 0x22, 0x97, 0x15, 0xd5, 0x2c, 0xd8, 0x1d, 0xdb, 0x06, 0xb6, 0x24, 0x11,
+  0x03, 0x14, 0x0c, 0xd8, 0x0d, 0xf9, 0x15, 0xf9, 0x05, 0x96, 0x14, 0x18, 0xfe, 0x19, 0xfe, 0x3a, 0xfe, 0xbc, 0xcc, 0x7d, 0xd4, 0x9d, 0xb4, 0xbd, 0xac, 0xbc, 0xb4, 0x3a, 0x94, 0x3d, 0xa4, 0xda,
+  0x9b, 0xeb, 0x40, 0x56, 0x1c, 0x53, 0x13, 0xae, 0x01, 0x30, 0x02, 0xee, 0x01, 0x10, 0xa9, 0xcf, 0x98, 0xee, 0x88, 0x0e, 0x79, 0x2e, 0x79, 0x0e, 0x71, 0xee, 0x60, 0x0d, 0x59, 0xea, 0x20, 0xec,
+  0x50, 0xec, 0x40, 0x0d, 0x49, 0x2c, 0x39, 0x4b, 0x21, 0x81, 0x0a, 0x11, 0x03, 0xe9, 0x00, 0xea, 0x00, 0x2a, 0x01, 0x0a, 0x01, 0x82, 0x2a, 0x01, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x82, 0x6b, 0x01,
+  0x81, 0x4b, 0x09, 0x08, 0x2b, 0x01, 0x4c, 0x11, 0x0b, 0x11, 0x4b, 0x11, 0x6c, 0x21, 0x6d, 0x31, 0x8d, 0x39, 0x6c, 0x39, 0x6d, 0x39, 0x81, 0x8c, 0x50, 0x0a, 0x8c, 0x58, 0xcc, 0x40, 0x8c, 0x50,
+  0x8b, 0x40, 0x8a, 0x30, 0x8a, 0x28, 0x8b, 0x40, 0x8c, 0x58, 0x67, 0x08, 0x68, 0x00, 0x88, 0x00, 0x81, 0xea, 0x00, 0x08, 0x87, 0x00, 0x8d, 0x01, 0xa8, 0x08, 0xa8, 0x00, 0xc9, 0x00, 0x4c, 0x09,
+  0xa9, 0x00, 0x88, 0x00, 0x8e, 0x01, 0x81, 0x88, 0x00, 0x01, 0x66, 0x08, 0xa8, 0x08, 0x81, 0x87, 0x00, 0x47, 0x88, 0x08, 0x89, 0x10, 0xcc, 0x50, 0x8e, 0x88, 0xa8, 0x18, 0xa9, 0x08, 0x8a, 0x30,
+  0x6b, 0x58, 0xee, 0xb0, 0xea, 0x18, 0x2a, 0x11, 0x4b, 0x11, 0x90, 0x89, 0xef, 0xb0, 0x6f, 0xc1, 0x8f, 0xc9, 0x11, 0xea, 0x12, 0xeb, 0x4c, 0x09, 0xca, 0x30, 0x90, 0x0a, 0x0f, 0x03, 0x30, 0x13,
+  0x73, 0x23, 0x32, 0xfe, 0x93, 0xfe, 0xf6, 0xfe, 0xac, 0xfa, 0x2c, 0xda, 0xcb, 0xea, 0x8c, 0xfb, 0x8d, 0xfc, 0x8f, 0xfd, 0x90, 0xfe, 0x12, 0xff, 0x15, 0xce, 0x6b, 0x51, 0x6d, 0x69, 0x8d, 0x71,
+  0x6c, 0x61, 0xcf, 0x79, 0x2f, 0x9a, 0xaf, 0xd2, 0x91, 0xd2, 0x50, 0xa2, 0xcb, 0x01, 0xa7, 0x00, 0x86, 0x08, 0x49, 0x09, 0x6a, 0x09, 0x69, 0x09, 0xfa, 0x2d, 0x75, 0x0c, 0x89, 0x01, 0x53, 0x44,
+  0x94, 0x3c, 0x4f, 0x2b, 0x8d, 0x93, 0xd0, 0x8c, 0x9b, 0x1d, 0x39, 0x46, 0xd1, 0x53, 0xd0, 0x02, 0xf7, 0x2c, 0x75, 0x14, 0xb5, 0x14, 0x95, 0x14, 0x1a, 0x1e, 0x72, 0x13, 0x32, 0x0b, 0x78, 0x0d,
+  0x37, 0x96, 0x82, 0x57, 0xfe, 0x21, 0x19, 0xfe, 0x5b, 0xcc, 0x5d, 0xbc, 0x5e, 0xac, 0x7c, 0xa4, 0xd1, 0x61, 0xbe, 0xbc, 0x1d, 0x8c, 0xfd, 0x93, 0x1d, 0x94, 0x72, 0x2b, 0xd4, 0x1b, 0x12, 0x0b,
+  0x6c, 0x09, 0x8d, 0x01, 0x2e, 0x51, 0x10, 0x99, 0x2f, 0x89, 0x2f, 0x79, 0xee, 0x68, 0x0d, 0x61, 0x4d, 0x41, 0x0c, 0x21, 0x2b, 0x21, 0x2d, 0x59, 0x2c, 0x39, 0x2a, 0x11, 0x4b, 0x29, 0x2a, 0x19,
+  0x4b, 0x11, 0x09, 0x09, 0x0a, 0x09, 0xc8, 0x00, 0xe9, 0x08, 0x82, 0x0a, 0x01, 0x03, 0x4a, 0x01, 0x2a, 0x01, 0x2a, 0x09, 0x4a, 0x01, 0x81, 0x6b, 0x01, 0x00, 0x8b, 0x01, 0x81, 0x4b, 0x01, 0x81,
+  0x2b, 0x01, 0x06, 0x2b, 0x09, 0x4c, 0x11, 0x6c, 0x09, 0x4c, 0x19, 0x6d, 0x39, 0x8d, 0x39, 0x6d, 0x39, 0x82, 0x8c, 0x48, 0x15, 0x8c, 0x40, 0xac, 0x40, 0x8c, 0x40, 0x8b, 0x38, 0x6b, 0x30, 0x8c,
+  0x48, 0x88, 0x08, 0x89, 0x00, 0xa8, 0x00, 0x67, 0x08, 0x88, 0x00, 0xa8, 0x00, 0xc9, 0x00, 0x8e, 0x01, 0x66, 0x08, 0xa9, 0x00, 0xc9, 0x08, 0xcb, 0x00, 0xe9, 0x00, 0xc8, 0x00, 0xea, 0x00, 0x2b,
+  0x09, 0x81, 0x87, 0x08, 0x49, 0xa8, 0x08, 0x67, 0x00, 0x87, 0x00, 0x88, 0x08, 0xa9, 0x10, 0xab, 0x28, 0xed, 0x58, 0x88, 0x18, 0x87, 0x08, 0xaa, 0x18, 0xca, 0x38, 0xab, 0x48, 0x2e, 0x79, 0x0f,
+  0x0a, 0x8d, 0x09, 0xd2, 0x02, 0xaf, 0x78, 0x30, 0x89, 0x0f, 0xb1, 0x2e, 0xb9, 0xef, 0xd9, 0xb3, 0xf2, 0x4d, 0x19, 0xed, 0x01, 0xce, 0x09, 0x32, 0x0b, 0x31, 0x0b, 0x3a, 0x1d, 0x32, 0xcd, 0x71,
+  0xfe, 0xad, 0xcb, 0x2e, 0xdb, 0x0f, 0xeb, 0xeb, 0xfa, 0xab, 0xe2, 0x6c, 0xfc, 0x4d, 0xfd, 0x50, 0xfe, 0x91, 0xfe, 0x71, 0xfe, 0x13, 0xff, 0xf3, 0xdd, 0x8a, 0x49, 0xad, 0x71, 0x6f, 0xba, 0x0e,
+  0xa2, 0xcf, 0xca, 0xce, 0x79, 0x0f, 0x62, 0xc7, 0x10, 0xc7, 0x00, 0x6a, 0x09, 0x8a, 0x01, 0xeb, 0x01, 0xd5, 0x14, 0x54, 0x14, 0x12, 0x04, 0x0e, 0x4b, 0x8e, 0x0a, 0x36, 0x35, 0x6e, 0x12, 0xb5,
+  0x0c, 0x77, 0x45, 0x96, 0x24, 0xf6, 0x14, 0xb5, 0x0c, 0xf4, 0x0b, 0xf6, 0x44, 0xb5, 0x2c, 0xae, 0x32, 0x19, 0xfe, 0xb6, 0xe5, 0x76, 0xfe, 0x97, 0xfe, 0x81, 0x37, 0xfe, 0x28, 0xf7, 0xfd, 0x9a,
+  0xcc, 0xdc, 0xcc, 0x1d, 0xac, 0x9c, 0xbc, 0xfe, 0xd4, 0x30, 0x51, 0xac, 0x40, 0x5d, 0x9c, 0x9d, 0x7b, 0x9a, 0x54, 0x3a, 0x35, 0x15, 0x1c, 0x70, 0x02, 0x2f, 0x0a, 0x6c, 0x01, 0x6f, 0x69, 0x4f,
+  0x89, 0x0e, 0x79, 0x0e, 0x69, 0xed, 0x58, 0x2c, 0x39, 0xce, 0x09, 0xaf, 0x09, 0x4c, 0x01, 0x90, 0x69, 0xec, 0x48, 0xeb, 0x28, 0xea, 0x20, 0x2a, 0x11, 0x2a, 0x09, 0x2a, 0x01, 0xe9, 0x08, 0xe9,
+  0x00, 0xc8, 0x00, 0x2a, 0x09, 0x2a, 0x01, 0xc8, 0x00, 0x09, 0x01, 0xe9, 0x00, 0x4b, 0x01, 0x81, 0x2a, 0x01, 0x81, 0x4b, 0x01, 0x02, 0x6b, 0x01, 0x2a, 0x01, 0x4b, 0x01, 0x81, 0x2a, 0x01, 0x00,
+  0x4b, 0x01, 0x81, 0x6c, 0x09, 0x01, 0x6c, 0x01, 0x6d, 0x21, 0x81, 0x6d, 0x39, 0x00, 0xac, 0x48, 0x81, 0x8c, 0x48, 0x06, 0xac, 0x40, 0xcb, 0x28, 0xac, 0x40, 0x8c, 0x38, 0x6a, 0x20, 0xa8, 0x00,
+  0x88, 0x08, 0x81, 0xa9, 0x00, 0x11, 0x4c, 0x09, 0xa9, 0x00, 0x87, 0x08, 0xa8, 0x08, 0x4b, 0x09, 0x2b, 0x09, 0xa9, 0x00, 0x88, 0x08, 0x0a, 0x01, 0xea, 0x00, 0x68, 0x00, 0xc9, 0x00, 0xcd, 0x01,
+  0x87, 0x00, 0x0a, 0x09, 0x87, 0x00, 0x88, 0x00, 0x87, 0x00, 0x81, 0x88, 0x00, 0x01, 0xaa, 0x20, 0xcc, 0x60, 0x81, 0x67, 0x08, 0x73, 0x89, 0x08, 0xa9, 0x20, 0xec, 0x48, 0xaa, 0x48, 0xaf, 0x90,
+  0x8f, 0x11, 0xac, 0x01, 0x2b, 0x01, 0x32, 0x1a, 0x0e, 0x51, 0xef, 0xa0, 0x0f, 0xb9, 0xb0, 0xd9, 0xb2, 0xfa, 0xc9, 0x10, 0xa8, 0x10, 0xcb, 0x01, 0x6b, 0x01, 0xf8, 0x24, 0xd4, 0x13, 0x93, 0x75,
+  0x8e, 0xfd, 0x0c, 0xda, 0x8e, 0xd2, 0xea, 0xb9, 0x8f, 0xfb, 0xad, 0xea, 0xed, 0xfb, 0x6f, 0xfd, 0x71, 0xfe, 0xce, 0xfd, 0x8e, 0xfd, 0x8f, 0xfd, 0x72, 0xfe, 0xed, 0x8a, 0x2f, 0xb2, 0xee, 0x99,
+  0xb0, 0xca, 0xee, 0x89, 0x09, 0x11, 0x4b, 0x29, 0x8f, 0x02, 0xfa, 0x2d, 0xec, 0x01, 0xf0, 0x02, 0x0b, 0x02, 0x4c, 0x02, 0x2c, 0x02, 0x91, 0x1b, 0x10, 0x1b, 0x0f, 0x83, 0x18, 0x45, 0xb7, 0x35,
+  0x11, 0x13, 0xaf, 0x0a, 0xf4, 0x13, 0x12, 0x2c, 0x38, 0xfe, 0xd7, 0xe4, 0xda, 0xfd, 0x77, 0xfd, 0xd8, 0xfd, 0x39, 0xfe, 0xb8, 0xfd, 0xf7, 0xfd, 0xb9, 0xfd, 0x59, 0xf5, 0xba, 0xd4, 0x1c, 0xa4,
+  0x7a, 0xac, 0x5d, 0x93, 0x9d, 0xbc, 0x1c, 0x9c, 0xe8, 0x20, 0xaa, 0x28, 0x6f, 0x49, 0x39, 0x74, 0x93, 0x13, 0x12, 0x0b, 0x53, 0x0b, 0xac, 0x01, 0x4b, 0x09, 0x8f, 0x81, 0xef, 0x88, 0x0e, 0x61,
+  0x0d, 0x51, 0xcf, 0x29, 0x50, 0x0a, 0x90, 0x02, 0x4c, 0x09, 0x4b, 0x01, 0x6f, 0x69, 0x2e, 0x61, 0x0b, 0x21, 0x0c, 0x39, 0x2b, 0x11, 0xc9, 0x00, 0xe9, 0x00, 0x2a, 0x09, 0xe8, 0x00, 0xe9, 0x00,
+  0xc9, 0x08, 0x2a, 0x01, 0x0a, 0x01, 0xc9, 0x00, 0x2a, 0x01, 0xc8, 0x00, 0x2a, 0x09, 0x2b, 0x01, 0x2a, 0x01, 0x4b, 0x01, 0x6b, 0x09, 0x2a, 0x01, 0x4b, 0x01, 0x0a, 0x01, 0x2a, 0x01, 0x81, 0x0a,
+  0x01, 0x07, 0x4b, 0x09, 0x2b, 0x01, 0x6b, 0x01, 0x4b, 0x01, 0x2c, 0x19, 0x2c, 0x29, 0xac, 0x40, 0xab, 0x28, 0x82, 0xa9, 0x00, 0x01, 0x69, 0x08, 0xab, 0x18, 0x81, 0xa8, 0x00, 0x00, 0xa8, 0x08,
+  0x81, 0xc9, 0x00, 0x0f, 0x0b, 0x01, 0xa8, 0x08, 0x6d, 0x09, 0x0a, 0x01, 0xc9, 0x08, 0x4c, 0x01, 0x87, 0x00, 0x88, 0x08, 0xc9, 0x00, 0x67, 0x00, 0xcf, 0x09, 0xc9, 0x00, 0xad, 0x01, 0xa8, 0x08,
+  0x0a, 0x01, 0x88, 0x00, 0x82, 0x87, 0x08, 0x2e, 0x88, 0x08, 0xc9, 0x10, 0xcb, 0x38, 0x88, 0x10, 0xa9, 0x18, 0xc9, 0x10, 0x89, 0x10, 0x8a, 0x28, 0xec, 0x48, 0x89, 0x30, 0xb1, 0xc1, 0xac, 0x58,
+  0xb1, 0x79, 0x0b, 0x11, 0x91, 0x0a, 0xd2, 0x22, 0x4f, 0x69, 0xee, 0xa0, 0x2d, 0xa1, 0x2f, 0xc1, 0x4a, 0x51, 0x29, 0x01, 0xe8, 0x00, 0x90, 0x02, 0xb0, 0x12, 0x13, 0x1c, 0x2c, 0xfd, 0x10, 0xfe,
+  0x2d, 0xfd, 0xaf, 0xeb, 0x8e, 0xe2, 0x8c, 0xda, 0xed, 0xf2, 0x4b, 0xf3, 0x6d, 0xfd, 0xce, 0xfd, 0x72, 0xfe, 0x8c, 0xfc, 0x8f, 0xfd, 0x71, 0xfe, 0x16, 0xff, 0xcc, 0x99, 0x2e, 0xaa, 0xef, 0x81,
+  0x09, 0x21, 0x29, 0x21, 0x8b, 0x11, 0x81, 0xae, 0x02, 0x42, 0x95, 0x14, 0x91, 0x13, 0xb7, 0x2c, 0x34, 0x04, 0x72, 0x1b, 0xd0, 0x02, 0xce, 0x11, 0xac, 0x51, 0x0e, 0x3a, 0x50, 0x13, 0xb3, 0x9c,
+  0xf7, 0xfd, 0x57, 0xfd, 0xb7, 0xdc, 0x78, 0xfd, 0x37, 0xfd, 0x97, 0xe4, 0xf9, 0xfc, 0xd7, 0xec, 0x78, 0xfd, 0x3a, 0xc4, 0x1a, 0xac, 0x1b, 0xed, 0x5a, 0xf5, 0xdc, 0xe4, 0x3b, 0xbc, 0x9b, 0xe4,
+  0xfd, 0xa3, 0x0c, 0x29, 0xe9, 0x28, 0x30, 0x0a, 0x12, 0x13, 0x94, 0x13, 0x93, 0x03, 0x0e, 0x02, 0xad, 0x01, 0x4b, 0x09, 0x6f, 0x81, 0x4f, 0x71, 0xec, 0x50, 0xcc, 0x48, 0x8d, 0x19, 0xae, 0x01,
+  0x0b, 0x01, 0x8d, 0x09, 0xcd, 0x01, 0x4d, 0x49, 0x2d, 0x39, 0x0d, 0x51, 0xeb, 0x28, 0x2c, 0x31, 0x2b, 0x11, 0xa8, 0x00, 0xe9, 0x00, 0x2a, 0x09, 0xe9, 0x00, 0x2a, 0x09, 0x0a, 0x09, 0x09, 0x01,
+  0x6b, 0x01, 0xe9, 0x00, 0x2a, 0x01, 0xc9, 0x00, 0x2b, 0x09, 0x09, 0x09, 0x0a, 0x01, 0x0a, 0x09, 0x81, 0x2a, 0x01, 0x01, 0x4b, 0x09, 0x2a, 0x01, 0x82, 0x0a, 0x01, 0x81, 0x2a, 0x01, 0x06, 0x4a,
+  0x01, 0x2a, 0x01, 0x0a, 0x01, 0x4c, 0x11, 0xaa, 0x18, 0x89, 0x08, 0xa8, 0x00, 0x81, 0xa9, 0x00, 0x02, 0xca, 0x08, 0xab, 0x20, 0x88, 0x00, 0x81, 0xa8, 0x00, 0x16, 0x88, 0x00, 0xa8, 0x00, 0xea,
+  0x00, 0xe9, 0x00, 0xcf, 0x09, 0xc8, 0x00, 0xa8, 0x00, 0xca, 0x00, 0x8d, 0x09, 0x87, 0x08, 0xcf, 0x09, 0xc8, 0x08, 0xcf, 0x09, 0x88, 0x00, 0x8e, 0x01, 0x2b, 0x01, 0xc8, 0x00, 0xae, 0x11, 0x0a,
+  0x09, 0x67, 0x10, 0x87, 0x00, 0x87, 0x08, 0xc9, 0x08, 0x81, 0xaa, 0x20, 0x62, 0x4c, 0x19, 0xa8, 0x00, 0x4c, 0x01, 0xc9, 0x08, 0xca, 0x20, 0xee, 0x70, 0xaa, 0x28, 0xcb, 0x40, 0xca, 0x28, 0xcd,
+  0x80, 0x50, 0x02, 0xee, 0x09, 0xef, 0x21, 0x2d, 0x41, 0x0d, 0x81, 0x4f, 0x99, 0xf1, 0xb8, 0x72, 0xda, 0xea, 0x08, 0x0d, 0x02, 0x8c, 0x09, 0xd3, 0x13, 0x54, 0xb5, 0xee, 0xfc, 0x30, 0xf6, 0xae,
+  0xfc, 0x30, 0xfe, 0xad, 0xda, 0x2c, 0xca, 0x4d, 0xfb, 0x4c, 0xfb, 0x0c, 0xfd, 0x8e, 0xfd, 0x71, 0xfe, 0xcc, 0xfc, 0x8e, 0xfd, 0x10, 0xfe, 0x52, 0xfe, 0x30, 0xa5, 0x08, 0x29, 0xa7, 0x10, 0x4a,
+  0x29, 0x49, 0x11, 0x0c, 0x0a, 0xaa, 0x01, 0x6e, 0x0a, 0x2f, 0x4a, 0x10, 0x53, 0x2d, 0x43, 0xf1, 0x63, 0x2f, 0x6a, 0xab, 0x41, 0x2c, 0x2a, 0x6a, 0x29, 0x36, 0xdd, 0x96, 0xfd, 0x18, 0xcc, 0xba,
+  0xfd, 0x37, 0xf5, 0x17, 0xfd, 0x97, 0xdc, 0x78, 0xe4, 0x7a, 0xfd, 0xba, 0xe4, 0x5c, 0xc4, 0x5b, 0xb4, 0x9b, 0x83, 0x7a, 0xdc, 0x5a, 0xd4, 0x79, 0xcc, 0x1b, 0x94, 0xbd, 0xdc, 0xf1, 0x31, 0x0a,
+  0x11, 0xc8, 0x10, 0xd1, 0x12, 0xf1, 0x02, 0x32, 0x13, 0x2f, 0x02, 0x8c, 0x01, 0xcf, 0x49, 0x4f, 0x89, 0x0d, 0x61, 0x2d, 0x49, 0x2a, 0x29, 0x4c, 0x11, 0x71, 0x0a, 0xcd, 0x01, 0x2f, 0x12, 0x4c,
+  0x11, 0x0b, 0x09, 0x0c, 0x39, 0x2c, 0x41, 0x0c, 0x31, 0xeb, 0x20, 0x0b, 0x19, 0x2b, 0x19, 0xc8, 0x00, 0xe9, 0x00, 0x81, 0x09, 0x01, 0x0d, 0xe9, 0x08, 0x6b, 0x01, 0x6b, 0x09, 0x6c, 0x01, 0xc9,
+  0x00, 0x2b, 0x09, 0xe9, 0x00, 0xc9, 0x00, 0xc8, 0x08, 0xe9, 0x00, 0x09, 0x01, 0xe9, 0x08, 0x2a, 0x09, 0x0a, 0x01, 0x82, 0x2a, 0x01, 0x82, 0x0a, 0x01, 0x81, 0x2a, 0x01, 0x04, 0x0a, 0x01, 0x2b,
+  0x09, 0x89, 0x08, 0xc8, 0x00, 0xa8, 0x00, 0x81, 0xa9, 0x00, 0x81, 0x88, 0x00, 0x82, 0xa8, 0x00, 0x02, 0xa9, 0x00, 0xa8, 0x00, 0x88, 0x00, 0x81, 0xea, 0x00, 0x07, 0x2b, 0x01, 0xa7, 0x00, 0xca,
+  0x00, 0x8e, 0x01, 0x88, 0x00, 0xef, 0x01, 0x87, 0x00, 0x6d, 0x09, 0x81, 0xa9, 0x00, 0x05, 0xca, 0x00, 0x67, 0x00, 0xae, 0x01, 0x68, 0x08, 0x6d, 0x09, 0x46, 0x00, 0x81, 0xa8, 0x08, 0x77, 0xc9,
+  0x08, 0xea, 0x18, 0xc9, 0x08, 0xad, 0x09, 0x8c, 0x09, 0xc8, 0x00, 0xc9, 0x08, 0xea, 0x20, 0x0e, 0x69, 0xad, 0x50, 0xa9, 0x10, 0x6d, 0x11, 0x90, 0x81, 0x6f, 0x12, 0x4e, 0x0a, 0xce, 0x09, 0xd3,
+  0x02, 0xec, 0x68, 0x0d, 0x79, 0xcd, 0x68, 0x50, 0xc1, 0x28, 0x01, 0x2b, 0x09, 0xcf, 0x02, 0x98, 0x45, 0xa9, 0xfc, 0xcc, 0xfc, 0x72, 0xfe, 0xcc, 0xfc, 0xb2, 0xfe, 0xcb, 0xba, 0xee, 0xfa, 0x6d,
+  0xf3, 0x2b, 0xfc, 0xec, 0xfc, 0x6e, 0xfd, 0x72, 0xfe, 0x13, 0xff, 0xed, 0xfc, 0xee, 0xfc, 0x10, 0xfe, 0x14, 0xff, 0x0d, 0x6b, 0x2a, 0x31, 0x68, 0x21, 0x8b, 0x09, 0x48, 0x11, 0x6d, 0x51, 0xee,
+  0x59, 0xad, 0x49, 0x2f, 0x2a, 0xd3, 0xcb, 0xf5, 0xf5, 0x12, 0xed, 0x33, 0xf5, 0xd6, 0xec, 0xb7, 0xcb, 0xb8, 0xdc, 0x78, 0xed, 0x98, 0xfd, 0x77, 0xd4, 0x19, 0xfd, 0x98, 0xdc, 0x3a, 0xcc, 0x7a,
+  0xec, 0x9b, 0xc4, 0x59, 0xbc, 0x99, 0xc4, 0xda, 0xfc, 0x3b, 0xd4, 0xd9, 0x9b, 0xda, 0xab, 0x9e, 0xa5, 0xd6, 0x1b, 0x2f, 0x0a, 0xa8, 0x08, 0x12, 0x0b, 0x50, 0x0a, 0xb0, 0x02, 0x0f, 0x0a, 0x6c,
+  0x11, 0x4f, 0x81, 0x0d, 0x59, 0x0c, 0x51, 0xeb, 0x40, 0x0e, 0x0a, 0x92, 0x0a, 0x0f, 0x02, 0xef, 0x09, 0x8c, 0x01, 0xec, 0x38, 0xea, 0x10, 0x6c, 0x19, 0x0b, 0x29, 0x0b, 0x31, 0x2b, 0x11, 0x0a,
+  0x01, 0x2b, 0x11, 0x2b, 0x09, 0xc9, 0x00, 0x09, 0x01, 0xe9, 0x00, 0x0a, 0x01, 0x4b, 0x09, 0x2b, 0x01, 0x2a, 0x09, 0x0b, 0x01, 0xa8, 0x00, 0x0b, 0x01, 0xa8, 0x00, 0x0a, 0x09, 0x09, 0x09, 0x0a,
+  0x01, 0xa9, 0x08, 0x2a, 0x01, 0x0a, 0x01, 0x09, 0x09, 0xe9, 0x00, 0x0a, 0x01, 0x0b, 0x01, 0x81, 0x0a, 0x01, 0x81, 0x2a, 0x01, 0x81, 0x0a, 0x01, 0x00, 0x2b, 0x09, 0x82, 0xa9, 0x00, 0x83, 0xa8,
+  0x00, 0x00, 0xa9, 0x00, 0x84, 0xa8, 0x00, 0x7b, 0xea, 0x00, 0xca, 0x00, 0xae, 0x01, 0x87, 0x00, 0xa9, 0x00, 0x2c, 0x01, 0xad, 0x09, 0x4d, 0x01, 0xc8, 0x08, 0x2b, 0x09, 0xc9, 0x00, 0x8c, 0x09,
+  0xc9, 0x00, 0x87, 0x08, 0xa8, 0x08, 0x09, 0x01, 0xe9, 0x00, 0x6b, 0x09, 0xc9, 0x00, 0x88, 0x00, 0xa8, 0x08, 0xc9, 0x08, 0xa8, 0x00, 0x8c, 0x09, 0x0a, 0x01, 0x8c, 0x01, 0xc9, 0x10, 0x88, 0x10,
+  0x4d, 0x19, 0x0d, 0x19, 0xae, 0x11, 0xce, 0x09, 0x4d, 0x21, 0xec, 0x60, 0x2f, 0x71, 0x0f, 0x02, 0xe9, 0x00, 0x0f, 0x0a, 0x2b, 0x11, 0xcb, 0x48, 0xcc, 0x60, 0xcc, 0x70, 0x6d, 0x51, 0x4f, 0x12,
+  0x75, 0x14, 0x56, 0x8d, 0x6b, 0xfc, 0xab, 0xfc, 0x30, 0xfe, 0x4e, 0xfd, 0x2e, 0xfd, 0x2f, 0xfe, 0x91, 0xf5, 0xcb, 0xfb, 0x2b, 0xfc, 0x0d, 0xfd, 0xcf, 0xfd, 0x50, 0xfe, 0xb2, 0xfe, 0x4b, 0xfc,
+  0x0e, 0xfd, 0x8f, 0xfd, 0x11, 0xfe, 0x92, 0xfe, 0x05, 0x21, 0xe8, 0x10, 0xcb, 0x51, 0x0e, 0x8b, 0xd0, 0x62, 0xf3, 0xf4, 0x6f, 0x83, 0xb1, 0xdc, 0x51, 0xa3, 0x11, 0xd4, 0x16, 0xf5, 0x36, 0xcc,
+  0xf8, 0xb3, 0xd9, 0xa3, 0xf7, 0xa3, 0x99, 0xfd, 0xd7, 0xfc, 0x3a, 0xfd, 0xb7, 0xdc, 0x58, 0x8c, 0x17, 0x64, 0x78, 0x5c, 0x9b, 0xac, 0xd9, 0x94, 0x35, 0x53, 0xf3, 0x12, 0x53, 0x13, 0xb4, 0x13,
+  0x90, 0x1a, 0x33, 0x1b, 0x4a, 0x09, 0xd1, 0x02, 0xcd, 0x01, 0xac, 0x01, 0x6b, 0x01, 0x4e, 0x59, 0x0d, 0x59, 0xeb, 0x48, 0xca, 0x38, 0xea, 0x30, 0x2a, 0x19, 0x0e, 0x02, 0x8d, 0x09, 0x2f, 0x0a,
+  0x6c, 0x09, 0x2c, 0x21, 0xca, 0x18, 0xce, 0x09, 0x2c, 0x11, 0xea, 0x18, 0x2c, 0x11, 0xea, 0x00, 0x8c, 0x09, 0x2a, 0x01, 0xea, 0x00, 0x4a, 0x01, 0xe9, 0x00, 0x0a, 0x01, 0xe9, 0x00, 0x6c, 0x01,
+  0x81, 0x2a, 0x01, 0x0b, 0xea, 0x00, 0xc9, 0x00, 0x0b, 0x01, 0xc9, 0x00, 0x2b, 0x09, 0xe9, 0x08, 0xc8, 0x00, 0x2b, 0x09, 0x0a, 0x01, 0xe9, 0x00, 0x2a, 0x09, 0xe9, 0x00, 0x81, 0x0a, 0x01, 0x85,
+  0x2a, 0x01, 0x00, 0x2b, 0x09, 0x84, 0xa9, 0x00, 0x81, 0xa8, 0x00, 0x00, 0xa9, 0x00, 0x82, 0xa8, 0x00, 0x38, 0x88, 0x08, 0x0b, 0x01, 0xc9, 0x00, 0xea, 0x08, 0xed, 0x00, 0x89, 0x08, 0x88, 0x00,
+  0x0b, 0x01, 0x30, 0x02, 0xa7, 0x08, 0xeb, 0x00, 0xce, 0x01, 0x67, 0x08, 0x6e, 0x01, 0xc9, 0x08, 0x65, 0x08, 0x88, 0x00, 0xc9, 0x00, 0x0b, 0x01, 0x0f, 0x02, 0x2c, 0x01, 0x87, 0x08, 0x4c, 0x09,
+  0x87, 0x08, 0x67, 0x00, 0xe9, 0x00, 0x8c, 0x09, 0x4b, 0x01, 0xe8, 0x08, 0x4c, 0x01, 0xe9, 0x00, 0x2b, 0x11, 0xed, 0x11, 0xcd, 0x01, 0x0f, 0x0a, 0xcd, 0x09, 0xaa, 0x18, 0x6e, 0x59, 0x0e, 0x0a,
+  0x6f, 0x0a, 0x2e, 0x02, 0x0b, 0x01, 0x2b, 0x19, 0xab, 0x40, 0xcb, 0x50, 0xf0, 0x59, 0x73, 0x0b, 0x76, 0x14, 0xcc, 0xeb, 0x8e, 0x5b, 0x55, 0x1c, 0xaf, 0xfd, 0x8e, 0xed, 0xac, 0xfc, 0x0e, 0xf5,
+  0xef, 0xfd, 0x4b, 0xfc, 0x81, 0x8b, 0xfc, 0x07, 0xcc, 0xfc, 0x8e, 0xfd, 0x51, 0xfe, 0x71, 0xfe, 0xcf, 0xfc, 0xee, 0xfc, 0x50, 0xfd, 0x31, 0xfd, 0x81, 0x92, 0xfd, 0x1f, 0x71, 0xdc, 0x4d, 0x9b,
+  0x52, 0x83, 0xf1, 0xe4, 0x74, 0xfd, 0x90, 0xcc, 0x51, 0xdc, 0x18, 0xed, 0x95, 0xd4, 0xf7, 0xe4, 0xf7, 0xdc, 0x77, 0xc4, 0x99, 0xc4, 0xd3, 0x53, 0x91, 0x12, 0xd2, 0x22, 0xee, 0x01, 0xac, 0x01,
+  0xb1, 0x12, 0xf2, 0x1a, 0xcc, 0x01, 0xf1, 0x02, 0x33, 0x13, 0x50, 0x0a, 0xd1, 0x02, 0x0e, 0x0a, 0xee, 0x01, 0x2f, 0x0a, 0xcd, 0x09, 0x4a, 0x01, 0x6c, 0x29, 0x4d, 0x49, 0x81, 0x0b, 0x39, 0x01,
+  0x2c, 0x21, 0x6c, 0x11, 0x81, 0x2f, 0x0a, 0x05, 0x2d, 0x11, 0x0f, 0x0a, 0xae, 0x09, 0xee, 0x01, 0x2c, 0x01, 0xed, 0x01, 0x81, 0x6b, 0x01, 0x19, 0x2b, 0x09, 0x2c, 0x09, 0xe9, 0x00, 0x4b, 0x01,
+  0xea, 0x00, 0xe8, 0x00, 0x2b, 0x01, 0x0a, 0x09, 0x4a, 0x01, 0xea, 0x00, 0x6b, 0x01, 0x0a, 0x01, 0xc9, 0x00, 0x2b, 0x01, 0xc8, 0x00, 0x4b, 0x09, 0x8c, 0x01, 0xe9, 0x00, 0xe9, 0x08, 0x2a, 0x01,
+  0x2c, 0x01, 0x0a, 0x01, 0xc9, 0x00, 0xa8, 0x00, 0xc8, 0x00, 0x2a, 0x01, 0x87, 0x0a, 0x01, 0x84, 0xa9, 0x00, 0x84, 0xa8, 0x00, 0x81, 0x88, 0x00, 0x76, 0xea, 0x00, 0xc9, 0x00, 0xa8, 0x00, 0xca,
+  0x00, 0xc9, 0x00, 0xa8, 0x08, 0xc9, 0x08, 0x8d, 0x09, 0xa8, 0x00, 0xeb, 0x00, 0x4c, 0x01, 0xea, 0x00, 0xe9, 0x08, 0x2b, 0x01, 0x8c, 0x01, 0x86, 0x00, 0xeb, 0x08, 0x8d, 0x09, 0x6b, 0x01, 0xc8,
+  0x00, 0x87, 0x00, 0x8e, 0x01, 0x66, 0x00, 0x88, 0x00, 0xc8, 0x00, 0x0a, 0x01, 0x4c, 0x01, 0xa7, 0x00, 0x6c, 0x01, 0x0e, 0x0a, 0x0a, 0x01, 0x8d, 0x01, 0x2b, 0x01, 0x8d, 0x01, 0x2b, 0x01, 0x8c,
+  0x09, 0xea, 0x10, 0x2b, 0x09, 0xee, 0x09, 0xcd, 0x01, 0xee, 0x09, 0x4b, 0x01, 0x4e, 0x0a, 0x4a, 0x09, 0x2b, 0x11, 0x6d, 0x41, 0x11, 0x0b, 0xac, 0x09, 0xcc, 0x01, 0x93, 0x0b, 0xd3, 0x0b, 0x6c,
+  0x22, 0xb2, 0xb4, 0x4e, 0x12, 0x8c, 0x42, 0xad, 0xfd, 0x8e, 0xed, 0xad, 0x83, 0x0c, 0xfd, 0x4e, 0xfd, 0xad, 0xfd, 0xee, 0xfd, 0xf1, 0xfd, 0x30, 0xec, 0x6f, 0xf4, 0xb0, 0xfc, 0xd1, 0xfc, 0x32,
+  0xed, 0x54, 0xf5, 0x51, 0xdc, 0xb3, 0xfd, 0xd0, 0xdb, 0x14, 0xf5, 0xb3, 0xdc, 0x93, 0xe4, 0x15, 0xe5, 0xb4, 0xdc, 0x15, 0xb4, 0x52, 0x5b, 0xb7, 0x84, 0xd5, 0x23, 0xcd, 0x09, 0x29, 0x09, 0x93,
+  0x0b, 0x95, 0x03, 0x6f, 0x02, 0xed, 0x01, 0x73, 0x0b, 0x52, 0x0b, 0xd4, 0x13, 0x10, 0x1b, 0xb0, 0x02, 0xcd, 0x09, 0xac, 0x09, 0x4f, 0x02, 0xee, 0x01, 0x2b, 0x09, 0xae, 0x31, 0xea, 0x20, 0xea,
+  0x10, 0xcd, 0x09, 0xad, 0x09, 0x2a, 0x01, 0xae, 0x09, 0x0d, 0x29, 0x2b, 0x11, 0xcf, 0x09, 0xae, 0x01, 0x6b, 0x01, 0x8d, 0x01, 0x2f, 0x02, 0x6c, 0x09, 0x2a, 0x09, 0xcd, 0x01, 0xed, 0x01, 0x4c,
+  0x09, 0xad, 0x01, 0x4c, 0x01, 0xc8, 0x00, 0x81, 0x0a, 0x01, 0x0e, 0xc8, 0x00, 0x2b, 0x01, 0x8c, 0x09, 0x4b, 0x01, 0x09, 0x01, 0xc9, 0x00, 0xe9, 0x00, 0x09, 0x01, 0x6c, 0x09, 0xc9, 0x00, 0x0a,
+  0x01, 0xa8, 0x00, 0x8d, 0x09, 0xe9, 0x00, 0x0a, 0x01, 0x81, 0xe9, 0x00, 0x00, 0x2a, 0x01, 0x86, 0x0a, 0x01, 0x01, 0x2a, 0x01, 0xea, 0x00, 0x84, 0xa9, 0x00, 0x83, 0xa8, 0x00, 0x81, 0xa9, 0x00,
+  0x7e, 0x88, 0x00, 0xa9, 0x08, 0xea, 0x00, 0xa8, 0x00, 0x88, 0x08, 0x0b, 0x09, 0x6c, 0x09, 0x4b, 0x01, 0xc8, 0x00, 0xc9, 0x08, 0x6c, 0x09, 0xa8, 0x00, 0x87, 0x00, 0x6c, 0x01, 0xc8, 0x00, 0x6f,
+  0x09, 0x89, 0x08, 0xc9, 0x00, 0x0a, 0x01, 0x4b, 0x01, 0xe8, 0x08, 0x4c, 0x09, 0x2b, 0x01, 0x92, 0x12, 0xa7, 0x00, 0x0a, 0x09, 0xc9, 0x00, 0xc9, 0x08, 0xce, 0x11, 0xa7, 0x00, 0x4b, 0x09, 0x0e,
+  0x12, 0x2b, 0x01, 0xea, 0x00, 0x4a, 0x01, 0x0e, 0x02, 0x0a, 0x01, 0x50, 0x12, 0xac, 0x01, 0x6c, 0x01, 0xcd, 0x01, 0x6b, 0x01, 0xed, 0x09, 0xcc, 0x01, 0x4a, 0x01, 0x6b, 0x01, 0xcc, 0x11, 0xcc,
+  0x09, 0x6a, 0x09, 0xac, 0x09, 0x0d, 0x0a, 0xee, 0x1a, 0x6d, 0x1a, 0x53, 0x0b, 0x8e, 0x02, 0xcc, 0x09, 0x6c, 0x32, 0x14, 0x3c, 0xec, 0x09, 0xcb, 0xfc, 0xb2, 0x9c, 0xab, 0x42, 0x2f, 0xfd, 0xcf,
+  0xdc, 0xef, 0xfc, 0x91, 0xe4, 0xd3, 0xe4, 0x12, 0xe5, 0x12, 0xfd, 0x33, 0xfd, 0x13, 0xfd, 0xf3, 0xfc, 0x93, 0xe4, 0xf3, 0xf4, 0x70, 0xa3, 0x8f, 0x7b, 0xd3, 0xa3, 0x75, 0xa4, 0x6c, 0x19, 0x8b,
+  0x01, 0xad, 0x09, 0x4f, 0x02, 0x0d, 0x02, 0x4e, 0x02, 0xcd, 0x01, 0x6a, 0x01, 0xb0, 0x0a, 0xf1, 0x0a, 0x8b, 0x09, 0x4e, 0x02, 0x90, 0x02, 0x6f, 0x02, 0xcc, 0x01, 0xed, 0x09, 0xf0, 0x02, 0xad,
+  0x09, 0xcd, 0x01, 0xcd, 0x09, 0x2b, 0x01, 0x4b, 0x11, 0xca, 0x08, 0xac, 0x01, 0x4b, 0x09, 0xed, 0x01, 0xad, 0x09, 0x0e, 0x0a, 0xad, 0x01, 0xee, 0x01, 0x09, 0x09, 0x8c, 0x01, 0xcd, 0x09, 0x6b,
+  0x01, 0x09, 0x01, 0x8d, 0x01, 0x2a, 0x01, 0x8c, 0x09, 0xc9, 0x00, 0x0b, 0x01, 0xae, 0x01, 0x4c, 0x09, 0x0a, 0x01, 0xea, 0x08, 0xa9, 0x00, 0xce, 0x01, 0xc9, 0x00, 0x0b, 0x01, 0xc8, 0x08, 0x81,
+  0xa8, 0x00, 0x03, 0x2b, 0x01, 0x4b, 0x01, 0xa8, 0x00, 0x0b, 0x01, 0x81, 0x0a, 0x01, 0x81, 0xea, 0x00, 0x01, 0xe9, 0x00, 0x4b, 0x01, 0x81, 0x0a, 0x01, 0x00, 0x0b, 0x01, 0x81, 0x0a, 0x01, 0x00,
+  0x2a, 0x01, 0x83, 0x0a, 0x01, 0x88, 0xa9, 0x00, 0x03, 0xc9, 0x00, 0xa8, 0x00, 0x88, 0x00, 0x6c, 0x09, 0x81, 0xca, 0x00, 0x0c, 0xa9, 0x08, 0xca, 0x00, 0x2c, 0x01, 0xea, 0x00, 0x88, 0x00, 0xc9,
+  0x00, 0xcb, 0x08, 0xea, 0x00, 0x88, 0x00, 0x0b, 0x01, 0xc9, 0x08, 0xea, 0x08, 0xad, 0x09, 0x81, 0xc8, 0x08, 0x1c, 0xc9, 0x08, 0x2e, 0x02, 0xa8, 0x08, 0xe9, 0x08, 0x8d, 0x01, 0x67, 0x00, 0x88,
+  0x00, 0xe9, 0x00, 0xc8, 0x00, 0x0b, 0x01, 0xc8, 0x00, 0xa8, 0x00, 0x4b, 0x09, 0xce, 0x09, 0xc9, 0x00, 0x0b, 0x01, 0x0f, 0x0a, 0x0a, 0x09, 0xad, 0x01, 0x0e, 0x02, 0x4a, 0x01, 0x2f, 0x0a, 0xcd,
+  0x09, 0xcc, 0x09, 0x29, 0x01, 0x8b, 0x01, 0xad, 0x01, 0xca, 0x08, 0x08, 0x09, 0x81, 0x8a, 0x01, 0x3b, 0x49, 0x09, 0xcc, 0x11, 0x4e, 0x02, 0xcf, 0x02, 0x11, 0x0b, 0x8b, 0x11, 0x12, 0x23, 0xec,
+  0x19, 0xf0, 0x0a, 0x0b, 0x1a, 0x2f, 0x0a, 0x69, 0x09, 0x0e, 0xcd, 0xec, 0x11, 0x2c, 0x22, 0x72, 0xed, 0x12, 0xc4, 0x50, 0xe4, 0xb1, 0xfc, 0x70, 0xf4, 0x13, 0xfd, 0x51, 0xe4, 0xd4, 0xdc, 0xd1,
+  0xec, 0x55, 0xfd, 0x94, 0xcc, 0x51, 0x83, 0xaa, 0x19, 0x6b, 0x11, 0x29, 0x09, 0xcc, 0x01, 0x09, 0x01, 0xf0, 0x02, 0x8f, 0x0a, 0x0e, 0x0a, 0xcc, 0x01, 0xec, 0x01, 0xcc, 0x01, 0xcf, 0x02, 0xed,
+  0x01, 0xac, 0x09, 0xab, 0x09, 0x0d, 0x0a, 0xce, 0x09, 0xab, 0x01, 0x6b, 0x01, 0x2a, 0x01, 0x09, 0x01, 0xac, 0x09, 0x8d, 0x09, 0xce, 0x09, 0x0a, 0x01, 0xee, 0x01, 0x8c, 0x09, 0x6b, 0x01, 0xcd,
+  0x01, 0xed, 0x01, 0x6c, 0x09, 0xe9, 0x00, 0x8c, 0x01, 0x81, 0x4b, 0x01, 0x16, 0xae, 0x01, 0x0a, 0x01, 0xac, 0x09, 0x0a, 0x09, 0x8b, 0x01, 0x0e, 0x0a, 0x6c, 0x01, 0x09, 0x01, 0xe9, 0x00, 0xea,
+  0x00, 0x0b, 0x01, 0x2b, 0x01, 0xc9, 0x00, 0xe9, 0x00, 0xc8, 0x00, 0x6c, 0x09, 0x4c, 0x01, 0x0a, 0x01, 0x2a, 0x01, 0xea, 0x00, 0xe9, 0x08, 0x4c, 0x01, 0xc8, 0x00, 0x81, 0xc9, 0x00, 0x00, 0x2b,
+  0x01, 0x82, 0x0a, 0x01, 0x00, 0x0b, 0x01, 0x86, 0x0a, 0x01, 0x89, 0xa9, 0x00, 0x0e, 0x88, 0x08, 0xa9, 0x00, 0x0b, 0x09, 0xea, 0x00, 0xc9, 0x08, 0xa9, 0x00, 0xc9, 0x08, 0x2b, 0x01, 0xaa, 0x00,
+  0xc8, 0x00, 0xca, 0x00, 0xc9, 0x00, 0x6d, 0x09, 0xa8, 0x08, 0xca, 0x08, 0x81, 0xa8, 0x00, 0x77, 0x6c, 0x01, 0xc9, 0x00, 0x87, 0x08, 0xe9, 0x00, 0x6c, 0x09, 0x2a, 0x09, 0x87, 0x08, 0x0a, 0x09,
+  0x2a, 0x09, 0xa9, 0x00, 0x2a, 0x01, 0x8c, 0x09, 0x6b, 0x11, 0x2b, 0x01, 0x87, 0x00, 0xa7, 0x00, 0x4c, 0x01, 0x6c, 0x01, 0xad, 0x01, 0x8d, 0x01, 0xac, 0x01, 0x8d, 0x09, 0x8c, 0x01, 0x0a, 0x01,
+  0x4a, 0x01, 0x6e, 0x02, 0x6b, 0x09, 0xe8, 0x00, 0x0a, 0x09, 0x8c, 0xf1, 0x92, 0xc3, 0xa8, 0x08, 0x09, 0x09, 0x48, 0x11, 0x28, 0x09, 0x8a, 0x09, 0x2a, 0x09, 0x4a, 0x09, 0x8f, 0x12, 0xac, 0x11,
+  0xe9, 0x08, 0xcb, 0x09, 0x6b, 0x01, 0x6f, 0x0a, 0xf1, 0x0a, 0xe6, 0x00, 0x28, 0x01, 0xb1, 0x0b, 0x4a, 0x11, 0xad, 0x4a, 0x07, 0x01, 0xb1, 0x9c, 0x8e, 0xfc, 0xae, 0xfc, 0xef, 0xfc, 0xd3, 0xdc,
+  0x52, 0xe4, 0x70, 0xec, 0x6f, 0xec, 0x0d, 0x0a, 0x69, 0x09, 0xaa, 0x09, 0x2e, 0x02, 0xab, 0x01, 0xac, 0x11, 0x8f, 0x02, 0xaf, 0x0a, 0xec, 0x11, 0x6e, 0x12, 0x2c, 0x02, 0x6e, 0x02, 0x8c, 0x11,
+  0x0e, 0x0a, 0x6a, 0x09, 0xac, 0x01, 0xce, 0x09, 0x4a, 0x09, 0xac, 0x01, 0x49, 0x09, 0xe9, 0x40, 0x6f, 0xca, 0x0c, 0x01, 0x90, 0xdb, 0x4b, 0x19, 0x09, 0x01, 0x4a, 0x01, 0x2b, 0x09, 0x8c, 0x01,
+  0xcd, 0x09, 0x2a, 0x09, 0x8b, 0x01, 0x0a, 0x01, 0x4a, 0x09, 0x6b, 0x01, 0x09, 0x01, 0x8c, 0x09, 0x2b, 0x01, 0x2a, 0x01, 0xc8, 0x00, 0x4b, 0x01, 0x0a, 0x01, 0x6c, 0x01, 0x0a, 0x01, 0x09, 0x01,
+  0xc9, 0x00, 0x0a, 0x01, 0x4b, 0x01, 0x2b, 0x01, 0x0a, 0x09, 0xc8, 0x00, 0xad, 0x09, 0xad, 0x01, 0x0a, 0x01, 0xe9, 0x00, 0x0a, 0x09, 0x4b, 0x01, 0xe9, 0x08, 0x0a, 0x01, 0x4c, 0x01, 0xa8, 0x08,
+  0x81, 0x2b, 0x01, 0x00, 0x0b, 0x01, 0x89, 0x0a, 0x01, 0x8a, 0xa9, 0x00, 0x7a, 0xca, 0x00, 0x0b, 0x11, 0xa8, 0x08, 0x88, 0x10, 0x87, 0x08, 0x66, 0x00, 0xa7, 0x08, 0x67, 0x08, 0x2b, 0x11, 0x87,
+  0x08, 0xa7, 0x00, 0xc9, 0x08, 0x2a, 0x09, 0xa8, 0x00, 0x86, 0x00, 0x87, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0x0a, 0x01, 0xea, 0x00, 0x8a, 0x08, 0x4d, 0x01, 0xa8, 0x00, 0xa9, 0x08, 0xce, 0x09, 0xc8,
+  0x08, 0x0a, 0x01, 0x2b, 0x09, 0x6c, 0x01, 0x86, 0x00, 0xa7, 0x00, 0x4a, 0x01, 0xe8, 0x08, 0x09, 0x01, 0x29, 0x01, 0x2a, 0x01, 0x4b, 0x01, 0xed, 0x09, 0x4a, 0x09, 0x8a, 0x11, 0x29, 0x09, 0xcc,
+  0x01, 0xe8, 0x08, 0x4c, 0x71, 0xc9, 0x60, 0xeb, 0x78, 0xe9, 0x70, 0x4c, 0xb1, 0x8a, 0x81, 0x2b, 0x79, 0x0d, 0xd2, 0x6e, 0xd2, 0xe8, 0x08, 0x08, 0x01, 0xc6, 0x00, 0x8b, 0x01, 0xac, 0x09, 0x0d,
+  0x0a, 0xee, 0x32, 0x09, 0x09, 0x29, 0x01, 0xeb, 0x09, 0x90, 0xe3, 0x08, 0x29, 0xcd, 0xc1, 0x89, 0x21, 0x48, 0x29, 0x69, 0x01, 0xee, 0x11, 0xec, 0xf3, 0xc7, 0x68, 0x0a, 0xb1, 0xec, 0xe1, 0x4f,
+  0xfc, 0xee, 0x7a, 0x49, 0x09, 0xac, 0x09, 0xaa, 0x09, 0x66, 0x08, 0x6d, 0xa2, 0xb0, 0xbb, 0x09, 0x09, 0x28, 0x01, 0xcc, 0x09, 0x8a, 0x09, 0xed, 0x11, 0x09, 0x09, 0xcd, 0xc9, 0x8b, 0x51, 0x6b,
+  0x09, 0xcc, 0x09, 0x09, 0x09, 0x6a, 0x09, 0x29, 0x01, 0x87, 0x08, 0x6a, 0x80, 0xea, 0x68, 0x2b, 0xd1, 0x6f, 0xfb, 0xcb, 0xa0, 0xcd, 0x99, 0x09, 0x01, 0x6a, 0x01, 0xea, 0x10, 0x4b, 0x11, 0x08,
+  0x19, 0x2d, 0x1a, 0xc9, 0x00, 0x4b, 0x09, 0xef, 0x99, 0x90, 0xb2, 0x4b, 0x01, 0x88, 0x10, 0x6c, 0x09, 0x6b, 0x09, 0x0a, 0x01, 0x6b, 0x01, 0xe9, 0x00, 0x4b, 0x01, 0x2b, 0x01, 0xa7, 0x00, 0xed,
+  0x09, 0x0b, 0x01, 0x82, 0xc9, 0x00, 0x09, 0x6c, 0x01, 0x6c, 0x09, 0x0a, 0x01, 0xc9, 0x08, 0x0a, 0x01, 0xea, 0x00, 0xc9, 0x00, 0xae, 0x09, 0x0b, 0x09, 0x09, 0x01, 0x81, 0x2b, 0x01, 0x83, 0x0b,
+  0x01, 0x86, 0x0a, 0x01, 0x88, 0xa9, 0x00, 0x08, 0xea, 0x00, 0xc9, 0x00, 0xca, 0x00, 0xca, 0x08, 0xaa, 0x00, 0xca, 0x08, 0xca, 0x00, 0xaa, 0x00, 0xaa, 0x08, 0x82, 0x89, 0x10, 0x81, 0x89, 0x08,
+  0x01, 0x68, 0x08, 0x88, 0x08, 0x81, 0x68, 0x10, 0x00, 0x68, 0x18, 0x81, 0x88, 0x10, 0x84, 0x88, 0x18, 0x81, 0x88, 0x20, 0x81, 0x88, 0x28, 0x5f, 0x88, 0x30, 0x88, 0x38, 0xa8, 0x40, 0xc8, 0x50,
+  0xe8, 0x58, 0xe8, 0x60, 0xe9, 0x70, 0x29, 0x81, 0x4a, 0x91, 0x6a, 0xa1, 0xea, 0xb1, 0x0b, 0xc2, 0x0b, 0xca, 0x4b, 0xd2, 0xab, 0xda, 0xcc, 0xea, 0x6d, 0xe3, 0x0c, 0xf3, 0x4d, 0xfb, 0x4b, 0xfb,
+  0x4c, 0xfc, 0xce, 0xfb, 0x2d, 0xfc, 0xcc, 0xfb, 0xad, 0xfb, 0xed, 0xfb, 0x2e, 0xfc, 0x2d, 0xfc, 0x0e, 0xfc, 0x0c, 0xfc, 0xee, 0xfb, 0x2e, 0xfc, 0x4d, 0xfc, 0xcc, 0xfb, 0x0e, 0xfc, 0x2e, 0xfc,
+  0x4d, 0xfc, 0xad, 0xfb, 0x8a, 0xba, 0x8d, 0xfb, 0x6e, 0xe3, 0x6b, 0xfb, 0xac, 0xda, 0x8c, 0xc2, 0xac, 0xf2, 0xca, 0xa9, 0x2d, 0xeb, 0x6d, 0xfb, 0x2f, 0xfc, 0x8d, 0xeb, 0x6c, 0xf3, 0x8d, 0xe2,
+  0xca, 0xb1, 0x89, 0xa2, 0xaa, 0x9a, 0x2e, 0xfc, 0x0c, 0xf4, 0xaa, 0xd2, 0xcb, 0xc2, 0x27, 0x59, 0x8b, 0xb2, 0xce, 0xd3, 0x4d, 0xc3, 0xeb, 0x9a, 0xab, 0x8a, 0xce, 0xb3, 0x49, 0xd2, 0x8e, 0xf3,
+  0x4f, 0xf3, 0x2e, 0xeb, 0xce, 0xf2, 0xed, 0xea, 0xcd, 0xd2, 0x6e, 0xeb, 0x6c, 0xfb, 0x69, 0x49, 0x6a, 0x39, 0xee, 0x99, 0x0b, 0x71, 0x29, 0x29, 0x2b, 0x81, 0xab, 0x90, 0x8c, 0x88, 0xaf, 0xb9,
+  0x4b, 0x90, 0xab, 0x80, 0x0c, 0x31, 0xc9, 0x10, 0x2b, 0x09, 0x0b, 0x09, 0xc9, 0x08, 0xca, 0x08, 0xc9, 0x08, 0x0a, 0x01, 0xe9, 0x00, 0xc9, 0x00, 0x81, 0xea, 0x08, 0x0a, 0x2b, 0x01, 0x2c, 0x09,
+  0xea, 0x08, 0xca, 0x08, 0x6d, 0x09, 0x2b, 0x09, 0xeb, 0x08, 0x0b, 0x01, 0x0a, 0x01, 0x2a, 0x01, 0x0a, 0x01, 0x83, 0x0b, 0x01, 0x87, 0x0a, 0x01, 0x88, 0xa9, 0x00, 0x03, 0xaa, 0x00, 0xca, 0x08,
+  0xcb, 0x10, 0xab, 0x18, 0x81, 0xab, 0x28, 0x03, 0x8a, 0x30, 0x6a, 0x40, 0x8b, 0x40, 0x8a, 0x38, 0x81, 0xab, 0x40, 0x82, 0x8b, 0x48, 0x83, 0x8c, 0x50, 0x81, 0x8b, 0x50, 0x01, 0xac, 0x50, 0xcc,
+  0x50, 0x81, 0xcc, 0x58, 0x04, 0xcc, 0x60, 0xad, 0x60, 0xad, 0x68, 0xcd, 0x68, 0xad, 0x68, 0x82, 0xcd, 0x70, 0x02, 0xad, 0x78, 0xad, 0x80, 0xcd, 0x80, 0x81, 0xcd, 0x88, 0x81, 0xed, 0x88, 0x81,
+  0xec, 0x88, 0x00, 0x0c, 0x91, 0x81, 0xec, 0x90, 0x03, 0x0c, 0x99, 0x2c, 0x99, 0x2c, 0x91, 0x2c, 0x99, 0x81, 0x4c, 0x99, 0x00, 0x6c, 0xa1, 0x81, 0x8b, 0xa1, 0x2a, 0xcb, 0xa9, 0xec, 0xa9, 0x2c,
+  0xb2, 0x0b, 0xb2, 0x2c, 0xb2, 0x0b, 0xba, 0x2c, 0xc2, 0x0c, 0xba, 0x2a, 0xca, 0x0b, 0xca, 0x0c, 0xda, 0xc9, 0xc9, 0xea, 0xb1, 0xa9, 0x89, 0x0c, 0xaa, 0xea, 0xa9, 0xac, 0xb1, 0xac, 0xa1, 0xca,
+  0x91, 0xec, 0xa9, 0x0c, 0xb2, 0x4d, 0xba, 0x2c, 0xba, 0xec, 0xa1, 0xeb, 0xb1, 0x4c, 0xba, 0xad, 0xba, 0x0c, 0xba, 0xae, 0xba, 0x4d, 0xd2, 0x8d, 0xc2, 0x2c, 0xba, 0x4d, 0xba, 0x0c, 0xb2, 0xcd,
+  0xb1, 0x0d, 0xaa, 0x8c, 0xa9, 0xcc, 0xa9, 0xec, 0xa9, 0xac, 0xa1, 0xad, 0xa1, 0x8c, 0xa1, 0xab, 0xa1, 0x81, 0x8b, 0xa1, 0x00, 0x8c, 0xa9, 0x81, 0x6c, 0xa1, 0x08, 0x6c, 0x99, 0x2c, 0xa1, 0x2c,
+  0x91, 0x6c, 0x91, 0x2c, 0x91, 0x6c, 0x89, 0x2c, 0x89, 0x2d, 0x91, 0x0c, 0x99, 0x81, 0x0d, 0x99, 0x00, 0x0c, 0xa1, 0x81, 0x0c, 0x99, 0x09, 0x2c, 0x99, 0x2c, 0x91, 0x0d, 0x91, 0x2d, 0x91, 0xcd,
+  0x98, 0xee, 0x98, 0x0e, 0x99, 0xed, 0xa0, 0x0c, 0xa1, 0x4c, 0x91, 0x81, 0x2c, 0x89, 0x0c, 0x0b, 0x89, 0x0c, 0x79, 0x2b, 0x71, 0x2b, 0x61, 0x2b, 0x51, 0x0a, 0x11, 0x2c, 0x09, 0x0b, 0x09, 0x0b,
+  0x01, 0xeb, 0x08, 0x2b, 0x01, 0x0a, 0x01, 0x0b, 0x01, 0x81, 0x0a, 0x01, 0x00, 0xea, 0x00, 0x86, 0x0a, 0x01, 0x01, 0xa9, 0x00, 0x88, 0x00, 0x81, 0x88, 0x08, 0x00, 0xa8, 0x00, 0x82, 0x88, 0x08,
+  0x07, 0xa9, 0x08, 0xaa, 0x08, 0xa9, 0x08, 0xaa, 0x10, 0xca, 0x18, 0xaa, 0x28, 0xca, 0x30, 0xaa, 0x38, 0x82, 0xaa, 0x40, 0x00, 0xaa, 0x48, 0x82, 0xcb, 0x50, 0x81, 0xab, 0x50, 0x02, 0x8b, 0x50,
+  0xab, 0x50, 0xab, 0x58, 0x81, 0x8c, 0x60, 0x81, 0x8c, 0x68, 0x02, 0xad, 0x68, 0xad, 0x70, 0xad, 0x78, 0x81, 0xae, 0x80, 0x00, 0xae, 0x88, 0x81, 0xee, 0x80, 0x50, 0xec, 0x88, 0xeb, 0x88, 0xec,
+  0x80, 0xed, 0x80, 0xec, 0x80, 0x0c, 0x81, 0x2c, 0x89, 0x2d, 0x91, 0x2d, 0x99, 0x4d, 0xa1, 0x4c, 0xa1, 0x4d, 0xa9, 0x4c, 0xb1, 0xac, 0xc1, 0xec, 0xc9, 0x4d, 0xd2, 0x4c, 0xda, 0x8d, 0xe2, 0x8c,
+  0xe2, 0xad, 0xe2, 0xed, 0xe2, 0xac, 0xea, 0xed, 0xf2, 0x0d, 0xf3, 0x2d, 0xe3, 0x0c, 0xe3, 0x4c, 0xf3, 0x8c, 0xf3, 0x8c, 0xfb, 0x6b, 0xfb, 0xed, 0xeb, 0x2d, 0x93, 0x88, 0x11, 0xac, 0x62, 0x2b,
+  0x3a, 0xc9, 0x29, 0x8d, 0xe4, 0xac, 0x21, 0x0d, 0x2a, 0xb0, 0xec, 0xee, 0xfc, 0x0e, 0xbb, 0x4d, 0x92, 0x4f, 0xc3, 0x50, 0xd4, 0xb1, 0xdc, 0xcb, 0x01, 0x29, 0x11, 0x0b, 0x6a, 0x28, 0x01, 0x4e,
+  0x92, 0x2d, 0xaa, 0xe5, 0x08, 0x4a, 0x01, 0xab, 0x11, 0xcb, 0x69, 0x08, 0x09, 0x6b, 0x09, 0xab, 0x01, 0x8b, 0x09, 0x8a, 0x01, 0x2a, 0x09, 0xe8, 0x00, 0x08, 0x01, 0xe9, 0x08, 0x08, 0x01, 0xae,
+  0x71, 0x6d, 0x51, 0xad, 0x89, 0x6e, 0xb2, 0xec, 0x81, 0x29, 0x19, 0xe8, 0x00, 0x29, 0x01, 0x8a, 0x01, 0x2e, 0x62, 0x0c, 0xa2, 0x4e, 0xb2, 0x2e, 0xc2, 0x8c, 0xca, 0x6c, 0xca, 0x81, 0x4c, 0xca,
+  0x0b, 0x0c, 0xca, 0x2c, 0xc2, 0x0b, 0xc2, 0xca, 0xb9, 0xca, 0xa1, 0xea, 0xa1, 0xaa, 0x89, 0x89, 0x89, 0x89, 0x81, 0x8a, 0x89, 0x6a, 0x89, 0x6a, 0x81, 0x81, 0x8a, 0x81, 0x81, 0x8a, 0x71, 0x03,
+  0x6a, 0x61, 0x8a, 0x51, 0x6a, 0x51, 0x4b, 0x49, 0x81, 0x6b, 0x49, 0x03, 0x2a, 0x49, 0x4b, 0x41, 0x0a, 0x09, 0x0b, 0x01, 0x8a, 0x0a, 0x01, 0x81, 0xa9, 0x00, 0x02, 0xc9, 0x18, 0xe9, 0x28, 0xea,
+  0x28, 0x81, 0xea, 0x38, 0x07, 0xea, 0x40, 0xea, 0x48, 0x0c, 0x71, 0x4a, 0x79, 0x6b, 0x89, 0x6c, 0xa1, 0x6b, 0xa9, 0xac, 0xb9, 0x81, 0xac, 0xc9, 0x00, 0xcc, 0xc9, 0x82, 0xec, 0xc1, 0x0d, 0xcc,
+  0xb9, 0xac, 0xb9, 0xcc, 0xc1, 0xac, 0xb9, 0xac, 0xb1, 0xcc, 0xb1, 0xcc, 0xa9, 0xab, 0xb1, 0x8b, 0xb1, 0x6b, 0xa9, 0x8b, 0xa9, 0x6b, 0xa9, 0x8b, 0xa9, 0xab, 0xa9, 0x81, 0xab, 0xb1, 0x00, 0xcb,
+  0xb9, 0x81, 0xcc, 0xb9, 0x00, 0xcb, 0xc1, 0x81, 0x2c, 0xca, 0x06, 0x0c, 0xca, 0x4c, 0xd2, 0x6b, 0xd2, 0x2b, 0xca, 0x0c, 0xd2, 0xcb, 0xc9, 0xcb, 0xc1, 0x81, 0xeb, 0xc1, 0x23, 0x0c, 0xca, 0xeb,
+  0xb1, 0x8a, 0x99, 0x8a, 0x91, 0xaa, 0x89, 0xca, 0x81, 0x0b, 0x8a, 0xaa, 0xa1, 0xaa, 0x99, 0x68, 0x99, 0xcd, 0xc2, 0x8b, 0x89, 0x8a, 0xa2, 0xad, 0xba, 0x8e, 0xd3, 0xae, 0xc3, 0x8f, 0xdc, 0x6e,
+  0xcc, 0x2e, 0xf5, 0x70, 0xed, 0x90, 0xfd, 0x4e, 0xfd, 0xcd, 0xfc, 0x0d, 0xfd, 0xea, 0xe2, 0x0e, 0xfc, 0x30, 0xfd, 0xd0, 0xfc, 0x6f, 0xec, 0x70, 0xf4, 0x11, 0xfd, 0xd0, 0xfc, 0x50, 0xec, 0xb0,
+  0xfc, 0xd1, 0x8b, 0x30, 0x43, 0x81, 0x2d, 0x02, 0x09, 0xab, 0x01, 0x0c, 0x02, 0x4a, 0x09, 0x2d, 0x0a, 0xed, 0x01, 0x2d, 0x02, 0x6e, 0x02, 0x2d, 0x0a, 0xab, 0x01, 0xcd, 0x01, 0x81, 0xcc, 0x01,
+  0x1c, 0x8b, 0x01, 0x2d, 0x0a, 0x8b, 0x01, 0x09, 0x09, 0xc8, 0x08, 0x90, 0xaa, 0xe8, 0x08, 0xad, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0xed, 0x09, 0xac, 0x01, 0x2b, 0x01, 0xad, 0x09, 0x6d, 0x29, 0x6d,
+  0x21, 0x8d, 0x09, 0x6d, 0x41, 0x4d, 0x29, 0xae, 0x09, 0x8c, 0x09, 0x6a, 0x29, 0x4a, 0x39, 0x6b, 0x49, 0x8b, 0x49, 0x8b, 0x51, 0xac, 0x59, 0xaa, 0x69, 0xeb, 0x79, 0x81, 0x0c, 0x7a, 0x00, 0x0b,
+  0x7a, 0x81, 0xcc, 0x71, 0x06, 0xab, 0x69, 0xab, 0x59, 0x8b, 0x51, 0x6b, 0x49, 0x6b, 0x39, 0x6b, 0x41, 0x2b, 0x09, 0x81, 0xc9, 0x00, 0x01, 0x0a, 0x01, 0x2b, 0x01, 0x8c, 0x0a, 0x01, 0x82, 0xa9,
+  0x00, 0x81, 0xaa, 0x00, 0x83, 0xa9, 0x00, 0x00, 0xcb, 0x20, 0x81, 0xaa, 0x08, 0x07, 0x89, 0x08, 0x89, 0x00, 0xaa, 0x00, 0xcb, 0x00, 0xaa, 0x00, 0x2d, 0x09, 0xaa, 0x00, 0x0b, 0x01, 0x81, 0xca,
+  0x00, 0x81, 0xeb, 0x00, 0x17, 0xca, 0x08, 0xa9, 0x08, 0xca, 0x08, 0xaa, 0x10, 0xeb, 0x10, 0x2b, 0x11, 0x2b, 0x21, 0x0a, 0x29, 0x09, 0x29, 0xe9, 0x20, 0xea, 0x20, 0xea, 0x28, 0x0c, 0x31, 0xeb,
+  0x30, 0x2b, 0x31, 0x6b, 0x31, 0x8b, 0x39, 0x8c, 0x49, 0xec, 0x61, 0xaa, 0x59, 0xca, 0x69, 0xab, 0x81, 0xec, 0x99, 0xcb, 0x91, 0x81, 0x0b, 0x92, 0x1d, 0x4d, 0x9a, 0x2c, 0xa2, 0x2b, 0xb2, 0x6c,
+  0xb2, 0xad, 0xc2, 0xcd, 0xca, 0xed, 0xca, 0xec, 0xc2, 0x8f, 0xbb, 0x4c, 0xaa, 0x0b, 0xfb, 0xc9, 0xe2, 0x0a, 0xeb, 0x0e, 0xe5, 0x29, 0x22, 0xac, 0x09, 0x50, 0x6b, 0xd0, 0xa4, 0x2b, 0xb3, 0x2d,
+  0x83, 0xcb, 0xfb, 0x2d, 0xfd, 0xac, 0xfc, 0xaf, 0xfd, 0x6c, 0xf4, 0x0b, 0xfc, 0x6a, 0xfc, 0x8c, 0xfc, 0x2e, 0xfd, 0xce, 0xfc, 0x81, 0xaf, 0xfc, 0x0e, 0xf0, 0xfc, 0x32, 0xfd, 0x30, 0xdc, 0x73,
+  0xfd, 0xf1, 0xc3, 0x14, 0xf5, 0x52, 0xb4, 0xae, 0x2a, 0x4e, 0x1a, 0xb0, 0x0a, 0xf0, 0x0a, 0x8f, 0x0a, 0x8f, 0x12, 0xad, 0x09, 0xab, 0x01, 0x81, 0x6e, 0x02, 0x1b, 0xcc, 0x09, 0xaf, 0x0a, 0xb0,
+  0x02, 0xed, 0x09, 0x70, 0x0a, 0xd0, 0x02, 0x2e, 0x02, 0xcc, 0x01, 0x6b, 0x01, 0xad, 0x01, 0x8d, 0x01, 0xed, 0x09, 0x8d, 0x11, 0x8c, 0x01, 0xcd, 0x01, 0x0e, 0x02, 0x8d, 0x09, 0x0e, 0x02, 0x2b,
+  0x09, 0x8f, 0x59, 0x8e, 0x29, 0x6e, 0x51, 0x6d, 0x39, 0x8d, 0x19, 0x8d, 0x01, 0x8c, 0x01, 0x4b, 0x01, 0x0a, 0x01, 0x81, 0x4b, 0x01, 0x11, 0x2b, 0x01, 0xe9, 0x00, 0x0b, 0x09, 0xec, 0x28, 0xeb,
+  0x10, 0x6b, 0x01, 0x0a, 0x01, 0x2b, 0x01, 0xe9, 0x00, 0xc8, 0x00, 0xe9, 0x00, 0x4b, 0x01, 0x0a, 0x01, 0x2b, 0x01, 0xc9, 0x00, 0xe9, 0x00, 0x0a, 0x01, 0x0b, 0x01, 0x81, 0x0a, 0x01, 0x00, 0xea,
+  0x00, 0x89, 0x0a, 0x01, 0x87, 0xa9, 0x00, 0x04, 0xc9, 0x00, 0xa9, 0x00, 0xaa, 0x20, 0x8a, 0x10, 0xa9, 0x08, 0x81, 0xa9, 0x00, 0x7f, 0xc9, 0x00, 0xeb, 0x00, 0xea, 0x08, 0x89, 0x00, 0xeb, 0x08,
+  0xc9, 0x08, 0xea, 0x00, 0x4c, 0x01, 0x6d, 0x01, 0xca, 0x00, 0xea, 0x00, 0xca, 0x00, 0x0b, 0x01, 0x4c, 0x01, 0x4d, 0x11, 0x6d, 0x21, 0x0b, 0x19, 0x0c, 0x11, 0x89, 0x08, 0xa9, 0x00, 0x0a, 0x01,
+  0x4c, 0x01, 0xad, 0x09, 0x4c, 0x09, 0x4c, 0x29, 0x4e, 0x49, 0x4f, 0x69, 0x6b, 0x09, 0x6d, 0x21, 0x6e, 0x39, 0x4d, 0x51, 0x6c, 0x31, 0x0f, 0x02, 0xae, 0x01, 0x0f, 0x02, 0xad, 0x01, 0x8d, 0x11,
+  0x6d, 0x21, 0xaf, 0x49, 0x2a, 0x01, 0xcc, 0x01, 0xad, 0x09, 0x0f, 0x0a, 0x2f, 0x63, 0x2a, 0xeb, 0x6a, 0xfb, 0x4d, 0xfc, 0x4e, 0xfd, 0x8a, 0xc2, 0x0e, 0x0b, 0x0d, 0xe4, 0x6d, 0xfc, 0x6c, 0xfc,
+  0x8c, 0xfc, 0xac, 0xfc, 0xec, 0xfc, 0x30, 0xfe, 0xcc, 0xfc, 0x0b, 0xfd, 0x8d, 0xfd, 0x6d, 0xb4, 0x8b, 0x52, 0x29, 0x11, 0x4a, 0x01, 0x52, 0xdc, 0xb2, 0xec, 0x31, 0xfd, 0xee, 0xcb, 0xae, 0x72,
+  0x57, 0xfd, 0x15, 0xf5, 0x12, 0xc4, 0xce, 0xa2, 0xd0, 0xbb, 0x34, 0xc4, 0x17, 0xf5, 0x35, 0xbc, 0xb3, 0x03, 0xb3, 0x13, 0x4f, 0x02, 0x53, 0x13, 0x53, 0x1b, 0x32, 0x13, 0xf5, 0x2b, 0x33, 0x0b,
+  0xd6, 0x43, 0xf1, 0x12, 0xd1, 0x0a, 0xad, 0x01, 0x0e, 0x0a, 0x2e, 0x02, 0x93, 0x0b, 0xf1, 0x02, 0x4e, 0x02, 0xcc, 0x09, 0xac, 0x09, 0x4c, 0x29, 0x6d, 0x39, 0x6c, 0x21, 0x4c, 0x11, 0x6c, 0x01,
+  0xcd, 0x01, 0xef, 0x09, 0xad, 0x09, 0x2b, 0x31, 0x6e, 0x41, 0x6c, 0x19, 0x4e, 0x51, 0x4e, 0x49, 0x6e, 0x31, 0x4d, 0x19, 0x4c, 0x11, 0x4c, 0x01, 0x4b, 0x01, 0x2b, 0x01, 0x0a, 0x01, 0x0a, 0x11,
+  0x2b, 0x11, 0xeb, 0x30, 0x6b, 0x01, 0xc9, 0x00, 0x0a, 0x01, 0x0b, 0x01, 0x2b, 0x09, 0xe9, 0x00, 0x2b, 0x09, 0x0a, 0x01, 0xc9, 0x08, 0x03, 0x0a, 0x01, 0x2b, 0x01, 0x0a, 0x01, 0xea, 0x00, 0x8c,
+  0x0a, 0x01, 0x89, 0xa9, 0x00, 0x00, 0xa9, 0x08, 0x81, 0xaa, 0x18, 0x82, 0xa9, 0x00, 0x00, 0x0b, 0x09, 0x82, 0xa9, 0x00, 0x57, 0xc9, 0x00, 0x0b, 0x01, 0xea, 0x08, 0x0b, 0x01, 0xca, 0x00, 0xab,
+  0x18, 0x2b, 0x01, 0x2c, 0x01, 0x8d, 0x01, 0x0b, 0x01, 0x0a, 0x01, 0xea, 0x08, 0xeb, 0x10, 0x2c, 0x29, 0xea, 0x08, 0x2b, 0x01, 0x4c, 0x01, 0x4c, 0x11, 0x4d, 0x31, 0x4e, 0x51, 0x4f, 0x79, 0x2c,
+  0x41, 0x6d, 0x39, 0x8e, 0x49, 0xd0, 0x71, 0x4b, 0x01, 0xd1, 0x02, 0x6c, 0x01, 0x6c, 0x11, 0x4d, 0x29, 0x6c, 0x31, 0x4d, 0x51, 0x4d, 0x59, 0x8b, 0x01, 0x8c, 0x01, 0x4e, 0x0a, 0x6f, 0x02, 0x51,
+  0x1b, 0x8b, 0xfb, 0x0c, 0xfc, 0xcc, 0xfc, 0xf0, 0xfd, 0xea, 0xea, 0xab, 0xfb, 0xcc, 0xeb, 0xac, 0xfc, 0x28, 0xfb, 0x4b, 0xfc, 0x6e, 0xfd, 0xcf, 0xfd, 0xcc, 0xfc, 0x4d, 0xfd, 0xef, 0xfd, 0xd1,
+  0xc4, 0x8b, 0x29, 0xab, 0x39, 0x8b, 0x39, 0xcc, 0x29, 0x0c, 0x0a, 0x6a, 0x09, 0xed, 0x69, 0x0f, 0x5a, 0xf2, 0xb3, 0x4d, 0x62, 0x4e, 0x83, 0x14, 0xed, 0x70, 0x9b, 0xd3, 0xdc, 0xd2, 0xf4, 0x33,
+  0xcc, 0x54, 0xcc, 0x14, 0xf5, 0xd5, 0xd4, 0xb5, 0xf4, 0xb6, 0xec, 0x97, 0xcc, 0x77, 0xfd, 0x7a, 0x8b, 0xbb, 0xbb, 0x58, 0x93, 0xbb, 0x8b, 0x38, 0x5b, 0x98, 0x53, 0x92, 0x0a, 0x33, 0x1b, 0x52,
+  0x0b, 0xb1, 0x02, 0x70, 0x0a, 0x81, 0x90, 0x02, 0x19, 0xee, 0x01, 0xcd, 0x01, 0x6c, 0x09, 0x4d, 0x49, 0x4d, 0x39, 0x8d, 0x29, 0x4c, 0x19, 0x4b, 0x01, 0x2b, 0x01, 0x0e, 0x02, 0x2b, 0x09, 0x2f,
+  0x71, 0x6e, 0x31, 0x6d, 0x19, 0x2b, 0x11, 0x6f, 0x51, 0x6d, 0x31, 0x6c, 0x19, 0x4c, 0x09, 0x4b, 0x01, 0x2a, 0x01, 0xe9, 0x00, 0xcb, 0x28, 0xeb, 0x20, 0x2b, 0x01, 0xe9, 0x00, 0x81, 0x0a, 0x01,
+  0x81, 0x0b, 0x01, 0x02, 0x0a, 0x09, 0xea, 0x00, 0xa8, 0x00, 0x81, 0x2b, 0x01, 0x8e, 0x0a, 0x01, 0x8b, 0xa9, 0x00, 0x02, 0x89, 0x10, 0x8a, 0x10, 0x88, 0x00, 0x81, 0xa9, 0x00, 0x81, 0xa8, 0x00,
+  0x7e, 0xca, 0x00, 0xa8, 0x00, 0x0a, 0x09, 0x2b, 0x09, 0xa8, 0x00, 0xc8, 0x00, 0xeb, 0x10, 0xeb, 0x20, 0x2c, 0x19, 0x0c, 0x21, 0xc9, 0x00, 0x2b, 0x09, 0xca, 0x10, 0x0e, 0x51, 0x8e, 0x39, 0x0a,
+  0x01, 0x2b, 0x01, 0x2c, 0x11, 0x4d, 0x31, 0x8f, 0x49, 0x70, 0x79, 0xd1, 0xa1, 0x4e, 0x59, 0x90, 0x79, 0x4b, 0x09, 0x10, 0x02, 0x91, 0x02, 0x6d, 0x19, 0x4c, 0x31, 0x6d, 0x49, 0x6e, 0x59, 0x8f,
+  0x89, 0x0a, 0x09, 0x8c, 0x01, 0xcd, 0x09, 0x4f, 0x02, 0xb0, 0x02, 0x32, 0x0b, 0xad, 0xdc, 0x6c, 0xfd, 0xaf, 0xfd, 0x2a, 0xdb, 0x2c, 0xfb, 0x8a, 0xfb, 0x8b, 0xfc, 0xce, 0xed, 0x69, 0xfb, 0x2c,
+  0xfd, 0xec, 0xfc, 0x6d, 0xfd, 0xae, 0xfd, 0x91, 0xfe, 0x48, 0x39, 0x6b, 0x41, 0xcf, 0x69, 0x2f, 0x6a, 0xcd, 0x61, 0x0d, 0x5a, 0xac, 0x39, 0x2d, 0x2a, 0xf1, 0x0a, 0xf0, 0x02, 0x2e, 0x83, 0x71,
+  0x9b, 0xf2, 0xd4, 0x94, 0xcc, 0xae, 0x7a, 0xb2, 0xdc, 0x36, 0xe5, 0x55, 0xf5, 0x51, 0x9b, 0x76, 0xe4, 0xd5, 0xdc, 0x57, 0xf5, 0x76, 0xd4, 0xd7, 0xd4, 0x76, 0xed, 0x75, 0xfd, 0x95, 0xec, 0xb7,
+  0xfd, 0x98, 0xd4, 0x3a, 0xc4, 0xf9, 0xb3, 0xda, 0x93, 0xf9, 0xab, 0x3c, 0xb4, 0xdd, 0xa4, 0x7c, 0x7c, 0x73, 0x0b, 0x2f, 0x02, 0xed, 0x01, 0xd1, 0x02, 0x2f, 0x02, 0xd1, 0x02, 0x2f, 0x02, 0x8c,
+  0x09, 0x6f, 0x69, 0x6d, 0x41, 0x4c, 0x29, 0x4c, 0x19, 0x4b, 0x09, 0x4c, 0x01, 0xae, 0x09, 0x0a, 0x01, 0x8e, 0x51, 0x4d, 0x31, 0x4c, 0x11, 0x2e, 0x61, 0x4d, 0x31, 0x4c, 0x19, 0x4c, 0x09, 0x2b,
+  0x01, 0x0a, 0x09, 0xea, 0x18, 0x2a, 0x01, 0x6c, 0x01, 0x4c, 0x01, 0xea, 0x00, 0xe9, 0x00, 0x4b, 0x09, 0x0a, 0x01, 0xa8, 0x08, 0xc8, 0x00, 0x0a, 0x09, 0x0b, 0x01, 0x2a, 0x01, 0xea, 0x00, 0x8d,
+  0x0a, 0x01, 0x8c, 0xa9, 0x00, 0x09, 0x68, 0x08, 0x89, 0x00, 0x88, 0x00, 0xa9, 0x00, 0xa8, 0x00, 0xa9, 0x00, 0xa8, 0x00, 0xa9, 0x00, 0xea, 0x00, 0x2b, 0x09, 0x81, 0x88, 0x00, 0x10, 0xa9, 0x00,
+  0xcc, 0x48, 0xcc, 0x40, 0x88, 0x00, 0xc9, 0x00, 0xeb, 0x10, 0xab, 0x18, 0xed, 0x60, 0xc9, 0x08, 0x0b, 0x01, 0x2c, 0x11, 0x4d, 0x29, 0x4e, 0x49, 0x4e, 0x61, 0x2f, 0x81, 0x0e, 0x59, 0xb1, 0x89,
+  0x81, 0xef, 0x09, 0x61, 0x4b, 0x19, 0x2c, 0x31, 0x4d, 0x49, 0x6d, 0x51, 0x8f, 0x71, 0xb0, 0xa9, 0x8d, 0x19, 0x0c, 0x11, 0x6c, 0x09, 0x91, 0x02, 0xd2, 0x0a, 0x33, 0x13, 0xf4, 0x1b, 0x6c, 0xfc,
+  0x4b, 0xda, 0xea, 0xf2, 0x6a, 0xfb, 0x8c, 0xfc, 0x6d, 0xfd, 0xcb, 0xf3, 0xcb, 0xfb, 0xad, 0xfd, 0x29, 0x42, 0xaa, 0x49, 0x69, 0x31, 0x4a, 0x31, 0xed, 0x69, 0x8c, 0x59, 0x4a, 0x41, 0xac, 0x59,
+  0x0e, 0x6a, 0xce, 0x81, 0x0f, 0x8a, 0xcc, 0x59, 0x2e, 0x6a, 0x10, 0x13, 0xf1, 0x02, 0x2e, 0x5a, 0xd2, 0xcc, 0x51, 0x8b, 0x10, 0xc4, 0x31, 0xa3, 0xf4, 0xd4, 0x36, 0xf5, 0xb2, 0x93, 0x73, 0xed,
+  0xd6, 0xfd, 0xf5, 0xfd, 0xf4, 0xcc, 0xf6, 0xfd, 0xd7, 0xfd, 0x97, 0xfd, 0xd8, 0xf4, 0x37, 0xf5, 0xb7, 0xfd, 0x35, 0xfd, 0x79, 0xfd, 0x7a, 0xc4, 0xdb, 0xa3, 0x5a, 0xbc, 0xf9, 0xa3, 0xba, 0xc4,
+  0x9c, 0x93, 0x3b, 0xbc, 0xb2, 0x0a, 0x91, 0x0a, 0xee, 0x09, 0xac, 0x01, 0xcd, 0x09, 0x2b, 0x09, 0x33, 0x03, 0xcd, 0x09, 0x8f, 0x79, 0x6e, 0x59, 0x4d, 0x41, 0x4c, 0x29, 0x4c, 0x21, 0x2b, 0x09,
+  0xce, 0x09, 0x8d, 0x01, 0xea, 0x08, 0x6e, 0x41, 0x4f, 0x51, 0x2d, 0x41, 0x4c, 0x21, 0x2b, 0x11, 0x2b, 0x09, 0x0a, 0x01, 0xec, 0x48, 0x2b, 0x01, 0x2c, 0x19, 0xa9, 0x00, 0xa8, 0x00, 0xea, 0x00,
+  0x2b, 0x01, 0xe9, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0x81, 0x0a, 0x01, 0x00, 0xea, 0x00, 0x8e, 0x0a, 0x01, 0x89, 0xa9, 0x00, 0x00, 0xa8, 0x00, 0x81, 0xa9, 0x00, 0x01, 0x89, 0x00, 0xa9, 0x08, 0x82,
+  0xa9, 0x00, 0x82, 0xa8, 0x00, 0x75, 0x0b, 0x01, 0xea, 0x00, 0x87, 0x00, 0x88, 0x08, 0xa9, 0x00, 0x89, 0x18, 0x8c, 0x40, 0xa9, 0x08, 0x8a, 0x10, 0xab, 0x20, 0xcc, 0x38, 0x2f, 0x79, 0xca, 0x00,
+  0x0b, 0x09, 0x2b, 0x21, 0x4d, 0x31, 0x2e, 0x59, 0x10, 0x99, 0xcd, 0x70, 0x10, 0xa1, 0x8d, 0x09, 0x0b, 0x21, 0x0c, 0x31, 0x2d, 0x49, 0x2d, 0x51, 0x2e, 0x69, 0x4f, 0x79, 0xd0, 0xb1, 0xeb, 0x20,
+  0x4d, 0x31, 0x8d, 0x11, 0x4e, 0x12, 0xd2, 0x0a, 0x94, 0x13, 0xb1, 0x4b, 0x8a, 0xfc, 0x4d, 0xfc, 0x4b, 0xfb, 0x4d, 0xfc, 0xae, 0xfd, 0x6a, 0xda, 0xab, 0xfb, 0xac, 0xfc, 0xcf, 0xfd, 0xad, 0x73,
+  0x8e, 0x79, 0x2f, 0x92, 0x0f, 0x82, 0x8d, 0x69, 0xed, 0x71, 0xce, 0x71, 0x8f, 0x89, 0x2e, 0x62, 0x0e, 0x7a, 0x70, 0x9a, 0x71, 0xaa, 0xae, 0x71, 0xce, 0x59, 0x2e, 0x72, 0xd0, 0x69, 0x74, 0xfd,
+  0xf1, 0xfc, 0x0a, 0x6a, 0xf4, 0xec, 0x0d, 0x93, 0xd0, 0x8a, 0x72, 0xe4, 0xf2, 0xfc, 0x8d, 0x4a, 0xce, 0x01, 0x70, 0x73, 0x96, 0xfe, 0x95, 0xed, 0x56, 0xf5, 0x76, 0xfd, 0x17, 0xfe, 0xd7, 0xfd,
+  0xb7, 0xfd, 0x17, 0xf5, 0x76, 0xfd, 0x99, 0xfd, 0x9b, 0xdc, 0x79, 0xcc, 0x7a, 0xcc, 0x5c, 0xbc, 0x5b, 0xbc, 0x5a, 0xc4, 0x99, 0xa3, 0xfc, 0xdc, 0xb2, 0x0a, 0x90, 0x0a, 0x4f, 0x02, 0xcd, 0x01,
+  0xad, 0x01, 0xee, 0x09, 0x0f, 0x02, 0xac, 0x09, 0x6f, 0x71, 0x6e, 0x49, 0x8d, 0x39, 0x6c, 0x31, 0x2b, 0x29, 0x0b, 0x19, 0x8d, 0x01, 0x6c, 0x01, 0x8e, 0x51, 0x2d, 0x41, 0x2c, 0x31, 0x2b, 0x11,
+  0x2b, 0x09, 0x0b, 0x11, 0x0c, 0x31, 0x0b, 0x21, 0x88, 0x08, 0xc8, 0x00, 0xc9, 0x00, 0xe9, 0x00, 0x0a, 0x01, 0x81, 0xea, 0x00, 0x01, 0x0a, 0x01, 0xea, 0x00, 0x8b, 0x0a, 0x01, 0x84, 0xea, 0x00,
+  0x88, 0xa9, 0x00, 0x82, 0xa8, 0x00, 0x81, 0xa9, 0x00, 0x01, 0x89, 0x00, 0xa9, 0x00, 0x81, 0xa8, 0x00, 0x00, 0x88, 0x00, 0x81, 0x88, 0x08, 0x67, 0xea, 0x00, 0x0b, 0x09, 0x88, 0x00, 0x88, 0x08,
+  0x88, 0x00, 0x48, 0x10, 0x8a, 0x20, 0xab, 0x38, 0xa9, 0x08, 0x8b, 0x38, 0xcc, 0x38, 0xcb, 0x28, 0xca, 0x08, 0x0b, 0x11, 0x0b, 0x21, 0x2d, 0x39, 0xee, 0x68, 0xed, 0x78, 0xcf, 0x90, 0xaa, 0x28,
+  0xcc, 0x40, 0x0d, 0x49, 0xed, 0x60, 0xee, 0x68, 0x0e, 0x79, 0x0e, 0x89, 0x11, 0xc2, 0xec, 0x38, 0x0b, 0x31, 0x6c, 0x31, 0x0f, 0x0a, 0x32, 0x13, 0x94, 0x0b, 0xcd, 0xfb, 0x8d, 0xfc, 0x8b, 0xfb,
+  0xeb, 0xfb, 0xce, 0xfc, 0x0b, 0xfc, 0x6a, 0xfb, 0x0d, 0xfd, 0x6f, 0x9c, 0x0f, 0x33, 0x0d, 0x0a, 0x8b, 0x09, 0xed, 0x91, 0x8c, 0x61, 0x6b, 0x51, 0x2f, 0x92, 0x0f, 0x8a, 0xce, 0x81, 0x8d, 0x71,
+  0xee, 0x79, 0xef, 0x91, 0xee, 0x99, 0x30, 0xa2, 0xcd, 0x71, 0x0f, 0x8a, 0x2f, 0x82, 0x71, 0xe4, 0x31, 0xcc, 0xb2, 0xc4, 0x54, 0xed, 0x72, 0xdc, 0x32, 0xdc, 0x52, 0xac, 0x51, 0x13, 0x8c, 0x0a,
+  0xaf, 0x0a, 0xb2, 0x23, 0x33, 0x0c, 0xf0, 0x12, 0x2f, 0x13, 0xf7, 0xf5, 0xf5, 0xfd, 0x57, 0xfd, 0xb8, 0xfd, 0xf7, 0xfd, 0xd8, 0xfd, 0x54, 0xac, 0xf8, 0xfd, 0xd8, 0xfd, 0xb9, 0xf5, 0x19, 0xdd,
+  0x7a, 0xcc, 0xba, 0xe4, 0x9b, 0xcc, 0x9a, 0xe4, 0x9b, 0xcc, 0xb7, 0x53, 0xd2, 0x02, 0x32, 0x0b, 0x0f, 0x02, 0xce, 0x01, 0x0e, 0x0a, 0x8d, 0x09, 0x2e, 0x02, 0x8e, 0x01, 0x6e, 0x29, 0x4f, 0x71,
+  0x4f, 0x61, 0x2d, 0x49, 0x2c, 0x39, 0x0b, 0x29, 0x81, 0x0b, 0x21, 0x08, 0xec, 0x48, 0x0c, 0x31, 0x0b, 0x21, 0xea, 0x18, 0xcb, 0x20, 0xec, 0x50, 0xa8, 0x00, 0xc8, 0x00, 0xc9, 0x00, 0x81, 0xe9,
+  0x00, 0x81, 0xea, 0x00, 0x01, 0x0a, 0x01, 0xea, 0x00, 0x87, 0x0a, 0x01, 0x89, 0xe9, 0x00,
 };
 const size_t Boot_img_size {sizeof(Boot_img) / sizeof(Boot_img[0])};
 
-const uint8_t Warning_icon[] = {
-  0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0x14, 0xf5, 0xf8, 0xfd, 0x72, 0xf4, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 
-  0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xf7, 0xf5, 0x7d, 0xff, 0xdb, 0xf6, 0x7d, 0xff, 0x51, 0xf4, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 
-  0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0x92, 0xf4, 0x7d, 0xff, 0x34, 0xf5, 0x4e, 0xf3, 0xf7, 0xf5, 0x1c, 0xff, 0x6e, 0xf3, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 
-  0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0x4d, 0xf3, 0xdb, 0xfe, 0x59, 0xfe, 0x4d, 0xeb, 0xea, 0xf2, 0xaf, 0xeb, 0x3d, 0xff, 0x75, 0xf5, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 
-  0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xcb, 0xfa, 0xf8, 0xf5, 0x5d, 0xff, 0xcf, 0xeb, 0xec, 0xf2, 0x6e, 0xeb, 0xeb, 0xf2, 0xf4, 0xf4, 0x7d, 0xff, 0x51, 0xf4, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 
-  0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xcf, 0xf3, 0x7d, 0xff, 0x95, 0xf5, 0xab, 0xfa, 0xf3, 0xf4, 0xdc, 0xfe, 0x0f, 0xec, 0xab, 0xfa, 0x7a, 0xfe, 0xba, 0xf6, 0x0c, 0xf3, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 
-  0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0x0c, 0xf3, 0xba, 0xfe, 0x7a, 0xfe, 0xec, 0xf2, 0xab, 0xfa, 0xd7, 0xfd, 0xdf, 0xff, 0xb2, 0xf4, 0xab, 0xfa, 0x10, 0xec, 0x5d, 0xff, 0x95, 0xfd, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 
-  0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0x34, 0xf5, 0x7d, 0xff, 0x51, 0xec, 0xab, 0xfa, 0xab, 0xfa, 0xb6, 0xfd, 0xdf, 0xff, 0x71, 0xf4, 0xab, 0xfa, 0xab, 0xfa, 0x76, 0xf5, 0x5c, 0xff, 0xaf, 0xf3, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 
-  0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0x8e, 0xf3, 0x5d, 0xff, 0xd7, 0xf5, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0x55, 0xf5, 0x9e, 0xff, 0x10, 0xec, 0xab, 0xfa, 0xab, 0xfa, 0x0c, 0xf3, 0x9a, 0xfe, 0x9a, 0xfe, 0x0c, 0xf3, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 
-  0xab, 0xfa, 0xab, 0xfa, 0xcb, 0xfa, 0xf8, 0xf5, 0xfb, 0xfe, 0x6d, 0xf3, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0x14, 0xed, 0x7e, 0xff, 0x6e, 0xeb, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0x92, 0xec, 0x7e, 0xff, 0x92, 0xf4, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 
-  0xab, 0xfa, 0xab, 0xfa, 0x92, 0xf4, 0x9d, 0xff, 0x92, 0xf4, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0x72, 0xec, 0x3d, 0xff, 0x0c, 0xf3, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xd7, 0xf5, 0x3c, 0xff, 0x8e, 0xf3, 0xab, 0xfa, 0xab, 0xfa, 
-  0xab, 0xfa, 0x0c, 0xfb, 0x1c, 0xff, 0x79, 0xf6, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0x2d, 0xf3, 0x75, 0xfd, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0x6d, 0xf3, 0x1c, 0xff, 0xf7, 0xf5, 0xcb, 0xfa, 0xab, 0xfa, 
-  0xab, 0xfa, 0xb6, 0xf5, 0x1c, 0xff, 0xcf, 0xf3, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xd0, 0xf3, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xf3, 0xf4, 0x7d, 0xff, 0x71, 0xf4, 0xab, 0xfa, 
-  0x51, 0xf4, 0x5d, 0xff, 0xd3, 0xf4, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0x14, 0xf5, 0x3c, 0xf7, 0x31, 0xf4, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0x38, 0xf6, 0xfb, 0xfe, 0x2c, 0xf3, 
-  0xf7, 0xfd, 0xdb, 0xf6, 0xcb, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0x31, 0xf4, 0xf7, 0xf5, 0x8f, 0xeb, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0xab, 0xfa, 0x10, 0xec, 0x5d, 0xff, 0xb3, 0xfc, 
-  0xd7, 0xfd, 0xfb, 0xf6, 0x10, 0xec, 0xaf, 0xf3, 0xaf, 0xf3, 0x6e, 0xf3, 0x6e, 0xf3, 0x6e, 0xf3, 0x8e, 0xf3, 0xce, 0xf3, 0xcf, 0xf3, 0xaf, 0xf3, 0x6d, 0xf3, 0x6d, 0xf3, 0x6d, 0xf3, 0x6d, 0xf3, 0x8f, 0xf3, 0x6e, 0xfb, 0x92, 0xf4, 0x5d, 0xff, 0x92, 0xfc, 
-  0xef, 0xf3, 0x1c, 0xff, 0x5d, 0xff, 0x5d, 0xff, 0x3d, 0xff, 0x5d, 0xff, 0x5d, 0xff, 0x5d, 0xff, 0x5d, 0xff, 0x5d, 0xff, 0x5d, 0xff, 0x5d, 0xff, 0x5d, 0xff, 0x5d, 0xff, 0x5d, 0xff, 0x5d, 0xff, 0x5d, 0xff, 0x5c, 0xff, 0x7d, 0xff, 0x59, 0xfe, 0xec, 0xfa, 
-  0xab, 0xfa, 0x0c, 0xf3, 0x51, 0xfc, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xfc, 0x92, 0xfc, 0x92, 0xfc, 0x92, 0xfc, 0x92, 0xfc, 0x92, 0xf4, 0x72, 0xfc, 0x92, 0xfc, 0x92, 0xfc, 0x92, 0xfc, 0x92, 0xfc, 0x72, 0xfc, 0x92, 0xf4, 0x11, 0xf4, 0x0c, 0xfb, 0xab, 0xfa, 
+// 21x18, 470 bytes (756 raw)
+const uint8_t Warning_icon[] PROGMEM = {
+  0x4f, 0x4d, 0x01, 0x10, 0x15, 0x00, 0x12, 0x00, 0x88, 0xab, 0xfa, 0x02, 0x14, 0xf5, 0xf8, 0xfd, 0x72, 0xf4, 0x90, 0xab, 0xfa, 0x04, 0xf7, 0xf5, 0x7d, 0xff, 0xdb, 0xf6, 0x7d, 0xff, 0x51, 0xf4,
+  0x8e, 0xab, 0xfa, 0x06, 0x92, 0xf4, 0x7d, 0xff, 0x34, 0xf5, 0x4e, 0xf3, 0xf7, 0xf5, 0x1c, 0xff, 0x6e, 0xf3, 0x8c, 0xab, 0xfa, 0x07, 0x4d, 0xf3, 0xdb, 0xfe, 0x59, 0xfe, 0x4d, 0xeb, 0xea, 0xf2,
+  0xaf, 0xeb, 0x3d, 0xff, 0x75, 0xf5, 0x8b, 0xab, 0xfa, 0x09, 0xcb, 0xfa, 0xf8, 0xf5, 0x5d, 0xff, 0xcf, 0xeb, 0xec, 0xf2, 0x6e, 0xeb, 0xeb, 0xf2, 0xf4, 0xf4, 0x7d, 0xff, 0x51, 0xf4, 0x8a, 0xab,
+  0xfa, 0x0a, 0xcf, 0xf3, 0x7d, 0xff, 0x95, 0xf5, 0xab, 0xfa, 0xf3, 0xf4, 0xdc, 0xfe, 0x0f, 0xec, 0xab, 0xfa, 0x7a, 0xfe, 0xba, 0xf6, 0x0c, 0xf3, 0x88, 0xab, 0xfa, 0x0b, 0x0c, 0xf3, 0xba, 0xfe,
+  0x7a, 0xfe, 0xec, 0xf2, 0xab, 0xfa, 0xd7, 0xfd, 0xdf, 0xff, 0xb2, 0xf4, 0xab, 0xfa, 0x10, 0xec, 0x5d, 0xff, 0x95, 0xfd, 0x88, 0xab, 0xfa, 0x02, 0x34, 0xf5, 0x7d, 0xff, 0x51, 0xec, 0x81, 0xab,
+  0xfa, 0x02, 0xb6, 0xfd, 0xdf, 0xff, 0x71, 0xf4, 0x81, 0xab, 0xfa, 0x02, 0x76, 0xf5, 0x5c, 0xff, 0xaf, 0xf3, 0x86, 0xab, 0xfa, 0x02, 0x8e, 0xf3, 0x5d, 0xff, 0xd7, 0xf5, 0x82, 0xab, 0xfa, 0x02,
+  0x55, 0xf5, 0x9e, 0xff, 0x10, 0xec, 0x81, 0xab, 0xfa, 0x00, 0x0c, 0xf3, 0x81, 0x9a, 0xfe, 0x00, 0x0c, 0xf3, 0x84, 0xab, 0xfa, 0x03, 0xcb, 0xfa, 0xf8, 0xf5, 0xfb, 0xfe, 0x6d, 0xf3, 0x82, 0xab,
+  0xfa, 0x02, 0x14, 0xed, 0x7e, 0xff, 0x6e, 0xeb, 0x82, 0xab, 0xfa, 0x02, 0x92, 0xec, 0x7e, 0xff, 0x92, 0xf4, 0x84, 0xab, 0xfa, 0x02, 0x92, 0xf4, 0x9d, 0xff, 0x92, 0xf4, 0x83, 0xab, 0xfa, 0x02,
+  0x72, 0xec, 0x3d, 0xff, 0x0c, 0xf3, 0x83, 0xab, 0xfa, 0x02, 0xd7, 0xf5, 0x3c, 0xff, 0x8e, 0xf3, 0x82, 0xab, 0xfa, 0x02, 0x0c, 0xfb, 0x1c, 0xff, 0x79, 0xf6, 0x84, 0xab, 0xfa, 0x01, 0x2d, 0xf3,
+  0x75, 0xfd, 0x84, 0xab, 0xfa, 0x03, 0x6d, 0xf3, 0x1c, 0xff, 0xf7, 0xf5, 0xcb, 0xfa, 0x81, 0xab, 0xfa, 0x02, 0xb6, 0xf5, 0x1c, 0xff, 0xcf, 0xf3, 0x85, 0xab, 0xfa, 0x00, 0xd0, 0xf3, 0x85, 0xab,
+  0xfa, 0x06, 0xf3, 0xf4, 0x7d, 0xff, 0x71, 0xf4, 0xab, 0xfa, 0x51, 0xf4, 0x5d, 0xff, 0xd3, 0xf4, 0x85, 0xab, 0xfa, 0x02, 0x14, 0xf5, 0x3c, 0xf7, 0x31, 0xf4, 0x85, 0xab, 0xfa, 0x05, 0x38, 0xf6,
+  0xfb, 0xfe, 0x2c, 0xf3, 0xf7, 0xfd, 0xdb, 0xf6, 0xcb, 0xfa, 0x85, 0xab, 0xfa, 0x02, 0x31, 0xf4, 0xf7, 0xf5, 0x8f, 0xeb, 0x85, 0xab, 0xfa, 0x05, 0x10, 0xec, 0x5d, 0xff, 0xb3, 0xfc, 0xd7, 0xfd,
+  0xfb, 0xf6, 0x10, 0xec, 0x81, 0xaf, 0xf3, 0x82, 0x6e, 0xf3, 0x03, 0x8e, 0xf3, 0xce, 0xf3, 0xcf, 0xf3, 0xaf, 0xf3, 0x83, 0x6d, 0xf3, 0x06, 0x8f, 0xf3, 0x6e, 0xfb, 0x92, 0xf4, 0x5d, 0xff, 0x92,
+  0xfc, 0xef, 0xf3, 0x1c, 0xff, 0x81, 0x5d, 0xff, 0x00, 0x3d, 0xff, 0x8b, 0x5d, 0xff, 0x06, 0x5c, 0xff, 0x7d, 0xff, 0x59, 0xfe, 0xec, 0xfa, 0xab, 0xfa, 0x0c, 0xf3, 0x51, 0xfc, 0x81, 0x92, 0xf4,
+  0x84, 0x92, 0xfc, 0x01, 0x92, 0xf4, 0x72, 0xfc, 0x83, 0x92, 0xfc, 0x04, 0x72, 0xfc, 0x92, 0xf4, 0x11, 0xf4, 0x0c, 0xfb, 0xab, 0xfa,
 };
 const size_t Warning_icon_size {sizeof(Warning_icon) / sizeof(Warning_icon[0])};
 
-const uint8_t Success_icon[] = {
-  0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x50, 0x36, 0x72, 0x4e, 0x30, 0x36, 
-  0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x50, 0x36, 0xf6, 0x86, 0xff, 0xff, 0x72, 0x46, 
-  0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x50, 0x36, 0xf6, 0x86, 0xff, 0xff, 0xf7, 0x8e, 0x51, 0x36, 
-  0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x51, 0x36, 0xf6, 0x86, 0xff, 0xff, 0xf7, 0x86, 0x51, 0x3e, 0x0f, 0x26, 
-  0x51, 0x3e, 0x94, 0x66, 0x51, 0x36, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x51, 0x3e, 0xf6, 0x86, 0xff, 0xff, 0xf6, 0x86, 0x51, 0x3e, 0x0f, 0x26, 0x0f, 0x26, 
-  0x72, 0x4e, 0xff, 0xff, 0xf7, 0x8e, 0x51, 0x3e, 0x0f, 0x26, 0x51, 0x3e, 0xf7, 0x8e, 0xff, 0xff, 0xf6, 0x86, 0x51, 0x3e, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 
-  0x30, 0x36, 0xf6, 0x7e, 0xff, 0xff, 0x17, 0x97, 0x93, 0x56, 0xf7, 0x8e, 0xff, 0xff, 0xf6, 0x86, 0x51, 0x36, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 
-  0x0f, 0x26, 0x30, 0x36, 0xd6, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x7e, 0x50, 0x36, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 
-  0x0f, 0x26, 0x0f, 0x26, 0x30, 0x36, 0xd5, 0x76, 0xff, 0xff, 0xd6, 0x7e, 0x50, 0x36, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 
-  0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x30, 0x36, 0x51, 0x46, 0x30, 0x36, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 0x0f, 0x26, 
+// 13x10, 169 bytes (260 raw)
+const uint8_t Success_icon[] PROGMEM = {
+  0x4f, 0x4d, 0x01, 0x10, 0x0d, 0x00, 0x0a, 0x00, 0x89, 0x0f, 0x26, 0x02, 0x50, 0x36, 0x72, 0x4e, 0x30, 0x36, 0x88, 0x0f, 0x26, 0x03, 0x50, 0x36, 0xf6, 0x86, 0xff, 0xff, 0x72, 0x46, 0x87, 0x0f,
+  0x26, 0x04, 0x50, 0x36, 0xf6, 0x86, 0xff, 0xff, 0xf7, 0x8e, 0x51, 0x36, 0x86, 0x0f, 0x26, 0x08, 0x51, 0x36, 0xf6, 0x86, 0xff, 0xff, 0xf7, 0x86, 0x51, 0x3e, 0x0f, 0x26, 0x51, 0x3e, 0x94, 0x66,
+  0x51, 0x36, 0x82, 0x0f, 0x26, 0x04, 0x51, 0x3e, 0xf6, 0x86, 0xff, 0xff, 0xf6, 0x86, 0x51, 0x3e, 0x81, 0x0f, 0x26, 0x09, 0x72, 0x4e, 0xff, 0xff, 0xf7, 0x8e, 0x51, 0x3e, 0x0f, 0x26, 0x51, 0x3e,
+  0xf7, 0x8e, 0xff, 0xff, 0xf6, 0x86, 0x51, 0x3e, 0x82, 0x0f, 0x26, 0x08, 0x30, 0x36, 0xf6, 0x7e, 0xff, 0xff, 0x17, 0x97, 0x93, 0x56, 0xf7, 0x8e, 0xff, 0xff, 0xf6, 0x86, 0x51, 0x36, 0x84, 0x0f,
+  0x26, 0x01, 0x30, 0x36, 0xd6, 0x7e, 0x82, 0xff, 0xff, 0x01, 0xf6, 0x7e, 0x50, 0x36, 0x86, 0x0f, 0x26, 0x04, 0x30, 0x36, 0xd5, 0x76, 0xff, 0xff, 0xd6, 0x7e, 0x50, 0x36, 0x88, 0x0f, 0x26, 0x02,
+  0x30, 0x36, 0x51, 0x46, 0x30, 0x36, 0x86, 0x0f, 0x26,
 };
 const size_t Success_icon_size {sizeof(Success_icon) / sizeof(Success_icon[0])};
 
-const uint8_t Info_icon[] = {
-  0x3f, 0x45, 0x3f, 0x45, 0x3f, 0x45, 0x3f, 0x45, 0x3f, 0x45, 0x3f, 0x45, 
-  0x3f, 0x45, 0xbf, 0x6d, 0xff, 0xbe, 0xff, 0xbe, 0x7f, 0x55, 0x3f, 0x45, 
-  0x3f, 0x45, 0x5f, 0x8e, 0xbf, 0xe7, 0x9f, 0xe7, 0xbf, 0x6d, 0x3f, 0x45, 
-  0x3f, 0x45, 0x9f, 0x5d, 0x7f, 0x9e, 0x7f, 0x9e, 0x7f, 0x55, 0x3f, 0x45, 
-  0x5f, 0x4d, 0xdf, 0x6d, 0xff, 0x7d, 0xbf, 0x65, 0x3f, 0x45, 0x3f, 0x45, 
-  0x9f, 0x5d, 0x3f, 0xcf, 0xbf, 0xef, 0xdf, 0xb6, 0x5f, 0x4d, 0x3f, 0x45, 
-  0x9f, 0x5d, 0x5f, 0xcf, 0xff, 0xff, 0x7f, 0xdf, 0x9f, 0x5d, 0x3f, 0x45, 
-  0x3f, 0x45, 0xdf, 0x75, 0x7f, 0xdf, 0x7f, 0xdf, 0x9f, 0x5d, 0x3f, 0x45, 
-  0x3f, 0x45, 0xdf, 0x75, 0x7f, 0xdf, 0x7f, 0xdf, 0x9f, 0x5d, 0x3f, 0x45, 
-  0x3f, 0x45, 0xdf, 0x75, 0x7f, 0xdf, 0x7f, 0xdf, 0x9f, 0x5d, 0x3f, 0x45, 
-  0x5f, 0x4d, 0x5f, 0x8e, 0x9f, 0xe7, 0x9f, 0xe7, 0xdf, 0x6d, 0x5f, 0x4d, 
-  0x9f, 0x5d, 0x5f, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xae, 0x9f, 0x5d, 
-  0x9f, 0x5d, 0x3f, 0xcf, 0xdf, 0xf7, 0xdf, 0xf7, 0xbf, 0xae, 0x9f, 0x5d, 
-  0x3f, 0x45, 0x3f, 0x45, 0x3f, 0x45, 0x3f, 0x45, 0x3f, 0x45, 0x3f, 0x45, 
+// 6x14, 157 bytes (168 raw)
+const uint8_t Info_icon[] PROGMEM = {
+  0x4f, 0x4d, 0x01, 0x10, 0x06, 0x00, 0x0e, 0x00, 0x86, 0x3f, 0x45, 0x00, 0xbf, 0x6d, 0x81, 0xff, 0xbe, 0x00, 0x7f, 0x55, 0x81, 0x3f, 0x45, 0x03, 0x5f, 0x8e, 0xbf, 0xe7, 0x9f, 0xe7, 0xbf, 0x6d,
+  0x81, 0x3f, 0x45, 0x00, 0x9f, 0x5d, 0x81, 0x7f, 0x9e, 0x05, 0x7f, 0x55, 0x3f, 0x45, 0x5f, 0x4d, 0xdf, 0x6d, 0xff, 0x7d, 0xbf, 0x65, 0x81, 0x3f, 0x45, 0x0a, 0x9f, 0x5d, 0x3f, 0xcf, 0xbf, 0xef,
+  0xdf, 0xb6, 0x5f, 0x4d, 0x3f, 0x45, 0x9f, 0x5d, 0x5f, 0xcf, 0xff, 0xff, 0x7f, 0xdf, 0x9f, 0x5d, 0x81, 0x3f, 0x45, 0x00, 0xdf, 0x75, 0x81, 0x7f, 0xdf, 0x00, 0x9f, 0x5d, 0x81, 0x3f, 0x45, 0x00,
+  0xdf, 0x75, 0x81, 0x7f, 0xdf, 0x00, 0x9f, 0x5d, 0x81, 0x3f, 0x45, 0x00, 0xdf, 0x75, 0x81, 0x7f, 0xdf, 0x03, 0x9f, 0x5d, 0x3f, 0x45, 0x5f, 0x4d, 0x5f, 0x8e, 0x81, 0x9f, 0xe7, 0x03, 0xdf, 0x6d,
+  0x5f, 0x4d, 0x9f, 0x5d, 0x5f, 0xcf, 0x81, 0xff, 0xff, 0x00, 0xbf, 0xae, 0x81, 0x9f, 0x5d, 0x00, 0x3f, 0xcf, 0x81, 0xdf, 0xf7, 0x01, 0xbf, 0xae, 0x9f, 0x5d, 0x85, 0x3f, 0x45,
 };
-const size_t Info_icon_size {sizeof(Info_icon) / sizeof(Info_icon[0])};
\ No newline at end of file
+const size_t Info_icon_size {sizeof(Info_icon) / sizeof(Info_icon[0])};
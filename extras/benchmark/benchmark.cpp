@@ -0,0 +1,353 @@
+/*
+  benchmark.cpp - Host benchmarks of the OpenMenuOS renderers.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+
+  Draws each renderer for a number of frames while the down button is pressed now and then, at several display sizes
+  and item counts, with and without the dirty rectangles. For each case it prints the CPU time of a frame on this
+  machine, the pixels drawn and the bytes that would go over SPI. The time only compares runs of the same machine,
+  the pixel and SPI counts are the same everywhere.
+
+  Usage: openmenuos_benchmark [--csv] [--frames N] [--filter NAME] [--fast] [--static] [--record FILE | --check FILE]
+
+  --fast draws with setFastRendering(true), the integer shapes instead of the anti-aliased ones.
+  --static draws with setStaticSprites(true), the caches are created before measuring and never grow.
+
+  --record and --check play a script of button presses on each renderer instead, at 160x80. Every frame of the panel is
+  hashed, with the pixels, the SPI bytes and the CPU time of a frame and the sprites created. --record writes them to
+  FILE, --check compares them with FILE and returns 1 if a renderer draws something else or costs more than its budget.
+*/
+
+#include <chrono>
+#include "OpenMenuOS.h"
+#include "HostBackend.h"
+
+#define BUTTON_UP_PIN 1
+#define BUTTON_DOWN_PIN 2
+#define BUTTON_SELECT_PIN 3
+#define BACKLIGHT_PIN 4
+
+#define BENCHMARK_FRAME_TIME 16      // Virtual milliseconds between the frames
+#define BENCHMARK_WARMUP_FRAMES 20   // Drawn before measuring, so the caches are filled like on a running device
+#define BENCHMARK_PRESS_PERIOD 8     // The down button is pressed every 8 frames
+#define BENCHMARK_MAX_ITEMS 200
+#define BENCHMARK_SPI_FREQUENCY 40e6  // To estimate the transfer time
+#define SCRIPT_STEP_FRAMES 4          // Frames of a step of a script, the button is held for the first 2
+#define SCRIPT_LONG_PRESS_FRAMES 25   // A long press is held for 400 ms
+#define SCRIPT_SETTLE_FRAMES 16       // Drawn after the script so the animations end
+#define CHECK_COST_TOLERANCE 1.10     // Pixels and SPI bytes may grow by 10% before --check fails
+#define CHECK_CPU_TOLERANCE 3.0       // The CPU time varies between runs, only a large regression fails
+
+OpenMenuOS menu(BUTTON_UP_PIN, BUTTON_DOWN_PIN, BUTTON_SELECT_PIN, BACKLIGHT_PIN);
+
+struct PanelSize {
+  int16_t width;  // Native size, the benchmarks use rotation 1 (landscape)
+  int16_t height;
+};
+static const PanelSize panelSizes[] = { { 80, 160 }, { 135, 240 }, { 240, 320 } };
+static const int itemCounts[] = { 4, 20, BENCHMARK_MAX_ITEMS };
+static const uint16_t tileColors[] = { TFT_BLUE, TFT_DARKGREEN, TFT_MAROON, TFT_PURPLE };
+
+static char itemNames[BENCHMARK_MAX_ITEMS][24];
+static const char* itemRows[BENCHMARK_MAX_ITEMS];
+static TileItem tiles[BENCHMARK_MAX_ITEMS];
+static int menuHandle;
+
+static void drawMenuFrame(int items) {
+  (void)items;
+  menu.drawMenu(menuHandle, true);
+}
+static void drawSubmenuFrame(int items) {
+  (void)items;
+  menu.drawSubmenu(menuHandle, true);
+}
+static void drawSettingsFrame(int items) {
+  (void)items;
+  menu.drawSettingMenu(menuHandle);
+}
+static void drawPopupFrame(int items) {
+  (void)items;
+  bool clicked = false;
+  menu.drawPopup((char*)"Benchmark popup message", clicked, 1);
+}
+static void drawToastsFrame(int items) {  // A toast every 24 frames, each one ends before the next
+  static const char* const messages[] = { "Saved", "Connected to the network", "Battery low" };
+  static int frames = 0;
+  if (frames % 24 == 0) {
+    menu.showToast(messages[frames / 24 % 3], frames / 24 % 3 + 1, 200);
+  }
+  frames++;
+  drawMenuFrame(items);
+}
+static void drawTilesFrame(int items) {
+  menu.drawTileMenu(tiles, items, 2, 3);
+}
+static void drawScrollTextFrame(int items) {
+  (void)items;
+  menu.scrollTextHorizontal(10, menu.getTftHeight() / 2, "A text long enough to scroll across the whole display", TFT_WHITE, TFT_BLACK, 1, 50, menu.getTftWidth() - 20);
+}
+
+struct Benchmark {
+  const char* name;
+  void (*draw)(int items);
+  bool itemCounts;  // Run for each item count, or once
+  int screen;       // The buttons move the selection of the renderers of this screen
+};
+static const Benchmark benchmarks[] = {
+  { "drawMenu", drawMenuFrame, true, 0 },
+  { "drawSettingMenu", drawSettingsFrame, true, 1 },
+  { "drawPopup", drawPopupFrame, false, 0 },
+  { "drawTileMenu", drawTilesFrame, true, 1 },
+  { "scrollTextHorizontal", drawScrollTextFrame, false, 0 },
+};
+
+struct Result {
+  double cpuMicros;  // Per frame
+  double pixels;
+  double spiBytes;
+  double pushes;
+  uint32_t allocations;  // Sprites created while measuring, the caches should keep it at 0
+};
+
+// A step per character: U and D press up and down, S presses select, L holds it for a long press, . waits
+struct Script {
+  const char* name;
+  void (*draw)(int items);
+  int screen;
+  int items;
+  const char* steps;
+  bool staticSprites;  // With setStaticSprites(true), its budget of allocations is 0
+};
+static const Script scripts[] = {
+  { "drawMenu", drawMenuFrame, 0, 20, "DDD.UUUU.DD", false },
+  { "drawSubmenu", drawSubmenuFrame, 1, 20, "DDUD.DDDD", false },
+  { "drawSettingMenu", drawSettingsFrame, 1, 4, "DSD.SUU", false },
+  { "drawTileMenu", drawTilesFrame, 1, 20, "DDDD.UUDDDDDD", false },
+  { "drawPopup", drawPopupFrame, 0, 4, "....", false },
+  { "showToast", drawToastsFrame, 0, 4, "....................", false },
+  { "drawMenuStatic", drawMenuFrame, 0, 20, "DDD.UUUU.DD", true },
+  { "drawTileMenuStatic", drawTilesFrame, 1, 20, "DDDD.UUDDDDDD", true },
+  { "drawPopupStatic", drawPopupFrame, 0, 4, "....", true },
+};
+
+struct Golden {  // What a script drew and what it cost, per frame
+  char name[24];
+  uint32_t hash;
+  double pixels;
+  double spiBytes;
+  double cpuMicros;
+  uint32_t allocations;
+};
+
+static void frame(const Benchmark& benchmark, int items, int index) {
+  if (index % BENCHMARK_PRESS_PERIOD == 0) digitalWrite(BUTTON_DOWN_PIN, HIGH);
+  if (index % BENCHMARK_PRESS_PERIOD == 2) digitalWrite(BUTTON_DOWN_PIN, LOW);
+  menu.loop();
+  benchmark.draw(items);
+  menu.drawCanvasOnTFT();
+}
+
+static Result run(const Benchmark& benchmark, const PanelSize& size, int items, bool dirty, int frames) {
+  setHostPanelSize(size.width, size.height);
+  menu.setRotation(1);
+  menu.setDirtyRectMode(dirty);
+  menu.updateMenu(menuHandle, itemRows, items);
+  menu.redirectToMenu(benchmark.screen, 0);
+  menu.invalidateScreen();
+
+  for (int i = 0; i < BENCHMARK_WARMUP_FRAMES; i++) {
+    frame(benchmark, items, i);
+    delay(BENCHMARK_FRAME_TIME);
+  }
+
+  resetHostCounters();
+  std::chrono::steady_clock::duration cpu(0);
+  for (int i = 0; i < frames; i++) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    frame(benchmark, items, BENCHMARK_WARMUP_FRAMES + i);
+    cpu += std::chrono::steady_clock::now() - start;
+    delay(BENCHMARK_FRAME_TIME);
+  }
+  digitalWrite(BUTTON_DOWN_PIN, LOW);
+
+  Result result;
+  result.cpuMicros = std::chrono::duration<double, std::micro>(cpu).count() / frames;
+  result.pixels = (double)hostCounters.pixels / frames;
+  result.spiBytes = (double)hostCounters.spiBytes / frames;
+  result.pushes = (double)hostCounters.pushes / frames;
+  result.allocations = hostCounters.allocations;
+  return result;
+}
+
+static Golden play(const Script& script) {
+  setHostPanelSize(panelSizes[0].width, panelSizes[0].height);
+  menu.setRotation(1);
+  menu.setDirtyRectMode(false);
+  menu.setStaticSprites(script.staticSprites);
+  menu.updateMenu(menuHandle, itemRows, script.items);
+  menu.redirectToMenu(script.screen, 0);
+  menu.invalidateScreen();
+  resetHostCounters();
+
+  Golden golden = {};
+  snprintf(golden.name, sizeof(golden.name), "%s", script.name);
+  golden.hash = 2166136261u;
+  std::chrono::steady_clock::duration cpu(0);
+  int frames = 0;
+  size_t length = strlen(script.steps);
+  for (size_t step = 0; step <= length; step++) {
+    char c = step < length ? script.steps[step] : '.';
+    int pin = c == 'U' ? BUTTON_UP_PIN : c == 'D' ? BUTTON_DOWN_PIN : c == 'S' || c == 'L' ? BUTTON_SELECT_PIN : -1;
+    int held = c == 'L' ? SCRIPT_LONG_PRESS_FRAMES : 2;
+    int count = step < length ? max(SCRIPT_STEP_FRAMES, held + 2) : SCRIPT_SETTLE_FRAMES;
+    for (int i = 0; i < count; i++) {
+      if (pin >= 0) digitalWrite(pin, i < held ? HIGH : LOW);
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      menu.loop();
+      script.draw(script.items);
+      menu.drawCanvasOnTFT();
+      cpu += std::chrono::steady_clock::now() - start;
+      golden.hash = (golden.hash ^ hostPanelHash()) * 16777619u;
+      frames++;
+      delay(BENCHMARK_FRAME_TIME);
+    }
+  }
+  golden.pixels = (double)hostCounters.pixels / frames;
+  golden.spiBytes = (double)hostCounters.spiBytes / frames;
+  golden.cpuMicros = std::chrono::duration<double, std::micro>(cpu).count() / frames;
+  golden.allocations = hostCounters.allocations;
+  menu.setStaticSprites(false);
+  return golden;
+}
+
+// Play the scripts, then write their results to path or compare them with the ones in it. Returns the exit code
+static int runScripts(const char* path, bool record) {
+  Golden expected[sizeof(scripts) / sizeof(scripts[0])];
+  int expectedCount = 0;
+  if (!record) {
+    FILE* file = fopen(path, "r");
+    if (file == NULL) {
+      fprintf(stderr, "Can't read %s\n", path);
+      return 1;
+    }
+    char line[128];
+    Golden g;
+    while (expectedCount < (int)(sizeof(expected) / sizeof(expected[0])) && fgets(line, sizeof(line), file) != NULL) {
+      if (line[0] != '#' && sscanf(line, "%23s %x %lf %lf %lf %u", g.name, &g.hash, &g.pixels, &g.spiBytes, &g.cpuMicros, &g.allocations) == 6) {
+        expected[expectedCount++] = g;
+      }
+    }
+    fclose(file);
+  }
+
+  FILE* out = record ? fopen(path, "w") : NULL;
+  if (record && out == NULL) {
+    fprintf(stderr, "Can't write %s\n", path);
+    return 1;
+  }
+  if (out != NULL) fprintf(out, "# name hash pixels spi_bytes cpu_us allocations, written by openmenuos_benchmark --record\n");
+  int failures = 0;
+  for (size_t i = 0; i < sizeof(scripts) / sizeof(scripts[0]); i++) {
+    Golden r = play(scripts[i]);
+    if (out != NULL) {
+      fprintf(out, "%s %08x %.1f %.1f %.1f %u\n", r.name, r.hash, r.pixels, r.spiBytes, r.cpuMicros, r.allocations);
+      printf("%-21s %08x recorded\n", r.name, r.hash);
+      continue;
+    }
+    const Golden* e = NULL;
+    for (int j = 0; j < expectedCount; j++) {
+      if (strcmp(expected[j].name, r.name) == 0) e = &expected[j];
+    }
+    char problems[160] = "";
+    if (e == NULL) {
+      snprintf(problems, sizeof(problems), " not in %s", path);
+    } else {
+      size_t n = 0;
+      if (r.hash != e->hash) n += snprintf(problems + n, sizeof(problems) - n, " drawn differently (%08x, expected %08x)", r.hash, e->hash);
+      if (r.pixels > e->pixels * CHECK_COST_TOLERANCE) n += snprintf(problems + n, sizeof(problems) - n, " pixels %.0f > %.0f", r.pixels, e->pixels);
+      if (r.spiBytes > e->spiBytes * CHECK_COST_TOLERANCE) n += snprintf(problems + n, sizeof(problems) - n, " SPI %.0f > %.0f", r.spiBytes, e->spiBytes);
+      if (r.cpuMicros > e->cpuMicros * CHECK_CPU_TOLERANCE) n += snprintf(problems + n, sizeof(problems) - n, " CPU %.1f us > %.1f", r.cpuMicros, e->cpuMicros);
+      if (r.allocations > e->allocations) n += snprintf(problems + n, sizeof(problems) - n, " allocations %u > %u", r.allocations, e->allocations);
+    }
+    printf("%-21s %08x %s%s\n", r.name, r.hash, problems[0] ? "FAIL" : "ok", problems);
+    failures += problems[0] != '\0';
+  }
+  if (out != NULL) fclose(out);
+  return failures > 0 ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+  bool csv = false;
+  int frames = 200;
+  const char* filter = NULL;
+  bool fast = false;
+  bool staticSprites = false;
+  const char* scriptPath = NULL;
+  bool record = false;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--csv") == 0) {
+      csv = true;
+    } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      frames = max(atoi(argv[++i]), 1);
+    } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+      filter = argv[++i];
+    } else if (strcmp(argv[i], "--fast") == 0) {
+      fast = true;
+    } else if (strcmp(argv[i], "--static") == 0) {
+      staticSprites = true;
+    } else if ((strcmp(argv[i], "--record") == 0 || strcmp(argv[i], "--check") == 0) && i + 1 < argc) {
+      record = strcmp(argv[i], "--record") == 0;
+      scriptPath = argv[++i];
+    } else {
+      fprintf(stderr, "Usage: %s [--csv] [--frames N] [--filter NAME] [--fast] [--static] [--record FILE | --check FILE]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  for (int i = 0; i < BENCHMARK_MAX_ITEMS; i++) {
+    snprintf(itemNames[i], sizeof(itemNames[i]), "Item number %d", i + 1);
+    itemRows[i] = itemNames[i];
+    TileItem tile = { itemNames[i], bitmap_icons[i % bitmap_icons_size], tileColors[i % 4], NULL };
+    tiles[i] = tile;
+  }
+
+  menu.setButtonsMode((char*)"High");
+  menu.setFastRendering(fast);
+  menu.setStaticSprites(staticSprites);
+  setHostPanelSize(panelSizes[0].width, panelSizes[0].height);
+  menu.begin(1);
+  menuHandle = menu.addMenu(0, itemRows, itemCounts[0]);
+  if (scriptPath != NULL) {
+    return runScripts(scriptPath, record);
+  }
+
+  if (csv) {
+    printf("benchmark,width,height,items,mode,cpu_us,pixels,spi_bytes,spi_ms,pushes,allocations\n");
+  } else {
+    printf("%-21s %9s %5s %-5s %9s %9s %10s %7s %7s %6s\n", "Benchmark", "Size", "Items", "Mode", "CPU us", "Pixels", "SPI bytes", "SPI ms", "Pushes", "Allocs");
+  }
+  for (size_t b = 0; b < sizeof(benchmarks) / sizeof(benchmarks[0]); b++) {
+    const Benchmark& benchmark = benchmarks[b];
+    if (filter != NULL && strstr(benchmark.name, filter) == NULL) continue;
+    for (size_t s = 0; s < sizeof(panelSizes) / sizeof(panelSizes[0]); s++) {
+      int counts = benchmark.itemCounts ? sizeof(itemCounts) / sizeof(itemCounts[0]) : 1;
+      for (int c = 0; c < counts; c++) {
+        for (int dirty = 0; dirty < 2; dirty++) {
+          int items = itemCounts[c];
+          Result r = run(benchmark, panelSizes[s], items, dirty, frames);
+          double spiMillis = r.spiBytes * 8 * 1000 / BENCHMARK_SPI_FREQUENCY;
+          const char* mode = dirty ? "dirty" : "full";
+          int16_t width = panelSizes[s].height, height = panelSizes[s].width;  // Landscape
+          if (csv) {
+            printf("%s,%d,%d,%d,%s,%.1f,%.0f,%.0f,%.2f,%.1f,%u\n", benchmark.name, width, height, items, mode, r.cpuMicros, r.pixels, r.spiBytes, spiMillis, r.pushes, r.allocations);
+          } else {
+            char sizeText[14];  // Two int16_t and the x
+            snprintf(sizeText, sizeof(sizeText), "%dx%d", width, height);
+            printf("%-21s %9s %5d %-5s %9.1f %9.0f %10.0f %7.2f %7.1f %6u\n", benchmark.name, sizeText, items, mode, r.cpuMicros, r.pixels, r.spiBytes, spiMillis, r.pushes, r.allocations);
+          }
+        }
+      }
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,132 @@
+/*
+  Arduino.h - Host build of the Arduino core for the OpenMenuOS benchmarks.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+
+  Only what OpenMenuOS uses. The time is virtual: delay() moves it forward instead of waiting, so the animations and
+  the button timings are the same on every run and no benchmark waits for real.
+*/
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <strings.h>
+#include <algorithm>
+using std::min;
+using std::max;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define INPUT_PULLDOWN 0x09
+#define CHANGE 0x03
+#define RISING 0x01
+#define FALLING 0x02
+#define IRAM_ATTR
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(s) (s)
+#define FPSTR(p) (reinterpret_cast<const __FlashStringHelper*>(p))
+#define F(s) FPSTR(s)
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_ptr(addr) (*(void* const*)(addr))
+#define strncpy_P strncpy
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define memcpy_P memcpy
+#define digitalPinToInterrupt(p) (p)
+#define noInterrupts()
+#define interrupts()
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+class __FlashStringHelper;
+typedef bool boolean;
+typedef uint8_t byte;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t val);  // Also sets the level read back by digitalRead(), to simulate the buttons
+void pinMode(uint8_t pin, uint8_t mode);
+void attachInterruptArg(uint8_t pin, void (*fn)(void*), void* arg, int mode);
+void detachInterrupt(uint8_t pin);
+
+class String {
+public:
+  String(const char* s = "");
+  String(const String& other);
+  String& operator=(const String& other);
+  String& operator=(const char* s);
+  ~String();
+
+  unsigned int length() const;
+  const char* c_str() const;
+  void toLowerCase();
+  String substring(unsigned int from, unsigned int to) const;
+  String operator+(const char* s) const;
+  bool operator==(const char* s) const;
+  bool operator!=(const char* s) const;
+private:
+  void set(const char* s);
+  char* buffer;
+};
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* data, size_t n);
+
+  size_t print(const char* s);
+  size_t print(const String& s);
+  size_t print(const __FlashStringHelper* s);
+  size_t print(char c);
+  size_t print(int value);
+  size_t print(unsigned int value);
+  size_t print(long value);
+  size_t print(unsigned long value);
+  size_t print(unsigned long value, int base);
+  size_t print(double value, int digits = 2);
+  size_t println();
+  template <typename T>
+  size_t println(T value) {
+    size_t n = print(value);
+    return n + println();
+  }
+  size_t printf(const char* format, ...);
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+};
+
+// Writes to the standard output
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long baud);
+  size_t write(uint8_t c);
+  using Print::write;
+  int available();
+  int read();
+  int peek();
+};
+extern HardwareSerial Serial;
+
+#endif
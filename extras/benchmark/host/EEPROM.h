@@ -0,0 +1,43 @@
+/*
+  EEPROM.h - Host build of the EEPROM library for the OpenMenuOS benchmarks.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#ifndef EEPROM_h
+#define EEPROM_h
+
+#include "Arduino.h"
+
+#define HOST_EEPROM_SIZE 4096
+
+// Kept in memory, starts erased
+class EEPROMClass {
+public:
+  EEPROMClass();
+  void begin(size_t size);
+  uint8_t read(int address);
+  void write(int address, uint8_t value);
+  bool commit();
+
+  template <typename T>
+  T& get(int address, T& value) {
+    for (size_t i = 0; i < sizeof(T); i++) {
+      ((uint8_t*)&value)[i] = read(address + i);
+    }
+    return value;
+  }
+  template <typename T>
+  const T& put(int address, const T& value) {
+    for (size_t i = 0; i < sizeof(T); i++) {
+      write(address + i, ((const uint8_t*)&value)[i]);
+    }
+    return value;
+  }
+private:
+  uint8_t data[HOST_EEPROM_SIZE];
+  size_t size;
+};
+extern EEPROMClass EEPROM;
+
+#endif
@@ -0,0 +1,752 @@
+/*
+  HostBackend.cpp - Headless display for the OpenMenuOS benchmarks.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "TFT_eSPI.h"
+#include "EEPROM.h"
+#include "HostBackend.h"
+
+HostCounters hostCounters;
+HardwareSerial Serial;
+EEPROMClass EEPROM;
+
+static int16_t panelWidth = 80;
+static int16_t panelHeight = 160;
+static TFT_eSPI* display = NULL;  // The last display initialised
+
+void resetHostCounters() {
+  memset(&hostCounters, 0, sizeof(hostCounters));
+}
+
+void setHostPanelSize(int16_t width, int16_t height) {
+  panelWidth = width;
+  panelHeight = height;
+}
+
+uint16_t hostPanelPixel(int16_t x, int16_t y) {
+  return display != NULL ? display->readPixel(x, y) : 0;
+}
+
+uint32_t hostPanelHash() {
+  uint32_t hash = 2166136261UL;
+  if (display == NULL) return hash;
+  for (int16_t y = 0; y < display->height(); y++) {
+    for (int16_t x = 0; x < display->width(); x++) {
+      hash = (hash ^ display->readPixel(x, y)) * 16777619UL;
+    }
+  }
+  return hash;
+}
+
+// Time
+
+static unsigned long long virtualMicros = 0;
+
+unsigned long millis() {
+  return (unsigned long)(virtualMicros / 1000);
+}
+unsigned long micros() {
+  return (unsigned long)virtualMicros;
+}
+void delay(unsigned long ms) {
+  virtualMicros += (unsigned long long)ms * 1000;
+}
+void delayMicroseconds(unsigned int us) {
+  virtualMicros += us;
+}
+void yield() {
+}
+
+// Pins
+
+#define HOST_PINS 64
+
+static uint8_t pinLevels[HOST_PINS];
+static void (*pinHandlers[HOST_PINS])(void*);
+static void* pinArguments[HOST_PINS];
+
+int digitalRead(uint8_t pin) {
+  return pin < HOST_PINS ? pinLevels[pin] : LOW;
+}
+void digitalWrite(uint8_t pin, uint8_t val) {
+  if (pin >= HOST_PINS) return;
+  bool changed = pinLevels[pin] != val;
+  pinLevels[pin] = val;
+  if (changed && pinHandlers[pin] != NULL) {
+    pinHandlers[pin](pinArguments[pin]);
+  }
+}
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+void attachInterruptArg(uint8_t pin, void (*fn)(void*), void* arg, int mode) {
+  (void)mode;
+  if (pin >= HOST_PINS) return;
+  pinHandlers[pin] = fn;
+  pinArguments[pin] = arg;
+}
+void detachInterrupt(uint8_t pin) {
+  if (pin < HOST_PINS) pinHandlers[pin] = NULL;
+}
+
+// String
+
+String::String(const char* s) {
+  buffer = NULL;
+  set(s);
+}
+String::String(const String& other) {
+  buffer = NULL;
+  set(other.buffer);
+}
+String& String::operator=(const String& other) {
+  if (this != &other) set(other.buffer);
+  return *this;
+}
+String& String::operator=(const char* s) {
+  set(s);
+  return *this;
+}
+String::~String() {
+  free(buffer);
+}
+unsigned int String::length() const {
+  return strlen(buffer);
+}
+const char* String::c_str() const {
+  return buffer;
+}
+void String::toLowerCase() {
+  for (char* c = buffer; *c; c++) {
+    *c = tolower(*c);
+  }
+}
+String String::substring(unsigned int from, unsigned int to) const {
+  unsigned int n = length();
+  if (to > n) to = n;
+  if (from > to) from = to;
+  String result;
+  free(result.buffer);
+  result.buffer = (char*)malloc(to - from + 1);
+  memcpy(result.buffer, buffer + from, to - from);
+  result.buffer[to - from] = '\0';
+  return result;
+}
+String String::operator+(const char* s) const {
+  size_t n = length();
+  size_t m = strlen(s);
+  String result;
+  free(result.buffer);
+  result.buffer = (char*)malloc(n + m + 1);
+  memcpy(result.buffer, buffer, n);
+  memcpy(result.buffer + n, s, m + 1);
+  return result;
+}
+bool String::operator==(const char* s) const {
+  return strcmp(buffer, s) == 0;
+}
+bool String::operator!=(const char* s) const {
+  return strcmp(buffer, s) != 0;
+}
+void String::set(const char* s) {
+  char* copy = strdup(s != NULL ? s : "");
+  free(buffer);
+  buffer = copy;
+}
+
+// Print
+
+size_t Print::write(const uint8_t* data, size_t n) {
+  size_t written = 0;
+  while (n--) {
+    written += write(*data++);
+  }
+  return written;
+}
+size_t Print::print(const char* s) {
+  return write((const uint8_t*)s, strlen(s));
+}
+size_t Print::print(const String& s) {
+  return print(s.c_str());
+}
+size_t Print::print(const __FlashStringHelper* s) {
+  return print((const char*)s);
+}
+size_t Print::print(char c) {
+  return write((uint8_t)c);
+}
+size_t Print::print(int value) {
+  return print((long)value);
+}
+size_t Print::print(unsigned int value) {
+  return print((unsigned long)value);
+}
+size_t Print::print(long value) {
+  char text[24];
+  snprintf(text, sizeof(text), "%ld", value);
+  return print(text);
+}
+size_t Print::print(unsigned long value) {
+  return print(value, 10);
+}
+size_t Print::print(unsigned long value, int base) {
+  char text[24];
+  snprintf(text, sizeof(text), base == 16 ? "%lX" : "%lu", value);
+  return print(text);
+}
+size_t Print::print(double value, int digits) {
+  char text[32];
+  snprintf(text, sizeof(text), "%.*f", digits, value);
+  return print(text);
+}
+size_t Print::println() {
+  return print("\r\n");
+}
+size_t Print::printf(const char* format, ...) {
+  char text[256];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(text, sizeof(text), format, args);
+  va_end(args);
+  return print(text);
+}
+
+void HardwareSerial::begin(unsigned long baud) {
+  (void)baud;
+}
+size_t HardwareSerial::write(uint8_t c) {
+  fputc(c, stdout);
+  return 1;
+}
+int HardwareSerial::available() {
+  return 0;
+}
+int HardwareSerial::read() {
+  return -1;
+}
+int HardwareSerial::peek() {
+  return -1;
+}
+
+// EEPROM
+
+EEPROMClass::EEPROMClass() {
+  memset(data, 0xFF, sizeof(data));
+  size = 0;
+}
+void EEPROMClass::begin(size_t bytes) {
+  size = bytes < sizeof(data) ? bytes : sizeof(data);
+}
+uint8_t EEPROMClass::read(int address) {
+  return address >= 0 && (size_t)address < size ? data[address] : 0xFF;
+}
+void EEPROMClass::write(int address, uint8_t value) {
+  if (address >= 0 && (size_t)address < size) data[address] = value;
+}
+bool EEPROMClass::commit() {
+  return true;
+}
+
+// Fonts: every printable glyph is a 7x10 pattern of its code, with the box and advance of FreeMono 9pt
+
+static uint8_t glyphBits[95 * 14];
+static GFXglyph monoGlyphs[95];
+
+static struct FontBuilder {
+  FontBuilder() {
+    for (int i = 0; i < 95; i++) {
+      for (int b = 0; b < 14; b++) {
+        glyphBits[i * 14 + b] = (uint8_t)((i + 1) * (b + 3) * 37);
+      }
+      GFXglyph glyph = { (uint32_t)(i * 14), (uint8_t)(i == 0 ? 0 : 7), (uint8_t)(i == 0 ? 0 : 16), 11, 2, -12 };
+      monoGlyphs[i] = glyph;
+    }
+  }
+} fontBuilder;
+
+const GFXfont FreeMono9pt7b = { glyphBits, monoGlyphs, 0x20, 0x7E, 18 };
+const GFXfont FreeMonoBold9pt7b = { glyphBits, monoGlyphs, 0x20, 0x7E, 18 };
+
+// TFT_eSPI
+
+SPIClass::SPIClass() {
+  frequency = 27000000;
+}
+void SPIClass::setFrequency(uint32_t hz) {
+  frequency = hz;
+}
+SPIClass& TFT_eSPI::getSPIinstance() {
+  static SPIClass spi;
+  return spi;
+}
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) {
+  _width = initWidth = w;
+  _height = initHeight = h;
+  rotation = 0;
+  swapBytes = false;
+  cursorX = cursorY = 0;
+  textColor = TFT_WHITE;
+  textBgColor = TFT_BLACK;
+  textSize = 1;
+  gfxFont = NULL;
+  panel = NULL;
+  isSprite = false;
+  windowX = windowY = windowW = windowH = windowPixel = 0;
+  resetViewport();
+}
+TFT_eSPI::~TFT_eSPI() {
+  if (!isSprite) free(panel);
+  if (display == this) display = NULL;
+}
+
+void TFT_eSPI::init(uint8_t tc) {
+  (void)tc;
+  setRotation(rotation);
+  display = this;
+}
+void TFT_eSPI::begin(uint8_t tc) {
+  init(tc);
+}
+void TFT_eSPI::setRotation(uint8_t r) {
+  rotation = r & 3;
+  if (!isSprite && (panel == NULL || initWidth != panelWidth || initHeight != panelHeight)) {
+    // The size of the panel changed since the last call, start with a black display of the new size
+    free(panel);
+    initWidth = panelWidth;
+    initHeight = panelHeight;
+    panel = (uint16_t*)calloc((size_t)initWidth * initHeight, sizeof(uint16_t));
+  }
+  _width = (rotation & 1) ? initHeight : initWidth;
+  _height = (rotation & 1) ? initWidth : initHeight;
+  resetViewport();
+}
+uint8_t TFT_eSPI::getRotation() const {
+  return rotation;
+}
+int16_t TFT_eSPI::width() const {
+  return _width;
+}
+int16_t TFT_eSPI::height() const {
+  return _height;
+}
+
+void TFT_eSPI::setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum) {
+  xDatum = vpDatum ? x : 0;
+  yDatum = vpDatum ? y : 0;
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > _width) w = _width - x;
+  if (y + h > _height) h = _height - y;
+  vpX = x;
+  vpY = y;
+  vpW = x + (w > 0 ? w : 0);
+  vpH = y + (h > 0 ? h : 0);
+}
+void TFT_eSPI::resetViewport() {
+  vpX = vpY = xDatum = yDatum = 0;
+  vpW = _width;
+  vpH = _height;
+}
+bool TFT_eSPI::clip(int32_t& x, int32_t& y, int32_t& w, int32_t& h) {
+  x += xDatum;
+  y += yDatum;
+  if (x < vpX) {
+    w -= vpX - x;
+    x = vpX;
+  }
+  if (y < vpY) {
+    h -= vpY - y;
+    y = vpY;
+  }
+  if (x + w > vpW) w = vpW - x;
+  if (y + h > vpH) h = vpH - y;
+  return w > 0 && h > 0;
+}
+void TFT_eSPI::store(int32_t x, int32_t y, uint16_t color) {
+  if (panel != NULL) panel[y * _width + x] = color;
+}
+void TFT_eSPI::sendWindow(int32_t pixels) {
+  if (isSprite) return;
+  hostCounters.pushes++;
+  hostCounters.spiBytes += HOST_WINDOW_BYTES + pixels * 2;
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  int32_t w = 1, h = 1;
+  if (!clip(x, y, w, h)) return;
+  hostCounters.pixels++;
+  sendWindow(1);
+  store(x, y, color);
+}
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  if (!clip(x, y, w, h)) return;
+  hostCounters.pixels += w * h;
+  sendWindow(w * h);
+  for (int32_t j = 0; j < h; j++) {
+    for (int32_t i = 0; i < w; i++) {
+      store(x + i, y + j, color);
+    }
+  }
+}
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+  fillRect(x, y, w, 1, color);
+}
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+  fillRect(x, y, 1, h, color);
+}
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) {
+  if (panel == NULL || x < 0 || y < 0 || x >= _width || y >= _height) return 0;
+  return panel[y * _width + x];
+}
+void TFT_eSPI::fillScreen(uint32_t color) {
+  fillRect(0, 0, _width, _height, color);
+}
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y, h, color);
+  drawFastVLine(x + w - 1, y, h, color);
+}
+void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+  drawFastHLine(x + r, y, w - 2 * r, color);
+  drawFastHLine(x + r, y + h - 1, w - 2 * r, color);
+  drawFastVLine(x, y + r, h - 2 * r, color);
+  drawFastVLine(x + w - 1, y + r, h - 2 * r, color);
+}
+void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color) {
+  if (r > w / 2) r = w / 2;
+  if (r > h / 2) r = h / 2;
+  for (int32_t j = 0; j < h; j++) {
+    int32_t d = j < r ? r - j : (j >= h - r ? j - (h - r - 1) : 0);
+    int32_t inset = 0;
+    while (inset < r && (r - inset) * (r - inset) < d * d && inset * 2 < w) {
+      inset++;
+    }
+    drawFastHLine(x + inset, y + j, w - 2 * inset, color);
+  }
+}
+void TFT_eSPI::fillSmoothRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color, uint32_t bg) {
+  (void)bg;
+  hostCounters.pixels += 4 * r * r;  // The corners are blended pixel by pixel
+  fillRoundRect(x, y, w, h, r, color);
+}
+void TFT_eSPI::drawSmoothRoundRect(int32_t x, int32_t y, int32_t r, int32_t ir, int32_t w, int32_t h, uint32_t fg, uint32_t bg, uint8_t quadrants) {
+  (void)ir;
+  (void)bg;
+  (void)quadrants;
+  hostCounters.pixels += 4 * r * r;
+  drawRoundRect(x, y, w + 1, h + 1, r, fg);  // Like the library, the outline is w + 1 by h + 1
+}
+void TFT_eSPI::fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color) {
+  for (int32_t dy = -r; dy <= r; dy++) {
+    int32_t dx = 0;
+    while ((dx + 1) * (dx + 1) + dy * dy <= r * r) {
+      dx++;
+    }
+    drawFastHLine(x - dx, y + dy, 2 * dx + 1, color);
+  }
+}
+void TFT_eSPI::fillSmoothCircle(int32_t x, int32_t y, int32_t r, uint32_t color, uint32_t bg) {
+  (void)bg;
+  hostCounters.pixels += 4 * r * r;
+  fillCircle(x, y, r, color);
+}
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+  int32_t dx = abs(x1 - x0), dy = -abs(y1 - y0);
+  int32_t sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1;
+  int32_t error = dx + dy;
+  while (true) {
+    drawPixel(x0, y0, color);
+    if (x0 == x1 && y0 == y1) break;
+    int32_t e2 = 2 * error;
+    if (e2 >= dy) {
+      error += dy;
+      x0 += sx;
+    }
+    if (e2 <= dx) {
+      error += dx;
+      y0 += sy;
+    }
+  }
+}
+void TFT_eSPI::drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t fg) {
+  int32_t stride = (w + 7) / 8;
+  for (int32_t j = 0; j < h; j++) {
+    for (int32_t i = 0; i < w; i++) {
+      if (bitmap[j * stride + i / 8] & (0x80 >> (i & 7))) drawPixel(x + i, y + j, fg);
+    }
+  }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+  int32_t dx = x, dy = y, dw = w, dh = h;
+  if (!clip(dx, dy, dw, dh)) return;
+  int32_t skipX = dx - (x + xDatum);
+  int32_t skipY = dy - (y + yDatum);
+  hostCounters.pixels += dw * dh;
+  sendWindow(dw * dh);
+  for (int32_t j = 0; j < dh; j++) {
+    for (int32_t i = 0; i < dw; i++) {
+      uint16_t color = data[(j + skipY) * w + i + skipX];
+      if (swapBytes) color = (uint16_t)(color >> 8 | color << 8);
+      store(dx + i, dy + j, color);
+    }
+  }
+}
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data) {
+  pushImage(x, y, w, h, (const uint16_t*)data);
+}
+void TFT_eSPI::setSwapBytes(bool swap) {
+  swapBytes = swap;
+}
+bool TFT_eSPI::getSwapBytes() const {
+  return swapBytes;
+}
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+  windowX = x;
+  windowY = y;
+  windowW = w;
+  windowH = h;
+  windowPixel = 0;
+  sendWindow(0);  // The pixels are counted as they are pushed
+}
+void TFT_eSPI::pushPixels(const void* data, uint32_t len) {
+  const uint16_t* pixels = (const uint16_t*)data;
+  if (!isSprite) hostCounters.spiBytes += len * 2;
+  for (uint32_t i = 0; i < len && windowPixel < windowW * windowH; i++, windowPixel++) {
+    uint16_t color = pixels[i];
+    if (swapBytes) color = (uint16_t)(color >> 8 | color << 8);
+    int32_t x = windowX + windowPixel % windowW, y = windowY + windowPixel / windowW;
+    if (x >= 0 && y >= 0 && x < _width && y < _height) store(x, y, color);
+  }
+  hostCounters.pixels += len;
+}
+
+void TFT_eSPI::setCursor(int16_t x, int16_t y) {
+  cursorX = x;
+  cursorY = y;
+}
+int16_t TFT_eSPI::getCursorX() const {
+  return cursorX;
+}
+int16_t TFT_eSPI::getCursorY() const {
+  return cursorY;
+}
+void TFT_eSPI::setTextColor(uint16_t color) {
+  textColor = textBgColor = color;
+}
+void TFT_eSPI::setTextColor(uint16_t color, uint16_t bg, bool fill) {
+  (void)fill;
+  textColor = color;
+  textBgColor = bg;
+}
+void TFT_eSPI::setTextSize(uint8_t size) {
+  textSize = size > 0 ? size : 1;
+}
+void TFT_eSPI::setTextWrap(bool wrapX, bool wrapY) {
+  (void)wrapX;
+  (void)wrapY;
+}
+void TFT_eSPI::setFreeFont(const GFXfont* font) {
+  gfxFont = font;
+}
+void TFT_eSPI::setTextFont(uint8_t font) {
+  (void)font;
+  gfxFont = NULL;
+}
+void TFT_eSPI::setTextDatum(uint8_t datum) {
+  (void)datum;
+}
+int16_t TFT_eSPI::textWidth(const char* text) {
+  int16_t width = 0;
+  for (; *text; text++) {
+    uint8_t c = (uint8_t)*text;
+    if (gfxFont == NULL) {
+      width += 6 * textSize;  // GLCD font
+    } else if (c >= gfxFont->first && c <= gfxFont->last) {
+      width += gfxFont->glyph[c - gfxFont->first].xAdvance * textSize;
+    }
+  }
+  return width;
+}
+int16_t TFT_eSPI::fontHeight() {
+  return gfxFont != NULL ? gfxFont->yAdvance * textSize : 8 * textSize;
+}
+void TFT_eSPI::drawGlyph(uint8_t c) {
+  if (c < gfxFont->first || c > gfxFont->last) return;
+  const GFXglyph& glyph = gfxFont->glyph[c - gfxFont->first];
+  const uint8_t* bits = gfxFont->bitmap + glyph.bitmapOffset;
+  int bit = 0;
+  for (int j = 0; j < glyph.height; j++) {
+    for (int i = 0; i < glyph.width; i++, bit++) {
+      if (bits[bit >> 3] & (0x80 >> (bit & 7))) {
+        fillRect(cursorX + (glyph.xOffset + i) * textSize, cursorY + (glyph.yOffset + j) * textSize, textSize, textSize, textColor);
+      }
+    }
+  }
+  cursorX += glyph.xAdvance * textSize;
+}
+size_t TFT_eSPI::write(uint8_t c) {
+  if (c == '\n') {
+    cursorX = 0;
+    cursorY += fontHeight();
+  } else if (c == '\r') {
+  } else if (gfxFont != NULL) {
+    drawGlyph(c);
+  } else {
+    if (textBgColor != textColor) fillRect(cursorX, cursorY, 6 * textSize, 8 * textSize, textBgColor);
+    fillRect(cursorX, cursorY, 5 * textSize, 7 * textSize, textColor);  // A block per character of the GLCD font
+    cursorX += 6 * textSize;
+  }
+  return 1;
+}
+
+void TFT_eSPI::startWrite() {
+}
+void TFT_eSPI::endWrite() {
+}
+bool TFT_eSPI::initDMA(bool ctrl_cs) {
+  (void)ctrl_cs;
+  return true;
+}
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer) {
+  (void)buffer;
+  pushImage(x, y, w, h, (const uint16_t*)data);
+}
+bool TFT_eSPI::dmaBusy() {
+  return false;
+}
+void TFT_eSPI::dmaWait() {
+}
+
+// TFT_eSprite
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI* tft)
+  : TFT_eSPI(0, 0) {
+  parent = tft;
+  buffer = NULL;
+  active = NULL;
+  bpp = 16;
+  frames = 1;
+  frameBytes = 0;
+  isSprite = true;
+}
+TFT_eSprite::~TFT_eSprite() {
+  deleteSprite();
+}
+
+void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t count) {
+  if (buffer != NULL) return active;
+  size_t bits = (size_t)(bpp == 1 ? ((w + 7) & ~7) : w) * h * bpp;  // Rows of a 1 bit sprite are padded to a byte
+  frameBytes = (bits + 7) / 8;
+  frames = count < 1 ? 1 : count;
+  buffer = (uint8_t*)calloc(frameBytes * frames, 1);
+  if (buffer == NULL) return NULL;
+  hostCounters.allocations++;
+  active = buffer;
+  _width = initWidth = w;
+  _height = initHeight = h;
+  resetViewport();
+  return active;
+}
+void TFT_eSprite::deleteSprite() {
+  free(buffer);
+  buffer = active = NULL;
+  _width = _height = 0;
+}
+bool TFT_eSprite::created() const {
+  return buffer != NULL;
+}
+void* TFT_eSprite::setColorDepth(int8_t bits) {
+  bpp = (bits == 1 || bits == 4 || bits == 8) ? bits : 16;
+  return NULL;
+}
+int8_t TFT_eSprite::getColorDepth() const {
+  return bpp;
+}
+void* TFT_eSprite::frameBuffer(int8_t frame) {
+  if (buffer != NULL && frame >= 1 && frame <= frames) active = buffer + (frame - 1) * frameBytes;
+  return active;
+}
+void* TFT_eSprite::getPointer() {
+  return active;
+}
+void TFT_eSprite::fillSprite(uint32_t color) {
+  fillRect(vpX - xDatum, vpY - yDatum, vpW - vpX, vpH - vpY, color);
+}
+void TFT_eSprite::store(int32_t x, int32_t y, uint16_t color) {
+  if (active == NULL) return;
+  if (bpp == 1) {
+    uint8_t& byte = active[(x + y * ((_width + 7) & ~7)) >> 3];
+    if (color) {
+      byte |= 0x80 >> (x & 7);
+    } else {
+      byte &= ~(0x80 >> (x & 7));
+    }
+  } else {
+    ((uint16_t*)active)[y * _width + x] = color;
+  }
+}
+uint16_t TFT_eSprite::readPixel(int32_t x, int32_t y) {
+  if (active == NULL || x < 0 || y < 0 || x >= _width || y >= _height) return 0;
+  if (bpp == 1) {
+    return (active[(x + y * ((_width + 7) & ~7)) >> 3] & (0x80 >> (x & 7))) ? 1 : 0;
+  }
+  return ((uint16_t*)active)[y * _width + x];
+}
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+  pushSprite(x, y, 0, 0, _width, _height);
+}
+void TFT_eSprite::pushSprite(int32_t x, int32_t y, uint16_t transparent) {
+  for (int32_t j = 0; j < _height; j++) {
+    for (int32_t i = 0; i < _width; i++) {
+      uint16_t color = readPixel(i, j);
+      if (color != transparent) parent->drawPixel(x + i, y + j, color);
+    }
+  }
+}
+bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh) {
+  if (active == NULL || bpp != 16) return false;
+  int32_t x = tx, y = ty, w = sw, h = sh;
+  if (!parent->clip(x, y, w, h)) return true;
+  sx += x - (tx + parent->xDatum);
+  sy += y - (ty + parent->yDatum);
+  hostCounters.pixels += w * h;
+  parent->sendWindow(w * h);  // One window, like the library
+  for (int32_t j = 0; j < h; j++) {
+    for (int32_t i = 0; i < w; i++) {
+      parent->store(x + i, y + j, readPixel(sx + i, sy + j));
+    }
+  }
+  return true;
+}
+bool TFT_eSprite::pushToSprite(TFT_eSprite* target, int32_t x, int32_t y) {
+  if (active == NULL || bpp != target->bpp) return false;
+  for (int32_t j = 0; j < _height; j++) {
+    for (int32_t i = 0; i < _width; i++) {
+      target->drawPixel(x + i, y + j, readPixel(i, j));
+    }
+  }
+  return true;
+}
+bool TFT_eSprite::pushToSprite(TFT_eSprite* target, int32_t x, int32_t y, uint16_t transparent) {
+  if (active == NULL || bpp != 16) return false;
+  for (int32_t j = 0; j < _height; j++) {
+    for (int32_t i = 0; i < _width; i++) {
+      uint16_t color = readPixel(i, j);
+      if (color != transparent) target->drawPixel(x + i, y + j, color);
+    }
+  }
+  return true;
+}
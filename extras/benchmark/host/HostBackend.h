@@ -0,0 +1,33 @@
+/*
+  HostBackend.h - Headless display for the OpenMenuOS benchmarks.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+
+  The host TFT_eSPI draws into memory: the sprites into their buffers like on the target, and the display into an
+  RGB565 buffer of the panel size. What a frame costs is counted on the way.
+*/
+
+#ifndef HostBackend_h
+#define HostBackend_h
+
+#include <stdint.h>
+
+#define HOST_WINDOW_BYTES 11  // Bytes sent to set the address window before the pixels (CASET, RASET and RAMWR with their parameters)
+
+struct HostCounters {
+  uint32_t pixels;       // Pixels written by the drawing functions, in the sprites or on the display
+  uint32_t spiBytes;     // Bytes that would go over SPI to the display
+  uint32_t pushes;       // Address windows sent to the display
+  uint32_t allocations;  // Sprite buffers created
+};
+extern HostCounters hostCounters;
+
+void resetHostCounters();
+// Native size of the panel (rotation 0), taken by the next init() or setRotation(). 80x160 by default
+void setHostPanelSize(int16_t width, int16_t height);
+// Colour of a pixel of the display, 0 outside of it
+uint16_t hostPanelPixel(int16_t x, int16_t y);
+// FNV-1a hash of what is on the display
+uint32_t hostPanelHash();
+
+#endif
@@ -0,0 +1,177 @@
+/*
+  TFT_eSPI.h - Host build of TFT_eSPI for the OpenMenuOS benchmarks.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+
+  The functions OpenMenuOS uses, with the same clipping and viewports as the library. The shapes are drawn plainly,
+  the smooth ones count the pixels their anti-aliasing would blend.
+*/
+
+#ifndef _TFT_eSPIH_
+#define _TFT_eSPIH_
+
+#include "Arduino.h"
+#include "HostBackend.h"
+
+#define TFT_BLACK 0x0000
+#define TFT_NAVY 0x000F
+#define TFT_DARKGREEN 0x03E0
+#define TFT_MAROON 0x7800
+#define TFT_PURPLE 0x780F
+#define TFT_DARKGREY 0x7BEF
+#define TFT_LIGHTGREY 0xD69A
+#define TFT_BLUE 0x001F
+#define TFT_GREEN 0x07E0
+#define TFT_CYAN 0x07FF
+#define TFT_RED 0xF800
+#define TFT_MAGENTA 0xF81F
+#define TFT_YELLOW 0xFFE0
+#define TFT_WHITE 0xFFFF
+#define TFT_ORANGE 0xFDA0
+#define TFT_TRANSPARENT 0x0120
+#define LOAD_GFXFF
+
+typedef struct {
+  uint32_t bitmapOffset;
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t* bitmap;
+  GFXglyph* glyph;
+  uint16_t first;
+  uint16_t last;
+  uint8_t yAdvance;
+} GFXfont;
+
+// Same metrics as the real fonts, the glyphs are a pattern of the character code
+extern const GFXfont FreeMono9pt7b;
+extern const GFXfont FreeMonoBold9pt7b;
+
+class SPIClass {
+public:
+  SPIClass();
+  void setFrequency(uint32_t frequency);
+  uint32_t frequency;
+};
+
+class TFT_eSPI : public Print {
+public:
+  TFT_eSPI(int16_t w = 80, int16_t h = 160);
+  virtual ~TFT_eSPI();
+
+  void init(uint8_t tc = 0);
+  void begin(uint8_t tc = 0);
+  void setRotation(uint8_t r);
+  uint8_t getRotation() const;
+  int16_t width() const;
+  int16_t height() const;
+
+  virtual void drawPixel(int32_t x, int32_t y, uint32_t color);
+  virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+  virtual uint16_t readPixel(int32_t x, int32_t y);
+  void fillScreen(uint32_t color);
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+  void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color);
+  void fillSmoothRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color, uint32_t bg = 0x00FFFFFF);
+  void drawSmoothRoundRect(int32_t x, int32_t y, int32_t r, int32_t ir, int32_t w, int32_t h, uint32_t fg, uint32_t bg = 0x00FFFFFF, uint8_t quadrants = 0xF);
+  void fillCircle(int32_t x, int32_t y, int32_t r, uint32_t color);
+  void fillSmoothCircle(int32_t x, int32_t y, int32_t r, uint32_t color, uint32_t bg = 0x00FFFFFF);
+  void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t fg);
+
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data);
+  void setSwapBytes(bool swap);
+  bool getSwapBytes() const;
+  void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);  // Then pushPixels() fills it row by row
+  void pushPixels(const void* data, uint32_t len);
+
+  void setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum = true);
+  void resetViewport();
+
+  void setCursor(int16_t x, int16_t y);
+  int16_t getCursorX() const;
+  int16_t getCursorY() const;
+  void setTextColor(uint16_t color);
+  void setTextColor(uint16_t color, uint16_t bg, bool fill = false);
+  void setTextSize(uint8_t size);
+  void setTextWrap(bool wrapX, bool wrapY = false);
+  void setFreeFont(const GFXfont* font = NULL);
+  void setTextFont(uint8_t font);
+  void setTextDatum(uint8_t datum);
+  int16_t textWidth(const char* text);
+  int16_t fontHeight();
+  size_t write(uint8_t c);
+  using Print::write;
+
+  void startWrite();
+  void endWrite();
+  bool initDMA(bool ctrl_cs = false);
+  void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer = NULL);
+  bool dmaBusy();
+  void dmaWait();
+  static SPIClass& getSPIinstance();
+
+protected:
+  friend class TFT_eSprite;  // Pushes into its display
+
+  bool clip(int32_t& x, int32_t& y, int32_t& w, int32_t& h);
+  virtual void store(int32_t x, int32_t y, uint16_t color);  // Already clipped
+  void drawGlyph(uint8_t c);
+  void sendWindow(int32_t pixels);
+
+  int16_t _width, _height;
+  int16_t initWidth, initHeight;
+  uint8_t rotation;
+  bool swapBytes;
+  int32_t vpX, vpY, vpW, vpH, xDatum, yDatum;  // vpW and vpH are the right and bottom edges
+  int16_t cursorX, cursorY;
+  uint16_t textColor, textBgColor;
+  uint8_t textSize;
+  const GFXfont* gfxFont;
+  uint16_t* panel;  // The display only
+  int32_t windowX, windowY, windowW, windowH, windowPixel;  // Set by setAddrWindow(), windowPixel is the next one filled
+  bool isSprite;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+  explicit TFT_eSprite(TFT_eSPI* tft);
+  ~TFT_eSprite();
+
+  void* createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+  void deleteSprite();
+  bool created() const;
+  void* setColorDepth(int8_t bits);
+  int8_t getColorDepth() const;
+  void* frameBuffer(int8_t frame);
+  void* getPointer();
+  void fillSprite(uint32_t color);
+  void pushSprite(int32_t x, int32_t y);
+  void pushSprite(int32_t x, int32_t y, uint16_t transparent);
+  bool pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
+  bool pushToSprite(TFT_eSprite* target, int32_t x, int32_t y);
+  bool pushToSprite(TFT_eSprite* target, int32_t x, int32_t y, uint16_t transparent);
+  uint16_t readPixel(int32_t x, int32_t y);
+
+protected:
+  void store(int32_t x, int32_t y, uint16_t color);
+
+private:
+  TFT_eSPI* parent;
+  uint8_t* buffer;
+  uint8_t* active;  // Frame being drawn
+  int8_t bpp;
+  uint8_t frames;
+  size_t frameBytes;
+};
+
+#endif
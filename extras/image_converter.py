@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""
+image_converter.py - Convert images to the compressed assets of OpenMenuOS.
+Created by Loic Daigle aka The Young Maker.
+Released into the public domain.
+
+The output is a C array that drawImage() draws in place of a raw RGB565 array, see ImageAsset.h for the format.
+
+Examples:
+  python3 image_converter.py icon.png -n Menu_icon_1              (needs Pillow: pip install pillow)
+  python3 image_converter.py images.cpp --array Boot_img --size 160x80
+  python3 image_converter.py boot.png -n Boot_img --colors 16     (lossy, reduces the image to 16 colours)
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+FORMAT_RLE = 1
+FORMAT_PALETTE = 2
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def load_image(path, colors):
+    from PIL import Image
+
+    image = Image.open(path).convert("RGB")
+    if colors:
+        image = image.quantize(colors).convert("RGB")
+    w, h = image.size
+    return w, h, [rgb565(*image.getpixel((x, y))) for y in range(h) for x in range(w)]
+
+
+def load_array(path, name, size):
+    # A raw array as written by the usual converters, two bytes per pixel, low byte first
+    source = open(path).read()
+    match = re.search(r"\b%s\s*\[\s*\]\s*(?:PROGMEM\s*)?=\s*\{(.*?)\}" % re.escape(name), source, re.S)
+    if not match:
+        sys.exit("Array %s not found in %s" % (name, path))
+    data = [int(value, 0) for value in re.findall(r"0x[0-9a-fA-F]+|\d+", match.group(1))]
+    w, h = size
+    if len(data) != w * h * 2:
+        sys.exit("%s has %d bytes, %dx%d needs %d" % (name, len(data), w, h, w * h * 2))
+    return w, h, [data[i] | (data[i + 1] << 8) for i in range(0, len(data), 2)]
+
+
+def encode_rle(pixels):
+    out = bytearray()
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < 128 and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            out += struct.pack("<BH", 0x80 | (run - 1), pixels[i])
+            i += run
+            continue
+        # Literal pixels, until the next run of at least 2
+        start = i
+        while i < len(pixels) and i - start < 128:
+            if i + 1 < len(pixels) and pixels[i + 1] == pixels[i]:
+                break
+            i += 1
+        out.append(i - start - 1)
+        for pixel in pixels[start:i]:
+            out += struct.pack("<H", pixel)
+    return out
+
+
+def encode_palette(pixels, w, h):
+    colors = sorted(set(pixels))
+    bits = next((b for b in (1, 2, 4, 8) if len(colors) <= 1 << b), None)
+    if bits is None:
+        return None, 0
+    colors += [0] * ((1 << bits) - len(colors))
+    index = {color: i for i, color in enumerate(colors)}
+    out = bytearray()
+    for color in colors:
+        out += struct.pack("<H", color)
+    for y in range(h):
+        byte, used = 0, 0
+        for x in range(w):
+            byte = (byte << bits) | index[pixels[y * w + x]]
+            used += bits
+            if used == 8:
+                out.append(byte)
+                byte, used = 0, 0
+        if used:
+            out.append(byte << (8 - used))  # Each row starts on a byte
+    return out, bits
+
+
+def encode(pixels, w, h, mode):
+    candidates = []
+    if mode in ("auto", "rle"):
+        candidates.append((FORMAT_RLE, 16, encode_rle(pixels)))
+    if mode in ("auto", "palette"):
+        body, bits = encode_palette(pixels, w, h)
+        if body is not None:
+            candidates.append((FORMAT_PALETTE, bits, body))
+        elif mode == "palette":
+            sys.exit("More than 256 colours, use --colors or the rle format")
+    fmt, bits, body = min(candidates, key=lambda candidate: len(candidate[2]))
+    return bytes(b"OM" + struct.pack("<BBHH", fmt, bits, w, h) + body)
+
+
+def to_c(name, data, w, h):
+    lines = ["// %dx%d, %d bytes (%d raw)" % (w, h, len(data), w * h * 2), "const uint8_t %s[] PROGMEM = {" % name]
+    for i in range(0, len(data), 32):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 32]) + ",")
+    lines.append("};")
+    lines.append("const size_t %s_size {sizeof(%s) / sizeof(%s[0])};" % (name, name, name))
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert images to the compressed assets of OpenMenuOS")
+    parser.add_argument("input", help="Image (png, bmp, ...) or C file holding a raw RGB565 array")
+    parser.add_argument("-n", "--name", help="Name of the array (default: name of the file, or --array)")
+    parser.add_argument("-o", "--output", help="File to write (default: standard output)")
+    parser.add_argument("-f", "--format", choices=("auto", "rle", "palette"), default="auto",
+                        help="auto takes the smallest (default)")
+    parser.add_argument("--colors", type=int, help="Reduce an image to this many colours first (lossy)")
+    parser.add_argument("--array", help="Raw array to read from the C file")
+    parser.add_argument("--size", help="Size of the raw array, WIDTHxHEIGHT")
+    args = parser.parse_args()
+
+    if args.array:
+        if not args.size:
+            sys.exit("--size is needed with --array")
+        w, h, pixels = load_array(args.input, args.array, [int(v) for v in args.size.lower().split("x")])
+        name = args.name or args.array
+    else:
+        w, h, pixels = load_image(args.input, args.colors)
+        name = args.name or re.sub(r"\W", "_", args.input.rsplit("/", 1)[-1].rsplit(".", 1)[0])
+
+    text = to_c(name, encode(pixels, w, h, args.format), w, h)
+    if args.output:
+        open(args.output, "w").write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
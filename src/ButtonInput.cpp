@@ -0,0 +1,219 @@
+/*
+  ButtonInput.cpp - Interrupt driven button input for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "ButtonInput.h"
+#ifdef ESP32
+#include "esp_sleep.h"
+#include "driver/gpio.h"
+#endif
+
+#if defined(ESP32) || defined(ESP8266)
+#define BUTTON_INPUT_INTERRUPTS  // Other boards don't all have attachInterruptArg(), the buttons are polled in update() instead
+#endif
+
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+ButtonInput::ButtonInput() {
+  for (int i = 0; i < BUTTON_COUNT; i++) {
+    Button& button = buttons[i];
+    button.owner = this;
+    button.id = i;
+    button.pin = BUTTON_NO_PIN;
+    button.longPressTime = 0;
+    button.repeatTime = 0;
+    button.down = false;
+    button.longPressed = false;
+    button.pressedTime = 0;
+    button.repeatedTime = 0;
+    button.edgeTime = 0;
+    button.isrDown = false;
+    button.isrTime = 0;
+  }
+  activeLevel = HIGH;
+  edgeHead = 0;
+  edgeTail = 0;
+  eventHead = 0;
+  eventTail = 0;
+}
+
+void ButtonInput::setButton(uint8_t id, int pin, unsigned long longPressTime, unsigned long repeatTime) {
+  if (id >= BUTTON_COUNT) return;
+  buttons[id].pin = pin;
+  buttons[id].longPressTime = longPressTime;
+  buttons[id].repeatTime = repeatTime;
+}
+
+void ButtonInput::begin(int level) {
+  activeLevel = level;
+  for (int i = 0; i < BUTTON_COUNT; i++) {
+    Button& button = buttons[i];
+    if (button.pin < 0) continue;
+    button.down = digitalRead(button.pin) == activeLevel;
+    button.isrDown = button.down;
+    button.longPressed = button.down;  // A button held at boot doesn't send a press
+#ifdef BUTTON_INPUT_INTERRUPTS
+    attachInterruptArg(digitalPinToInterrupt(button.pin), onChange, &button, CHANGE);
+#endif
+  }
+}
+
+void IRAM_ATTR ButtonInput::onChange(void* arg) {
+  Button* button = (Button*)arg;
+  button->owner->recordEdge(button->id);
+}
+
+void IRAM_ATTR ButtonInput::recordEdge(uint8_t id) {
+  Button& button = buttons[id];
+  bool down = digitalRead(button.pin) == activeLevel;
+  unsigned long time = millis();
+  if (down == button.isrDown || time - button.isrTime < BUTTON_DEBOUNCE_TIME) {
+    return;  // Bounce, update() reads the pin again once it settles
+  }
+  button.isrDown = down;
+  button.isrTime = time;
+
+  uint8_t head = edgeHead;
+  uint8_t next = (head + 1) & (BUTTON_EDGE_QUEUE_SIZE - 1);
+  if (next == edgeTail) {
+    return;  // Full, the edge is picked up by update() reading the pin
+  }
+  edges[head].button = id;
+  edges[head].down = down;
+  edges[head].time = time;
+  edgeHead = next;  // Publish the edge only once it is written
+}
+
+void ButtonInput::update() {
+  // Edges recorded by the interrupts, with the time they happened
+  while (edgeTail != edgeHead) {
+    Edge& edge = edges[edgeTail];
+    applyEdge(buttons[edge.button], edge.down, edge.time);
+    edgeTail = (edgeTail + 1) & (BUTTON_EDGE_QUEUE_SIZE - 1);
+  }
+
+  unsigned long now = millis();
+  for (int i = 0; i < BUTTON_COUNT; i++) {
+    Button& button = buttons[i];
+    if (button.pin < 0) continue;
+
+    // Read the pin too, for the boards without interrupts and for an edge the interrupt filtered out as a bounce
+    bool down = digitalRead(button.pin) == activeLevel;
+    if (down != button.down && now - button.edgeTime >= BUTTON_DEBOUNCE_TIME) {
+      button.isrDown = down;
+      button.isrTime = now;
+      applyEdge(button, down, now);
+    }
+
+    if (button.down && !button.longPressed && now - button.pressedTime >= button.longPressTime) {
+      button.longPressed = true;
+      button.repeatedTime = now;
+      pushEvent(button.id, BUTTON_LONG_PRESS);
+    } else if (button.down && button.longPressed && button.repeatTime > 0 && now - button.repeatedTime >= button.repeatTime) {
+      button.repeatedTime = now;
+      pushEvent(button.id, BUTTON_REPEAT);
+    }
+  }
+}
+
+void ButtonInput::applyEdge(Button& button, bool down, unsigned long time) {
+  if (down == button.down) return;
+  button.down = down;
+  button.edgeTime = time;
+  if (down) {
+    button.pressedTime = time;
+    button.longPressed = false;
+    return;
+  }
+  if (!button.longPressed) {
+    if (time - button.pressedTime >= button.longPressTime) {
+      pushEvent(button.id, BUTTON_LONG_PRESS);  // Held long enough, even if no update() happened during the press
+    } else {
+      pushEvent(button.id, BUTTON_SHORT_PRESS);
+    }
+  }
+  button.longPressed = false;
+  pushEvent(button.id, BUTTON_RELEASE);
+}
+
+void ButtonInput::pushEvent(uint8_t button, uint8_t type) {
+  uint8_t next = (eventHead + 1) & (BUTTON_EVENT_QUEUE_SIZE - 1);
+  if (next == eventTail) return;  // Full, the menu isn't reading the events
+  events[eventHead].button = button;
+  events[eventHead].type = type;
+  eventHead = next;
+}
+
+void ButtonInput::inject(uint8_t button, uint8_t type) {
+  pushEvent(button, type);
+}
+
+bool ButtonInput::read(ButtonEvent& event) {
+  if (eventTail == eventHead) return false;
+  event = events[eventTail];
+  eventTail = (eventTail + 1) & (BUTTON_EVENT_QUEUE_SIZE - 1);
+  return true;
+}
+
+bool ButtonInput::available() const {
+  return eventTail != eventHead;
+}
+
+bool ButtonInput::isDown(uint8_t button) const {
+  return button < BUTTON_COUNT && buttons[button].down;
+}
+
+bool ButtonInput::nextDeadline(unsigned long& deadline) const {
+  bool found = false;
+  unsigned long now = millis();
+  for (int i = 0; i < BUTTON_COUNT; i++) {
+    const Button& button = buttons[i];
+    if (button.pin < 0 || !button.down) continue;
+
+    unsigned long time;
+    if (!button.longPressed) {
+      time = button.pressedTime + button.longPressTime;
+    } else if (button.repeatTime > 0) {
+      time = button.repeatedTime + button.repeatTime;
+    } else {
+      continue;  // Held after its long press, nothing happens until it is released
+    }
+    if (!found || (long)(time - now) < (long)(deadline - now)) {
+      deadline = time;
+      found = true;
+    }
+  }
+  return found;
+}
+
+void ButtonInput::enableWakeup() {
+#ifdef ESP32
+  for (int i = 0; i < BUTTON_COUNT; i++) {
+    const Button& button = buttons[i];
+    if (button.pin < 0) continue;
+    // The wakeup is on a level, so wait for the level the button doesn't have yet. The edge interrupt is off
+    // meanwhile as the pin can only have one type, update() reads the change after waking up
+    bool wakeLevel = button.down ? !activeLevel : activeLevel;
+    gpio_intr_disable((gpio_num_t)button.pin);
+    gpio_wakeup_enable((gpio_num_t)button.pin, wakeLevel ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+  }
+  esp_sleep_enable_gpio_wakeup();
+#endif
+}
+
+void ButtonInput::disableWakeup() {
+#ifdef ESP32
+  for (int i = 0; i < BUTTON_COUNT; i++) {
+    const Button& button = buttons[i];
+    if (button.pin < 0) continue;
+    gpio_wakeup_disable((gpio_num_t)button.pin);
+    gpio_set_intr_type((gpio_num_t)button.pin, GPIO_INTR_ANYEDGE);
+    gpio_intr_enable((gpio_num_t)button.pin);
+  }
+#endif
+}
@@ -0,0 +1,98 @@
+/*
+  ButtonInput.h - Interrupt driven button input for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#ifndef ButtonInput_h
+#define ButtonInput_h
+
+#include "Arduino.h"
+
+#define BUTTON_COUNT 3              // Up, Down and Select
+#define BUTTON_EDGE_QUEUE_SIZE 16   // Number of edges the interrupts can record between two update() (must be a power of 2)
+#define BUTTON_EVENT_QUEUE_SIZE 16  // Number of events waiting to be read (must be a power of 2)
+#define BUTTON_DEBOUNCE_TIME 20     // 20 milliseconds
+#define BUTTON_NO_PIN -1            // Pin of a button that isn't there, 0 is a real pin (the BOOT button of most ESP boards)
+
+enum ButtonId {
+  BUTTON_UP,
+  BUTTON_DOWN,
+  BUTTON_SELECT
+};
+
+enum ButtonEventType {
+  BUTTON_SHORT_PRESS,  // Released before the long press time
+  BUTTON_LONG_PRESS,   // Held for the long press time
+  BUTTON_REPEAT,       // Still held after a long press, sent every repeat time
+  BUTTON_RELEASE       // Released, after a short or a long press
+};
+
+struct ButtonEvent {
+  uint8_t button;  // ButtonId
+  uint8_t type;    // ButtonEventType
+};
+
+class ButtonInput {
+public:
+  ButtonInput();
+
+  // Set up a button before begin(). A pin of BUTTON_NO_PIN means the button isn't there, a repeatTime of 0 disables the repeat
+  void setButton(uint8_t button, int pin, unsigned long longPressTime, unsigned long repeatTime);
+  // Attach the interrupts. activeLevel is the level read when a button is pressed
+  void begin(int activeLevel);
+  // Turn the edges recorded since the last call into events, call it once per frame
+  void update();
+  // Get the next event, returns false if there is none
+  bool read(ButtonEvent& event);
+  // Add an event that doesn't come from a pin (the viewer of the mirror...), read after the ones already waiting
+  void inject(uint8_t button, uint8_t type);
+  // Check if there are events waiting to be read
+  bool available() const;
+  // Debounced state of a button, as of the last update()
+  bool isDown(uint8_t button) const;
+  // Get the time of the next long press or repeat event of the held buttons, returns false if there is none
+  bool nextDeadline(unsigned long& deadline) const;
+  // Wake up from light sleep on the next change of a button, and go back to the interrupts after (ESP32 only)
+  void enableWakeup();
+  void disableWakeup();
+private:
+  struct Edge {
+    uint8_t button;
+    bool down;
+    unsigned long time;
+  };
+  struct Button {
+    ButtonInput* owner;
+    uint8_t id;
+    int pin;
+    unsigned long longPressTime;
+    unsigned long repeatTime;
+    bool down;         // Debounced state
+    bool longPressed;  // The long press event was sent for this press
+    unsigned long pressedTime;
+    unsigned long repeatedTime;
+    unsigned long edgeTime;  // Time of the last accepted edge
+    volatile bool isrDown;   // State and time of the last edge seen by the interrupt
+    volatile unsigned long isrTime;
+  };
+
+  Button buttons[BUTTON_COUNT];
+  int activeLevel;
+
+  // Written by the interrupts (head) and read by update() (tail), no lock needed with a single producer and a single consumer
+  Edge edges[BUTTON_EDGE_QUEUE_SIZE];
+  volatile uint8_t edgeHead;
+  volatile uint8_t edgeTail;
+
+  ButtonEvent events[BUTTON_EVENT_QUEUE_SIZE];
+  uint8_t eventHead;
+  uint8_t eventTail;
+
+  static void onChange(void* arg);  // Interrupt of a button, arg is its Button
+  void recordEdge(uint8_t button);
+  void applyEdge(Button& button, bool down, unsigned long time);
+  void pushEvent(uint8_t button, uint8_t type);
+};
+
+#endif
@@ -0,0 +1,82 @@
+/*
+  FrameGovernor.cpp - Frame pacing and adaptive quality for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "FrameGovernor.h"
+
+FrameGovernor::FrameGovernor() {
+  period = 0;
+  adaptive = false;
+  frameStart = 0;
+  deadline = 0;
+  started = false;
+  cost = 0;
+  level = QUALITY_FULL;
+  lateFrames = 0;
+  fastFrames = 0;
+}
+
+void FrameGovernor::setTarget(uint8_t fps, bool adaptiveQuality) {
+  period = fps > 0 ? 1000000UL / fps : 0;
+  adaptive = adaptiveQuality && fps > 0;
+  deadline = micros();
+  if (!adaptive) {
+    level = QUALITY_FULL;
+  }
+  lateFrames = 0;
+  fastFrames = 0;
+}
+
+bool FrameGovernor::active() const {
+  return period > 0;
+}
+
+uint32_t FrameGovernor::idleTime(uint32_t now) const {
+  if (period == 0 || (int32_t)(now - deadline) >= 0) return 0;
+  return deadline - now;
+}
+
+void FrameGovernor::beginFrame(uint32_t now) {
+  frameStart = now;
+  started = true;
+  if (period == 0) return;
+  // The next frame is one period after the one due now. A frame late by more than a period moves the schedule instead
+  // of trying to catch up with a burst of frames
+  deadline = (int32_t)(now - deadline) > (int32_t)period ? now + period : deadline + period;
+}
+
+void FrameGovernor::endFrame(uint32_t now) {
+  if (!started) return;  // drawCanvasOnTFT() without loop()
+  started = false;
+  uint32_t frame = now - frameStart;
+  cost = cost == 0 ? frame : (cost * 7 + frame) / 8;
+  if (!adaptive) return;
+
+  if (frame > period) {
+    fastFrames = 0;
+    if (++lateFrames >= GOVERNOR_LATE_FRAMES && level < QUALITY_LEVELS - 1) {
+      level++;
+      lateFrames = 0;
+    }
+  } else if (frame < period / 2) {
+    lateFrames = 0;
+    if (++fastFrames >= GOVERNOR_FAST_FRAMES && level > QUALITY_FULL) {
+      level--;
+      fastFrames = 0;
+    }
+  } else {
+    lateFrames = 0;
+    fastFrames = 0;
+  }
+}
+
+uint8_t FrameGovernor::quality() const {
+  return level;
+}
+
+uint32_t FrameGovernor::frameCost() const {
+  return cost;
+}
@@ -0,0 +1,52 @@
+/*
+  FrameGovernor.h - Frame pacing and adaptive quality for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#ifndef FrameGovernor_h
+#define FrameGovernor_h
+
+#include "Arduino.h"
+
+#define GOVERNOR_LATE_FRAMES 4   // Frames over their budget in a row before the quality is lowered
+#define GOVERNOR_FAST_FRAMES 60  // Frames under half their budget in a row before the quality is raised again
+
+enum Quality {  // Levels of quality, each one keeps the savings of the previous ones
+  QUALITY_FULL,
+  QUALITY_FAST_SHAPES,  // Integer shapes instead of the anti-aliased ones, as setFastRendering(true)
+  QUALITY_SLOW_SCROLL,  // The texts scroll by 2 pixels every 2 steps, a frame out of 2 less
+  QUALITY_DIRTY_RECTS,  // Only the changed regions are pushed, as setDirtyRectMode(true)
+  QUALITY_LEVELS
+};
+
+// Starts a frame every 1 / fps second and lowers the quality while the frames take longer than that
+class FrameGovernor {
+public:
+  FrameGovernor();
+
+  // 0 to stop pacing the frames, adaptive to change the quality with the cost of the frames
+  void setTarget(uint8_t fps, bool adaptive);
+  bool active() const;
+  // The times are in microseconds (micros())
+  // Time until the next frame is due, 0 if it is (or without a target)
+  uint32_t idleTime(uint32_t now) const;
+  // Record the start and the end of a frame
+  void beginFrame(uint32_t now);
+  void endFrame(uint32_t now);
+
+  uint8_t quality() const;
+  uint32_t frameCost() const;  // Average cost of the last frames, in microseconds
+private:
+  uint32_t period;       // Microseconds between two frames, 0 without a target
+  bool adaptive;
+  uint32_t frameStart;
+  uint32_t deadline;     // Start of the next frame
+  bool started;          // beginFrame() was called since the last endFrame()
+  uint32_t cost;         // Moving average
+  uint8_t level;         // Quality
+  uint8_t lateFrames;
+  uint8_t fastFrames;
+};
+
+#endif
@@ -0,0 +1,123 @@
+/*
+  FrameProfiler.cpp - Timing of the phases of a frame for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "FrameProfiler.h"
+
+FrameProfiler::FrameProfiler() {
+  activeScope = NULL;
+  reset();
+}
+
+void FrameProfiler::beginFrame() {
+  if (inFrame) {
+    endFrame();  // drawCanvasOnTFT() wasn't called, the frame ends with the next one
+  }
+  for (uint8_t i = 0; i < PROFILE_PHASES; i++) {
+    current[i] = 0;
+  }
+  frameStart = micros();
+  inFrame = true;
+}
+
+void FrameProfiler::endFrame() {
+  if (!inFrame) return;
+  uint32_t now = micros();
+  current[PROFILE_FRAME] = now - frameStart;
+  current[PROFILE_INTERVAL] = lastFrameEnd != 0 ? now - lastFrameEnd : current[PROFILE_FRAME];
+  lastFrameEnd = now;
+  inFrame = false;
+
+  for (uint8_t i = 0; i < PROFILE_PHASES; i++) {
+    history[next][i] = current[i];
+  }
+  next = (next + 1) % PROFILE_HISTORY;
+  if (count < PROFILE_HISTORY) count++;
+}
+
+void FrameProfiler::add(uint8_t phase, uint32_t us) {
+  if (phase < PROFILE_PHASES) {
+    current[phase] += us;
+  }
+}
+
+bool FrameProfiler::stats(uint8_t phase, ProfileStats& out) const {
+  if (count == 0 || phase >= PROFILE_PHASES) return false;
+  uint32_t total = 0;
+  out.min = UINT32_MAX;
+  out.max = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    uint32_t time = history[i][phase];
+    total += time;
+    if (time < out.min) out.min = time;
+    if (time > out.max) out.max = time;
+  }
+  out.avg = total / count;
+  return true;
+}
+
+uint8_t FrameProfiler::frames() const {
+  return count;
+}
+
+void FrameProfiler::reset() {
+  for (uint8_t i = 0; i < PROFILE_PHASES; i++) {
+    current[i] = 0;
+  }
+  next = 0;
+  count = 0;
+  frameStart = 0;
+  lastFrameEnd = 0;
+  inFrame = false;
+}
+
+void FrameProfiler::print(Print& out) const {
+  out.print("Frame profile (us, last ");
+  out.print(count);
+  out.println(" frames): min avg max");
+  for (uint8_t i = 0; i < PROFILE_PHASES; i++) {
+    ProfileStats s;
+    if (!stats(i, s)) break;
+    out.print(phaseName(i));
+    out.print(": ");
+    out.print(s.min);
+    out.print(" ");
+    out.print(s.avg);
+    out.print(" ");
+    out.println(s.max);
+  }
+}
+
+const char* FrameProfiler::phaseName(uint8_t phase) {
+  switch (phase) {
+    case PROFILE_INPUT: return "Input";
+    case PROFILE_MENU: return "Menu";
+    case PROFILE_TEXT: return "Text";
+    case PROFILE_BLIT: return "Blit";
+    case PROFILE_PUSH: return "Push";
+    case PROFILE_FRAME: return "Frame";
+    case PROFILE_INTERVAL: return "Interval";
+    default: return "?";
+  }
+}
+
+ProfileScope::ProfileScope(FrameProfiler& owner, uint8_t timedPhase)
+  : profiler(owner) {
+  phase = timedPhase;
+  nested = 0;
+  parent = profiler.activeScope;
+  profiler.activeScope = this;
+  start = micros();
+}
+
+ProfileScope::~ProfileScope() {
+  uint32_t elapsed = micros() - start;
+  profiler.add(phase, elapsed - nested);
+  if (parent != NULL) {
+    parent->nested += elapsed;
+  }
+  profiler.activeScope = parent;
+}
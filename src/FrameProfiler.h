@@ -0,0 +1,81 @@
+/*
+  FrameProfiler.h - Timing of the phases of a frame for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#ifndef FrameProfiler_h
+#define FrameProfiler_h
+
+#include "Arduino.h"
+
+// Uncomment (or add -DOPENMENUOS_PROFILE to the build flags) to time the phases of every frame, see getProfileStats()
+// #define OPENMENUOS_PROFILE
+
+#define PROFILE_HISTORY 32  // Number of frames the min/avg/max are computed over
+
+enum ProfilePhase {
+  PROFILE_INPUT,     // Buttons and settings store, in loop() and checkForButtonPress()
+  PROFILE_MENU,      // Building the menus: items, layout, scene keys and shapes
+  PROFILE_TEXT,      // Rendering the texts into their cached masks and strips
+  PROFILE_BLIT,      // Drawing the masks, icons and backgrounds into the canvas
+  PROFILE_PUSH,      // Sending the canvas to the display in drawCanvasOnTFT()
+  PROFILE_FRAME,     // From loop() to the end of drawCanvasOnTFT(), the sketch included
+  PROFILE_INTERVAL,  // From a frame to the next, the time between the frames included
+  PROFILE_PHASES
+};
+
+struct ProfileStats {
+  uint32_t min;  // Microseconds
+  uint32_t avg;
+  uint32_t max;
+};
+
+class ProfileScope;
+
+// Keeps the time of each phase for the last PROFILE_HISTORY frames. The phases don't overlap: the time of a phase
+// started inside another one only counts for the inner one
+class FrameProfiler {
+public:
+  FrameProfiler();
+
+  void beginFrame();
+  void endFrame();
+  // Add time to a phase of the current frame
+  void add(uint8_t phase, uint32_t us);
+
+  // Returns false if no frame was recorded yet
+  bool stats(uint8_t phase, ProfileStats& out) const;
+  uint8_t frames() const;
+  void reset();
+  // One line per phase, "name min avg max"
+  void print(Print& out) const;
+
+  static const char* phaseName(uint8_t phase);
+private:
+  friend class ProfileScope;
+
+  uint32_t current[PROFILE_PHASES];
+  uint32_t history[PROFILE_HISTORY][PROFILE_PHASES];
+  uint8_t next;   // Row of history written by the next endFrame()
+  uint8_t count;  // Rows of history in use
+  uint32_t frameStart;
+  uint32_t lastFrameEnd;
+  bool inFrame;
+  ProfileScope* activeScope;  // Innermost scope timing this profiler, each profiler (and menu) has its own chain
+};
+
+// Times the block it is declared in
+class ProfileScope {
+public:
+  ProfileScope(FrameProfiler& profiler, uint8_t phase);
+  ~ProfileScope();
+private:
+  FrameProfiler& profiler;
+  uint8_t phase;
+  uint32_t start;
+  uint32_t nested;  // Time of the scopes inside this one
+  ProfileScope* parent;
+};
+
+#endif
@@ -0,0 +1,179 @@
+/*
+  ImageAsset.cpp - Compressed images for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "ImageAsset.h"
+
+// The assets can be in PROGMEM, read them a byte at a time
+static uint16_t readPixel(const uint8_t* data) {
+  return pgm_read_byte(data) | (pgm_read_byte(data + 1) << 8);
+}
+
+bool isImageAsset(const uint8_t* data) {
+  if (data == NULL || pgm_read_byte(data) != 'O' || pgm_read_byte(data + 1) != 'M') return false;
+  uint8_t format = pgm_read_byte(data + 2);
+  uint8_t bits = pgm_read_byte(data + 3);
+  if (format == IMAGE_FORMAT_RLE) return bits == 16;
+  if (format == IMAGE_FORMAT_PALETTE) return bits == 1 || bits == 2 || bits == 4 || bits == 8;
+  return false;
+}
+
+bool getImageSize(const uint8_t* data, uint16_t& w, uint16_t& h) {
+  if (!isImageAsset(data)) return false;
+  w = readPixel(data + 4);
+  h = readPixel(data + 6);
+  return true;
+}
+
+bool ImageDecoder::begin(const uint8_t* asset) {
+  if (!getImageSize(asset, w, h)) return false;
+  format = pgm_read_byte(asset + 2);
+  bits = pgm_read_byte(asset + 3);
+  data = asset + IMAGE_HEADER_SIZE;
+  palette = NULL;
+  if (format == IMAGE_FORMAT_PALETTE) {
+    palette = data;
+    data += (1 << bits) * 2;
+  }
+  column = 0;
+  runLength = 0;
+  runRepeat = false;
+  runColor = 0;
+  indexByte = 0;
+  indexBits = 0;
+  return true;
+}
+
+uint16_t ImageDecoder::width() const {
+  return w;
+}
+
+uint16_t ImageDecoder::height() const {
+  return h;
+}
+
+void ImageDecoder::read(uint16_t* pixels, uint16_t count) {
+  if (format == IMAGE_FORMAT_RLE) {
+    while (count > 0) {
+      if (runLength == 0) {
+        uint8_t packet = pgm_read_byte(data++);
+        runRepeat = packet & 0x80;
+        runLength = (packet & 0x7F) + 1;
+        if (runRepeat) {
+          runColor = readPixel(data);
+          data += 2;
+        }
+      }
+      uint8_t n = count < runLength ? count : runLength;
+      runLength -= n;
+      count -= n;
+      if (runRepeat) {
+        while (n--) *pixels++ = runColor;
+      } else {
+        while (n--) {
+          *pixels++ = readPixel(data);
+          data += 2;
+        }
+      }
+    }
+    return;
+  }
+
+  uint8_t mask = (1 << bits) - 1;
+  while (count--) {
+    if (indexBits == 0) {
+      indexByte = pgm_read_byte(data++);
+      indexBits = 8;
+    }
+    indexBits -= bits;
+    *pixels++ = readPixel(palette + ((indexByte >> indexBits) & mask) * 2);
+    if (++column == w) {
+      column = 0;
+      indexBits = 0;  // The next row starts on a new byte
+    }
+  }
+}
+
+// Same for the TFT and a sprite, their pushImage() aren't virtual
+template <typename Target>
+static void drawImageOn(Target& target, int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t* data) {
+  ImageDecoder decoder;
+  if (!decoder.begin(data)) {
+    target.pushImage(x, y, w, h, (uint16_t*)data);
+    return;
+  }
+
+  // Decode a part of a row at a time and push it right away, the image is never decoded as a whole
+  uint16_t pixels[IMAGE_DECODE_PIXELS];
+  for (int32_t row = 0; row < decoder.height(); row++) {
+    for (int32_t column = 0; column < decoder.width(); column += IMAGE_DECODE_PIXELS) {
+      uint16_t n = min((int32_t)IMAGE_DECODE_PIXELS, decoder.width() - column);
+      decoder.read(pixels, n);
+      target.pushImage(x + column, y + row, n, 1, pixels);
+    }
+  }
+}
+
+void drawImage(TFT_eSPI& tft, int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t* data) {
+  drawImageOn(tft, x, y, w, h, data);
+}
+
+void drawImage(TFT_eSprite& sprite, int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t* data) {
+  drawImageOn(sprite, x, y, w, h, data);
+}
+
+void streamImage(TFT_eSPI& tft, int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t* data, bool dma) {
+  ImageDecoder decoder;
+  bool compressed = decoder.begin(data);
+  if (compressed) {
+    w = decoder.width();
+    h = decoder.height();
+  }
+  if (w <= 0 || h <= 0 || x < 0 || y < 0 || x + w > tft.width() || y + h > tft.height()) {
+    drawImage(tft, x, y, w, h, data);  // The window can't be clipped
+    return;
+  }
+
+  uint16_t stackPixels[IMAGE_STREAM_PIXELS];
+  uint16_t* pixels = stackPixels;
+#ifdef ESP32
+  static uint16_t dmaPixels[2][IMAGE_STREAM_PIXELS];  // Still read by the transfer after returning
+  uint8_t dmaBuffer = 0;
+#else
+  dma = false;
+#endif
+  tft.startWrite();
+  tft.setAddrWindow(x, y, w, h);
+  uint32_t left = (uint32_t)w * h;
+  while (left > 0) {
+    uint16_t n = min(left, (uint32_t)IMAGE_STREAM_PIXELS);
+#ifdef ESP32
+    if (dma) {
+      pixels = dmaPixels[dmaBuffer];
+      dmaBuffer ^= 1;
+    }
+#endif
+    if (compressed) {
+      decoder.read(pixels, n);
+    } else {
+      for (uint16_t i = 0; i < n; i++, data += 2) {
+        pixels[i] = readPixel(data);
+      }
+    }
+#ifdef ESP32
+    if (dma) {
+      tft.pushPixelsDMA(pixels, n);  // Waits for the previous part, which was sent while this one was decoded
+      left -= n;
+      continue;
+    }
+#endif
+    tft.pushPixels(pixels, n);
+    left -= n;
+  }
+  if (!dma) {
+    tft.endWrite();  // With DMA the display stays selected until the transfer is over
+  }
+}
@@ -0,0 +1,61 @@
+/*
+  ImageAsset.h - Compressed images for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#ifndef ImageAsset_h
+#define ImageAsset_h
+
+#include "Arduino.h"
+#include <TFT_eSPI.h>
+
+// An asset starts with an 8 bytes header, written by extras/image_converter.py:
+//   'O', 'M', format, bits per pixel, width (2 bytes), height (2 bytes), little endian
+// IMAGE_FORMAT_RLE: packets of a count byte, if its high bit is set (count & 0x7F) + 1 times the next pixel,
+//   else count + 1 pixels. A packet can go over the end of a row
+// IMAGE_FORMAT_PALETTE: (1 << bits per pixel) colours, then the indices, high bits first, each row starting on a byte
+// The pixels and colours are 16 bits RGB565, in the same byte order as the raw arrays given to pushImage()
+#define IMAGE_HEADER_SIZE 8
+#define IMAGE_FORMAT_RLE 1
+#define IMAGE_FORMAT_PALETTE 2
+#define IMAGE_DECODE_PIXELS 64  // Pixels decoded at a time on the stack (128 bytes)
+#define IMAGE_STREAM_PIXELS 256  // Pixels sent at a time by streamImage(), twice with DMA (1 KB)
+
+class ImageDecoder {
+public:
+  // Returns false if data isn't a compressed asset
+  bool begin(const uint8_t* data);
+  uint16_t width() const;
+  uint16_t height() const;
+  // Decode the next count pixels, going to the next row after the last pixel of a row
+  void read(uint16_t* pixels, uint16_t count);
+private:
+  const uint8_t* data;     // Next byte to read
+  const uint8_t* palette;  // Colours of a palette asset
+  uint8_t format;
+  uint8_t bits;
+  uint16_t w;
+  uint16_t h;
+  uint16_t column;         // Position in the row, to skip the padding of a palette asset
+  uint8_t runLength;       // Pixels left in the current RLE packet
+  bool runRepeat;
+  uint16_t runColor;
+  uint8_t indexByte;       // Palette byte being read
+  uint8_t indexBits;       // Bits of indexByte not read yet
+};
+
+// Check if data is a compressed asset, and get its size
+bool isImageAsset(const uint8_t* data);
+bool getImageSize(const uint8_t* data, uint16_t& w, uint16_t& h);
+
+// Draw a compressed asset at x, y, decoding it row by row into the target. Anything else is drawn as a raw
+// RGB565 image of w x h with pushImage(), w and h are not used by the compressed assets which have their own size
+void drawImage(TFT_eSPI& tft, int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t* data);
+void drawImage(TFT_eSprite& sprite, int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t* data);
+// Same on the display, with its window set once and the pixels sent as they are decoded. With dma (ESP32, after
+// initDMA()), a part is sent while the next one is decoded and the last one may still be sent when it returns: call
+// dmaWait() before drawing on the display without DMA. An image going over the edges is drawn with drawImage()
+void streamImage(TFT_eSPI& tft, int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t* data, bool dma = false);
+
+#endif
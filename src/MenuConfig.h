@@ -0,0 +1,20 @@
+/*
+  MenuConfig.h - Build options of OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+
+  Each option fixes a part of the style when the library is built. The setter of a fixed option does nothing, and the
+  compiler drops the code of the styles that can't be used, with the fonts only they need. Uncomment them here, or
+  add them to the build flags (-DOPENMENUOS_MENU_STYLE=0).
+*/
+
+#ifndef MenuConfig_h
+#define MenuConfig_h
+
+// #define OPENMENUOS_MENU_STYLE 0         // Only this style, 0 (Default) or 1 (Modern), see setMenuStyle()
+// #define OPENMENUOS_SCROLLBAR_STYLE 0    // Only this scrollbar, 0 (dotted track) or 1 (rounded handle), see setScrollbarStyle()
+// #define OPENMENUOS_NO_SCROLLBAR         // Never a scrollbar, see setScrollbar()
+// #define OPENMENUOS_NO_TEXT_SCROLL       // Long items are truncated, see setTextScroll()
+// #define OPENMENUOS_NO_BUTTON_ANIMATION  // The selection isn't pushed in while select is down, see setButtonAnimation()
+
+#endif
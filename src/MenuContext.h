@@ -0,0 +1,353 @@
+/*
+  MenuContext.h - State of a menu for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+
+  Everything a menu keeps between two frames: its display and canvas, its buttons, its caches and what it drew last.
+  Each OpenMenuOS has its own, so several menus can run on several displays, even on different cores of an ESP32.
+*/
+
+#ifndef MenuContext_h
+#define MenuContext_h
+
+#include "Arduino.h"
+#include <TFT_eSPI.h>
+#include "ButtonInput.h"
+#include "Tween.h"
+#include "StringArena.h"
+#include "SettingsStore.h"
+#include "FrameProfiler.h"
+#include "FrameGovernor.h"
+#include "MenuConfig.h"
+#include "PopupQueue.h"
+#include "ScreenMirror.h"
+
+#define MAX_SETTINGS_ITEMS 10  // Maximum number of settings items
+#define MAX_DIRTY_RECTS 8      // Maximum number of separate regions pushed per frame in dirty rectangle mode
+#define MAX_TEXT_SCROLLERS 3   // Maximum number of texts scrolling at the same time (each one keeps its own cached strip)
+#define MAX_LABEL_MASKS 8      // Maximum number of labels kept pre-rendered (the least recently used one is replaced)
+#define TILE_ROUND_RADIUS 5    // Radius of the corners of the tiles
+#define MAX_TILE_COLORS 4      // Maximum number of tile colours with their corners kept pre-rendered
+#define MAX_LIST_ROWS 9        // Maximum number of rows shown by the list view
+#define MAX_TREE_DEPTH 8       // Maximum number of levels of a menu tree, the root included
+#define POPUP_MARGIN 3         // Space between the edges of the screen and a popup
+#define POPUP_HEADER_PERCENT 30  // Height of the coloured header of a popup
+#define POPUP_RADIUS 5         // Radius of the corners of a popup
+#define TOAST_PADDING 6        // Space around the text of a toast
+#define SPRITE_WIDTH_STEP 16   // The cached sprites grow in steps of 16 pixels, a slightly longer text reuses the buffer
+#define STATIC_STRIP_SCREENS 3  // With setStaticSprites(true), a scrolling text up to 3 screens wide is cached, a longer one is printed
+
+struct TileItem;
+struct MenuNode;
+
+enum View {  // What was drawn during the last frame, decides what the buttons do on screen 1
+  VIEW_NONE,
+  VIEW_MENU,
+  VIEW_SUBMENU,
+  VIEW_SETTINGS,
+  VIEW_TILE_MENU,
+  VIEW_POPUP
+};
+
+enum Scene {  // The renderers that report damage, each one keeps the key of what it drew last
+  SCENE_MENU,
+  SCENE_SUBMENU,
+  SCENE_SETTINGS,
+  SCENE_TILE_MENU,
+  SCENE_POPUP,
+  SCENE_OVERLAY,  // The popups and toasts queued with showPopup() and showToast()
+  SCENE_COUNT
+};
+
+struct TextScroller {  // A scrolling text, the whole text is rendered once into a 1 bit strip and only the visible window is drawn each frame
+  TextScroller()
+    : strip(NULL) {}  // Given the display by the MenuContext constructor, see attachSprite()
+  TFT_eSprite strip;
+  uint32_t textKey = 0;  // Hash of the text and size rendered in the strip
+  int16_t x = 0;         // Position of the window, identifies the scroller
+  int16_t y = 0;
+  int16_t offset = 0;     // Position of the text relative to the left of the window
+  int16_t textWidth = 0;  // Width of the text in pixels
+  int16_t ascent = 0;     // Height of the text above the baseline
+  int16_t height = 0;     // Height of the strip
+  unsigned long lastStep = 0;
+  unsigned long lastUsed = 0;
+  uint32_t lastFrame = 0;  // Value of frameCount when the scroller was last drawn
+  bool inUse = false;
+  bool ready = false;  // The strip holds the text, false if there wasn't enough memory
+};
+
+struct LabelMask {  // A label rendered once into a 1 bit mask, drawn in any colour afterwards
+  LabelMask()
+    : mask(NULL) {}  // Given the display by the MenuContext constructor, see attachSprite()
+  TFT_eSprite mask;
+  uint32_t key = 0;       // Hash of the text (after truncation) and the font rendered in the mask
+  int16_t ascent = 0;     // Height of the mask above the baseline
+  int16_t width = 0;      // Width of the label, the mask can be wider
+  uint32_t lastUsed = 0;  // Value of labelClock when the label was last drawn
+  bool inUse = false;
+  bool ready = false;  // The mask holds the label, false if there wasn't enough memory
+};
+
+struct ListRow {  // A row of the list view (icon and label) rendered once, copied to its position while it stays on the screen
+  ListRow()
+    : sprite(NULL) {}  // Given the display by the MenuContext constructor, see attachSprite()
+  TFT_eSprite sprite;
+  uint32_t key = 0;       // Hash of the label (after truncation) and the icon rendered in the sprite
+  uint32_t lastUsed = 0;  // Value of listClock when the row was last drawn
+  bool inUse = false;
+  bool ready = false;  // The sprite holds the row, false if there wasn't enough memory
+};
+
+struct PopupBox {  // A popup box or a toast rendered once, copied over the screen while it is shown. Kept for the next one
+  PopupBox()
+    : sprite(NULL) {}  // Given the display by the MenuContext constructor, see attachSprite()
+  TFT_eSprite sprite;
+  uint32_t key = 0;  // Hash of the type, the size and the style of a box, of the message of a toast
+};
+
+struct DirtyRect {
+  int16_t x, y, w, h;
+};
+
+struct SceneAnimation {  // The transitions of a renderer
+  Tween selection;       // Offset of the selection rectangle from the middle row, it slides to the newly selected item
+  Tween scrollbar;       // Y position of the scrollbar handle
+  int previous = -1;     // Items shown when the renderer last ran
+  int selected = -1;
+  int next = -1;
+};
+
+struct TileCorner {  // Top left corner of a tile, rendered once per colour with its anti-aliasing, the other corners are its mirror images
+  uint16_t color = 0;
+  uint16_t pixels[TILE_ROUND_RADIUS * TILE_ROUND_RADIUS];
+  uint32_t lastUsed = 0;
+  bool ready = false;
+};
+
+// Layout of the list renderers (menu, submenu and settings), computed by updateLayout() from the size of the display,
+// the font and the style, so the renderers don't hold any pixel position
+enum LayoutRow {
+  ROW_PREVIOUS,
+  ROW_SELECTED,
+  ROW_NEXT,
+  ROW_COUNT
+};
+struct Layout {
+  int16_t rowHeight;            // Height of the selection rectangle
+  int16_t rowPitch;             // Distance between the tops of two rows
+  int16_t rowTop[ROW_COUNT];    // The selected row is centered vertically
+  int16_t baseline[ROW_COUNT];  // Text centered in its row
+  int16_t iconX;
+  int16_t iconY[ROW_COUNT];
+  int16_t selectionWidth;       // Width left by the scrollbar
+  int16_t textX;                // Text next to an icon
+  int16_t textXNoIcon;
+  int16_t scrollWindow;         // Width available to the text, up to the right margin
+  int16_t scrollWindowNoIcon;
+  uint8_t maxLength;            // Characters fitting in the window before the text is truncated or scrolls
+  uint8_t maxLengthNoIcon;
+  int16_t settingsTextX;
+  int16_t settingsScrollWindow;  // Up to the toggle switch
+  uint8_t settingsMaxLength;
+  int16_t toggleX;
+  int16_t toggleY[ROW_COUNT];
+  int8_t listAbove;  // Rows of the list view above and below the selected one
+  int8_t listBelow;
+};
+
+struct MenuContext {
+  // Draws on display through sprite, or through a canvas of its own if sprite is NULL
+  MenuContext(TFT_eSPI& display, TFT_eSprite* sprite);
+  ~MenuContext();
+  MenuContext(const MenuContext&) = delete;
+  MenuContext& operator=(const MenuContext&) = delete;
+
+  ////////////////// Display //////////////////
+  TFT_eSPI& tft;
+  TFT_eSprite& canvas;
+  bool ownsCanvas;
+  int tftWidth = 0;
+  int tftHeight = 0;
+  Layout layout = {};
+#ifdef OPENMENUOS_PROFILE
+  FrameProfiler profiler;
+#endif
+  bool fastStartup = false;          // Set by setFastStartup()
+  unsigned long startupTime = 0;     // Milliseconds spent in begin()
+  unsigned long firstFrameTime = 0;  // Value of millis() when the first frame was on the display, 0 before
+  uint32_t spiFrequency = 0;         // Set by setSPIFrequency(), 0 for the SPI_FREQUENCY of the TFT_eSPI setup
+  ScreenMirror mirror;       // Set by setMirror()
+  bool mirrorWhole = false;  // The frame sends the whole screen to the mirror
+  bool profileOverlay = false;
+  char profileOverlayText[24] = "";
+  unsigned long profileOverlayTime = 0;
+  ////////////////// Buttons //////////////////
+  ButtonInput buttons;
+  int buttonsMode = 0;  // Set by setButtonsMode()
+  int buttonVoltage = 0;
+  int upPin = BUTTON_NO_PIN;
+  int downPin = BUTTON_NO_PIN;
+  int selectPin = BUTTON_NO_PIN;
+  int backlightPin = 0;
+  uint8_t activeView = VIEW_NONE;
+  bool popupClicked = false;  // Select was pressed while a popup was shown
+  ////////////////// Popups //////////////////
+  PopupQueue popups;  // Shown over the screen by drawCanvasOnTFT()
+  PopupBox popupBox;  // Header, icon and title of the popup shown, the message scrolls over it
+  PopupBox toastBox;
+  ////////////////// Text scrolling and label cache //////////////////
+  TextScroller textScrollers[MAX_TEXT_SCROLLERS];
+  LabelMask labelMasks[MAX_LABEL_MASKS];
+  uint32_t labelClock = 0;
+  ListRow listRows[MAX_LIST_ROWS + 2];  // A row slides in on each side while the list scrolls. The least recently used row is recycled
+  uint32_t listClock = 0;
+  TFT_eSprite cornerTile;        // A tile made of only its corners, read by findTileCorner()
+  bool staticSprites = false;    // Set by setStaticSprites()
+  bool spritesReserved = false;  // The caches were reserved, they don't grow anymore
+  uint32_t allocationCount = 0;  // Sprite buffers created by the caches since begin()
+  ////////////////// Dirty rectangles //////////////////
+  bool dirtyRectMode = false;
+  DirtyRect dirtyRects[MAX_DIRTY_RECTS];  // Regions of the canvas changed since the last drawCanvasOnTFT()
+  uint8_t dirtyRectCount = 0;
+  bool fullRedrawPending = true;    // The first frame is always pushed entirely
+  bool sceneChanged = true;         // Set by beginScene(). Stays true outside of the renderers so standalone calls always report damage
+  uint32_t sceneKeys[SCENE_COUNT] = {};  // Key of the content drawn by each renderer during the last frame
+  uint8_t scenesDrawn = 0;          // Bitmask of the renderers that ran during the current frame
+  uint8_t scenesDrawnPrevious = 0;  // Bitmask of the renderers that ran during the previous frame
+  int lastPushedScreen = -1;
+  uint8_t scenesChanged = 0;        // Bitmask of the renderers whose content changed during the current frame
+  ////////////////// Banding and DMA //////////////////
+  int bandCount = 1;     // Number of horizontal bands the frame is drawn in, the canvas holds one band
+  int bandIndex = 0;     // Band being drawn
+  int bandHeight = 0;    // Height of a band (the last one can be shorter)
+  int bandTop = 0;       // Y position of the band being drawn on the screen
+  bool dmaMode = false;  // The canvas has two buffers, one is pushed with DMA while the other one is drawn (ESP32 only)
+  int dmaFrame = 1;      // Buffer of the canvas being drawn
+  bool dmaPushed = false;  // pushCanvas() started a transfer from the buffer being drawn
+  ////////////////// Redraw tracking //////////////////
+  bool redrawRequested = true;  // The first frame is always drawn
+  bool lightSleep = false;
+  bool animationPending = false;  // An animation needs a frame at animationDeadline
+  unsigned long animationDeadline = 0;
+  bool frameAnimationPending = false;  // Same, for the deadlines requested during the current frame
+  unsigned long frameAnimationDeadline = 0;
+  FrameGovernor governor;          // Set by setTargetFPS()
+  uint8_t quality = QUALITY_FULL;  // Lowered by the governor while the frames are late, taken at the start of a frame
+  ////////////////// Animations //////////////////
+  SceneAnimation sceneAnimations[SCENE_COUNT];
+  Tween toggleKnobs[MAX_SETTINGS_ITEMS];  // Position of the knob of each setting's toggle switch, 0 (off) to 1024 (on)
+  bool animations = true;
+  uint8_t currentScene = SCENE_COUNT;  // Renderer running, SCENE_COUNT outside of them
+  uint32_t frameCount = 0;             // Number of frames pushed
+  unsigned long frameTime = 0;         // Time of the frame being drawn, see frameNow()
+  bool frameTimeSet = false;
+  bool frameSkipped = false;  // loop() returned before the frame was due, drawCanvasOnTFT() pushes nothing
+  ////////////////// Tile menu //////////////////
+  int current_screen_tile_menu = 0;
+  int item_selected_tile_menu = 2;
+  int tile_menu_count = 0;            // Number of tiles of the last drawn tile menu
+  int tile_menu_columns = 1;          // Grid of the last drawn tile menu
+  int16_t tile_menu_width = 0;        // Size of a tile
+  int16_t tile_menu_height = 0;
+  int tile_menu_drawn_selected = -1;  // Tile shown selected by the last frame
+  Tween tileScroll;                   // Y position of the page of tiles shown, the pages slide in
+  TileCorner tileCorners[MAX_TILE_COLORS];
+  uint32_t tileClock = 0;  // Incremented every time a corner is used, the least recently used one is replaced
+  ////////////////// Selections //////////////////
+  int item_sel_previous = 0;  // Previous item - used in the menu screen to draw the item before the selected one
+  int item_selected = 0;      // Current item -  used in the menu screen to draw the selected item
+  int item_sel_next = 0;      // Next item - used in the menu screen to draw next item after the selected one
+  int item_sel_previous_submenu = 0;  // Previous item - used in the submenu screen to draw the item before the selected one
+  int item_selected_submenu = 0;      // Current item -  used in the submenu screen to draw the selected item
+  int item_sel_next_submenu = 0;      // Next item - used in the submenu screen to draw next item after the selected one
+  int item_selected_settings_previous = 0;  // Previous item - used in the menu screen to draw the item before the selected one
+  int item_selected_settings = 0;           // Current item -  used in the menu screen to draw the selected item
+  int item_selected_settings_next = 0;      // Next item - used in the menu screen to draw next item after the selected one
+  ////////////////// Style //////////////////
+  // The options fixed by MenuConfig.h are constants, the renderers' branches on them are resolved when building
+#ifdef OPENMENUOS_NO_TEXT_SCROLL
+  static const bool textScroll = false;
+#else
+  bool textScroll = true;
+#endif
+#ifdef OPENMENUOS_NO_BUTTON_ANIMATION
+  static const bool buttonAnimation = false;
+#else
+  bool buttonAnimation = true;
+#endif
+#ifdef OPENMENUOS_NO_SCROLLBAR
+  static const bool scrollbar = false;
+#else
+  bool scrollbar = true;
+#endif
+  bool bootImage = false;
+#ifdef OPENMENUOS_MENU_STYLE
+  static const int menuStyle = OPENMENUOS_MENU_STYLE;
+#else
+  int menuStyle = 0;
+#endif
+  uint16_t selectionBorderColor = TFT_WHITE;
+#ifdef OPENMENUOS_SCROLLBAR_STYLE
+  static const int scrollbarStyle = OPENMENUOS_SCROLLBAR_STYLE;
+#else
+  int scrollbarStyle = 0;
+#endif
+  uint16_t selectionFillColor = TFT_BLACK;
+  uint16_t scrollbarColor = TFT_WHITE;
+  bool fastRendering = false;  // Integer shapes instead of the anti-aliased ones
+  bool listView = false;       // Menus and submenus drawn by drawListItems()
+  int listVisibleRows = 0;     // Rows of the list view, 0 for as many as fit the display
+  ////////////////// Menu tree //////////////////
+  const MenuNode* menuTree = NULL;   // Nodes given to setMenuTree(), in flash
+  int menuTreeSize = 0;
+  int16_t treePath[MAX_TREE_DEPTH];  // Nodes from the root to the current one. The selection of a level is the next node of the path
+  uint8_t treeDepth = 0;
+  int treeSelected = 0;              // Child selected in the list of the current node
+  bool treeShown = false;            // drawMenuTree() ran during the last frame, the buttons navigate the tree
+  ////////////////// Settings //////////////////
+  SettingsStore settingsStore;  // The bools of the settings menu, followed by the values set with setSettingInt() and setSettingString()
+  uint8_t settingsId = 0;       // Given to settingsStore.begin()
+  int NUM_SETTINGS_ITEMS = 1;
+  StringArena menu_items_settings;  // Items given to drawSettingMenu() directly, after the backlight
+  uint16_t settings_items_generation = 0;
+
+  // Drawing helpers of the renderers, see OpenMenuOS.cpp
+  void drawIcon(int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t* data);
+  void applyBandViewport();
+  void createCanvas();
+  void pushCanvas(int x, int y, int w, int h);
+  void mirrorRegion(int x, int y, int w, int h);
+  void pollMirror();
+  void scheduleFrame(unsigned long time);
+  unsigned long frameNow();
+  bool animate(Tween& tween);
+  bool sceneWasDrawn(uint8_t scene) const;
+  bool animateSelection(uint8_t scene, int previous, int selected, int next, int16_t rowHeight);
+  bool animateToggle(int index, bool state);
+  TextScroller& findScroller(int16_t x, int16_t y);
+  void updateLayout();
+  void fillRounded(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color, uint32_t bg);
+  void fillRounded(TFT_eSprite& target, int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color, uint32_t bg);
+  void drawRounded(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color, uint32_t bg);
+  void fillDisc(int32_t x, int32_t y, int32_t r, uint32_t color, uint32_t bg);
+  void drawScrollbarTrack(int16_t x, uint16_t color);
+  uint16_t drawSelection(int16_t y, bool pressed);
+  TileCorner* findTileCorner(uint16_t color);
+  void drawTileBackground(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void drawTileContent(const TileItem& tile, int index, int16_t x, int16_t y, int16_t w, int16_t h, bool selected);
+  void tilePosition(int index, int16_t& x, int16_t& y) const;
+  bool regionDirty(int16_t x, int16_t y, int16_t w, int16_t h) const;
+  void drawStripWindow(TFT_eSprite& strip, int16_t x, int16_t y, int16_t srcX, int16_t w, uint16_t color);
+  void drawLabel(int16_t x, int16_t y, const char* text, const GFXfont* font, uint8_t maxLength, uint16_t color);
+  void drawListRow(int16_t y, const char* text, const uint8_t* icon, bool images);
+  void freeListRows();
+  bool fitSprite(TFT_eSprite& sprite, int16_t w, int16_t h, uint8_t depth);
+  void reserveSprites();
+  void drawPopupBox(TFT_eSprite& target, int16_t x, int16_t y, int16_t w, int16_t h, int type);
+  uint32_t hashStyle(uint32_t hash) const;
+  bool fastShapes() const;   // setFastRendering(), or forced by the governor
+  bool dirtyPushes() const;  // setDirtyRectMode(), or forced by the governor
+};
+
+#endif
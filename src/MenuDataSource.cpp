@@ -0,0 +1,74 @@
+/*
+  MenuDataSource.cpp - Items of a menu given on demand for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "MenuDataSource.h"
+
+MenuDataSource::MenuDataSource() {
+  clock = 0;
+  invalidate();
+}
+
+void MenuDataSource::invalidate() {
+  for (int i = 0; i < MENU_SOURCE_CACHE_SIZE; i++) {
+    entries[i].index = -1;
+    entries[i].ready = false;
+    entries[i].lastUsed = 0;
+  }
+}
+
+// The entry of an item, or NULL if it isn't kept and fetch is false. A new item takes the least recently used entry
+MenuDataSource::Entry* MenuDataSource::find(int index, bool fetch) {
+  Entry* oldest = &entries[0];
+  for (int i = 0; i < MENU_SOURCE_CACHE_SIZE; i++) {
+    Entry& entry = entries[i];
+    if (entry.index == index) {
+      if (!entry.ready) {
+        entry.ready = itemAt(index, entry.text, sizeof(entry.text));  // Still loading, ask again
+      }
+      return &entry;
+    }
+    if (entry.lastUsed < oldest->lastUsed) {
+      oldest = &entry;
+    }
+  }
+  if (!fetch) return NULL;
+
+  oldest->index = index;
+  oldest->text[0] = '\0';
+  oldest->ready = itemAt(index, oldest->text, sizeof(oldest->text));
+  return oldest;
+}
+
+const char* MenuDataSource::item(int index) {
+  Entry* entry = find(index, true);
+  entry->lastUsed = ++clock;
+  entry->text[MENU_SOURCE_ITEM_LENGTH - 1] = '\0';
+  return entry->ready ? entry->text : "...";
+}
+
+void MenuDataSource::prefetch(int selected, int count, int around) {
+  if (count <= 0) return;
+  around = min(around, (MENU_SOURCE_CACHE_SIZE - 1) / 2);  // The shown item stays in the cache
+  for (int i = 1; i <= around; i++) {
+    int before = ((selected - i) % count + count) % count;
+    int after = (selected + i) % count;
+    find(before, true)->lastUsed = ++clock;
+    find(after, true)->lastUsed = ++clock;
+  }
+}
+
+bool MenuDataSource::loading() {
+  bool waiting = false;
+  for (int i = 0; i < MENU_SOURCE_CACHE_SIZE; i++) {
+    Entry& entry = entries[i];
+    if (entry.index >= 0 && !entry.ready) {
+      entry.ready = itemAt(entry.index, entry.text, sizeof(entry.text));
+      waiting |= !entry.ready;
+    }
+  }
+  return waiting;
+}
@@ -0,0 +1,51 @@
+/*
+  MenuDataSource.h - Items of a menu given on demand for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#ifndef MenuDataSource_h
+#define MenuDataSource_h
+
+#include "Arduino.h"
+
+#define MENU_SOURCE_CACHE_SIZE 16    // Items kept, enough for the rows of the list view and the prefetched ones
+#define MENU_SOURCE_ITEM_LENGTH 48   // Longest text kept for an item, longer ones are cut
+#define MENU_SOURCE_PREFETCH 2       // Items fetched ahead on each side of the rows shown
+#define MENU_SOURCE_RETRY_TIME 50    // Milliseconds between two frames while items are still loading
+
+// The items of a large or changing list (scanned networks, files, logs...), given to addMenu(). Only the items on the
+// screen and a few around them are asked for and kept, the memory used doesn't depend on the number of items
+class MenuDataSource {
+public:
+  MenuDataSource();
+  virtual ~MenuDataSource() {}
+
+  // Number of items, asked for every frame the menu is drawn
+  virtual int count() = 0;
+  // Write the text of an item in buffer (size bytes). Return false if it isn't ready yet, the menu asks again later
+  virtual bool itemAt(int index, char* buffer, size_t size) = 0;
+
+  // Forget the items kept, call it when they changed (a new scan...)
+  void invalidate();
+
+  // Used by the menu: the text of an item, "..." while it is loading
+  const char* item(int index);
+  // Fetch the items around selected that aren't kept yet, the list wraps around
+  void prefetch(int selected, int count, int around);
+  // Ask again for the items kept that weren't ready, returns true if some still aren't
+  bool loading();
+private:
+  struct Entry {
+    int index;  // -1 for a free entry
+    bool ready;
+    uint32_t lastUsed;
+    char text[MENU_SOURCE_ITEM_LENGTH];
+  };
+  Entry* find(int index, bool fetch);
+
+  Entry entries[MENU_SOURCE_CACHE_SIZE];
+  uint32_t clock;
+};
+
+#endif
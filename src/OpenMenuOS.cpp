@@ -7,108 +7,41 @@
 #pragma message "The OpenMenuOS library is still in Beta. If you find any bug, please create an issue on the OpenMenuOS's Github repository"
 
 #include "Arduino.h"
+#include <new>
 #include <TFT_eSPI.h>
-#include <EEPROM.h>
 #include "OpenMenuOS.h"
+#include "SettingsStore.h"
+#ifdef ESP32
+#include "esp_sleep.h"
+#endif
 
 TFT_eSPI tft = TFT_eSPI();
 TFT_eSprite canvas = TFT_eSprite(&tft);
 
-#define SHORT_PRESS_TIME 300      // 300 milliseconds
-#define LONG_PRESS_TIME 1000      // 1000 milliseconds
-#define LONG_PRESS_TIME_MENU 500  // 500 milliseconds
+#ifdef OPENMENUOS_PROFILE
+#define PROFILE_SCOPE(phase) ProfileScope profileScope(profiler, phase)
+#else
+#define PROFILE_SCOPE(phase)
+#endif
+#define PROFILE_OVERLAY_TIME 500  // The overlay is updated every 500 milliseconds
 
-////////////////// Variables for button presses //////////////////
-unsigned long pressedTime = 0;
-unsigned long releasedTime = 0;
-bool isPressing = false;
-bool isLongDetected = false;
-
-bool PreviousButtonState = LOW;
-bool ButtonPressProcessed = false;
-int upButtonState;
-int downButtonState;
-////////////////// Variables for text scrolling //////////////////
-int CHAR_WIDTH;
-int CHAR_SPACING;
-unsigned long previousMillis1 = 0;
-unsigned long previousMillis2 = 0;
-uint16_t w, h;
-//////////////////////////////////////////////////////////////////
-
-// Display Constants
-int tftWidth;
-int tftHeight;
-
-// Tile menu variable
-int current_screen_tile_menu = 0;
-int item_selected_tile_menu = 2;
-int tile_menu_selection_X = 0;
-int tile_menu_selection_Y = 0;
-
-// Rectangle dimensions
-uint16_t rect_width = tftWidth - 5;  // Width of the selection rectangle
-uint16_t rect_height = 26;           // Height of the selection rectangle
-
-// Menu Item Positioning Variables
-int item_sel_previous;  // Previous item - used in the menu screen to draw the item before the selected one
-int item_selected;      // Current item -  used in the menu screen to draw the selected item
-int item_sel_next;      // Next item - used in the menu screen to draw next item after the selected one
-
-// Submenu Item Positioning Variables
-int item_sel_previous_submenu;  // Previous item - used in the submenu screen to draw the item before the selected one
-int item_selected_submenu;      // Current item -  used in the submenu screen to draw the selected item
-int item_sel_next_submenu;      // Next item - used in the submenu screen to draw next item after the selected one
-
-// Settings Item Positioning Variables
-int item_selected_settings_previous;  // Previous item - used in the menu screen to draw the item before the selected one
-int item_selected_settings = 0;       // Current item -  used in the menu screen to draw the selected item
-int item_selected_settings_next;      // Next item - used in the menu screen to draw next item after the selected one
-
-// Button Press Timing and Control
-unsigned long select_button_press_time = 0;
-int button_up_clicked = 0;  // Only perform action when the button is clicked, and wait until another press
-int button_up_clicked_tile = 0;
-int button_up_clicked_settings = 0;  // Only perform action when the button is clicked, and wait until another press
-int button_down_clicked = 0;         // Only perform action when the button is clicked, and wait until another press
-int button_down_clicked_tile = 0;
-int button_down_clicked_settings = 0;  // Only perform action when the button is clicked, and wait until another press
-int button_select_clicked = 0;
-bool previousButtonState = LOW;
-bool buttonPressProcessed = false;
-bool long_press_handled = false;  // Flag to track if long press action has been handled
-
-
-bool textScroll = true;
-bool buttonAnimation = true;
-bool scrollbar = true;
-bool bootImage = false;
-int menuStyle = 0;
-uint16_t selectionBorderColor = TFT_WHITE;
-int scrollbarStyle = 0;
-uint16_t selectionFillColor = TFT_BLACK;
-uint16_t scrollbarColor = TFT_WHITE;
-
-// Button Pin Definitions
-int buttonsMode;
-int buttonVoltage;
-int BUTTON_UP_PIN;      // Pin for UP button
-int BUTTON_DOWN_PIN;    // Pin for DOWN button
-int BUTTON_SELECT_PIN;  // Pin for SELECT button
-int TFT_BL_PIN;         // Pin for TFT Backlight
+#define LONG_PRESS_TIME_MENU 500  // 500 milliseconds
+#define REPEAT_TIME_MENU 200      // 200 milliseconds
+#define SELECTION_ANIMATION_TIME 120  // 120 milliseconds for the selection to slide to the next item
+#define SCROLLBAR_ANIMATION_TIME 120  // 120 milliseconds for the scrollbar handle
+#define TOGGLE_ANIMATION_TIME 150     // 150 milliseconds for the knob of a toggle switch
+#define ICON_SIZE 16                  // Size of the menu icons
+#define MAX_LIST_ITEMS 1000           // Most items drawMenu() and drawSubmenu() take, more can be given by a provider with addMenu()
+#define SCROLLBAR_MIN_HANDLE 4        // Smallest height of the scrollbar handle, for the long menus
+#define TOGGLE_WIDTH 40               // Size of the toggle switches
+#define TOGGLE_HEIGHT 20
+#define TILE_MARGIN 2                 // Space around the tiles
+#define PAGE_ANIMATION_TIME 200       // 200 milliseconds for a page of tiles to slide in
 
 // Button Constants
 #define SELECT_BUTTON_LONG_PRESS_DURATION 300
 
-#define EEPROM_SIZE (MAX_SETTINGS_ITEMS * sizeof(bool) + (32 + 1) + (64 + 1) + (32 + 1) + (64 + 1))  // Possibly change the "MAX_SETTINGS_ITEMS" to the value of NUM_SETTINGS_ITEMS if setting array made before eeprom ; to also do in readFromEEPROM and saveToEEPROM
-int NUM_SETTINGS_ITEMS = 1;
-
-char menu_items_settings[MAX_SETTINGS_ITEMS][MAX_ITEM_LENGTH] = {
-  // array with item names
-  { "Backlight" },
-};
-
-bool OpenMenuOS::menu_items_settings_bool[MAX_SETTINGS_ITEMS] = {
+static const bool defaultSettings[MAX_SETTINGS_ITEMS] = {  // Settings of a menu until they are loaded
   true,
   false,
   true,
@@ -121,930 +54,1545 @@ bool OpenMenuOS::menu_items_settings_bool[MAX_SETTINGS_ITEMS] = {
   false,
 };
 
-OpenMenuOS::OpenMenuOS(int btn_up, int btn_down, int btn_sel, int tft_bl) {
-  BUTTON_UP_PIN = btn_up;
-  BUTTON_DOWN_PIN = btn_down;
-  BUTTON_SELECT_PIN = btn_sel;
-  TFT_BL_PIN = tft_bl;
-}
+#define FNV_OFFSET_BASIS 2166136261UL
+#define FNV_PRIME 16777619UL
 
-void OpenMenuOS::begin(int rotation) {  //  Display Rotation
-  // Set up display
-  tft.init();
-  tft.setRotation(rotation);
-
-  tftWidth = tft.width();
-  tftHeight = tft.height();
-
-  // Show The Boot image if bootImage is true
-  if (bootImage) {
-    tft.pushImage(0, 0, 160, 80, (uint16_t*)Boot_img);  // To remove as will not work correctly with other display size
+// Draw an icon or image into the canvas
+void MenuContext::drawIcon(int32_t x, int32_t y, int32_t w, int32_t h, const uint8_t* data) {
+  PROFILE_SCOPE(PROFILE_BLIT);
+  drawImage(canvas, x, y, w, h, data);
+}
+// A menu made of the items stored in an arena
+static MenuModel arenaMenu(const StringArena& arena, uint16_t generation) {
+  MenuModel menu = { -1, arena.items(), NULL, NULL, arena.count(), generation, NULL, NULL, NULL };
+  return menu;
+}
+// Text of an item of a menu, written in buffer (MAX_ITEM_LENGTH bytes) if the menu has a provider that needs it or is in flash
+static const char* itemText(const MenuModel& menu, int index, char* buffer) {
+  if (index < 0 || index >= menu.count) return "";
+  const char* text;
+  if (menu.entries != NULL) {
+    PGM_P label = (PGM_P)pgm_read_ptr(&menu.entries[index].label);
+    if (label == NULL) return "";
+    strncpy_P(buffer, label, MAX_ITEM_LENGTH - 1);
+    buffer[MAX_ITEM_LENGTH - 1] = '\0';
+    return buffer;
+  } else if (menu.nodes != NULL) {
+    PGM_P label = (PGM_P)pgm_read_ptr(&menu.nodes[index].label);
+    if (label == NULL) return "";
+    strncpy_P(buffer, label, MAX_ITEM_LENGTH - 1);
+    buffer[MAX_ITEM_LENGTH - 1] = '\0';
+    return buffer;
+  } else if (menu.provider != NULL) {
+    buffer[0] = '\0';
+    text = menu.provider(index, buffer, menu.context);
+    buffer[MAX_ITEM_LENGTH - 1] = '\0';
+  } else {
+    text = menu.items[index];
   }
+  return text != NULL ? text : "";
+}
+// Icon of an item: the one of its entry for a menu in flash, else the icon with the index of the item
+static const uint8_t* itemIcon(const MenuModel& menu, int index) {
+  int icon = index;
+  if (menu.entries != NULL) {
+    icon = index >= 0 && index < menu.count ? (int8_t)pgm_read_byte(&menu.entries[index].icon) : -1;
+  } else if (menu.nodes != NULL) {
+    icon = index >= 0 && index < menu.count ? (int8_t)pgm_read_byte(&menu.nodes[index].icon) : -1;
+  }
+  return icon >= 0 && icon < (int)bitmap_icons_size ? bitmap_icons[icon] : NULL;
+}
+// Items of a data source, through the provider of its menu
+static const char* sourceItem(int index, char* buffer, void* context) {
+  (void)buffer;
+  return ((MenuDataSource*)context)->item(index);
+}
+// Colour, title and icon of each type of popup
+struct PopupStyle {
+  uint16_t color;
+  const char* title;
+  const uint8_t* icon;
+  uint8_t iconW, iconH;
+};
+static const PopupStyle popupStyles[] = {
+  { 0xf2aa, "Warning!", Warning_icon, 21, 18 },
+  { 0x260f, "Success!", Success_icon, 13, 10 },
+  { 0x453e, "Info", Info_icon, 6, 14 },
+};
+static const PopupStyle& popupStyle(int type) {
+  return popupStyles[constrain(type, 1, 3) - 1];
+}
+// Fields of a node of a menu tree, which can be in flash
+static int16_t nodeWord(const int16_t& field) {
+  return (int16_t)pgm_read_word(&field);
+}
+static MenuNodeCallback nodeCallback(const MenuNodeCallback& field) {
+  return (MenuNodeCallback)pgm_read_ptr(&field);
+}
+// The settings menu starts with the backlight, followed by the items of the menu given as context
+static const char* settingsItem(int index, char* buffer, void* context) {
+  return index == 0 ? "Backlight" : itemText(*(const MenuModel*)context, index - 1, buffer);
+}
 
-  tft.setTextWrap(false);
-  canvas.setSwapBytes(true);
-  canvas.createSprite(tftWidth, tftWidth);
-  canvas.fillSprite(TFT_BLACK);
-
-  item_selected = 0;
-  current_screen = 0;  // 0 = Menu, 1 = Submenu
-
-  // Initialize EEPROM
-  EEPROM.begin(EEPROM_SIZE);
-
-  readFromEEPROM();
-
-  // Set TFT_BL_PIN as OUTPUT and se it HIGH or LOW depending on the settings
-  pinMode(TFT_BL_PIN, OUTPUT);
-  digitalWrite(TFT_BL_PIN, menu_items_settings_bool[0] ? LOW : HIGH);
+// Grow "a" so it also covers "b"
+static void unionRect(DirtyRect& a, const DirtyRect& b) {
+  int16_t x2 = max(a.x + a.w, b.x + b.w);
+  int16_t y2 = max(a.y + a.h, b.y + b.h);
+  a.x = min(a.x, b.x);
+  a.y = min(a.y, b.y);
+  a.w = x2 - a.x;
+  a.h = y2 - a.y;
+}
 
-  // Set up button pins
-  pinMode(BUTTON_UP_PIN, buttonsMode);
+// Make the canvas show the band being drawn: drawing at a screen position lands on the right row of the band
+void MenuContext::applyBandViewport() {
+  if (bandCount > 1) {
+    canvas.setViewport(0, -bandTop, tftWidth, tftHeight, true);
+  } else {
+    canvas.resetViewport();
+  }
+}
 
-  pinMode(BUTTON_DOWN_PIN, buttonsMode);
+// Create the canvas for the current band count, with two buffers in DMA mode
+void MenuContext::createCanvas() {
+  bandHeight = (tftHeight + bandCount - 1) / bandCount;
+#ifdef ESP32
+  if (dmaMode) {
+    tft.initDMA();  // Before creating the sprite, so its buffers are allocated in DMA capable memory
+    if (canvas.createSprite(tftWidth, bandHeight, 2)) {
+      dmaFrame = 1;
+      dmaPushed = false;
+      canvas.frameBuffer(dmaFrame);
+      tft.setSwapBytes(false);  // The sprite already holds the bytes in the order of the display
+      tft.startWrite();         // Keep the display selected, the DMA transfers continue after drawCanvasOnTFT() returns
+    } else {
+      dmaMode = false;  // Not enough memory for two buffers, use one
+    }
+  }
+#else
+  dmaMode = false;
+#endif
+  if (!canvas.created()) {
+    canvas.createSprite(tftWidth, bandHeight);
+  }
+  bandIndex = 0;
+  bandTop = 0;
+  applyBandViewport();
+}
 
-  pinMode(BUTTON_SELECT_PIN, buttonsMode);
+// Push rows of the band to the display, y is a position on the screen
+void MenuContext::pushCanvas(int x, int y, int w, int h) {
+#ifdef ESP32
+  if (dmaMode) {
+    // A DMA transfer needs contiguous pixels, so push full rows. This waits for the previous transfer
+    uint16_t* pixels = (uint16_t*)canvas.getPointer();
+    tft.pushImageDMA(0, y, tftWidth, h, pixels + (y - bandTop) * tftWidth);
+    dmaPushed = true;
+    return;
+  }
+#endif
+  canvas.pushSprite(x, y, x, y - bandTop, w, h);
 }
-void OpenMenuOS::loop() {
-  checkForButtonPress();
-  checkForButtonPressSubmenu();
-  canvas.fillSprite(TFT_BLACK);  // Set the background of the canvas/sprite to black instead of transparent
+// Send a region of the band to the mirror, as it is in the canvas
+void MenuContext::mirrorRegion(int x, int y, int w, int h) {
+  canvas.resetViewport();  // In the coordinates of the band
+  mirror.beginRegion(x, y, w, h);
+  for (int row = y - bandTop; row < y - bandTop + h; row++) {
+    for (int column = x; column < x + w; column++) {
+      mirror.pixel(canvas.readPixel(column, row));
+    }
+  }
+  mirror.endRegion();
+  applyBandViewport();
 }
-void OpenMenuOS::drawMenu(bool images, const char* names...) {
-  NUM_MENU_ITEMS = 0;
-  va_list args;
-  va_start(args, names);
-  const char* name = names;
-  // Clear the menu_items array before putting in new values
-  memset(menu_items, 0, sizeof(menu_items));
-  while (name != NULL) {
-    strncpy(menu_items[NUM_MENU_ITEMS], name, MAX_ITEM_LENGTH);
-    name = va_arg(args, const char*);
-    NUM_MENU_ITEMS++;
+// The buttons pressed in the viewer of the mirror join those of the pins
+void MenuContext::pollMirror() {
+  ButtonEvent event;
+  while (mirror.read(event)) {
+    buttons.inject(event.button, event.type);
   }
-  va_end(args);
-
-  checkForButtonPress();  // Check for button presses to control the menu
-  if (!scrollbar) {       // If no scrollbar, offset the text from 18px
-    rect_width = tftWidth;
-  } else if (scrollbar) {  // If no scrollbar, offset the text from 18px
-    rect_width = tftWidth - 5;
+  if (mirror.wantsFrame()) {
+    fullRedrawPending = true;  // The viewer gets the whole screen
+    redrawRequested = true;
   }
+}
 
-  // Calculate the position of the rectangle
-  uint16_t rect_x = 0;
-  uint16_t rect_y = (tftHeight - rect_height) / 2;  // Center the rectangle vertically
-
-  uint16_t selectedItemColor;
-
-  canvas.fillRoundRect(rect_x + 1, rect_y - 25, rect_width - 3, rect_height - 3, 4, TFT_BLACK);  // Remove Old Text. Change it by setting old text's color to white? (May be slower and more complicated??)
-  canvas.fillRoundRect(rect_x + 1, rect_y - 1, rect_width - 3, rect_height - 3, 4, TFT_BLACK);
-  canvas.fillRoundRect(rect_x + 1, rect_y + 27, rect_width - 3, rect_height - 3, 4, TFT_BLACK);
-
-  switch (menuStyle) {
-    case 0:
-      if (digitalRead(BUTTON_SELECT_PIN) == buttonVoltage && buttonAnimation) {
-        canvas.drawSmoothRoundRect(rect_x + 1, rect_y + 1, 4, 4, rect_width - 2, rect_height - 1, selectionBorderColor, TFT_BLACK);  // Display the rectangle || The "-2" should be determined dynamicaly
-
-      } else {
-        if (!scrollbar) {
-          canvas.drawSmoothRoundRect(rect_x, rect_y, 4, 4, rect_width, rect_height, selectionBorderColor, TFT_BLACK);  // Display the rectangle || The "-2" should be determined dynamicaly
-          canvas.drawFastVLine(tftWidth - 2, 29, 23, selectionBorderColor);                                            // Display the inside part
-          canvas.drawFastVLine(tftWidth, 29, 22, selectionBorderColor);                                                // Display the Shadow
-          canvas.drawFastHLine(2, 51, tftWidth - 3, selectionBorderColor);                                             // Display the inside part
-          canvas.drawFastHLine(3, 51, tftWidth - 4, selectionBorderColor);                                             // Display the Shadow
-        } else {
-          canvas.drawSmoothRoundRect(rect_x, rect_y, 4, 4, rect_width - 2, rect_height, selectionBorderColor, TFT_BLACK);  // Display the rectangle || The "-2" should be determined dynamicaly
-          canvas.drawFastVLine(rect_width - 4, rect_y + 2, 23, selectionBorderColor);                                      // Display the inside part
-          canvas.drawFastVLine(rect_width - 3, rect_y + 2, 22, selectionBorderColor);                                      // Display the Shadow
-          canvas.drawFastHLine(2, 51, 149, selectionBorderColor);                                                          // Display the inside part
-          canvas.drawFastHLine(3, 52, 148, selectionBorderColor);                                                          // Display the Shadow
-        }
-      }
-      selectedItemColor = TFT_WHITE;
-      break;
-    case 1:
-      if (!scrollbar) {
-        canvas.fillSmoothRoundRect(rect_x, rect_y, rect_width, rect_height, 4, selectionBorderColor, TFT_BLACK);  // Display the rectangle || The "-2" should be determined dynamicaly
-        // canvas.drawSmoothRoundRect(rect_x, rect_y, 4, 4, rect_width, rect_height, selectionBorderColor, TFT_BLACK);  // Display the rectangle || The "-2" should be determined dynamicaly                                          // Display the Shadow
-      } else {
-        canvas.fillSmoothRoundRect(rect_x, rect_y, rect_width, rect_height, 4, selectionBorderColor, TFT_BLACK);  // Display the rectangle || The "-2" should be determined dynamicaly
-        // canvas.drawSmoothRoundRect(rect_x, rect_y, 4, 4, rect_width, rect_height, selectionBorderColor, TFT_BLACK);  // Display the rectangle || The "-2" should be determined dynamicaly                                                         // Display the Shadow
-      }
-      selectedItemColor = TFT_BLACK;
+// Ask for a frame at the given time, the earliest request of the frame wins
+void MenuContext::scheduleFrame(unsigned long time) {
+  if (!frameAnimationPending || (long)(time - frameAnimationDeadline) < 0) {
+    frameAnimationDeadline = time;
+    frameAnimationPending = true;
+  }
+}
 
-      break;
+// Time of the frame being drawn. All the animations of a frame, and all its bands, use the same time
+unsigned long MenuContext::frameNow() {
+  if (!frameTimeSet) {
+    frameTime = millis();
+    frameTimeSet = true;
   }
-  int xPos = 30;   // X Position of text 0
-  int x1Pos = 30;  // X Position of text 1
-  int x2Pos = 30;  // X Position of text 2
-
-  int yPos = 17;   // Y Position of text 0
-  int y1Pos = 44;  // Y Position of text 1
-  int y2Pos = 70;  // Y Position of text 2
-  // int sectionHeight = tftHeight / 3;
-  // int yPos = sectionHeight / 2 + 6;   // Center of the first section
-  // canvas.drawFastHLine(0, yPos, 160, TFT_RED);
-  // int y1Pos = sectionHeight + sectionHeight / 2 + 6;  // Center of the second section
-  // canvas.drawFastHLine(0, y1Pos, 160, TFT_RED);
-  // int y2Pos = 2 * sectionHeight + sectionHeight / 2 +6;  // Center of the third section
-  // canvas.drawFastHLine(0, y2Pos, 160, TFT_RED);
-  int scrollWindowSize = 120;
-  if (!images) {  // If no image, offset the text from 18px
-    xPos -= 18;
-    x1Pos -= 18;
-    x2Pos -= 18;
-    scrollWindowSize += 18;
+  return frameTime;
+}
+// Bring an animation to the time of the frame and ask for the next frame while it runs, returns true if it moved
+bool MenuContext::animate(Tween& tween) {
+  bool moved = tween.update(frameNow());
+  if (tween.running()) {
+    scheduleFrame(frameNow() + ANIMATION_FRAME_TIME);
   }
-
-  // draw previous item as icon + label
-  canvas.setFreeFont(&FreeMono9pt7b);
-  canvas.setTextSize(1);
-  canvas.setTextColor(TFT_WHITE, TFT_BLACK);
-  canvas.setCursor(xPos, yPos);
-
-  // Get the text of the previous item
-  String previousItem = menu_items[item_sel_previous];
-
-  // Check if the length of the text exceeds the maximum length for non-scrolling items
-  if (previousItem.length() > MAX_ITEM_LENGTH_NOT_SCROLLING) {
-    // Truncate the text and add "..." at the end
-    previousItem = previousItem.substring(0, MAX_ITEM_LENGTH_NOT_SCROLLING - 3) + "...";
+  return moved;
+}
+// Check if a renderer ran during the previous frame, its transitions start from what it showed then
+bool MenuContext::sceneWasDrawn(uint8_t scene) const {
+  return scene < SCENE_COUNT && (scenesDrawnPrevious & (1 << scene));
+}
+// Slide the selection rectangle from the row of the previously selected item, returns true if it moved
+bool MenuContext::animateSelection(uint8_t scene, int previous, int selected, int next, int16_t rowHeight) {
+  SceneAnimation& animation = sceneAnimations[scene];
+  if (bandIndex == 0 && selected != animation.selected) {
+    if (!animations || !sceneWasDrawn(scene)) {
+      animation.selection.jumpTo(0);
+    } else if (animation.selected == previous) {  // Moved down, the previous item is now above
+      animation.selection.start(-rowHeight, 0, SELECTION_ANIMATION_TIME);
+    } else if (animation.selected == next) {
+      animation.selection.start(rowHeight, 0, SELECTION_ANIMATION_TIME);
+    } else {
+      animation.selection.jumpTo(0);
+    }
   }
-
-  // Print the modified text
-  canvas.println(previousItem);
-
-  if (images) {
-    canvas.pushImage(5, 5, 16, 16, (uint16_t*)bitmap_icons[item_sel_previous]);
+  bool moved = animate(animation.selection);
+  if (bandIndex == 0) {
+    animation.previous = previous;
+    animation.selected = selected;
+    animation.next = next;
   }
-  // draw selected item as icon + label in bold font
-  if (strlen(menu_items[item_selected]) > MAX_ITEM_LENGTH_NOT_SCROLLING && textScroll) {
-    // tft.setFreeFont(&FreeMonoBold9pt7b);  // Here, We don't use "canvas." because when using it, the calculated value in the "scrollTextHorizontal" function is wrong but not with "tft." #bug
-    canvas.setFreeFont(&FreeMonoBold9pt7b);
-    scrollTextHorizontal(x1Pos, y1Pos, menu_items[item_selected], selectedItemColor, selectionFillColor, 1, 50, scrollWindowSize);  // Adjust windowSize as needed
-  } else if (!textScroll) {
-    // draw selected item as icon + label
-    canvas.setFreeFont(&FreeMono9pt7b);
-    canvas.setTextSize(1);
-    canvas.setTextColor(selectedItemColor, selectionFillColor);
-    canvas.setCursor(x1Pos, y1Pos);
+  return moved;
+}
+// Move the knob of a setting's toggle switch to its state. It only slides if the switch was shown during the previous frame
+bool MenuContext::animateToggle(int index, bool state) {
+  SceneAnimation& animation = sceneAnimations[SCENE_SETTINGS];
+  Tween& knob = toggleKnobs[index];
+  int16_t target = state ? 1024 : 0;
+  bool shown = sceneWasDrawn(SCENE_SETTINGS) && (index == animation.previous || index == animation.selected || index == animation.next);
+  if (animations && shown) {
+    knob.moveTo(target, TOGGLE_ANIMATION_TIME);
+  } else if (knob.target() != target || knob.running()) {
+    knob.jumpTo(target);
+  }
+  return animate(knob);
+}
 
-    // Get the text of the selected item
-    String selectedItem = menu_items[item_selected];
+// FNV-1a hash, used to build a key of what a renderer draws so unchanged frames don't report any damage
+static uint32_t hashValue(uint32_t hash, uint32_t value) {
+  for (int i = 0; i < 4; i++) {
+    hash = (hash ^ (value & 0xFF)) * FNV_PRIME;
+    value >>= 8;
+  }
+  return hash;
+}
+static uint32_t hashText(uint32_t hash, const char* text) {
+  while (*text) {
+    hash = (hash ^ (uint8_t)*text++) * FNV_PRIME;
+  }
+  return hashValue(hash, 0);  // Terminate so "ab" + "c" and "a" + "bc" give different keys
+}
 
-    // Check if the length of the text exceeds the maximum length for non-scrolling items
-    if (selectedItem.length() > MAX_ITEM_LENGTH_NOT_SCROLLING) {
-      // Truncate the text and add "..." at the end
-      selectedItem = selectedItem.substring(0, MAX_ITEM_LENGTH_NOT_SCROLLING - 3) + "...";
+// Find the scroller of the window at x, y, or take a free (or the least recently used) one
+TextScroller& MenuContext::findScroller(int16_t x, int16_t y) {
+  TextScroller* oldest = &textScrollers[0];
+  for (int i = 0; i < MAX_TEXT_SCROLLERS; i++) {
+    TextScroller& scroller = textScrollers[i];
+    if (scroller.inUse && scroller.x == x && scroller.y == y) {
+      return scroller;
+    }
+    if (!scroller.inUse) {
+      if (oldest->inUse) oldest = &scroller;
+    } else if (oldest->inUse && scroller.lastUsed < oldest->lastUsed) {
+      oldest = &scroller;
     }
-
-    // Print the modified text
-    canvas.println(selectedItem);
-  } else {
-    canvas.setFreeFont(&FreeMonoBold9pt7b);
-    canvas.setTextSize(1);
-    canvas.setTextColor(selectedItemColor, selectionFillColor);
-    canvas.setCursor(x1Pos, y1Pos);
-    canvas.println(menu_items[item_selected]);
   }
-
-  if (images) {
-    canvas.pushImage(5, 32, 16, 16, (uint16_t*)bitmap_icons[item_selected]);
+  oldest->inUse = true;
+  oldest->x = x;
+  oldest->y = y;
+  oldest->textKey = 0;  // Its strip is kept, the new text is rendered into it if it fits
+  return *oldest;
+}
+// Height above and below the baseline of the tallest glyphs of a GFX font (the font can be in PROGMEM)
+static void fontMetrics(const GFXfont* font, int16_t& ascent, int16_t& descent) {
+  const GFXglyph* glyphs = (const GFXglyph*)pgm_read_ptr(&font->glyph);
+  uint16_t count = pgm_read_word(&font->last) - pgm_read_word(&font->first) + 1;
+  ascent = 0;
+  descent = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    int8_t yOffset = (int8_t)pgm_read_byte(&glyphs[i].yOffset);
+    int8_t bottom = yOffset + (int8_t)pgm_read_byte(&glyphs[i].height);
+    if (-yOffset > ascent) ascent = -yOffset;
+    if (bottom > descent) descent = bottom;
   }
-  // draw next item as icon + label
-  canvas.setFreeFont(&FreeMono9pt7b);
-  canvas.setTextSize(1);
-  canvas.setTextColor(TFT_WHITE, TFT_BLACK);
-  canvas.setCursor(x2Pos, y2Pos);
-
-  // Get the text of the next item
-  String nextItem = menu_items[item_sel_next];
-
-  // Check if the length of the text exceeds the maximum length for non-scrolling items
-  if (nextItem.length() > MAX_ITEM_LENGTH_NOT_SCROLLING) {
-    // Truncate the text and add "..." at the end
-    nextItem = nextItem.substring(0, MAX_ITEM_LENGTH_NOT_SCROLLING - 3) + "...";
+}
+// Widest advance of a GFX font, the width of every character of a monospaced font
+static int16_t fontAdvance(const GFXfont* font) {
+  const GFXglyph* glyphs = (const GFXglyph*)pgm_read_ptr(&font->glyph);
+  uint16_t count = pgm_read_word(&font->last) - pgm_read_word(&font->first) + 1;
+  int16_t advance = 1;
+  for (uint16_t i = 0; i < count; i++) {
+    advance = max(advance, (int16_t)pgm_read_byte(&glyphs[i].xAdvance));
+  }
+  return advance;
+}
+// Compute the layout of the lists, called by begin() and when the rotation or the style changes
+void MenuContext::updateLayout() {
+  int16_t ascent, descent;
+  fontMetrics(&FreeMono9pt7b, ascent, descent);
+  int16_t advance = fontAdvance(&FreeMono9pt7b);
+
+  layout.rowHeight = (uint8_t)pgm_read_byte(&FreeMono9pt7b.yAdvance) + 8;
+  layout.rowPitch = layout.rowHeight + 1;
+  int16_t selectedTop = (tftHeight - layout.rowHeight) / 2;
+  for (int row = 0; row < ROW_COUNT; row++) {
+    layout.rowTop[row] = selectedTop + (row - ROW_SELECTED) * layout.rowPitch;
+    layout.baseline[row] = layout.rowTop[row] + (layout.rowHeight - ascent - descent) / 2 + ascent;
+    layout.iconY[row] = layout.rowTop[row] + (layout.rowHeight - ICON_SIZE) / 2;
+    layout.toggleY[row] = layout.rowTop[row] + 2;  // Inside the border of the selection
   }
 
-  // Print the modified text
-  canvas.println(nextItem);
-
-  if (images) {
-    canvas.pushImage(5, 59, 16, 16, (uint16_t*)bitmap_icons[item_sel_next]);
+  layout.selectionWidth = scrollbar ? tftWidth - 5 : tftWidth;
+  int16_t textEnd = layout.selectionWidth - 5;  // Right margin, inside the border of the selection
+  layout.iconX = 5;
+  layout.textX = layout.iconX + ICON_SIZE + 9;
+  layout.textXNoIcon = 12;
+  layout.scrollWindow = textEnd - layout.textX;
+  layout.scrollWindowNoIcon = textEnd - layout.textXNoIcon;
+  // The last character can go one pixel over the window, its advance includes the space after it
+  layout.maxLength = min((layout.scrollWindow + 1) / advance, MAX_ITEM_LENGTH - 1);
+  layout.maxLengthNoIcon = min((layout.scrollWindowNoIcon + 1) / advance, MAX_ITEM_LENGTH - 1);
+
+  // Rows of the list view, as many as fit above the selected one and as many below it when setListView() doesn't say
+  int listRows = listVisibleRows > 0 ? listVisibleRows : selectedTop / layout.rowPitch * 2 + 1;
+  listRows = constrain(listRows, 1, MAX_LIST_ROWS);
+  layout.listAbove = (listRows - 1) / 2;
+  layout.listBelow = listRows - 1 - layout.listAbove;
+
+  layout.toggleX = textEnd - TOGGLE_WIDTH;
+  layout.settingsTextX = 10;
+  layout.settingsScrollWindow = layout.toggleX - layout.settingsTextX;
+  layout.settingsMaxLength = min((layout.settingsScrollWindow + 1) / advance, MAX_ITEM_LENGTH - 1);
+}
+// Rounded shapes of the rendering tier: anti-aliased on bg, or plain integer fills in fast rendering
+void MenuContext::fillRounded(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color, uint32_t bg) {
+  fillRounded(canvas, x, y, w, h, r, color, bg);
+}
+void MenuContext::fillRounded(TFT_eSprite& target, int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color, uint32_t bg) {
+  if (!fastShapes()) {
+    target.fillSmoothRoundRect(x, y, w, h, r, color, bg);
+    return;
   }
-  if (scrollbar) {
-    // Draw the scrollbar
-    drawScrollbar(item_selected, item_sel_next);
+  r = min(r, min(w, h) / 2);  // fillRoundRect() doesn't limit the radius
+  target.fillRoundRect(x, y, w, h, r, color);
+}
+void MenuContext::drawRounded(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color, uint32_t bg) {
+  if (!fastShapes()) {
+    canvas.drawSmoothRoundRect(x, y, r, r, w, h, color, bg);  // Outer and inner radius equal, one pixel wide
+    return;
   }
+  r = min(r, min(w, h) / 2);
+  canvas.drawRoundRect(x, y, w, h, r, color);
 }
-void OpenMenuOS::drawSubmenu(bool images, const char* names...) {
-  NUM_SUBMENU_ITEMS = 0;
-  va_list args;
-  va_start(args, names);
-  const char* name = names;
-  // Clear the submenu_items array before putting in new values
-  memset(submenu_items, 0, sizeof(submenu_items));
-  while (name != NULL) {
-    strncpy(submenu_items[NUM_SUBMENU_ITEMS], name, MAX_ITEM_LENGTH);
-    name = va_arg(args, const char*);
-    NUM_SUBMENU_ITEMS++;
+void MenuContext::fillDisc(int32_t x, int32_t y, int32_t r, uint32_t color, uint32_t bg) {
+  if (!fastShapes()) {
+    canvas.fillSmoothCircle(x, y, r, color, bg);
+    return;
   }
-  va_end(args);
-
-  checkForButtonPressSubmenu();  // Check for button presses to control the submenu
-
-  if (!scrollbar) {  // If no scrollbar, offset the text from 18px
-    rect_width = tftWidth;
+  canvas.fillCircle(x, y, r, color);
+}
+// Dotted vertical line over the height of the screen, one pixel out of two. Written straight into the rows of the band
+// instead of one drawPixel() per dot
+void MenuContext::drawScrollbarTrack(int16_t x, uint16_t color) {
+  int bandBottom = min(bandTop + bandHeight, tftHeight);
+  if (!canvas.created() || canvas.getColorDepth() != 16 || x < 0 || x >= tftWidth) {
+    for (int y = bandTop + (bandTop & 1); y < bandBottom; y += 2) {
+      canvas.drawPixel(x, y, color);
+    }
+    return;
   }
-  // Calculate the position of the rectangle
-  uint16_t rect_x = 0;
-  uint16_t rect_y = (tftHeight - rect_height) / 2;  // Center the rectangle vertically
-  uint16_t selectedItemColor;
-  canvas.fillRoundRect(rect_x + 1, rect_y - 25, rect_width - 3, rect_height - 3, 4, TFT_BLACK);  // Remove Old Text. Change it by setting old text's color to white? (May be slower and more complicated??)
-  canvas.fillRoundRect(rect_x + 1, rect_y - 1, rect_width - 3, rect_height - 3, 4, TFT_BLACK);
-  canvas.fillRoundRect(rect_x + 1, rect_y + 27, rect_width - 3, rect_height - 3, 4, TFT_BLACK);
-
-  switch (menuStyle) {
-    case 0:
-      if (digitalRead(BUTTON_SELECT_PIN) == buttonVoltage && buttonAnimation) {
-        // canvas.drawRoundRect(rect_x + 1, rect_y + 1, rect_width - 2, rect_height - 1, 4, selectionBorderColor);  // Display the rectangle
-        canvas.drawSmoothRoundRect(rect_x + 1, rect_y + 1, 4, 4, rect_width - 2, rect_height - 1, selectionBorderColor, TFT_BLACK);  // Display the rectangle || The "-2" should be determined dynamicaly
-
-      } else {
-        if (!scrollbar) {
-          canvas.drawSmoothRoundRect(rect_x, rect_y, 4, 4, rect_width, rect_height, selectionBorderColor, TFT_BLACK);  // Display the rectangle || The "-2" should be determined dynamicaly
-          canvas.drawFastVLine(tftWidth - 2, 29, 23, selectionBorderColor);                                            // Display the inside part
-          canvas.drawFastVLine(tftWidth, 29, 22, selectionBorderColor);                                                // Display the Shadow
-          canvas.drawFastHLine(2, 51, tftWidth - 3, selectionBorderColor);                                             // Display the inside part
-          canvas.drawFastHLine(3, 51, tftWidth - 4, selectionBorderColor);                                             // Display the Shadow
-        } else {
-          canvas.drawSmoothRoundRect(rect_x, rect_y, 4, 4, rect_width - 2, rect_height, selectionBorderColor, TFT_BLACK);  // Display the rectangle || The "-2" should be determined dynamicaly
-          canvas.drawFastVLine(rect_width - 4, rect_y + 2, 23, selectionBorderColor);                                      // Display the inside part
-          canvas.drawFastVLine(rect_width - 3, rect_y + 2, 22, selectionBorderColor);                                      // Display the Shadow
-          canvas.drawFastHLine(2, 51, 149, selectionBorderColor);                                                          // Display the inside part
-          canvas.drawFastHLine(3, 52, 148, selectionBorderColor);                                                          // Display the Shadow
-        }
-      }
-      selectedItemColor = TFT_WHITE;
-      break;
-    case 1:
-      canvas.fillSmoothRoundRect(rect_x, rect_y, rect_width, rect_height, 4, selectionBorderColor, TFT_BLACK);  // Display the rectangle || The "-2" should be determined dynamicaly
-
-      selectedItemColor = TFT_BLACK;
-
-      break;
+  uint16_t* pixels = (uint16_t*)canvas.getPointer();
+  uint16_t swapped = color >> 8 | color << 8;  // The sprite keeps the bytes in the order of the display
+  for (int y = bandTop + (bandTop & 1); y < bandBottom; y += 2) {
+    pixels[(y - bandTop) * tftWidth + x] = swapped;
   }
-  int xPos = 30;   // X Position of text 0
-  int yPos = 17;   // Y Position of text 0
-  int x1Pos = 30;  // X Position of text 1
-  int y1Pos = 44;  // Y Position of text 1
-  int x2Pos = 30;  // X Position of text 2
-  int y2Pos = 70;  // Y Position of text 2
-  int scrollWindowSize = 120;
-
-  if (!images) {  // If no image, offset the text from 18px
-    xPos -= 18;
-    x1Pos -= 18;
-    x2Pos -= 18;
-    scrollWindowSize += 18;
+}
+// Draw the selection rectangle of a list with its top at y, returns the colour of the selected text
+uint16_t MenuContext::drawSelection(int16_t y, bool pressed) {
+  int16_t w = layout.selectionWidth;
+  int16_t h = layout.rowHeight;
+  if (menuStyle == 1) {
+    fillRounded(0, y, w, h, 4, selectionBorderColor, TFT_BLACK);
+    return TFT_BLACK;
   }
-  // draw previous item as icon + label
-  canvas.setFreeFont(&FreeMono9pt7b);
-  canvas.setTextSize(1);
-  canvas.setTextColor(TFT_WHITE, TFT_BLACK);
-  canvas.setCursor(xPos, yPos);
-
-  // Get the text of the previous item
-  String previousItem = submenu_items[item_sel_previous_submenu];
-
-  // Check if the length of the text exceeds the maximum length for non-scrolling items
-  if (previousItem.length() > MAX_ITEM_LENGTH_NOT_SCROLLING) {
-    // Truncate the text and add "..." at the end
-    previousItem = previousItem.substring(0, MAX_ITEM_LENGTH_NOT_SCROLLING - 3) + "...";
+  if (pressed && buttonAnimation) {
+    drawRounded(1, y + 1, w - 2, h - 1, 4, selectionBorderColor, TFT_BLACK);  // Pushed in, without the shadow
+    return TFT_WHITE;
   }
-
-  // Print the modified text
-  canvas.println(previousItem);
-  if (images) {
-    canvas.pushImage(5, 5, 16, 16, (uint16_t*)bitmap_icons[item_sel_previous_submenu]);
+  int16_t boxWidth = scrollbar ? w - 2 : w;  // 2 pixels between the selection and the scrollbar
+  drawRounded(0, y, boxWidth, h, 4, selectionBorderColor, TFT_BLACK);
+  canvas.drawFastVLine(boxWidth - 2, y + 2, h - 3, selectionBorderColor);  // Display the inside part
+  canvas.drawFastVLine(boxWidth - 1, y + 2, h - 4, selectionBorderColor);  // Display the Shadow
+  canvas.drawFastHLine(2, y + h - 2, boxWidth - 4, selectionBorderColor);  // Display the inside part
+  canvas.drawFastHLine(3, y + h - 1, boxWidth - 5, selectionBorderColor);  // Display the Shadow
+  return TFT_WHITE;
+}
+// Get the corner of a tile colour, rendering it if it isn't cached. Returns NULL if there is not enough memory
+TileCorner* MenuContext::findTileCorner(uint16_t color) {
+  TileCorner* oldest = &tileCorners[0];
+  for (uint8_t i = 0; i < MAX_TILE_COLORS; i++) {
+    TileCorner& corner = tileCorners[i];
+    if (corner.ready && corner.color == color) {
+      corner.lastUsed = ++tileClock;
+      return &corner;
+    }
+    if (!corner.ready || (oldest->ready && corner.lastUsed < oldest->lastUsed)) {
+      oldest = &corner;
+    }
   }
 
-  // draw selected item as icon + label in bold font
-  if (strlen(submenu_items[item_selected_submenu]) > MAX_ITEM_LENGTH_NOT_SCROLLING && textScroll) {
-    // tft.setFreeFont(&FreeMonoBold9pt7b);  // Here, We don't use "canvas." because when using it, the calculated value in the "scrollTextHorizontal" function is wrong but not with "tft." #bug
-    canvas.setFreeFont(&FreeMonoBold9pt7b);
-    scrollTextHorizontal(x1Pos, y1Pos, submenu_items[item_selected_submenu], selectedItemColor, selectionFillColor, 1, 50, 120);  // Adjust windowSize as needed
-  } else if (!textScroll) {
-    // draw selected item as icon + label
-    canvas.setFreeFont(&FreeMono9pt7b);
-    canvas.setTextSize(1);
-    canvas.setTextColor(selectedItemColor, selectionFillColor);
-    canvas.setCursor(x1Pos, y1Pos);
-
-    // Get the text of the selected item
-    String selectedItem = submenu_items[item_selected_submenu];
-
-    // Check if the length of the text exceeds the maximum length for non-scrolling items
-    if (selectedItem.length() > MAX_ITEM_LENGTH_NOT_SCROLLING) {
-      // Truncate the text and add "..." at the end
-      selectedItem = selectedItem.substring(0, MAX_ITEM_LENGTH_NOT_SCROLLING - 3) + "...";
+  // A tile made of only its corners, blended with the black background like fillSmoothRoundRect() does
+  const int16_t r = TILE_ROUND_RADIUS;
+  if (!fitSprite(cornerTile, r * 2, r * 2, 16)) {
+    return NULL;
+  }
+  cornerTile.fillSprite(TFT_BLACK);
+  cornerTile.fillSmoothRoundRect(0, 0, r * 2, r * 2, r, color, TFT_BLACK);
+  for (int16_t y = 0; y < r; y++) {
+    for (int16_t x = 0; x < r; x++) {
+      oldest->pixels[y * r + x] = cornerTile.readPixel(x, y);
     }
-
-    // Print the modified text
-    canvas.println(selectedItem);
-  } else {
-    canvas.setFreeFont(&FreeMonoBold9pt7b);
-    canvas.setTextSize(1);
-    canvas.setTextColor(selectedItemColor, selectionFillColor);
-    canvas.setCursor(x1Pos, y1Pos);
-    canvas.println(submenu_items[item_selected_submenu]);
   }
-  if (images) {
-    canvas.pushImage(5, 32, 16, 16, (uint16_t*)bitmap_icons[item_selected_submenu]);
+  oldest->color = color;
+  oldest->ready = true;
+  oldest->lastUsed = ++tileClock;
+  return oldest;
+}
+// Same as fillSmoothRoundRect() on the black background, without computing the anti-aliasing of the corners every time
+void MenuContext::drawTileBackground(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  PROFILE_SCOPE(PROFILE_BLIT);
+  const int16_t r = TILE_ROUND_RADIUS;
+  TileCorner* corner = !fastShapes() && w >= r * 2 && h >= r * 2 ? findTileCorner(color) : NULL;
+  if (corner == NULL) {
+    fillRounded(x, y, w, h, r, color, TFT_BLACK);
+    return;
   }
-  // draw next item as icon + label
-  canvas.setFreeFont(&FreeMono9pt7b);
-  canvas.setTextSize(1);
-  canvas.setTextColor(TFT_WHITE, TFT_BLACK);
-  canvas.setCursor(x2Pos, y2Pos);
-
-  // Get the text of the next item
-  String nextItem = submenu_items[item_sel_next_submenu];
-
-  // Check if the length of the text exceeds the maximum length for non-scrolling items
-  if (nextItem.length() > MAX_ITEM_LENGTH_NOT_SCROLLING) {
-    // Truncate the text and add "..." at the end
-    nextItem = nextItem.substring(0, MAX_ITEM_LENGTH_NOT_SCROLLING - 3) + "...";
+  canvas.fillRect(x, y + r, w, h - r * 2, color);
+  canvas.fillRect(x + r, y, w - r * 2, r, color);
+  canvas.fillRect(x + r, y + h - r, w - r * 2, r, color);
+  for (int16_t cy = 0; cy < r; cy++) {
+    for (int16_t cx = 0; cx < r; cx++) {
+      uint16_t pixel = corner->pixels[cy * r + cx];
+      if (pixel == TFT_BLACK) continue;  // Outside of the tile, the canvas is already black
+      canvas.drawPixel(x + cx, y + cy, pixel);
+      canvas.drawPixel(x + w - 1 - cx, y + cy, pixel);
+      canvas.drawPixel(x + cx, y + h - 1 - cy, pixel);
+      canvas.drawPixel(x + w - 1 - cx, y + h - 1 - cy, pixel);
+    }
   }
-
-  // Print the modified text
-  canvas.println(nextItem);
-
-  if (images) {
-    canvas.pushImage(5, 59, 16, 16, (uint16_t*)bitmap_icons[item_sel_next_submenu]);
+}
+// Icon, label and callback of a tile, drawn in the coordinates of the tile and clipped to it
+void MenuContext::drawTileContent(const TileItem& tile, int index, int16_t x, int16_t y, int16_t w, int16_t h, bool selected) {
+  canvas.setViewport(x, y - bandTop, w, h, true);
+  bool icon = tile.icon != NULL;
+  bool label = tile.label != NULL && tile.label[0] != '\0';
+  if (icon && label && ICON_SIZE + 10 > h) {
+    label = false;  // No room for both, the icon is kept
   }
-
-  if (scrollbar) {
-    // Draw the scrollbar
-    drawScrollbar(item_selected_submenu, item_sel_next_submenu);
+  int16_t top = (h - (icon ? ICON_SIZE : 0) - (label ? 8 : 0) - (icon && label ? 2 : 0)) / 2;
+  if (icon) {
+    drawIcon((w - ICON_SIZE) / 2, top, ICON_SIZE, ICON_SIZE, tile.icon);
+    top += ICON_SIZE + 2;
+  }
+  if (label) {
+    canvas.setFreeFont(nullptr);  // Built in 6x8 font
+    canvas.setTextSize(1);
+    canvas.setTextColor(TFT_WHITE);
+    canvas.setCursor((w - canvas.textWidth(tile.label)) / 2, top);
+    canvas.print(tile.label);
+  }
+  if (tile.draw != NULL) {
+    tile.draw(index, w, h, selected);
   }
+  applyBandViewport();
 }
-
-void OpenMenuOS::drawSettingMenu(const char* items...) {
-
-  NUM_SETTINGS_ITEMS = 1;
-  va_list args;
-  va_start(args, items);
-  const char* item = items;
-  while (item != NULL && NUM_SETTINGS_ITEMS < MAX_SETTINGS_ITEMS) {
-    strncpy(menu_items_settings[NUM_SETTINGS_ITEMS++], item, MAX_ITEM_LENGTH - 1);
-    item = va_arg(args, const char*);
+// Position of a tile of the last drawn tile menu on the screen
+void MenuContext::tilePosition(int index, int16_t& x, int16_t& y) const {
+  x = (index % tile_menu_columns) * (tile_menu_width + TILE_MARGIN) + TILE_MARGIN;
+  y = (index / tile_menu_columns) * (tile_menu_height + TILE_MARGIN) + TILE_MARGIN - tileScroll.value();
+}
+// Check if a region was marked as changed during this frame
+bool MenuContext::regionDirty(int16_t x, int16_t y, int16_t w, int16_t h) const {
+  for (uint8_t i = 0; i < dirtyRectCount; i++) {
+    const DirtyRect& r = dirtyRects[i];
+    if (x < r.x + r.w && r.x < x + w && y < r.y + r.h && r.y < y + h) {
+      return true;
+    }
   }
-  va_end(args);
-
-  if (BUTTON_UP_PIN != NULL) {
-    ///////////////////////IF REMOVED, THE SHORT PRESS DOESN'T DO ANYTHING #Bug////////////////////////////////
-    if ((digitalRead(BUTTON_UP_PIN) == buttonVoltage) && (button_up_clicked_settings == 0)) {  // up button clicked - jump to previous menu item
-      item_selected_settings = item_selected_settings - 1;                                     // select previous item
-      button_up_clicked_settings = 1;                                                          // set button to clicked to only perform the action once
-      if (item_selected_settings < 0) {                                                        // if first item was selected, jump to last item
-        item_selected_settings = NUM_SETTINGS_ITEMS - 1;
+  return false;
+}
+// Draw the columns srcX to srcX + w of a 1 bit strip at x, y as horizontal runs of color, the background is left untouched
+void MenuContext::drawStripWindow(TFT_eSprite& strip, int16_t x, int16_t y, int16_t srcX, int16_t w, uint16_t color) {
+  PROFILE_SCOPE(PROFILE_BLIT);
+  const uint8_t* bits = (const uint8_t*)strip.getPointer();
+  int16_t stripWidth = strip.width();
+  int16_t stride = (stripWidth + 7) >> 3;  // Rows of a 1 bit sprite are padded to a whole byte
+  for (int16_t row = 0; row < strip.height(); row++) {
+    const uint8_t* line = bits + row * stride;
+    int16_t runStart = -1;
+    for (int16_t i = 0; i <= w; i++) {
+      int16_t sx = srcX + i;
+      bool on = i < w && sx >= 0 && sx < stripWidth && (line[sx >> 3] & (0x80 >> (sx & 7)));
+      if (on && runStart < 0) {
+        runStart = i;
+      } else if (!on && runStart >= 0) {
+        canvas.drawFastHLine(x + runStart, y + row, i - runStart, color);
+        runStart = -1;
       }
     }
-
-    if ((digitalRead(BUTTON_UP_PIN) == LOW) && (button_up_clicked_settings == 1)) {  // unclick
-      button_up_clicked_settings = 0;
+  }
+}
+// Text cut with "..." to maxLength characters (0 to never cut), written in truncated (MAX_ITEM_LENGTH bytes) if it's too long
+static const char* truncateLabel(const char* text, uint8_t maxLength, char* truncated) {
+  if (maxLength > 3 && maxLength < MAX_ITEM_LENGTH && strlen(text) > maxLength) {
+    memcpy(truncated, text, maxLength - 3);
+    strcpy(truncated + maxLength - 3, "...");
+    return truncated;
+  }
+  return text;
+}
+// Draw a label with its baseline at y, truncated with "..." to maxLength characters (0 to never truncate). The label is
+// rendered into a mask the first time and only the mask is drawn afterwards, as long as it stays in the cache
+void MenuContext::drawLabel(int16_t x, int16_t y, const char* text, const GFXfont* font, uint8_t maxLength, uint16_t color) {
+  char truncated[MAX_ITEM_LENGTH];
+  text = truncateLabel(text, maxLength, truncated);
+
+  uint32_t key = hashValue(hashText(FNV_OFFSET_BASIS, text), (uintptr_t)font);
+  LabelMask* label = &labelMasks[0];
+  for (int i = 0; i < MAX_LABEL_MASKS; i++) {
+    LabelMask& entry = labelMasks[i];
+    if (entry.inUse && entry.key == key) {
+      label = &entry;
+      break;
     }
-    ///////////////////////////////////////////////////////
-
-    upButtonState = digitalRead(BUTTON_UP_PIN);  // Read the current button state
-
-    if (upButtonState == HIGH && !ButtonPressProcessed) {
-      if (PreviousButtonState == LOW) {
-        pressedTime = millis();
-        isPressing = true;
-        isLongDetected = false;  // Ensure long press flag is reset each time button is pressed
-        ButtonPressProcessed = true;
-      }
+    if (!entry.inUse) {
+      if (label->inUse) label = &entry;
+    } else if (label->inUse && entry.lastUsed < label->lastUsed) {
+      label = &entry;
     }
+  }
 
-    if (isPressing && !isLongDetected) {
-      long pressDuration = millis() - pressedTime;
-
-      if (pressDuration > LONG_PRESS_TIME_MENU) {
-        isLongDetected = true;
-      }
+  if (!label->inUse || label->key != key) {
+    // Not in the cache, render it in place of the least recently used label
+    PROFILE_SCOPE(PROFILE_TEXT);
+    int16_t descent;
+    fontMetrics(font, label->ascent, descent);
+    label->mask.setFreeFont(font);
+    label->mask.setTextSize(1);
+    label->width = label->mask.textWidth(text);
+    label->ready = label->width > 0 && fitSprite(label->mask, label->width, label->ascent + descent, 1);
+    if (label->ready) {
+      label->mask.fillSprite(0);
+      label->mask.setTextColor(1);
+      label->mask.setCursor(0, label->ascent);
+      label->mask.print(text);
     }
-    if (isPressing && isLongDetected) {
-      static unsigned long lastTempAdjustTime = 0;
-      unsigned long currentMillis = millis();
-      if (currentMillis - lastTempAdjustTime >= 200) {        // Check if 00ms have passed
-        item_selected_settings = item_selected_settings - 1;  // select previous item
-        button_up_clicked_settings = 1;                       // set button to clicked to only perform the action once
-        if (item_selected_settings < 0) {                     // if first item was selected, jump to last item
-          item_selected_settings = NUM_SETTINGS_ITEMS - 1;
-        }
-        lastTempAdjustTime = currentMillis;  // Update the last adjustment time
-      }
-    }
-
-    if (upButtonState == LOW && PreviousButtonState == HIGH) {
-      isPressing = false;
-      releasedTime = millis();
-
-      long pressDuration = releasedTime - pressedTime;
-
-      // Determine the type of press based on the duration
-      if (pressDuration >= LONG_PRESS_TIME_MENU) {
-        isLongDetected = true;
-      } else {
-        isLongDetected = false;
-      }
+    label->key = key;
+    label->inUse = true;
+  }
+  label->lastUsed = ++labelClock;
 
-      // Check if it was a short press and long press was not detected
-      if (pressDuration < SHORT_PRESS_TIME && !isLongDetected) {
-        // item_selected_settings = item_selected_settings - 1;  // select previous item
-        // button_up_clicked_settings = 1;                       // set button to clicked to only perform the action once
-        // if (item_selected_settings < 0) {                     // if first item was selected, jump to last item
-        //   item_selected_settings = NUM_SETTINGS_ITEMS - 1;
-        // }
-      }
-      ButtonPressProcessed = false;  // Reset the control variable when the button is not pressed anymore
+  if (label->ready) {
+    drawStripWindow(label->mask, x, y - label->ascent, 0, label->width, color);
+  } else {
+    // Not enough memory for the mask, print the text directly
+    PROFILE_SCOPE(PROFILE_TEXT);
+    canvas.setFreeFont(font);
+    canvas.setTextSize(1);
+    canvas.setTextColor(color);
+    canvas.setCursor(x, y);
+    canvas.print(text);
+  }
+}
+// Draw a row of the list view that isn't selected with its top at y. The row is rendered into a sprite the first time,
+// then only the sprite is copied while the row stays on the screen, so a step of the list renders the row entering it
+void MenuContext::drawListRow(int16_t y, const char* text, const uint8_t* icon, bool images) {
+  int16_t x = images ? layout.iconX : layout.textXNoIcon;
+  int16_t textX = images ? layout.textX : layout.textXNoIcon;
+  int16_t baseline = layout.baseline[ROW_SELECTED] - layout.rowTop[ROW_SELECTED];
+  int16_t iconY = layout.iconY[ROW_SELECTED] - layout.rowTop[ROW_SELECTED];
+  char truncated[MAX_ITEM_LENGTH];
+  text = truncateLabel(text, images ? layout.maxLength : layout.maxLengthNoIcon, truncated);
+
+  uint32_t key = hashValue(hashValue(hashText(FNV_OFFSET_BASIS, text), (uintptr_t)icon), images | layout.rowHeight << 1);
+  ListRow* row = &listRows[0];
+  for (int i = 0; i < MAX_LIST_ROWS + 2; i++) {
+    ListRow& entry = listRows[i];
+    if (entry.inUse && entry.key == key) {
+      row = &entry;
+      break;
+    }
+    if (!entry.inUse) {
+      if (row->inUse) row = &entry;
+    } else if (row->inUse && entry.lastUsed < row->lastUsed) {
+      row = &entry;
     }
-
-    PreviousButtonState = upButtonState;
   }
 
-
-  if (BUTTON_DOWN_PIN != NULL) {
-    ///////////////////////IF REMOVED, THE SHORT PRESS DOESN'T DO ANYTHING #Bug////////////////////////////////
-    if ((digitalRead(BUTTON_DOWN_PIN) == buttonVoltage) && (button_down_clicked_settings == 0)) {  // up button clicked - jump to previous menu item
-      item_selected_settings = item_selected_settings + 1;                                         // select next item
-      button_down_clicked_settings = 1;                                                            // set button to clicked to only perform the action once
-      if (item_selected_settings >= NUM_SETTINGS_ITEMS) {                                          // if last item was selected, jump to first item
-        item_selected_settings = 0;
+  if (!row->inUse || row->key != key) {
+    // Entering the screen, render it in place of the row that left it
+    PROFILE_SCOPE(PROFILE_TEXT);
+    row->sprite.setSwapBytes(true);  // Icons in the same byte order as on the canvas
+    row->sprite.setFreeFont(&FreeMono9pt7b);
+    row->sprite.setTextSize(1);
+    row->ready = fitSprite(row->sprite, textX - x + row->sprite.textWidth(text), layout.rowHeight, 16);
+    if (row->ready) {
+      row->sprite.fillSprite(TFT_BLACK);
+      if (icon != NULL) {
+        drawImage(row->sprite, 0, iconY, ICON_SIZE, ICON_SIZE, icon);
       }
+      row->sprite.setTextColor(TFT_WHITE);
+      row->sprite.setCursor(textX - x, baseline);
+      row->sprite.print(text);
     }
+    row->key = key;
+    row->inUse = true;
+  }
+  row->lastUsed = ++listClock;
 
-    if ((digitalRead(BUTTON_DOWN_PIN) == LOW) && (button_down_clicked_settings == 1)) {  // unclick
-      button_down_clicked_settings = 0;
+  if (row->ready) {
+    PROFILE_SCOPE(PROFILE_BLIT);
+    row->sprite.pushToSprite(&canvas, x, y, TFT_BLACK);  // Black is left out, the row can slide over the selection
+  } else {
+    // Not enough memory for the row, draw it directly
+    drawLabel(textX, y + baseline, text, &FreeMono9pt7b, 0, TFT_WHITE);
+    if (icon != NULL) {
+      drawIcon(layout.iconX, y + iconY, ICON_SIZE, ICON_SIZE, icon);
     }
-    ///////////////////////////////////////////////////////
-
-    int downButtonState = digitalRead(BUTTON_DOWN_PIN);  // Read the current button state
+  }
+}
+void MenuContext::freeListRows() {
+  for (int i = 0; i < MAX_LIST_ROWS + 2; i++) {
+    listRows[i].sprite.deleteSprite();
+    listRows[i].inUse = false;
+  }
+}
+// Make sprite at least w x h, reusing its buffer when it is large enough. The caches never shrink, so they stop
+// allocating once each entry held its longest text. Once reserveSprites() ran nothing grows, returns false instead
+bool MenuContext::fitSprite(TFT_eSprite& sprite, int16_t w, int16_t h, uint8_t depth) {
+  if (sprite.created() && sprite.getColorDepth() == depth && sprite.width() >= w && sprite.height() >= h) {
+    return true;
+  }
+  if (spritesReserved || w <= 0 || h <= 0) {
+    return false;
+  }
+  sprite.deleteSprite();
+  sprite.setColorDepth(depth);
+  if (!sprite.createSprite((w + SPRITE_WIDTH_STEP - 1) / SPRITE_WIDTH_STEP * SPRITE_WIDTH_STEP, h)) {
+    return false;
+  }
+  allocationCount++;
+  return true;
+}
+// Create the 1 bit caches at the largest size they are used at, for setStaticSprites(true). The 16 bit ones (the rows
+// of the list view, the popup boxes and the toasts) take as much memory as the canvas, they are drawn directly instead
+void MenuContext::reserveSprites() {
+  spritesReserved = false;
+  int16_t ascent, descent, boldAscent, boldDescent;
+  fontMetrics(&FreeMono9pt7b, ascent, descent);
+  fontMetrics(&FreeMonoBold9pt7b, boldAscent, boldDescent);
+  for (int i = 0; i < MAX_LABEL_MASKS; i++) {
+    fitSprite(labelMasks[i].mask, tftWidth, max(ascent + descent, boldAscent + boldDescent), 1);
+    labelMasks[i].inUse = false;
+  }
+  for (int i = 0; i < MAX_TEXT_SCROLLERS; i++) {
+    fitSprite(textScrollers[i].strip, tftWidth * STATIC_STRIP_SCREENS, boldAscent + boldDescent, 1);
+    textScrollers[i].textKey = 0;
+  }
+  fitSprite(cornerTile, TILE_ROUND_RADIUS * 2, TILE_ROUND_RADIUS * 2, 16);
+  freeListRows();
+  popupBox.sprite.deleteSprite();
+  toastBox.sprite.deleteSprite();
+  spritesReserved = true;
+}
+// The box of a popup without its message: the coloured header with the icon, then the title
+void MenuContext::drawPopupBox(TFT_eSprite& target, int16_t x, int16_t y, int16_t w, int16_t h, int type) {
+  const PopupStyle& style = popupStyle(type);
+  int header = (h * POPUP_HEADER_PERCENT) / 100;
+  fillRounded(target, x, y, w, h, POPUP_RADIUS, TFT_WHITE, TFT_BLACK);
+  fillRounded(target, x, y, w, header + POPUP_RADIUS, POPUP_RADIUS, style.color, TFT_BLACK);
+  target.fillRect(x, y + header, w, POPUP_RADIUS, TFT_WHITE);  // Hide the bottom corners of the header to make it flat
+  drawImage(target, x + (w - style.iconW) / 2, y + (header - style.iconH) / 2 + 1, style.iconW, style.iconH, style.icon);
+
+  target.setFreeFont(&FreeMonoBold9pt7b);  // Before measuring the title
+  target.setTextSize(1);
+  target.setTextColor(TFT_BLACK);
+  target.setCursor(x + (w - target.textWidth(style.title)) / 2, y + header + 14);
+  target.print(style.title);
+}
+uint32_t MenuContext::hashStyle(uint32_t hash) const {
+  hash = hashValue(hash, menuStyle | scrollbarStyle << 8 | textScroll << 16 | buttonAnimation << 17 | scrollbar << 18 | fastShapes() << 19 | listView << 20 | listVisibleRows << 21);
+  hash = hashValue(hash, selectionBorderColor | (uint32_t)selectionFillColor << 16);
+  return hashValue(hash, scrollbarColor);
+}
+bool MenuContext::fastShapes() const {
+  return fastRendering || quality >= QUALITY_FAST_SHAPES;
+}
+bool MenuContext::dirtyPushes() const {
+  return dirtyRectMode || quality >= QUALITY_DIRTY_RECTS;
+}
 
-    if (downButtonState == HIGH && !ButtonPressProcessed) {
-      if (PreviousButtonState == LOW) {
-        pressedTime = millis();
-        isPressing = true;
-        isLongDetected = false;  // Ensure long press flag is reset each time button is pressed
-        ButtonPressProcessed = true;
-      }
-    }
+// Give a cache sprite the display. TFT_eSprite reads it when allocating (PSRAM and DMA on ESP32), and the arrays of
+// caches can only be built with the default constructor of their entries
+static void attachSprite(TFT_eSprite& sprite, TFT_eSPI* display) {
+  sprite.~TFT_eSprite();
+  new (&sprite) TFT_eSprite(display);
+}
 
-    if (isPressing && !isLongDetected) {
-      long pressDuration = millis() - pressedTime;
+MenuContext::MenuContext(TFT_eSPI& display, TFT_eSprite* sprite)
+  : tft(display), canvas(sprite != NULL ? *sprite : *new TFT_eSprite(&display)), ownsCanvas(sprite == NULL), cornerTile(&display) {
+  for (int i = 0; i < MAX_TEXT_SCROLLERS; i++) {
+    attachSprite(textScrollers[i].strip, &display);
+  }
+  for (int i = 0; i < MAX_LABEL_MASKS; i++) {
+    attachSprite(labelMasks[i].mask, &display);
+  }
+  for (int i = 0; i < MAX_LIST_ROWS + 2; i++) {
+    attachSprite(listRows[i].sprite, &display);
+  }
+  attachSprite(popupBox.sprite, &display);
+  attachSprite(toastBox.sprite, &display);
+}
+MenuContext::~MenuContext() {
+  if (ownsCanvas) {
+    delete &canvas;
+  }
+}
 
-      if (pressDuration > LONG_PRESS_TIME_MENU) {
-        isLongDetected = true;
-      }
-    }
-    if (isPressing && isLongDetected) {
-      static unsigned long lastTempAdjustTime = 0;
-      unsigned long currentMillis = millis();
-      if (currentMillis - lastTempAdjustTime >= 200) {        // Check if 200ms have passed
-        item_selected_settings = item_selected_settings + 1;  // select next item
-        if (item_selected_settings >= NUM_SETTINGS_ITEMS) {   // if last item was selected, jump to first item
-          item_selected_settings = 0;
-        }
-        lastTempAdjustTime = currentMillis;  // Update the last adjustment time
-      }
-    }
+OpenMenuOS::OpenMenuOS(int btn_up, int btn_down, int btn_sel, int tft_bl)
+  : MenuContext(::tft, &::canvas) {
+  init(btn_up, btn_down, btn_sel, tft_bl);
+}
+OpenMenuOS::OpenMenuOS(TFT_eSPI& display, int btn_up, int btn_down, int btn_sel, int tft_bl)
+  : MenuContext(display, NULL) {
+  init(btn_up, btn_down, btn_sel, tft_bl);
+}
+void OpenMenuOS::init(int btn_up, int btn_down, int btn_sel, int tft_bl) {
+  memcpy(menu_items_settings_bool, defaultSettings, sizeof(menu_items_settings_bool));
+  upPin = btn_up;
+  downPin = btn_down;
+  selectPin = btn_sel;
+  backlightPin = tft_bl;
 
-    if (downButtonState == LOW && PreviousButtonState == HIGH) {
-      isPressing = false;
-      releasedTime = millis();
+  NUM_MENU_ITEMS = 0;
+  NUM_SUBMENU_ITEMS = 0;
+  NUM_MENU_MODELS = 0;
+  menu_items_generation = 0;
+  submenu_items_generation = 0;
+  main_menu = arenaMenu(menu_items, 0);
+  sub_menu = arenaMenu(submenu_items, 0);
+#ifdef ESP32
+  uiTask = NULL;
+  uiStarter = NULL;
+  uiCommands = NULL;
+  uiEvents = NULL;
+  uiRender = NULL;
+  uiRenderContext = NULL;
+  uiRotation = 0;
+#endif
+}
 
-      long pressDuration = releasedTime - pressedTime;
+void OpenMenuOS::begin(int rotation) {  //  Display Rotation
+  unsigned long start = millis();
+  // Set up display
+  tft.init();
+  tft.setRotation(rotation);
 
-      // Determine the type of press based on the duration
-      if (pressDuration >= LONG_PRESS_TIME_MENU) {
-        isLongDetected = true;
-      } else {
-        isLongDetected = false;
-      }
+  tftWidth = tft.width();
+  tftHeight = tft.height();
+  updateLayout();
 
-      // Check if it was a short press and long press was not detected
-      if (pressDuration < SHORT_PRESS_TIME && !isLongDetected) {
-        // item_selected_settings = item_selected_settings + 1;  // select next item
-        // if (item_selected_settings >= NUM_SETTINGS_ITEMS) {   // if last item was selected, jump to first item
-        //   item_selected_settings = 0;
-        // }
+  // Show The Boot image if bootImage is true
+  bool bootDMA = false;  // The boot image may still be sent, createCanvas() can turn dmaMode off meanwhile
+  if (bootImage) {
+    // A compressed boot image is centered with its own size, a raw one is 160 x 80
+    uint16_t bootW = 160, bootH = 80;
+    getImageSize(Boot_img, bootW, bootH);
+    if (fastStartup) {
+      // Sent in one window as it is decoded, with DMA the canvas and the settings below are set up during the last part
+#ifdef ESP32
+      if (dmaMode) {
+        tft.initDMA();
       }
-      ButtonPressProcessed = false;  // Reset the control variable when the button is not pressed anymore
+#endif
+      bootDMA = dmaMode;
+      streamImage(tft, (tftWidth - bootW) / 2, (tftHeight - bootH) / 2, bootW, bootH, Boot_img, bootDMA);
+    } else {
+      drawImage(tft, (tftWidth - bootW) / 2, (tftHeight - bootH) / 2, bootW, bootH, Boot_img);
     }
+  }
 
-    PreviousButtonState = downButtonState;
+  tft.setTextWrap(false);
+  canvas.setSwapBytes(true);
+  createCanvas();
+  canvas.fillSprite(TFT_BLACK);
+  if (staticSprites) {
+    reserveSprites();
   }
-  // Calculate the position of the rectangle
-  uint16_t rect_x = 0;
-  uint16_t rect_y = (tftHeight - rect_height) / 2;  // Center the rectangle vertically
+  allocationCount = 0;
 
-  uint16_t selectedItemColor;
+  item_selected = 0;
+  current_screen = 0;  // 0 = Menu, 1 = Submenu
 
-  canvas.fillRoundRect(rect_x + 1, rect_y - 25, rect_width - 3, rect_height - 3, 4, TFT_BLACK);  // Remove Old Text. Change it by setting old text's color to white? (May be slower and more complicated??)
-  canvas.fillRoundRect(rect_x + 1, rect_y - 1, rect_width - 3, rect_height - 3, 4, TFT_BLACK);
-  canvas.fillRoundRect(rect_x + 1, rect_y + 27, rect_width - 3, rect_height - 3, 4, TFT_BLACK);
+  // Load the settings, or save the default ones if there are none yet
+  if (settingsStore.begin(settingsId)) {
+    readFromEEPROM();
+  } else {
+    saveToEEPROM();
+  }
 
-  switch (menuStyle) {
-    case 0:
-      if (digitalRead(BUTTON_SELECT_PIN) == buttonVoltage && buttonAnimation) {
-        // canvas.drawRoundRect(rect_x + 1, rect_y + 1, rect_width - 2, rect_height - 1, 4, selectionBorderColor);  // Display the rectangle
-        canvas.drawSmoothRoundRect(rect_x + 1, rect_y + 1, 4, 4, rect_width - 2, rect_height - 1, selectionBorderColor, TFT_BLACK);  // Display the rectangle || The "-2" should be determined dynamicaly
+  // Set backlightPin as OUTPUT and se it HIGH or LOW depending on the settings
+  pinMode(backlightPin, OUTPUT);
+  digitalWrite(backlightPin, menu_items_settings_bool[0] ? LOW : HIGH);
 
-      } else {
-        if (!scrollbar) {
-          canvas.drawSmoothRoundRect(rect_x, rect_y, 4, 4, rect_width, rect_height, selectionBorderColor, TFT_BLACK);  // Display the rectangle || The "-2" should be determined dynamicaly
-          canvas.drawFastVLine(tftWidth - 2, 29, 23, selectionBorderColor);                                            // Display the inside part
-          canvas.drawFastVLine(tftWidth, 29, 22, selectionBorderColor);                                                // Display the Shadow
-          canvas.drawFastHLine(2, 51, tftWidth - 3, selectionBorderColor);                                             // Display the inside part
-          canvas.drawFastHLine(3, 51, tftWidth - 4, selectionBorderColor);                                             // Display the Shadow
-        } else {
-          canvas.drawSmoothRoundRect(rect_x, rect_y, 4, 4, rect_width - 2, rect_height, selectionBorderColor, TFT_BLACK);  // Display the rectangle || The "-2" should be determined dynamicaly
-          canvas.drawFastVLine(rect_width - 4, rect_y + 2, 23, selectionBorderColor);                                      // Display the inside part
-          canvas.drawFastVLine(rect_width - 3, rect_y + 2, 22, selectionBorderColor);                                      // Display the Shadow
-          canvas.drawFastHLine(2, 51, 149, selectionBorderColor);                                                          // Display the inside part
-          canvas.drawFastHLine(3, 52, 148, selectionBorderColor);                                                          // Display the Shadow
-        }
-      }
-      selectedItemColor = TFT_WHITE;
-      break;
-    case 1:
-      // canvas.fillRoundRect(rect_x, rect_y, rect_width, rect_height, 4, selectionBorderColor);  // Display the rectangle
-      canvas.fillSmoothRoundRect(rect_x, rect_y, rect_width, rect_height, 4, selectionBorderColor, TFT_BLACK);  // Display the rectangle || The "-2" should be determined dynamicaly
+  // Set up button pins, BUTTON_NO_PIN for a button that isn't there
+  if (upPin >= 0) pinMode(upPin, buttonsMode);
 
-      selectedItemColor = TFT_BLACK;
+  if (downPin >= 0) pinMode(downPin, buttonsMode);
 
-      break;
+  if (selectPin >= 0) pinMode(selectPin, buttonsMode);
+
+  buttons.setButton(BUTTON_UP, upPin, LONG_PRESS_TIME_MENU, REPEAT_TIME_MENU);
+  buttons.setButton(BUTTON_DOWN, downPin, LONG_PRESS_TIME_MENU, REPEAT_TIME_MENU);
+  buttons.setButton(BUTTON_SELECT, selectPin, SELECT_BUTTON_LONG_PRESS_DURATION, 0);
+  buttons.begin(buttonVoltage);
+#ifdef ESP32
+  if (bootDMA) {
+    tft.dmaWait();  // The boot image is complete before anything else is drawn
+  }
+#endif
+  startupTime = millis() - start;
+}
+void OpenMenuOS::setFastStartup(bool x) {
+  fastStartup = x;
+}
+void OpenMenuOS::setStaticSprites(bool x) {
+  staticSprites = x;
+  if (!x) {
+    spritesReserved = false;
+  } else if (canvas.created()) {  // Called after begin()
+    reserveSprites();
+  }
+}
+uint32_t OpenMenuOS::getAllocationCount() const {
+  return allocationCount;
+}
+void OpenMenuOS::setMirror(Stream* stream) {
+  mirror.begin(stream);
+  redrawRequested = true;  // The viewer gets the whole screen with the next frame
+}
+uint32_t OpenMenuOS::getMirrorBytes() const {
+  return mirror.bytesSent();
+}
+unsigned long OpenMenuOS::getStartupTime() const {
+  return startupTime;
+}
+unsigned long OpenMenuOS::getFirstFrameTime() const {
+  return firstFrameTime;
+}
+bool OpenMenuOS::setSPIFrequency(uint32_t frequency) {
+#if defined(SPI_FREQUENCY) && !defined(TFT_PARALLEL_8_BIT)
+  SPIClass& spi = tft.getSPIinstance();
+  uint32_t previous = spiFrequency != 0 ? spiFrequency : SPI_FREQUENCY;
+  if (spiFrequency == 0 && !dmaMode) {
+    tft.startWrite();  // Keep the display selected like in DMA mode, each new transaction would set SPI_FREQUENCY again
+  }
+  spi.setFrequency(frequency);
+  spiFrequency = frequency;
+  fullRedrawPending = true;  // The pixels of the check are replaced by the next frame
+  if (!checkSPI()) {
+    spi.setFrequency(previous);
+    spiFrequency = previous;
+    return false;
+  }
+  return true;
+#else
+  (void)frequency;
+  return false;  // The clock is only known to the SPI displays
+#endif
+}
+uint32_t OpenMenuOS::getSPIFrequency() const {
+#ifdef SPI_FREQUENCY
+  return spiFrequency != 0 ? spiFrequency : SPI_FREQUENCY;
+#else
+  return 0;
+#endif
+}
+// Write a few pixels at the new frequency and read them back, on the panels wired for reading (TFT_MISO)
+bool OpenMenuOS::checkSPI() {
+#if defined(SPI_FREQUENCY) && defined(TFT_MISO) && defined(SPI_READ_FREQUENCY)
+  if (TFT_MISO < 0) return true;
+  static const uint16_t pattern[] = { TFT_RED, TFT_GREEN, TFT_BLUE, TFT_WHITE };
+  const int count = sizeof(pattern) / sizeof(pattern[0]);
+  for (int i = 0; i < count; i++) {
+    tft.drawPixel(i, 0, pattern[i]);
   }
-  int xPos = 10;   // X Position of text 0
-  int yPos = 17;   // Y Position of text 0
-  int x1Pos = 10;  // X Position of text 1
-  int y1Pos = 44;  // Y Position of text 1
-  int x2Pos = 10;  // X Position of text 2
-  int y2Pos = 70;  // Y Position of text 2
-  int scrollWindowSize = 100;
+  SPIClass& spi = tft.getSPIinstance();
+  spi.setFrequency(SPI_READ_FREQUENCY);  // Most panels read much slower than they write
+  bool valid = true;
+  for (int i = 0; i < count; i++) {
+    valid = valid && tft.readPixel(i, 0) == pattern[i];
+  }
+  spi.setFrequency(spiFrequency);
+  return valid;
+#else
+  return true;  // Nothing to read back with
+#endif
+}
+bool OpenMenuOS::loop() {
+  if (governor.active() && governor.idleTime(micros()) > 0) {
+    // Not due yet, the time is left to the sketch. The button presses wait in the queue for the frame
+    settingsStore.update();
+    buttons.update();
+    pollMirror();
+    frameSkipped = true;
+    return false;
+  }
+  frameSkipped = false;
+  governor.beginFrame(micros());
+  quality = governor.quality();
+#ifdef OPENMENUOS_PROFILE
+  profiler.beginFrame();
+#endif
+  {
+    PROFILE_SCOPE(PROFILE_INPUT);
+    settingsStore.update();
+    buttons.update();
+    pollMirror();
+    ButtonEvent event;
+    while (buttons.read(event)) {
+      int screen = current_screen;
+      int screenTileMenu = current_screen_tile_menu;
+      int node = getCurrentNode();
+      handleButtonEvent(event);
+      if (current_screen != screen || current_screen_tile_menu != screenTileMenu || getCurrentNode() != node) {
+        break;  // The next events wait for the new screen to be drawn, as what they do depends on it
+      }
+    }
+  }
+  activeView = VIEW_NONE;
+  treeShown = false;
+  frameTimeSet = false;  // A new frame starts, its animations take a new time
 
-  // draw previous item as icon + label
-  canvas.setFreeFont(&FreeMono9pt7b);
-  canvas.setTextSize(1);
-  canvas.setTextColor(TFT_WHITE, TFT_BLACK);
-  canvas.setCursor(xPos, yPos);
+  PROFILE_SCOPE(PROFILE_BLIT);
+  canvas.fillSprite(TFT_BLACK);  // Set the background of the canvas/sprite to black instead of transparent
+  return true;
+}
+void OpenMenuOS::drawMenu(bool images, const char* names...) {
+  PROFILE_SCOPE(PROFILE_MENU);
+  va_list args;
+  va_start(args, names);
+  if (menu_items.assign(MAX_LIST_ITEMS, names, args)) {
+    menu_items_generation++;
+  }
+  va_end(args);
+  main_menu = arenaMenu(menu_items, menu_items_generation);
+  NUM_MENU_ITEMS = main_menu.count;
 
-  // Get the text of the previous item
-  String previousItem = menu_items_settings[item_selected_settings_previous];
+  checkForButtonPress();  // Check for button presses to control the menu
+  drawMenuItems(SCENE_MENU, main_menu, item_sel_previous, item_selected, item_sel_next, images);
+}
+void OpenMenuOS::drawMenu(int handle, bool images) {
+  if (handle < 0 || handle >= NUM_MENU_MODELS) return;
+  countSource(menu_models[handle], item_selected);
+  main_menu = menu_models[handle];
+  NUM_MENU_ITEMS = main_menu.count;
 
-  // Check if the length of the text exceeds the maximum length for non-scrolling items
-  if (previousItem.length() > MAX_SETTING_ITEM_LENGTH_NOT_SCROLLING) {
-    // Truncate the text and add "..." at the end
-    previousItem = previousItem.substring(0, MAX_SETTING_ITEM_LENGTH_NOT_SCROLLING - 3) + "...";
+  checkForButtonPress();  // Check for button presses to control the menu
+  drawMenuItems(SCENE_MENU, main_menu, item_sel_previous, item_selected, item_sel_next, images);
+  prefetchSource(main_menu, item_selected);
+}
+void OpenMenuOS::drawSubmenu(bool images, const char* names...) {
+  PROFILE_SCOPE(PROFILE_MENU);
+  va_list args;
+  va_start(args, names);
+  if (submenu_items.assign(MAX_LIST_ITEMS, names, args)) {
+    submenu_items_generation++;
   }
+  va_end(args);
+  sub_menu = arenaMenu(submenu_items, submenu_items_generation);
+  NUM_SUBMENU_ITEMS = sub_menu.count;
 
-  // Print the modified text
-  canvas.println(previousItem);
-
-  /////// Variables for the toggle buttons ///////
-  int rectWidth = 41;
-  int rectHeight = 20;
-  int rectRadius = 10;
+  checkForButtonPressSubmenu();  // Check for button presses to control the submenu
+  drawMenuItems(SCENE_SUBMENU, sub_menu, item_sel_previous_submenu, item_selected_submenu, item_sel_next_submenu, images);
+}
+void OpenMenuOS::drawSubmenu(int handle, bool images) {
+  if (handle < 0 || handle >= NUM_MENU_MODELS) return;
+  countSource(menu_models[handle], item_selected_submenu);
+  sub_menu = menu_models[handle];
+  NUM_SUBMENU_ITEMS = sub_menu.count;
 
-  int roundXOffset = 2;  // Horizontal offset for the round shape
-  int roundDiameter = 15;
-  int roundRadius = 10;
+  checkForButtonPressSubmenu();  // Check for button presses to control the submenu
+  drawMenuItems(SCENE_SUBMENU, sub_menu, item_sel_previous_submenu, item_selected_submenu, item_sel_next_submenu, images);
+  prefetchSource(sub_menu, item_selected_submenu);
+}
+// The number of items of a data source can change anytime (a scan going on...), the selection stays on an item
+void OpenMenuOS::countSource(MenuModel& menu, int& selected) {
+  if (menu.source == NULL) return;
+  menu.count = max(menu.source->count(), 0);
+  if (selected >= menu.count) {
+    selected = max(menu.count - 1, 0);
+  }
+}
+// Fetch the items the next steps will show while the frame is idle, and come back for the ones still loading
+void OpenMenuOS::prefetchSource(const MenuModel& menu, int selected) {
+  if (menu.source == NULL) return;
+  int rows = listView ? max(layout.listAbove, layout.listBelow) + 1 : 1;  // Items shown on each side of the selection
+  menu.source->prefetch(selected, menu.count, rows + MENU_SOURCE_PREFETCH);
+  if (menu.source->loading()) {
+    scheduleFrame(frameNow() + MENU_SOURCE_RETRY_TIME);
+  }
+}
+int OpenMenuOS::addMenu(int id, const char* const items[], int count) {
+  for (int i = 0; i < NUM_MENU_MODELS; i++) {  // Registering the same id again only updates it
+    if (menu_models[i].id == id) {
+      updateMenu(i, items, count);
+      return i;
+    }
+  }
+  if (NUM_MENU_MODELS >= MAX_MENU_MODELS) return -1;
+
+  MenuModel& model = menu_models[NUM_MENU_MODELS];
+  model.id = id;
+  model.items = items;
+  model.provider = NULL;
+  model.context = NULL;
+  model.count = max(count, 0);
+  model.generation = 0;
+  model.entries = NULL;
+  model.nodes = NULL;
+  model.source = NULL;
+  return NUM_MENU_MODELS++;
+}
+int OpenMenuOS::addMenu(int id, MenuItemProvider provider, void* context, int count) {
+  int handle = addMenu(id, (const char* const*)NULL, 0);
+  updateMenu(handle, provider, context, count);
+  return handle;
+}
+void OpenMenuOS::updateMenu(int handle, const char* const items[], int count) {
+  if (handle < 0 || handle >= NUM_MENU_MODELS) return;
+  MenuModel& model = menu_models[handle];
+  model.items = items;
+  model.provider = NULL;
+  model.context = NULL;
+  model.count = max(count, 0);
+  model.generation++;
+  model.entries = NULL;
+  model.source = NULL;
+}
+void OpenMenuOS::updateMenu(int handle, MenuItemProvider provider, void* context, int count) {
+  if (handle < 0 || handle >= NUM_MENU_MODELS) return;
+  MenuModel& model = menu_models[handle];
+  model.items = NULL;
+  model.provider = provider;
+  model.context = context;
+  model.count = provider != NULL ? max(count, 0) : 0;
+  model.generation++;
+  model.entries = NULL;
+  model.source = NULL;
+}
+int OpenMenuOS::addMenu(int id, const MenuEntry entries[], int count) {
+  int handle = addMenu(id, (const char* const*)NULL, 0);
+  updateMenu(handle, entries, count);
+  return handle;
+}
+void OpenMenuOS::updateMenu(int handle, const MenuEntry entries[], int count) {
+  if (handle < 0 || handle >= NUM_MENU_MODELS) return;
+  MenuModel& model = menu_models[handle];
+  model.items = NULL;
+  model.provider = NULL;
+  model.context = NULL;
+  model.count = entries != NULL ? max(count, 0) : 0;
+  model.generation++;
+  model.entries = entries;
+  model.source = NULL;
+}
+int OpenMenuOS::addMenu(int id, MenuDataSource& source) {
+  int handle = addMenu(id, (const char* const*)NULL, 0);
+  updateMenu(handle, source);
+  return handle;
+}
+void OpenMenuOS::updateMenu(int handle, MenuDataSource& source) {
+  if (handle < 0 || handle >= NUM_MENU_MODELS) return;
+  MenuModel& model = menu_models[handle];
+  model.items = NULL;
+  model.provider = sourceItem;
+  model.context = &source;
+  model.count = max(source.count(), 0);
+  model.generation++;
+  model.entries = NULL;
+  model.source = &source;
+}
+bool OpenMenuOS::getMenuEntry(int handle, int index, MenuEntry& entry) const {
+  if (handle < 0 || handle >= NUM_MENU_MODELS) return false;
+  const MenuModel& model = menu_models[handle];
+  if (model.entries == NULL || index < 0 || index >= model.count) return false;
+  memcpy_P(&entry, &model.entries[index], sizeof(MenuEntry));
+  return true;
+}
+void OpenMenuOS::setMenuTree(const MenuNode nodes[], int count, int root) {
+  menuTree = nodes;
+  menuTreeSize = nodes != NULL ? max(count, 0) : 0;
+  treeDepth = 0;
+  treeSelected = 0;
+  if (root >= 0 && root < menuTreeSize) {
+    treePath[treeDepth++] = root;
+  }
+  sceneAnimations[SCENE_MENU].selected = -1;  // The list appears without sliding from the previous one
+  redrawRequested = true;
+}
+// The list of the current node, or its page. Only the current node is looked at, whatever the depth
+void OpenMenuOS::drawMenuTree(bool images) {
+  if (treeDepth == 0) return;
+  treeShown = true;
+  int node = treePath[treeDepth - 1];
+  int first = nodeWord(menuTree[node].firstChild);
+  int count = min((int)nodeWord(menuTree[node].childCount), menuTreeSize - first);
+  if (count <= 0) {
+    MenuNodeCallback onRender = nodeCallback(menuTree[node].onRender);
+    if (onRender != NULL) {
+      onRender(*this, node);
+    }
+    return;
+  }
+  // The children are read from the array of nodes, like the entries of a menu in flash
+  MenuModel children = { -1, NULL, NULL, NULL, count, 0, NULL, &menuTree[first], NULL };
+  treeSelected = constrain(treeSelected, 0, count - 1);
+  int previous = treeSelected > 0 ? treeSelected - 1 : count - 1;
+  int next = treeSelected < count - 1 ? treeSelected + 1 : 0;
+  drawMenuItems(SCENE_MENU, children, previous, treeSelected, next, images);
+}
+void OpenMenuOS::openNode(int node) {
+  if (treeDepth == 0 || node < 0 || node >= menuTreeSize) return;
+  // Path from the node up to the root, in reverse
+  int16_t path[MAX_TREE_DEPTH];
+  int depth = 0;
+  for (int n = node; n >= 0 && n < menuTreeSize && depth < MAX_TREE_DEPTH; n = nodeWord(menuTree[n].parent)) {
+    path[depth++] = n;
+    if (n == treePath[0]) break;
+  }
+  if (path[depth - 1] != treePath[0]) return;  // Not under the root of the tree
+  for (int i = 0; i < depth / 2; i++) {
+    int16_t n = path[i];
+    path[i] = path[depth - 1 - i];
+    path[depth - 1 - i] = n;
+  }
 
-  // int rectX = 114;
-  int rectX = 110;
-  ////////////////////////////////////////////////
+  // Go back to the part of the path both have, then down to the node
+  int common = 1;
+  while (common < treeDepth && common < depth && treePath[common] == path[common]) {
+    common++;
+  }
+  while (treeDepth > common) {
+    leaveNode();
+  }
+  for (int i = treeDepth; i < depth && treePath[treeDepth - 1] == path[i - 1]; i++) {
+    enterNode(path[i]);
+  }
+  if (getCurrentNode() != node && treePath[treeDepth - 1] == nodeWord(menuTree[node].parent)) {
+    treeSelected = node - nodeWord(menuTree[getCurrentNode()].firstChild);  // An action, or the tree is too deep for the node
+  }
+}
+// Open a child of the current node. A page or a list becomes the current node, an action only has its onEnter called
+void OpenMenuOS::enterNode(int node) {
+  bool opens = nodeWord(menuTree[node].childCount) > 0 || nodeCallback(menuTree[node].onRender) != NULL;
+  if (opens) {
+    if (treeDepth >= MAX_TREE_DEPTH) return;
+    treePath[treeDepth++] = node;
+    treeSelected = 0;
+    sceneAnimations[SCENE_MENU].selected = -1;
+    redrawRequested = true;
+  }
+  MenuNodeCallback onEnter = nodeCallback(menuTree[node].onEnter);
+  if (onEnter != NULL) {
+    onEnter(*this, node);
+  }
+}
+// Back to the parent, with the node that was left selected
+void OpenMenuOS::leaveNode() {
+  if (treeDepth <= 1) return;  // The root stays
+  int node = treePath[--treeDepth];
+  treeSelected = node - nodeWord(menuTree[treePath[treeDepth - 1]].firstChild);
+  sceneAnimations[SCENE_MENU].selected = -1;
+  redrawRequested = true;
+  MenuNodeCallback onLeave = nodeCallback(menuTree[node].onLeave);
+  if (onLeave != NULL) {
+    onLeave(*this, node);
+  }
+}
+int OpenMenuOS::getCurrentNode() const {
+  return treeDepth > 0 ? treePath[treeDepth - 1] : -1;
+}
+int OpenMenuOS::getSelectedNode() const {
+  if (treeDepth == 0) return -1;
+  int node = treePath[treeDepth - 1];
+  return nodeWord(menuTree[node].childCount) > 0 ? nodeWord(menuTree[node].firstChild) + treeSelected : -1;
+}
+int OpenMenuOS::getTreeDepth() const {
+  return treeDepth;
+}
+void OpenMenuOS::touchMenu(int handle) {
+  if (handle < 0 || handle >= NUM_MENU_MODELS) return;
+  menu_models[handle].generation++;
+}
+int OpenMenuOS::findMenu(int id) const {
+  for (int i = 0; i < NUM_MENU_MODELS; i++) {
+    if (menu_models[i].id == id) return i;
+  }
+  return -1;
+}
+uint16_t OpenMenuOS::getMenuGeneration(int handle) const {
+  if (handle < 0 || handle >= NUM_MENU_MODELS) return 0;
+  return menu_models[handle].generation;
+}
+void OpenMenuOS::drawMenuItems(uint8_t scene, const MenuModel& menu, int previous, int selected, int next, bool images) {
+  PROFILE_SCOPE(PROFILE_MENU);
+  if (listView) {
+    drawListItems(scene, menu, previous, selected, next, images);
+    return;
+  }
+  bool selectPressed = buttons.isDown(BUTTON_SELECT);
+  activeView = scene == SCENE_MENU ? VIEW_MENU : VIEW_SUBMENU;
+
+  // Only the items on the screen are asked for
+  char buffers[ROW_COUNT][MAX_ITEM_LENGTH];
+  const char* items[ROW_COUNT] = { itemText(menu, previous, buffers[ROW_PREVIOUS]), itemText(menu, selected, buffers[ROW_SELECTED]), itemText(menu, next, buffers[ROW_NEXT]) };
+
+  // The generation changes whenever the items of an array change, so their labels don't need to be hashed. Those of a provider may change anytime
+  uint32_t sceneKey = hashStyle(FNV_OFFSET_BASIS);
+  sceneKey = hashValue(sceneKey, (uintptr_t)menu.items ^ (uintptr_t)menu.provider ^ (uintptr_t)menu.context ^ (uintptr_t)menu.entries ^ (uintptr_t)menu.nodes);
+  sceneKey = hashValue(sceneKey, menu.generation | images << 16 | selectPressed << 17);
+  sceneKey = hashValue(sceneKey, menu.count);
+  sceneKey = hashValue(hashValue(hashValue(sceneKey, previous), selected), next);
+  if (menu.provider != NULL) {
+    for (int row = 0; row < ROW_COUNT; row++) {
+      sceneKey = hashText(sceneKey, items[row]);
+    }
+  }
+  beginScene(scene, sceneKey);
+  if (menu.count == 0) {
+    endScene();  // Nothing to show
+    return;
+  }
+  bool selectionMoved = animateSelection(scene, previous, selected, next, layout.rowPitch);
+  if (sceneChanged || selectionMoved) {
+    markDirty(0, 0, layout.selectionWidth, tftHeight);
+  }
 
-  if (item_selected_settings_previous >= 0) {
-    int rectY = 2;
+  uint16_t selectedItemColor = drawSelection(layout.rowTop[ROW_SELECTED] + sceneAnimations[scene].selection.value(), selectPressed);
 
-    // Calculate the vertical center of the rounded rectangle
-    int rectCenterY = rectY + (rectHeight / 2);
+  int16_t textX = images ? layout.textX : layout.textXNoIcon;
+  int16_t scrollWindowSize = images ? layout.scrollWindow : layout.scrollWindowNoIcon;
+  uint8_t maxLength = images ? layout.maxLength : layout.maxLengthNoIcon;
 
-    // Calculate the Y position for the round shape to be centered vertically
-    int roundY = rectCenterY - (roundDiameter / 2);
+  // draw previous item as icon + label
+  drawLabel(textX, layout.baseline[ROW_PREVIOUS], items[ROW_PREVIOUS], &FreeMono9pt7b, maxLength, TFT_WHITE);  // Truncated with "..." when too long
 
-    drawToggleSwitch(rectX, rectY, menu_items_settings_bool[item_selected_settings_previous]);
+  if (images && itemIcon(menu, previous) != NULL) {
+    drawIcon(layout.iconX, layout.iconY[ROW_PREVIOUS], ICON_SIZE, ICON_SIZE, itemIcon(menu, previous));
   }
-
   // draw selected item as icon + label in bold font
-  if (strlen(menu_items_settings[item_selected_settings]) > MAX_SETTING_ITEM_LENGTH_NOT_SCROLLING && textScroll) {
-    tft.setFreeFont(&FreeMonoBold9pt7b);  // Here, We don't use "canvas." because when using it, the calculated value in the "scrollTextHorizontal" function is wrong but not with "tft." #bug
-    canvas.setFreeFont(&FreeMonoBold9pt7b);
-    scrollTextHorizontal(x1Pos, y1Pos, menu_items_settings[item_selected_settings], selectedItemColor, selectionFillColor, 1, 50, scrollWindowSize);  // Adjust windowSize as needed
+  if (strlen(items[ROW_SELECTED]) > maxLength && textScroll) {
+    scrollTextHorizontal(textX, layout.baseline[ROW_SELECTED], items[ROW_SELECTED], selectedItemColor, selectionFillColor, 1, 50, scrollWindowSize);
   } else if (!textScroll) {
     // draw selected item as icon + label
-    canvas.setFreeFont(&FreeMono9pt7b);
-    canvas.setTextSize(1);
-    canvas.setTextColor(selectedItemColor, selectionFillColor);
-    canvas.setCursor(x1Pos, y1Pos);
+    drawLabel(textX, layout.baseline[ROW_SELECTED], items[ROW_SELECTED], &FreeMono9pt7b, maxLength, selectedItemColor);
+  } else {
+    drawLabel(textX, layout.baseline[ROW_SELECTED], items[ROW_SELECTED], &FreeMonoBold9pt7b, 0, selectedItemColor);
+  }
 
-    // Get the text of the selected item
-    String selectedItem = menu_items_settings[item_selected_settings];
+  if (images && itemIcon(menu, selected) != NULL) {
+    drawIcon(layout.iconX, layout.iconY[ROW_SELECTED], ICON_SIZE, ICON_SIZE, itemIcon(menu, selected));
+  }
+  // draw next item as icon + label
+  drawLabel(textX, layout.baseline[ROW_NEXT], items[ROW_NEXT], &FreeMono9pt7b, maxLength, TFT_WHITE);  // Truncated with "..." when too long
 
-    // Check if the length of the text exceeds the maximum length for non-scrolling items
-    if (selectedItem.length() > MAX_SETTING_ITEM_LENGTH_NOT_SCROLLING) {
-      // Truncate the text and add "..." at the end
-      selectedItem = selectedItem.substring(0, MAX_SETTING_ITEM_LENGTH_NOT_SCROLLING - 3) + "...";
+  if (images && itemIcon(menu, next) != NULL) {
+    drawIcon(layout.iconX, layout.iconY[ROW_NEXT], ICON_SIZE, ICON_SIZE, itemIcon(menu, next));
+  }
+  if (scrollbar) {
+    // Draw the scrollbar
+    drawScrollbar(selected, next, menu.count);
+  }
+  endScene();
+}
+// Item shown at a position of the list view, -1 for an empty row
+static int listItem(int index, int count, bool wrap) {
+  if (count <= 0) return -1;
+  if (wrap) return (index % count + count) % count;
+  return index >= 0 && index < count ? index : -1;
+}
+// The menu as a list of rows around the selected one. When the selection moves the rows slide by one row under the
+// selection rectangle, each row is copied from its sprite and only the one entering the screen is rendered
+void OpenMenuOS::drawListItems(uint8_t scene, const MenuModel& menu, int previous, int selected, int next, bool images) {
+  bool selectPressed = buttons.isDown(BUTTON_SELECT);
+  activeView = scene == SCENE_MENU ? VIEW_MENU : VIEW_SUBMENU;
+  bool wrap = menu.count >= layout.listAbove + layout.listBelow + 1;  // Like the three rows, unless an item would be shown twice
+  int first = -layout.listAbove - 1;  // A row slides in on each side while the list scrolls
+  int last = layout.listBelow + 1;
+
+  // Same key as the three rows, with the texts of all the rows shown for a provider
+  char buffer[MAX_ITEM_LENGTH];
+  uint32_t sceneKey = hashStyle(FNV_OFFSET_BASIS);
+  sceneKey = hashValue(sceneKey, (uintptr_t)menu.items ^ (uintptr_t)menu.provider ^ (uintptr_t)menu.context ^ (uintptr_t)menu.entries ^ (uintptr_t)menu.nodes);
+  sceneKey = hashValue(sceneKey, menu.generation | images << 16 | selectPressed << 17);
+  sceneKey = hashValue(sceneKey, menu.count);
+  sceneKey = hashValue(hashValue(hashValue(sceneKey, previous), selected), next);
+  if (menu.provider != NULL) {
+    for (int row = first; row <= last; row++) {
+      sceneKey = hashText(sceneKey, itemText(menu, listItem(selected + row, menu.count, wrap), buffer));
     }
+  }
+  beginScene(scene, sceneKey);
+  if (menu.count == 0) {
+    endScene();  // Nothing to show
+    return;
+  }
+  bool moved = animateSelection(scene, previous, selected, next, layout.rowPitch);
+  if (sceneChanged || moved) {
+    markDirty(0, 0, layout.selectionWidth, tftHeight);
+  }
 
-    // Print the modified text
-    canvas.println(selectedItem);
-  } else {
-    canvas.setFreeFont(&FreeMonoBold9pt7b);
-    canvas.setTextSize(1);
-    canvas.setTextColor(selectedItemColor, selectionFillColor);
-    canvas.setCursor(x1Pos, y1Pos);
-    canvas.println(menu_items_settings[item_selected_settings]);
-  }
-
-  // if (item_selected_settings >= 0 && item_selected_settings < NUM_SETTINGS_ITEMS) {
-  //   if (menu_items_settings_bool[item_selected_settings] == false) {
-  //     // canvas.drawRoundRect(114, 30, 40, 20, 11, TFT_RED);
-  //     // canvas.fillRoundRect(116, 32, 16, 16, 11, TFT_RED);
-  //     canvas.drawSmoothRoundRect(114, 29, 10, 10, 41, 20, TFT_RED, selectionBorderColor);
-  //     canvas.fillSmoothRoundRect(116, 32, 16, 16, 11, TFT_RED, selectionBorderColor);
-  //   } else {
-  //     // canvas.drawRoundRect(114, 30, 40, 20, 11, TFT_GREEN);
-  //     // canvas.fillRoundRect(136, 32, 16, 16, 11, TFT_GREEN);
-  //     canvas.drawSmoothRoundRect(114, 29, 10, 10, 41, 20, TFT_GREEN, selectionBorderColor);
-  //     canvas.fillSmoothRoundRect(136, 32, 16, 16, 11, TFT_GREEN, selectionBorderColor);
-  //   }
-  // }
-  if (item_selected_settings_previous >= 0 && item_selected_settings < NUM_SETTINGS_ITEMS) {
-    int rectY = 29;
-
-    // Calculate the vertical center of the rounded rectangle
-    int rectCenterY = rectY + (rectHeight / 2);
-
-    // Calculate the Y position for the round shape to be centered vertically
-    int roundY = rectCenterY - (roundDiameter / 2);
-    drawToggleSwitch(rectX, rectY, menu_items_settings_bool[item_selected_settings]);
+  // The rows move the other way the selection rectangle of the three rows would
+  int16_t offset = -sceneAnimations[scene].selection.value();
+  uint16_t selectedItemColor = drawSelection(layout.rowTop[ROW_SELECTED], selectPressed);
+
+  int16_t textX = images ? layout.textX : layout.textXNoIcon;
+  int16_t scrollWindowSize = images ? layout.scrollWindow : layout.scrollWindowNoIcon;
+  uint8_t maxLength = images ? layout.maxLength : layout.maxLengthNoIcon;
+
+  if (offset <= 0) first++;  // Only the side the rows come from needs the extra row
+  if (offset >= 0) last--;
+  for (int row = first; row <= last; row++) {
+    int item = listItem(selected + row, menu.count, wrap);
+    if (row == 0 || item < 0) continue;
+    const uint8_t* icon = images ? itemIcon(menu, item) : NULL;
+    drawListRow(layout.rowTop[ROW_SELECTED] + row * layout.rowPitch + offset, itemText(menu, item, buffer), icon, images);
   }
 
+  // The selected row, it only scrolls and turns bold once it reached the selection rectangle
+  const char* text = itemText(menu, selected, buffer);
+  int16_t baseline = layout.baseline[ROW_SELECTED] + offset;
+  if (offset != 0 || !textScroll) {
+    drawLabel(textX, baseline, text, &FreeMono9pt7b, maxLength, selectedItemColor);
+  } else if (strlen(text) > maxLength) {
+    scrollTextHorizontal(textX, baseline, text, selectedItemColor, selectionFillColor, 1, 50, scrollWindowSize);
+  } else {
+    drawLabel(textX, baseline, text, &FreeMonoBold9pt7b, 0, selectedItemColor);
+  }
+  if (images && itemIcon(menu, selected) != NULL) {
+    drawIcon(layout.iconX, layout.iconY[ROW_SELECTED] + offset, ICON_SIZE, ICON_SIZE, itemIcon(menu, selected));
+  }
 
-  // draw next item as icon + label
-  canvas.setFreeFont(&FreeMono9pt7b);
-  canvas.setTextSize(1);
-  canvas.setTextColor(TFT_WHITE, TFT_BLACK);
-  canvas.setCursor(x2Pos, y2Pos);
-
-  // Get the text of the next item
-  String nextItem = menu_items_settings[item_selected_settings_next];
-
-  // Check if the length of the text exceeds the maximum length for non-scrolling items
-  if (nextItem.length() > MAX_SETTING_ITEM_LENGTH_NOT_SCROLLING) {
-    // Truncate the text and add "..." at the end
-    nextItem = nextItem.substring(0, MAX_SETTING_ITEM_LENGTH_NOT_SCROLLING - 3) + "...";
-  }
-
-  // Print the modified text
-  canvas.println(nextItem);
-
-  // if ((item_selected_settings_next) < NUM_SETTINGS_ITEMS) {
-  //   if (menu_items_settings_bool[item_selected_settings_next] == false) {
-  //     // canvas.drawRoundRect(114, 56, 40, 20, 11, TFT_RED);
-  //     // canvas.fillRoundRect(116, 58, 16, 16, 11, TFT_RED);
-  //     canvas.drawSmoothRoundRect(114, 55, 10, 10, 41, 20, TFT_RED, TFT_BLACK);
-  //     canvas.fillSmoothRoundRect(116, 58, 16, 16, 11, TFT_RED, TFT_BLACK);
-  //   } else {
-  //     // canvas.drawRoundRect(114, 56, 40, 20, 11, TFT_GREEN);
-  //     // canvas.fillRoundRect(136, 58, 16, 16, 11, TFT_GREEN);
-  //     canvas.drawSmoothRoundRect(114, 55, 10, 10, 41, 20, TFT_GREEN, TFT_BLACK);
-  //     canvas.fillSmoothRoundRect(136, 58, 16, 16, 11, TFT_GREEN, TFT_BLACK);
-  //   }
-  // }
-  if (item_selected_settings_next < NUM_SETTINGS_ITEMS) {
-    int rectY = 55;
-
-    // Calculate the vertical center of the rounded rectangle
-    int rectCenterY = rectY + (rectHeight / 2);
-
-    // Calculate the Y position for the round shape to be centered vertically
-    int roundY = rectCenterY - (roundDiameter / 2);
-
-    drawToggleSwitch(rectX, rectY, menu_items_settings_bool[item_selected_settings_next]);
-  }
-
-  /////////////////////////////////////Still there only for reference purpose///////////////////////////////////////////
-
-  // if (digitalRead(BUTTON_SELECT_PIN) == buttonVoltage) {
-  //   if (previousButtonState == LOW && !buttonPressProcessed) {
-  //     if (item_selected_settings == 0) {
-  //       if (menu_items_settings_bool[0] == true) {
-  //         menu_items_settings_bool[0] = false;
-  //         digitalWrite(TFT_BL_PIN, HIGH);
-  //       } else {
-  //         menu_items_settings_bool[0] = true;
-  //         digitalWrite(TFT_BL_PIN, LOW);
-  //       }
-  //     } else if (item_selected_settings == 1) {
-  //       if (menu_items_settings_bool[1] == true) {
-  //         menu_items_settings_bool[1] = false;
-  //       } else {
-  //         menu_items_settings_bool[1] = true;
-  //       }
-  //     } else if (item_selected_settings == 2) {
-  //       if (menu_items_settings_bool[2] == true) {
-  //         menu_items_settings_bool[2] = false;
-  //       } else {
-  //         menu_items_settings_bool[2] = true;
-  //       }
-  //     } else if (item_selected_settings == 3) {
-  //       if (menu_items_settings_bool[3] == true) {
-  //         menu_items_settings_bool[3] = false;
-  //       } else {
-  //         menu_items_settings_bool[3] = true;
-  //       }
-  //     } else if (item_selected_settings == 4) {
-  //       if (menu_items_settings_bool[4] == true) {
-  //         menu_items_settings_bool[4] = false;
-  //       } else {
-  //         menu_items_settings_bool[4] = true;
-  //       }
-  //     } else if (item_selected_settings == 5) {
-  //       if (menu_items_settings_bool[5] == true) {
-  //         menu_items_settings_bool[5] = false;
-  //       } else {
-  //         menu_items_settings_bool[5] = true;
-  //       }
-  //     } else if (item_selected_settings == 6) {
-  //       if (menu_items_settings_bool[6] == true) {
-  //         menu_items_settings_bool[6] = false;
-  //       } else {
-  //         menu_items_settings_bool[6] = true;
-  //       }
-  //     } else if (item_selected_settings == 7) {
-  //       if (menu_items_settings_bool[7] == true) {
-  //         menu_items_settings_bool[7] = false;
-  //       } else {
-  //         menu_items_settings_bool[7] = true;
-  //       }
-  //     } else if (item_selected_settings == 8) {
-  //       if (menu_items_settings_bool[8] == true) {
-  //         menu_items_settings_bool[8] = false;
-  //       } else {
-  //         menu_items_settings_bool[8] = true;
-  //       }
-  //     } else if (item_selected_settings == 9) {
-  //       if (menu_items_settings_bool[9] == true) {
-  //         menu_items_settings_bool[9] = false;
-  //       } else {
-  //         menu_items_settings_bool[9] = true;
-  //       }
-  //     }
-  //     buttonPressProcessed = true;
-  //     saveToEEPROM();
-  //   }
-  //   previousButtonState = HIGH;
-  // } else {
-  //   previousButtonState = LOW;
-  //   buttonPressProcessed = false;  // Reset the control variable when the button is not pressed anymore
-  // }
-
-  //////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-  upButtonState = digitalRead(BUTTON_SELECT_PIN);  // Read the current button state
-
-  if (upButtonState == buttonVoltage && !buttonPressProcessed) {
-    if (previousButtonState == !buttonVoltage) {
-      pressedTime = millis();
-      isPressing = true;
-      isLongDetected = false;  // Ensure long press flag is reset each time button is pressed
-      buttonPressProcessed = true;
-    }
+  if (scrollbar) {
+    drawScrollbar(selected, next, menu.count);
   }
+  endScene();
+}
 
-  if (isPressing && !isLongDetected) {
-    long pressDuration = millis() - pressedTime;
+void OpenMenuOS::drawSettingMenu(const char* items...) {
+  PROFILE_SCOPE(PROFILE_MENU);
+  va_list args;
+  va_start(args, items);
+  if (menu_items_settings.assign(MAX_SETTINGS_ITEMS - 1, items, args)) {  // The first item is the backlight
+    settings_items_generation++;
+  }
+  va_end(args);
 
-    if (pressDuration > LONG_PRESS_TIME) {
-      isLongDetected = true;
+  drawSettingItems(arenaMenu(menu_items_settings, settings_items_generation));
+}
+void OpenMenuOS::drawSettingMenu(int handle) {
+  if (handle < 0 || handle >= NUM_MENU_MODELS) return;
+  int selected = 0;  // The settings keep their own selection, with the backlight first
+  countSource(menu_models[handle], selected);
+  drawSettingItems(menu_models[handle]);
+}
+void OpenMenuOS::drawSettingItems(const MenuModel& userItems) {
+  PROFILE_SCOPE(PROFILE_MENU);
+  bool selectPressed = buttons.isDown(BUTTON_SELECT);
+  activeView = VIEW_SETTINGS;
+
+  // The backlight, then the items, as many as there are settings
+  MenuModel menu = { -1, NULL, settingsItem, (void*)&userItems, 1 + min(userItems.count, MAX_SETTINGS_ITEMS - 1), userItems.generation, NULL, NULL, NULL };
+  NUM_SETTINGS_ITEMS = menu.count;
+  char buffers[ROW_COUNT][MAX_ITEM_LENGTH];
+  const char* items[ROW_COUNT] = { itemText(menu, item_selected_settings_previous, buffers[ROW_PREVIOUS]), itemText(menu, item_selected_settings, buffers[ROW_SELECTED]), itemText(menu, item_selected_settings_next, buffers[ROW_NEXT]) };
+
+  uint32_t sceneKey = hashStyle(FNV_OFFSET_BASIS);
+  sceneKey = hashValue(sceneKey, (uintptr_t)userItems.items ^ (uintptr_t)userItems.provider ^ (uintptr_t)userItems.context ^ (uintptr_t)userItems.entries ^ (uintptr_t)userItems.nodes);
+  sceneKey = hashValue(sceneKey, userItems.generation | NUM_SETTINGS_ITEMS << 16 | selectPressed << 24);
+  if (userItems.provider != NULL) {
+    for (int row = 0; row < ROW_COUNT; row++) {
+      sceneKey = hashText(sceneKey, items[row]);
     }
   }
+  sceneKey = hashValue(sceneKey, item_selected_settings_previous | item_selected_settings << 8 | item_selected_settings_next << 16);
+  sceneKey = hashValue(sceneKey, menu_items_settings_bool[item_selected_settings_previous] | menu_items_settings_bool[item_selected_settings] << 1 | menu_items_settings_bool[item_selected_settings_next] << 2);
+  beginScene(SCENE_SETTINGS, sceneKey);
+  // The knobs first, they need the items shown during the previous frame
+  bool moved = animateToggle(item_selected_settings_previous, menu_items_settings_bool[item_selected_settings_previous]);
+  moved |= animateToggle(item_selected_settings, menu_items_settings_bool[item_selected_settings]);
+  moved |= animateToggle(item_selected_settings_next, menu_items_settings_bool[item_selected_settings_next]);
+  moved |= animateSelection(SCENE_SETTINGS, item_selected_settings_previous, item_selected_settings, item_selected_settings_next, layout.rowPitch);
+  if (sceneChanged || moved) {
+    markDirty(0, 0, layout.selectionWidth, tftHeight);
+  }
 
-  if (upButtonState == !buttonVoltage && previousButtonState == buttonVoltage) {
-    isPressing = false;
-    releasedTime = millis();
-
-    long pressDuration = releasedTime - pressedTime;
+  uint16_t selectedItemColor = drawSelection(layout.rowTop[ROW_SELECTED] + sceneAnimations[SCENE_SETTINGS].selection.value(), selectPressed);
 
-    // Determine the type of press based on the duration
-    if (pressDuration >= LONG_PRESS_TIME) {
-      isLongDetected = true;
-    } else {
-      isLongDetected = false;
-    }
+  // draw previous item as label + toggle switch
+  drawLabel(layout.settingsTextX, layout.baseline[ROW_PREVIOUS], items[ROW_PREVIOUS], &FreeMono9pt7b, layout.settingsMaxLength, TFT_WHITE);  // Truncated with "..." when too long
+  if (item_selected_settings_previous >= 0) {
+    drawToggleSwitch(layout.toggleX, layout.toggleY[ROW_PREVIOUS], menu_items_settings_bool[item_selected_settings_previous], toggleKnobs[item_selected_settings_previous].value());
+  }
 
-    // Check if it was a short press and long press was not detected
-    if (pressDuration < SHORT_PRESS_TIME && !isLongDetected) {
-      if (current_screen == 1) {
-        if (item_selected_settings >= 0 && item_selected_settings < 10) {
-          menu_items_settings_bool[item_selected_settings] = !menu_items_settings_bool[item_selected_settings];
-          if (item_selected_settings == 0) {
-            digitalWrite(TFT_BL_PIN, menu_items_settings_bool[0] ? LOW : HIGH);  // Toggle TFT backlight pin based on boolean state
-          }
-          saveToEEPROM();
-        }
-      }
-    }
-    buttonPressProcessed = false;  // Reset the control variable when the button is not pressed anymore
+  // draw selected item as label in bold font + toggle switch
+  if (strlen(items[ROW_SELECTED]) > layout.settingsMaxLength && textScroll) {
+    scrollTextHorizontal(layout.settingsTextX, layout.baseline[ROW_SELECTED], items[ROW_SELECTED], selectedItemColor, selectionFillColor, 1, 50, layout.settingsScrollWindow);
+  } else if (!textScroll) {
+    drawLabel(layout.settingsTextX, layout.baseline[ROW_SELECTED], items[ROW_SELECTED], &FreeMono9pt7b, layout.settingsMaxLength, selectedItemColor);
+  } else {
+    drawLabel(layout.settingsTextX, layout.baseline[ROW_SELECTED], items[ROW_SELECTED], &FreeMonoBold9pt7b, 0, selectedItemColor);
+  }
+  if (item_selected_settings_previous >= 0 && item_selected_settings < NUM_SETTINGS_ITEMS) {
+    drawToggleSwitch(layout.toggleX, layout.toggleY[ROW_SELECTED], menu_items_settings_bool[item_selected_settings], toggleKnobs[item_selected_settings].value());
   }
 
-  previousButtonState = upButtonState;
+  // draw next item as label + toggle switch
+  drawLabel(layout.settingsTextX, layout.baseline[ROW_NEXT], items[ROW_NEXT], &FreeMono9pt7b, layout.settingsMaxLength, TFT_WHITE);  // Truncated with "..." when too long
+  if (item_selected_settings_next < NUM_SETTINGS_ITEMS) {
+    drawToggleSwitch(layout.toggleX, layout.toggleY[ROW_NEXT], menu_items_settings_bool[item_selected_settings_next], toggleKnobs[item_selected_settings_next].value());
+  }
 
   if (scrollbar) {
     // Draw the scrollbar
-    drawScrollbar(item_selected_settings, item_selected_settings_next);
+    drawScrollbar(item_selected_settings, item_selected_settings_next, NUM_SETTINGS_ITEMS);
   }
+  endScene();
 }
 void OpenMenuOS::drawToggleSwitch(int16_t x, int16_t y, bool state) {
-  uint16_t switchWidth = 40;
-  uint16_t switchHeight = 20;
+  drawToggleSwitch(x, y, state, state ? 1024 : 0);
+}
+void OpenMenuOS::drawToggleSwitch(int16_t x, int16_t y, bool state, int16_t knob) {
+  uint16_t switchWidth = TOGGLE_WIDTH;
+  uint16_t switchHeight = TOGGLE_HEIGHT;
   uint16_t knobDiameter = 16;
 
   uint16_t bgColor = state ? TFT_GREEN : TFT_RED;
   uint16_t knobColor = TFT_WHITE;
 
+  if (sceneChanged) {
+    markDirty(x, y, switchWidth, switchHeight);
+  }
+
   // Draw switch background
-  canvas.fillSmoothRoundRect(x, y, switchWidth, switchHeight, switchHeight / 2, bgColor, TFT_BLACK);
+  fillRounded(x, y, switchWidth, switchHeight, switchHeight / 2, bgColor, TFT_BLACK);
 
   // Draw knob
-  int16_t knobX = state ? x + switchWidth - knobDiameter - 2 : x + 2;
-  canvas.fillSmoothCircle(knobX + knobDiameter / 2, y + switchHeight / 2, knobDiameter / 2, knobColor, bgColor);
+  int16_t knobX = x + 2 + ((int32_t)(switchWidth - knobDiameter - 4) * knob >> 10);  // From the left (off) to the right (on)
+  fillDisc(knobX + knobDiameter / 2, y + switchHeight / 2, knobDiameter / 2, knobColor, bgColor);
 }
 
 void OpenMenuOS::drawTileMenu(int rows, int columns, int tile_color) {
-  int TILE_ROUND_RADIUS = 5;
-  int TILE_MARGIN = 2;
-  int tileWidth = (tftWidth - (columns + 1) * TILE_MARGIN) / columns;
-  int tileHeight = (tftHeight - (rows + 1) * TILE_MARGIN) / rows;
+  drawTileGrid(NULL, rows * columns, rows, columns, tile_color);
+}
+void OpenMenuOS::drawTileMenu(const TileItem tiles[], int count, int rows, int columns) {
+  drawTileGrid(tiles, count, rows, columns, TFT_BLACK);
+}
+void OpenMenuOS::drawTileGrid(const TileItem* tiles, int count, int rows, int columns, uint16_t color) {
+  PROFILE_SCOPE(PROFILE_MENU);
+  rows = max(rows, 1);
+  columns = max(columns, 1);
+  tile_menu_columns = columns;
+  tile_menu_width = (tftWidth - (columns + 1) * TILE_MARGIN) / columns;
+  tile_menu_height = (tftHeight - (rows + 1) * TILE_MARGIN) / rows;
+
+  activeView = VIEW_TILE_MENU;
+  tile_menu_count = count;
+  if (item_selected_tile_menu >= tile_menu_count) {
+    item_selected_tile_menu = 0;
+  }
 
   if (current_screen_tile_menu == 0) {
-    if (digitalRead(BUTTON_SELECT_PIN) == buttonVoltage) {
-      if (current_screen_tile_menu == 0) {
-        current_screen_tile_menu = 1;
+    // The page of the selected tile slides in
+    int16_t rowPitch = tile_menu_height + TILE_MARGIN;
+    int16_t pageTop = item_selected_tile_menu / (rows * columns) * rows * rowPitch;
+    if (bandIndex == 0) {
+      if (animations && sceneWasDrawn(SCENE_TILE_MENU)) {
+        tileScroll.moveTo(pageTop, PAGE_ANIMATION_TIME);
+      } else {
+        tileScroll.jumpTo(pageTop);
       }
-      button_select_clicked = 1;
     }
-    if ((digitalRead(BUTTON_UP_PIN) == buttonVoltage) && (button_up_clicked_tile == 0)) {  // up button clicked - jump to previous menu item
-      item_selected_tile_menu = item_selected_tile_menu + 1;                               // select previous item
-      button_up_clicked_tile = 1;                                                          // set button to clicked to only perform the action once
-      if (item_selected_tile_menu >= rows * columns) {                                     // if first item was selected, jump to last item
-        item_selected_tile_menu = 0;
-      }
+    animate(tileScroll);
+
+    // The selection isn't part of the key, only the two tiles it moved between are redrawn
+    uint32_t sceneKey = hashValue(FNV_OFFSET_BASIS, (uintptr_t)tiles);
+    sceneKey = hashValue(sceneKey, count);
+    sceneKey = hashValue(sceneKey, rows | columns << 8 | (uint32_t)color << 16);
+    sceneKey = hashValue(sceneKey, tileScroll.value());
+    beginScene(SCENE_TILE_MENU, sceneKey);
+    if (sceneChanged) {
+      markDirty(0, 0, tftWidth, tftHeight);
+    } else if (tile_menu_drawn_selected != item_selected_tile_menu) {
+      invalidateTile(tile_menu_drawn_selected);
+      invalidateTile(item_selected_tile_menu);
     }
-
-    if ((digitalRead(BUTTON_UP_PIN) == LOW) && (button_up_clicked_tile == 1)) {  // unclick
-      button_up_clicked_tile = 0;
+    if (bandIndex == 0) {
+      tile_menu_drawn_selected = item_selected_tile_menu;
     }
 
-    if ((digitalRead(BUTTON_SELECT_PIN) == LOW) && (button_select_clicked == 1)) {  // unclick
-      button_select_clicked = 0;
-    }
-
-    int row = item_selected_tile_menu / columns;
-    int col = item_selected_tile_menu % columns;
-    tile_menu_selection_X = col * (tileWidth + TILE_MARGIN) + TILE_MARGIN;
-    tile_menu_selection_Y = row * (tileHeight + TILE_MARGIN) + TILE_MARGIN;
-
-    canvas.fillSprite(TFT_BLACK);
-    canvas.setTextColor(TFT_WHITE, tile_color);
-    canvas.setTextSize(1);
-
-    for (int i = 0; i < rows * columns; ++i) {
-      int row = i / columns;
-      int col = i % columns;
-      int tileX = col * (tileWidth + TILE_MARGIN) + TILE_MARGIN;
-      int tileY = row * (tileHeight + TILE_MARGIN) + TILE_MARGIN;
-      canvas.fillSmoothRoundRect(tileX, tileY, tileWidth, tileHeight, TILE_ROUND_RADIUS, tile_color, TFT_BLACK);
+    // Only the tiles of the band that reach the display are drawn: in dirty rectangle mode, the others are already on it
+    bool drawAll = !dirtyPushes() || fullRedrawPending || sceneChanged || current_screen != lastPushedScreen || scenesDrawn != scenesDrawnPrevious;
+    int firstRow = tileScroll.value() / rowPitch;
+    int lastRow = min((tileScroll.value() + tftHeight) / rowPitch, (count - 1) / columns);
+    for (int i = firstRow * columns; i < count && i / columns <= lastRow; i++) {
+      int16_t tileX, tileY;
+      tilePosition(i, tileX, tileY);
+      if (tileY + tile_menu_height <= bandTop || tileY >= bandTop + bandHeight) continue;
+      if (!drawAll && !regionDirty(tileX, tileY, tile_menu_width, tile_menu_height)) continue;
+
+      bool selected = i == item_selected_tile_menu;
+      drawTileBackground(tileX, tileY, tile_menu_width, tile_menu_height, tiles != NULL ? tiles[i].color : color);
+      if (tiles != NULL) {
+        drawTileContent(tiles[i], i, tileX, tileY, tile_menu_width, tile_menu_height, selected);
+      }
+      if (selected) {
+        drawRounded(tileX, tileY, tile_menu_width, tile_menu_height, TILE_ROUND_RADIUS, TFT_WHITE, TFT_BLACK);
+      }
     }
-    canvas.drawSmoothRoundRect(tile_menu_selection_X, tile_menu_selection_Y, TILE_ROUND_RADIUS, TILE_ROUND_RADIUS, tileWidth, tileHeight, TFT_WHITE, TFT_BLACK);
   } else if (current_screen_tile_menu == 1) {
-    delay(200);
-    if (digitalRead(BUTTON_SELECT_PIN) == buttonVoltage) {
-      if (current_screen_tile_menu == 1) {
-        current_screen_tile_menu = 0;
-        delay(200);
-      }
+    beginScene(SCENE_TILE_MENU, hashValue(FNV_OFFSET_BASIS, current_screen_tile_menu));
+    if (sceneChanged) {
+      markDirty(0, 0, tftWidth, tftHeight);
     }
     canvas.fillSprite(TFT_BLACK);
     canvas.setFreeFont(nullptr);
   }
+  endScene();
+}
+void OpenMenuOS::invalidateTile(int index) {
+  if (index < 0 || index >= tile_menu_count) return;
+  int16_t x, y;
+  tilePosition(index, x, y);
+  markDirty(x - 1, y - 1, tile_menu_width + 2, tile_menu_height + 2);  // With the border of the selection, which is drawn over the margin
+  redrawRequested = true;
 }
 void OpenMenuOS::redirectToMenu(int screen, int item) {
+  redrawRequested = true;
   current_screen = screen;
   if (current_screen == 0) {
     item_selected = item;
@@ -1053,206 +1601,319 @@ void OpenMenuOS::redirectToMenu(int screen, int item) {
   }
 }
 void OpenMenuOS::drawPopup(char* message, bool& clicked, int type) {
-  static bool selectClicked = false;
-  uint16_t color;
-  char* title;
-  int iconW, iconH;
-  int iconX, iconY;
-  int spaceBetweenPopup = 3;   // The space between the screen limits and the popup
-  int coloredPercentage = 30;  // The percentage of the colored section. Change to 25????
-  int popupWidth = tftWidth - spaceBetweenPopup * 2;
-  int popupHeight = tftHeight - spaceBetweenPopup * 2;
-  int buttonWidth = popupWidth / 3;
-  int buttonHeight = popupHeight / 5;
-  int buttonX = (tftWidth - buttonWidth) / 2;                      // X position of the OK button
-  int buttonY = tftHeight - buttonHeight - spaceBetweenPopup - 3;  // Y position of the OK button
-  int radius = 5;                                                  // The radius of the popup's corners
-  // Set color depending on popup type (Warning, Success, Info)
-  switch (type) {
-    case 1:  // Warning
-      color = 0xf2aa;
-      title = "Warning!";
-      iconW = 21;
-      iconH = 18;
-      break;
-    case 2:  // Success
-      color = 0x260f;
-      title = "Success!";
-      iconW = 13;
-      iconH = 10;
-      break;
-    case 3:  // Info
-      color = 0x453e;
-      title = "Info";
-      iconW = 6;
-      iconH = 14;
-      break;
-  }
-
-  // Determine icon's positionning
-  iconX = (tftWidth - iconW) / 2;                                                           // Center the icon on the X axis
-  iconY = (((popupHeight * coloredPercentage) / 100) - iconH) / 2 + spaceBetweenPopup + 1;  // Center the icon on the Y axis
-
-  // Check if the select button is pressed and hasn't been clicked before
-  if (digitalRead(BUTTON_SELECT_PIN) == buttonVoltage && !selectClicked) {
-    selectClicked = true;
+  // Check if the select button was pressed while the popup was shown
+  activeView = VIEW_POPUP;
+  if (popupClicked) {
+    popupClicked = false;
     clicked = true;
   }
-
-  // If select button not clicked, draw the popup
-
-  // Draw the background of the popupcanvas.fillSprite
-  canvas.fillSprite(TFT_BLACK);  // Uncomment?
-  canvas.fillSmoothRoundRect(spaceBetweenPopup, spaceBetweenPopup, tftWidth - spaceBetweenPopup * 2, popupHeight, radius, TFT_WHITE, TFT_BLACK);
-  canvas.fillSmoothRoundRect(spaceBetweenPopup, spaceBetweenPopup, tftWidth - spaceBetweenPopup * 2, ((popupHeight * coloredPercentage) / 100) + radius, radius, color, TFT_BLACK);  // The colored part is 34% of the height of the popup
-
-  // To be corrected, Y not placed correctly when popup is another size #bug
-  canvas.fillRect(spaceBetweenPopup, ((popupHeight * coloredPercentage) / 100) + radius, tftWidth - spaceBetweenPopup * 2, radius, TFT_WHITE);  // Hide the bottom part of the colored rounded rectangle to make it flat
-
-
-
-  switch (type) {
-    case 1:  // Warning
-      canvas.pushImage(iconX, iconY, iconW, iconH, (uint16_t*)Warning_icon);
-      break;
-    case 2:  // Success
-      canvas.pushImage(iconX, iconY, iconW, iconH, (uint16_t*)Success_icon);
-      break;
-    case 3:  // Info
-      canvas.pushImage(iconX, iconY, iconW, iconH, (uint16_t*)Info_icon);
-      break;
+  drawPopupScene(SCENE_POPUP, message, type);
+}
+// A popup over the whole screen. Its box is rendered once into popupBox, only the message is drawn every frame
+void OpenMenuOS::drawPopupScene(uint8_t scene, const char* message, int type) {
+  PROFILE_SCOPE(PROFILE_MENU);
+  int popupWidth = tftWidth - POPUP_MARGIN * 2;
+  int popupHeight = tftHeight - POPUP_MARGIN * 2;
+  int titleY = POPUP_MARGIN + (popupHeight * POPUP_HEADER_PERCENT) / 100 + 14;  // As in drawPopupBox()
+
+  beginScene(scene, hashValue(hashText(FNV_OFFSET_BASIS, message), type));
+  if (sceneChanged) {
+    markDirty(0, 0, tftWidth, tftHeight);
   }
+  canvas.fillSprite(TFT_BLACK);
 
-  // Calculate message area dimensions
-  int messageAreaWidth = tftWidth - 40;
-  int messageAreaHeight = buttonY - 40;  // Gap between button and top of popup
-  int messageAreaX = (tftWidth - messageAreaWidth) / 2;
-  int messageAreaY = 50;  // Adjust the position as needed
-  int titleAreaWidth = tftWidth - 40;
-  int titleAreaHeight = buttonY - 40;                               // Gap between button and top of popup
-  int titleAreaX = (tftWidth - titleAreaWidth) / 2;                 // Center title horizontally
-  int titleAreaY = ((popupHeight * coloredPercentage) / 100) + 17;  // Adjust the position as needed
-
-  // Draw the message
-  uint16_t messageWidth = canvas.textWidth(message);
-  uint16_t messageHeight = canvas.fontHeight();
-  int16_t messageX, messageY;
-  uint16_t titleWidth = canvas.textWidth(title);
-  uint16_t titleHeight = canvas.fontHeight();
-  int16_t titleX, titleY;
-
-  // Draw the title
-  titleX = titleAreaX + (titleAreaWidth - titleWidth) / 2;  // Center title horizontally
-  canvas.setCursor(titleX, titleAreaY);                     // Set the cursor to the center
-  canvas.setFreeFont(&FreeMonoBold9pt7b);
-  canvas.setTextSize(1);
-  canvas.setTextColor(TFT_BLACK, TFT_WHITE);
-  canvas.print(title);
+  uint32_t key = hashStyle(hashValue(hashValue(FNV_OFFSET_BASIS, type), popupWidth | popupHeight << 16));
+  if (bandCount == 1 && (popupBox.key != key || !popupBox.sprite.created())) {
+    // The box uses as much memory as the canvas, it is drawn directly when the canvas is cut in bands to save memory
+    PROFILE_SCOPE(PROFILE_TEXT);
+    popupBox.sprite.setSwapBytes(true);  // Icons in the same byte order as on the canvas
+    if (fitSprite(popupBox.sprite, popupWidth, popupHeight, 16)) {  // Can be larger, only the box is pushed
+      popupBox.sprite.fillSprite(TFT_BLACK);
+      drawPopupBox(popupBox.sprite, 0, 0, popupWidth, popupHeight, type);
+    }
+    popupBox.key = key;
+  }
+  if (bandCount == 1 && popupBox.sprite.created()) {
+    PROFILE_SCOPE(PROFILE_BLIT);
+    canvas.setViewport(POPUP_MARGIN, POPUP_MARGIN, popupWidth, popupHeight, true);  // Clips the columns past the box
+    popupBox.sprite.pushToSprite(&canvas, 0, 0);
+    applyBandViewport();
+  } else {
+    drawPopupBox(canvas, POPUP_MARGIN, POPUP_MARGIN, popupWidth, popupHeight, type);
+  }
 
   // Draw the message
-  // if (messageAreaWidth > tftWidth - 8) {
-  // tft.setFreeFont(&FreeMonoBold9pt7b);  // Here, We don't use "canvas." because when using it, the calculated value in the "scrollTextHorizontal" function is wrong but not with "tft." #bug
   canvas.setFreeFont(&FreeMonoBold9pt7b);
-  scrollTextHorizontal(spaceBetweenPopup + 1, titleAreaY + 20, message, TFT_BLACK, TFT_WHITE, 1, 50, popupWidth - 2);
-  // } else {
-  //   // If the message fits within the screen width, draw it normally
-  //   messageX = messageAreaX + (messageAreaWidth - messageWidth) / 2;
-  //   messageY = messageAreaY + (messageAreaHeight - messageHeight) / 2;
+  scrollTextHorizontal(POPUP_MARGIN + 1, titleY + 20, message, TFT_BLACK, TFT_WHITE, 1, 50, popupWidth - 2);
+  endScene();
+}
+// A line at the bottom of the screen, drawn over it without the black of its corners
+void OpenMenuOS::drawToast(const Popup& toast) {
+  const PopupStyle& style = popupStyle(toast.type);
+  char truncated[MAX_ITEM_LENGTH];
+  const char* text = truncateLabel(toast.message, min((tftWidth - 8 - TOAST_PADDING * 2) / 6, MAX_ITEM_LENGTH - 1), truncated);
+  int16_t w = min((int)strlen(text) * 6 + TOAST_PADDING * 2, tftWidth - 8);  // The built-in font is 6 pixels wide
+  int16_t h = 8 + TOAST_PADDING;
+  int16_t x = (tftWidth - w) / 2;
+  int16_t y = tftHeight - h - 4;
+
+  uint32_t key = hashStyle(hashValue(hashText(FNV_OFFSET_BASIS, text), toast.type | w << 8 | h << 20));
+  beginScene(SCENE_OVERLAY, key);
+  if (sceneChanged) {
+    markDirty(x, y, w, h);
+  }
+  if (toastBox.key != key || !toastBox.sprite.created()) {
+    PROFILE_SCOPE(PROFILE_TEXT);
+    if (fitSprite(toastBox.sprite, w, h, 16)) {  // Can be wider, the black around the toast is left out
+      toastBox.sprite.fillSprite(TFT_BLACK);
+      fillRounded(toastBox.sprite, 0, 0, w, h, h / 2, style.color, TFT_BLACK);
+      toastBox.sprite.setTextFont(1);
+      toastBox.sprite.setTextSize(1);
+      toastBox.sprite.setTextColor(TFT_WHITE);
+      toastBox.sprite.setCursor(TOAST_PADDING, TOAST_PADDING / 2);
+      toastBox.sprite.print(text);
+    }
+    toastBox.key = key;
+  }
+  if (toastBox.sprite.created()) {
+    PROFILE_SCOPE(PROFILE_BLIT);
+    toastBox.sprite.pushToSprite(&canvas, x, y, TFT_BLACK);  // The screen stays visible around the rounded ends
+  } else {
+    fillRounded(x, y, w, h, h / 2, style.color, TFT_BLACK);
+    canvas.setTextFont(1);
+    canvas.setTextSize(1);
+    canvas.setTextColor(TFT_WHITE);
+    canvas.setCursor(x + TOAST_PADDING, y + TOAST_PADDING / 2);
+    canvas.print(text);
+  }
+  endScene();
+}
+// Draw the popup or the toast at the front of the queue over what was drawn during the frame
+void OpenMenuOS::drawPopups() {
+  Popup* popup = popups.front();
+  while (popup != NULL && popup->toast && bandIndex == 0) {  // The queue changes once per frame, before the first band
+    if (!popup->shown) {
+      popup->shown = true;
+      popup->shownAt = frameNow();
+    }
+    if (frameNow() - popup->shownAt < popup->duration) break;
+    popups.pop();  // Over, the next one is shown in the same frame
+    popup = popups.front();
+  }
+  if (popup == NULL) return;
 
-  //   canvas.setCursor(messageX, messageY);
-  //   canvas.setFreeFont(&FreeMono9pt7b);
-  //   canvas.setTextSize(1);
-  //   canvas.setTextColor(TFT_WHITE, TFT_BLACK);
-  //   canvas.print(message);
-  // }
+  if (popup->toast) {
+    drawToast(*popup);
+    scheduleFrame(popup->shownAt + popup->duration);
+  } else {
+    popup->shown = true;
+    drawPopupScene(SCENE_OVERLAY, popup->message, popup->type);
+  }
+}
+int OpenMenuOS::showPopup(const char* message, int type) {
+  redrawRequested = true;
+  return popups.push(message, type, false, 0);
+}
+int OpenMenuOS::showToast(const char* message, int type, unsigned long duration) {
+  redrawRequested = true;
+  return popups.push(message, type, true, duration);
+}
+bool OpenMenuOS::isPopupShown(int id) const {
+  return popups.contains(id);
+}
+void OpenMenuOS::closePopup(int id) {
+  if (popups.remove(id)) {
+    redrawRequested = true;
+  }
+}
+// Select closes the popup on the screen, the other buttons are kept from the menu under it
+void OpenMenuOS::handlePopupEvent(const ButtonEvent& event) {
+  if (event.button != BUTTON_SELECT || (event.type != BUTTON_SHORT_PRESS && event.type != BUTTON_LONG_PRESS)) return;
+#ifdef ESP32
+  if (uiEvents != NULL) {
+    Popup* popup = popups.front();
+    postEvent(MENU_EVENT_POPUP, popup->id, popup->type);
+  }
+#endif
+  popups.pop();
 }
 
 void OpenMenuOS::drawScrollbar(int selectedItem, int nextItem) {
-  // Draw scrollbar handle
-  int boxHeight = tftHeight / (NUM_MENU_ITEMS);
-  int boxY = boxHeight * selectedItem;
+  drawScrollbar(selectedItem, nextItem, NUM_MENU_ITEMS);
+}
+void OpenMenuOS::drawScrollbar(int selectedItem, int nextItem, int count) {
+  if (count <= 0) return;
+  // Draw scrollbar handle, it keeps a usable size with many items and goes from the top to the bottom
+  int boxHeight = max(tftHeight / count, SCROLLBAR_MIN_HANDLE);
+  int boxY = count > 1 ? (int32_t)(tftHeight - boxHeight) * selectedItem / (count - 1) : 0;
+  bool moved = false;
+  if (currentScene < SCENE_COUNT) {  // In a renderer, the handle slides to its new position
+    Tween& handle = sceneAnimations[currentScene].scrollbar;
+    if (animations && sceneWasDrawn(currentScene)) {
+      handle.moveTo(boxY, SCROLLBAR_ANIMATION_TIME);
+    } else {
+      handle.jumpTo(boxY);
+    }
+    moved = animate(handle);
+    boxY = handle.value();
+  }
+  if (sceneChanged || moved) {
+    markDirty(tftWidth - 3, 0, 3, tftHeight);
+  }
   if (scrollbarStyle == 0) {
     // Clear previous scrollbar handle
-    canvas.fillRect(tftWidth - 3, boxHeight * nextItem, 3, boxHeight, TFT_BLACK);
+    canvas.fillRect(tftWidth - 3, count > 1 ? (int32_t)(tftHeight - boxHeight) * nextItem / (count - 1) : 0, 3, boxHeight, TFT_BLACK);
     // Draw new scrollbar handle
     canvas.fillRect(tftWidth - 3, boxY, 3, boxHeight, scrollbarColor);
 
-    for (int y = 0; y < tftHeight; y++) {  // Display the Scrollbar
-      if (y % 2 == 0) {
-        canvas.drawPixel(tftWidth - 2, y, TFT_WHITE);
-      }
-    }
+    drawScrollbarTrack(tftWidth - 2, TFT_WHITE);  // Display the Scrollbar
   } else if (scrollbarStyle == 1) {
     // Clear previous scrollbar handle
     canvas.fillRoundRect(tftWidth - 3, boxY, 3, boxHeight, TFT_BLACK, TFT_BLACK);
     // Draw new scrollbar handle
-    canvas.fillSmoothRoundRect(tftWidth - 3, boxY, 3, boxHeight, 4, scrollbarColor, TFT_BLACK);  // Display the rectangle || The "-2" should be determined dynamicaly
+    fillRounded(tftWidth - 3, boxY, 3, boxHeight, 4, scrollbarColor, TFT_BLACK);  // Display the rectangle || The "-2" should be determined dynamicaly
   }
 }
 
 void OpenMenuOS::scrollTextHorizontal(int16_t x, int16_t y, const char* text, uint16_t textColor, uint16_t bgColor, uint8_t textSize, uint16_t delayTime, uint16_t windowSize) {
-  static int16_t xPos = x;
-  static unsigned long previousMillis = 0;
-  static String currentText = "";
-
-  if (currentText != text) {
-    xPos = x;
-    currentText = text;
+  (void)bgColor;  // The text is drawn transparently, bgColor is kept for compatibility only
+  TextScroller& scroller = findScroller(x, y);
+  unsigned long currentMillis = frameNow();
+  bool moved = false;
+
+  uint32_t textKey = hashValue(hashText(FNV_OFFSET_BASIS, text), textSize);
+  if (scroller.textKey != textKey) {
+    // New text, render it once into a strip as wide as the text
+    PROFILE_SCOPE(PROFILE_TEXT);
+    int16_t descent;
+    fontMetrics(&FreeMonoBold9pt7b, scroller.ascent, descent);
+    scroller.ascent *= textSize;
+    scroller.height = scroller.ascent + descent * textSize;
+
+    scroller.strip.setFreeFont(&FreeMonoBold9pt7b);
+    scroller.strip.setTextSize(textSize);
+    scroller.textWidth = scroller.strip.textWidth(text);  // Measured with the font of the strip, not whatever font the canvas has
+    scroller.ready = fitSprite(scroller.strip, scroller.textWidth, scroller.height, 1);
+    if (scroller.ready) {
+      scroller.strip.fillSprite(0);
+      scroller.strip.setTextColor(1);
+      scroller.strip.setCursor(0, scroller.ascent);
+      scroller.strip.print(text);
+    }
+    scroller.textKey = textKey;
+    scroller.offset = 0;
+    scroller.lastStep = currentMillis;
+    moved = true;
   }
-
-  canvas.setTextSize(textSize);
-  int16_t textWidth = canvas.textWidth(text);
-
-  unsigned long currentMillis = millis();
-  if (currentMillis - previousMillis >= delayTime) {
-    previousMillis = currentMillis;
-    xPos--;
-
-    if (xPos <= x - textWidth) {
-      xPos = x + windowSize;
+  if (bandIndex == 0 && scroller.lastFrame + 1 != frameCount && scroller.lastFrame != frameCount) {
+    scroller.lastStep = currentMillis;  // Not shown during the previous frame, continue from where it was
+  }
+  scroller.lastUsed = currentMillis;
+  scroller.lastFrame = frameCount;
+
+  uint16_t stepTime = quality >= QUALITY_SLOW_SCROLL ? delayTime * 2 : delayTime;  // Same speed, in steps of 2 pixels
+  if (bandIndex == 0 && currentMillis - scroller.lastStep >= stepTime) {  // The other bands draw the same frame
+    // Move by all the steps since the last frame, so the text keeps its speed when the frames are late
+    unsigned long steps = delayTime > 0 ? (currentMillis - scroller.lastStep) / delayTime : 1;
+    scroller.lastStep += steps * delayTime;
+    int16_t range = scroller.textWidth + windowSize;  // The offset goes from windowSize down to -textWidth + 1
+    if (range > 0) {
+      scroller.offset -= steps % range;
+      if (scroller.offset <= -scroller.textWidth) {
+        scroller.offset += range;
+      }
     }
+    moved = true;
   }
 
-  // Create a temporary sprite for double buffering
-  TFT_eSprite tempSprite = TFT_eSprite(&tft);
-  tempSprite.createSprite(windowSize, canvas.fontHeight());
-  // tempSprite.setTextFont(canvas.textfont);
-  tempSprite.setFreeFont(&FreeMonoBold9pt7b);
-  tempSprite.setTextSize(textSize);
-  tempSprite.setTextColor(textColor, bgColor);
-  // Draw text on the temporary sprite
-  int16_t yPos = tempSprite.fontHeight();
-  tempSprite.setCursor(xPos - x, yPos);
-  tempSprite.print(text);
-
-
+  int16_t top = y - scroller.ascent;
+  if (scroller.ready) {
+    drawStripWindow(scroller.strip, x, top, -scroller.offset, windowSize, textColor);
+  } else {
+    // Not enough memory for the strip, print the text clipped to the window instead
+    PROFILE_SCOPE(PROFILE_TEXT);
+    canvas.setViewport(x, top - bandTop, windowSize, scroller.height, true);
+    canvas.setFreeFont(&FreeMonoBold9pt7b);
+    canvas.setTextSize(textSize);
+    canvas.setTextColor(textColor);
+    canvas.setCursor(scroller.offset, scroller.ascent);
+    canvas.print(text);
+    applyBandViewport();
+  }
 
-  // Push the temporary sprite to the main canvas
-  // y -= 5;
-  tempSprite.pushToSprite(&canvas, x, y - yPos, bgColor);
-  tempSprite.deleteSprite();
+  if (moved || sceneChanged) {
+    markDirty(x, top, windowSize, scroller.height);
+  }
+  scheduleFrame(scroller.lastStep + stepTime);
 }
 
 void OpenMenuOS::setTextScroll(bool x = true) {
+#ifndef OPENMENUOS_NO_TEXT_SCROLL
   textScroll = x;
+#else
+  (void)x;  // Fixed by MenuConfig.h
+#endif
 }
 void OpenMenuOS::showBootImage(bool x = true) {
   bootImage = x;
 }
 void OpenMenuOS::setButtonAnimation(bool x = true) {
+#ifndef OPENMENUOS_NO_BUTTON_ANIMATION
   buttonAnimation = x;
+#else
+  (void)x;  // Fixed by MenuConfig.h
+#endif
+}
+void OpenMenuOS::setAnimations(bool x = true) {
+  animations = x;
+}
+void OpenMenuOS::setFastRendering(bool x) {
+  fastRendering = x;
+}
+void OpenMenuOS::setTargetFPS(uint8_t fps, bool adaptive) {
+  governor.setTarget(fps, adaptive);
+}
+unsigned long OpenMenuOS::getIdleTime() const {
+  return governor.idleTime(micros()) / 1000;
+}
+uint8_t OpenMenuOS::getQuality() const {
+  return quality;
+}
+uint32_t OpenMenuOS::getFrameCost() const {
+  return governor.frameCost();
+}
+void OpenMenuOS::setListView(bool x, int rows) {
+  listView = x;
+  listVisibleRows = constrain(rows, 0, MAX_LIST_ROWS);
+  if (!listView) {
+    freeListRows();
+  }
+  updateLayout();
 }
 void OpenMenuOS::setMenuStyle(int style) {
+#ifndef OPENMENUOS_MENU_STYLE
   menuStyle = style;
+#else
+  (void)style;  // Fixed by MenuConfig.h
+#endif
 }
 void OpenMenuOS::setScrollbar(bool x = true) {
+#ifndef OPENMENUOS_NO_SCROLLBAR
   scrollbar = x;
+#else
+  (void)x;  // Fixed by MenuConfig.h
+#endif
+  updateLayout();  // The selection is narrower with the scrollbar
 }
 void OpenMenuOS::setScrollbarColor(uint16_t color = TFT_WHITE) {
   scrollbarColor = color;
 }
 void OpenMenuOS::setScrollbarStyle(int style) {
+#ifndef OPENMENUOS_SCROLLBAR_STYLE
   scrollbarStyle = style;
+#else
+  (void)style;  // Fixed by MenuConfig.h
+#endif
 }
 void OpenMenuOS::setSelectionBorderColor(uint16_t color = TFT_WHITE) {
   selectionBorderColor = color;
@@ -1263,21 +1924,20 @@ void OpenMenuOS::setSelectionFillColor(uint16_t color = TFT_BLACK) {
 void OpenMenuOS::useStylePreset(char* preset) {
   int presetNumber = 0;  // Initialize with the default preset number
 
-  // Convert the preset name to lowercase for case-insensitive comparison
-  String lowercasePreset = String(preset);
-  lowercasePreset.toLowerCase();
-
-  // Compare the preset name with lowercase versions of the preset names
-  if (lowercasePreset == "default") {
+  // Compare the preset name whatever its case
+  if (strcasecmp(preset, "default") == 0) {
     presetNumber = 0;
-  } else if (lowercasePreset == "rabbit_r1") {
+  } else if (strcasecmp(preset, "rabbit_r1") == 0) {
     presetNumber = 1;
+  } else if (strcasecmp(preset, "fast") == 0) {
+    presetNumber = 2;
   }
 
   // Apply the preset based on the preset number
   switch (presetNumber) {
     case 0:
       setMenuStyle(0);
+      setFastRendering(false);
       break;
     case 1:
       setScrollbar(false);  // Disable scrollbar
@@ -1285,6 +1945,10 @@ void OpenMenuOS::useStylePreset(char* preset) {
       setSelectionBorderColor(0xfa60);  // Setting the selection rectangle's color to Rabbit R1's Orange/Leuchtorange
       setSelectionFillColor(0xfa60);
       break;
+    case 2:
+      setMenuStyle(0);
+      setFastRendering(true);  // Flat shapes, for the slow boards
+      break;
     default:
       // Handle invalid presets
       // Optionally, you can log an error or take other actions here
@@ -1293,15 +1957,11 @@ void OpenMenuOS::useStylePreset(char* preset) {
 }
 
 void OpenMenuOS::setButtonsMode(char* mode) {  // The mode is either Pullup or Pulldown
-  // Convert mode to lowercase for case-insensitive comparison
-  String lowercaseMode = String(mode);
-  lowercaseMode.toLowerCase();
-
-  // Check if mode is valid
-  if (lowercaseMode == "high") {
+  // Check if mode is valid, whatever its case
+  if (strcasecmp(mode, "high") == 0) {
     buttonsMode = INPUT_PULLDOWN;
     buttonVoltage = HIGH;
-  } else if (lowercaseMode == "low") {
+  } else if (strcasecmp(mode, "low") == 0) {
     buttonsMode = INPUT_PULLUP;
     buttonVoltage = LOW;
   } else {
@@ -1311,181 +1971,48 @@ void OpenMenuOS::setButtonsMode(char* mode) {  // The mode is either Pullup or P
 }
 
 
+void OpenMenuOS::setSettingsId(uint8_t id) {
+  settingsId = id;
+}
+
 void OpenMenuOS::printMenuToSerial() {
   Serial.println("Menu Items:");
   for (int i = 0; i < NUM_MENU_ITEMS; i++) {
     Serial.print("Item ");
     Serial.print(i + 1);
     Serial.print(": ");
-    Serial.println(menu_items[i]);
+    char buffer[MAX_ITEM_LENGTH];
+    Serial.println(itemText(main_menu, i, buffer));
   }
 }
+bool OpenMenuOS::getProfileStats(uint8_t phase, ProfileStats& stats) const {
+#ifdef OPENMENUOS_PROFILE
+  return profiler.stats(phase, stats);
+#else
+  (void)phase;
+  (void)stats;
+  return false;
+#endif
+}
+void OpenMenuOS::printProfileToSerial() {
+#ifdef OPENMENUOS_PROFILE
+  profiler.print(Serial);
+#else
+  Serial.println("Profiling is off, define OPENMENUOS_PROFILE to enable it");
+#endif
+}
+void OpenMenuOS::resetProfile() {
+#ifdef OPENMENUOS_PROFILE
+  profiler.reset();
+#endif
+}
+void OpenMenuOS::setProfileOverlay(bool x) {
+  profileOverlay = x;
+  profileOverlayText[0] = '\0';
+}
 void OpenMenuOS::checkForButtonPress() {
-  if (current_screen == 0) {  // MENU SCREEN // up and down buttons only work for the menu screen
-                              // if ((digitalRead(BUTTON_UP_PIN) == buttonVoltage) && (button_up_clicked == 0)) {  // up button clicked - jump to previous menu item
-                              //   item_selected = item_selected - 1;                                              // select previous item
-                              //   button_up_clicked = 1;                                                          // set button to clicked to only perform the action once
-                              //   if (item_selected < 0) {                                                        // if first item was selected, jump to last item
-                              //     item_selected = NUM_MENU_ITEMS - 1;
-                              //   }
-                              // }
-
-    // if ((digitalRead(BUTTON_UP_PIN) == LOW) && (button_up_clicked == 1)) {  // unclick
-    //   button_up_clicked = 0;
-    // }
-
-    if (BUTTON_UP_PIN != NULL) {
-
-      upButtonState = digitalRead(BUTTON_UP_PIN);  // Read the current button state
-
-      if (upButtonState == HIGH && !ButtonPressProcessed) {
-        if (PreviousButtonState == LOW) {
-          pressedTime = millis();
-          isPressing = true;
-          isLongDetected = false;  // Ensure long press flag is reset each time button is pressed
-          ButtonPressProcessed = true;
-        }
-      }
-
-      if (isPressing && !isLongDetected) {
-        long pressDuration = millis() - pressedTime;
-
-        if (pressDuration > LONG_PRESS_TIME_MENU) {
-          isLongDetected = true;
-        }
-      }
-      if (isPressing && isLongDetected) {
-        static unsigned long lastTempAdjustTime = 0;
-        unsigned long currentMillis = millis();
-        if (currentMillis - lastTempAdjustTime >= 200) {  // Check if 500ms have passed
-          item_selected = item_selected - 1;              // select previous item
-          if (item_selected < 0) {                        // if first item was selected, jump to last item
-            item_selected = NUM_MENU_ITEMS - 1;
-          }
-          lastTempAdjustTime = currentMillis;  // Update the last adjustment time
-        }
-      }
-
-      if (upButtonState == LOW && PreviousButtonState == HIGH) {
-        isPressing = false;
-        releasedTime = millis();
-
-        long pressDuration = releasedTime - pressedTime;
-
-        // Determine the type of press based on the duration
-        if (pressDuration >= LONG_PRESS_TIME_MENU) {
-          isLongDetected = true;
-        } else {
-          isLongDetected = false;
-        }
-
-        // Check if it was a short press and long press was not detected
-        if (pressDuration < SHORT_PRESS_TIME && !isLongDetected) {
-          item_selected = item_selected - 1;  // select previous item
-          if (item_selected < 0) {            // if first item was selected, jump to last item
-            item_selected = NUM_MENU_ITEMS - 1;
-          }
-        }
-        ButtonPressProcessed = false;  // Reset the control variable when the button is not pressed anymore
-      }
-
-      PreviousButtonState = upButtonState;
-    }
-    if (BUTTON_DOWN_PIN != NULL) {
-      //   if ((digitalRead(BUTTON_DOWN_PIN) == buttonVoltage) && (button_down_clicked == 0)) {  // down button clicked - jump to next menu item
-      // item_selected = item_selected + 1;                                                  // select next item
-      // button_down_clicked = 1;                                                            // set button to clicked to only perform the action once
-      // if (item_selected >= NUM_MENU_ITEMS) {                                              // if last item was selected, jump to first item
-      //   item_selected = 0;
-      // }
-      //   }
-
-      //   if ((digitalRead(BUTTON_DOWN_PIN) == LOW) && (button_down_clicked == 1)) {  // unclick
-      //     button_down_clicked = 0;
-      //   }
-
-      int downButtonState = digitalRead(BUTTON_DOWN_PIN);  // Read the current button state
-
-      if (downButtonState == HIGH && !ButtonPressProcessed) {
-        if (PreviousButtonState == LOW) {
-          pressedTime = millis();
-          isPressing = true;
-          isLongDetected = false;  // Ensure long press flag is reset each time button is pressed
-          ButtonPressProcessed = true;
-        }
-      }
-
-      if (isPressing && !isLongDetected) {
-        long pressDuration = millis() - pressedTime;
-
-        if (pressDuration > LONG_PRESS_TIME_MENU) {
-          isLongDetected = true;
-        }
-      }
-      if (isPressing && isLongDetected) {
-        static unsigned long lastTempAdjustTime = 0;
-        unsigned long currentMillis = millis();
-        if (currentMillis - lastTempAdjustTime >= 200) {  // Check if 500ms have passed
-          item_selected = item_selected + 1;              // select next item
-          if (item_selected >= NUM_MENU_ITEMS) {          // if last item was selected, jump to first item
-            item_selected = 0;
-          }
-          lastTempAdjustTime = currentMillis;  // Update the last adjustment time
-        }
-      }
-
-      if (downButtonState == LOW && PreviousButtonState == HIGH) {
-        isPressing = false;
-        releasedTime = millis();
-
-        long pressDuration = releasedTime - pressedTime;
-
-        // Determine the type of press based on the duration
-        if (pressDuration >= LONG_PRESS_TIME_MENU) {
-          isLongDetected = true;
-        } else {
-          isLongDetected = false;
-        }
-
-        // Check if it was a short press and long press was not detected
-        if (pressDuration < SHORT_PRESS_TIME && !isLongDetected) {
-          item_selected = item_selected + 1;      // select next item
-          if (item_selected >= NUM_MENU_ITEMS) {  // if last item was selected, jump to first item
-            item_selected = 0;
-          }
-        }
-        ButtonPressProcessed = false;  // Reset the control variable when the button is not pressed anymore
-      }
-
-      PreviousButtonState = downButtonState;
-    }
-  }
-  if (digitalRead(BUTTON_SELECT_PIN) == buttonVoltage) {
-    if (button_select_clicked == 0 && !long_press_handled) {
-      select_button_press_time = millis();  // Start measuring button press time
-      button_select_clicked = 1;
-      long_press_handled = false;  // Reset the long press handled flag
-    } else {
-      // Button still pressed, check for long press
-      if (current_screen == 1 && (millis() - select_button_press_time >= SELECT_BUTTON_LONG_PRESS_DURATION)) {
-        if (!long_press_handled) {  // Check if long press action has been handled
-          current_screen = 0;
-          long_press_handled = true;  // Set the long press handled flag
-          upButtonState = !buttonVoltage;
-        }
-      }
-    }
-  } else if (digitalRead(BUTTON_SELECT_PIN) == LOW) {
-    if (button_select_clicked == 1) {
-      if (current_screen == 0 && !long_press_handled) {
-        current_screen = 1;
-      }
-      button_select_clicked = 0;   // Reset the button state
-      long_press_handled = false;  // Reset the long press handled flag when the button is released
-    }
-  }
-
-  // set correct values for the previous and next items
+  PROFILE_SCOPE(PROFILE_INPUT);
+  // The buttons are handled in loop(), only update the items around the selection
   item_sel_previous = item_selected - 1;
   if (item_sel_previous < 0) { item_sel_previous = NUM_MENU_ITEMS - 1; }  // previous item would be below first = make it the last
   item_sel_next = item_selected + 1;
@@ -1496,195 +2023,605 @@ void OpenMenuOS::checkForButtonPress() {
   if (item_selected_settings_next >= NUM_SETTINGS_ITEMS) { item_selected_settings_next = 0; }  // next item would be after last = make it the first
 }
 void OpenMenuOS::checkForButtonPressSubmenu() {
-  if (current_screen == 1) {  // MENU SCREEN // up and down buttons only work for the menu screen
-                              // if ((digitalRead(BUTTON_UP_PIN) == buttonVoltage) && (button_up_clicked == 0)) {  // up button clicked - jump to previous menu item
-                              //   item_selected_submenu = item_selected_submenu - 1;                              // select previous item
-                              //   button_up_clicked = 1;                                                          // set button to clicked to only perform the action once
-                              //   if (item_selected_submenu < 0) {                                                // if first item was selected, jump to last item
-                              //     item_selected_submenu = NUM_SUBMENU_ITEMS - 1;
-                              //   }
-                              // }
-
-    // if ((digitalRead(BUTTON_UP_PIN) == LOW) && (button_up_clicked == 1)) {  // unclick
-    //   button_up_clicked = 0;
-    // }
-
-
-    // if ((digitalRead(BUTTON_DOWN_PIN) == buttonVoltage) && (button_down_clicked == 0)) {  // down button clicked - jump to next menu item
-    // item_selected_submenu = item_selected_submenu + 1;                                  // select next item
-    // button_down_clicked = 1;                                                            // set button to clicked to only perform the action once
-    // if (item_selected_submenu >= NUM_SUBMENU_ITEMS) {                                   // if last item was selected, jump to first item
-    //   item_selected_submenu = 0;
-    // }
-    // }
-
-    // if ((digitalRead(BUTTON_DOWN_PIN) == LOW) && (button_down_clicked == 1)) {  // unclick
-    //   button_down_clicked = 0;
-    // }
-    if (BUTTON_UP_PIN != NULL) {
-
-      upButtonState = digitalRead(BUTTON_UP_PIN);  // Read the current button state
-
-      if (upButtonState == HIGH && !ButtonPressProcessed) {
-        if (PreviousButtonState == LOW) {
-          pressedTime = millis();
-          isPressing = true;
-          isLongDetected = false;  // Ensure long press flag is reset each time button is pressed
-          ButtonPressProcessed = true;
-        }
+  PROFILE_SCOPE(PROFILE_INPUT);
+  // The buttons are handled in loop(), only update the items around the selection
+  item_sel_previous_submenu = item_selected_submenu - 1;
+  if (item_sel_previous_submenu < 0) { item_sel_previous_submenu = NUM_SUBMENU_ITEMS - 1; }  // previous item would be below first = make it the last
+  item_sel_next_submenu = item_selected_submenu + 1;
+  if (item_sel_next_submenu >= NUM_SUBMENU_ITEMS) { item_sel_next_submenu = 0; }  // next item would be after last = make it the first
+}
+// Move a selection by one item, wrapping around at both ends
+static void stepSelection(int& selected, int count, int step) {
+  if (count <= 0) return;
+  selected += step;
+  if (selected < 0) {  // if first item was selected, jump to last item
+    selected = count - 1;
+  } else if (selected >= count) {  // if last item was selected, jump to first item
+    selected = 0;
+  }
+}
+void OpenMenuOS::stepView(int step) {
+  if (activeView == VIEW_SUBMENU) {
+    stepSelection(item_selected_submenu, NUM_SUBMENU_ITEMS, step);
+  } else if (activeView == VIEW_SETTINGS) {
+    stepSelection(item_selected_settings, NUM_SETTINGS_ITEMS, step);
+  } else if (activeView == VIEW_TILE_MENU && current_screen_tile_menu == 0) {
+    stepSelection(item_selected_tile_menu, tile_menu_count, -step);  // Up goes to the next tile
+  }
+}
+void OpenMenuOS::handleButtonEvent(const ButtonEvent& event) {
+  Popup* popup = popups.front();
+  if (popup != NULL && !popup->toast) {
+    handlePopupEvent(event);
+    return;
+  }
+  if (treeShown && activeView != VIEW_POPUP) {
+    handleTreeEvent(event);
+    return;
+  }
+  if (event.button == BUTTON_UP || event.button == BUTTON_DOWN) {
+    if (event.type == BUTTON_RELEASE) return;  // Short press, long press and repeat all move the selection
+    int step = event.button == BUTTON_UP ? -1 : 1;
+
+    if (current_screen == 0) {
+      stepSelection(item_selected, NUM_MENU_ITEMS, step);
+    } else if (current_screen == 1) {
+      stepView(step);
+    }
+    return;
+  }
+
+  // Select button
+  if (activeView == VIEW_POPUP) {
+    if (event.type == BUTTON_SHORT_PRESS || event.type == BUTTON_LONG_PRESS) {
+      popupClicked = true;
+    }
+    return;
+  }
+  if (event.type == BUTTON_LONG_PRESS) {  // Long press goes back
+    if (current_screen == 0) {
+      current_screen = 1;
+    } else if (current_screen == 1) {
+      current_screen = 0;
+    } else if (current_screen == 2) {
+      current_screen = 1;
+    }
+  } else if (event.type == BUTTON_SHORT_PRESS) {
+    if (current_screen == 0) {
+      current_screen = 1;
+    } else if (current_screen == 1) {
+      if (activeView == VIEW_SUBMENU) {
+        current_screen = 2;
+      } else if (activeView == VIEW_SETTINGS) {
+        toggleSetting(item_selected_settings);
+      } else if (activeView == VIEW_TILE_MENU) {
+        current_screen_tile_menu = current_screen_tile_menu == 0 ? 1 : 0;
       }
+    }
+  }
+}
+// The buttons in a menu tree: they move in the list of the current node, or go to what its page drew
+void OpenMenuOS::handleTreeEvent(const ButtonEvent& event) {
+  if (event.type == BUTTON_RELEASE) return;
+  int node = treePath[treeDepth - 1];
+  int count = nodeWord(menuTree[node].childCount);
+  if (event.button == BUTTON_UP || event.button == BUTTON_DOWN) {
+    int step = event.button == BUTTON_UP ? -1 : 1;
+    if (count > 0) {
+      stepSelection(treeSelected, count, step);
+    } else {
+      stepView(step);
+    }
+  } else if (event.type == BUTTON_LONG_PRESS) {  // Long press goes back
+    leaveNode();
+  } else if (event.type == BUTTON_SHORT_PRESS) {
+    if (count > 0) {
+      enterNode(nodeWord(menuTree[node].firstChild) + treeSelected);
+    } else if (activeView == VIEW_SETTINGS) {
+      toggleSetting(item_selected_settings);
+    } else if (activeView == VIEW_TILE_MENU) {
+      current_screen_tile_menu = current_screen_tile_menu == 0 ? 1 : 0;
+    }
+  }
+}
+void OpenMenuOS::toggleSetting(int index) {
+  if (index >= 0 && index < MAX_SETTINGS_ITEMS) {
+    menu_items_settings_bool[index] = !menu_items_settings_bool[index];
+    if (index == 0) {
+      digitalWrite(backlightPin, menu_items_settings_bool[0] ? LOW : HIGH);  // Toggle TFT backlight pin based on boolean state
+    }
+    saveToEEPROM();
+  }
+}
 
-      if (isPressing && !isLongDetected) {
-        long pressDuration = millis() - pressedTime;
 
-        if (pressDuration > LONG_PRESS_TIME_MENU) {
-          isLongDetected = true;
-        }
+#ifdef OPENMENUOS_PROFILE
+// FPS and free heap in the top left corner, drawn over the frame. The text changes every PROFILE_OVERLAY_TIME only,
+// so it doesn't keep the dirty rectangles busy
+void OpenMenuOS::drawProfileOverlay() {
+  unsigned long now = millis();
+  if (bandIndex == 0 && (profileOverlayText[0] == '\0' || now - profileOverlayTime >= PROFILE_OVERLAY_TIME)) {
+    ProfileStats interval;
+    uint32_t fps = profiler.stats(PROFILE_INTERVAL, interval) && interval.avg > 0 ? 1000000UL / interval.avg : 0;
+#if defined(ESP32) || defined(ESP8266)
+    snprintf(profileOverlayText, sizeof(profileOverlayText), "%lufps %luk", (unsigned long)fps, (unsigned long)(ESP.getFreeHeap() / 1024));
+#else
+    snprintf(profileOverlayText, sizeof(profileOverlayText), "%lufps", (unsigned long)fps);
+#endif
+    profileOverlayTime = now;
+    markDirty(0, 0, tftWidth, 8);  // Old and new text, whatever their widths
+  }
+  canvas.setTextFont(1);
+  canvas.setTextSize(1);
+  canvas.setTextColor(TFT_YELLOW, TFT_BLACK);
+  canvas.setCursor(0, 0);
+  canvas.print(profileOverlayText);
+}
+#endif
+void OpenMenuOS::drawCanvasOnTFT() {
+  if (frameSkipped) return;  // loop() didn't start a frame, the display keeps the last one
+  drawPopups();
+  // Changing screen, or the set of renderers used, replaces everything that is on the display
+  if (current_screen != lastPushedScreen || scenesDrawn != scenesDrawnPrevious) {
+    fullRedrawPending = true;
+  }
+#ifdef OPENMENUOS_PROFILE
+  if (profileOverlay) {
+    drawProfileOverlay();
+  }
+#endif
+
+  {
+    PROFILE_SCOPE(PROFILE_PUSH);
+    int bandBottom = min(bandTop + bandHeight, tftHeight);
+    if (!dirtyPushes() || fullRedrawPending) {
+      if (bandCount > 1 || dmaMode) {
+        pushCanvas(0, bandTop, tftWidth, bandBottom - bandTop);
+      } else {
+        canvas.pushSprite(0, 0);
       }
-      if (isPressing && isLongDetected) {
-        static unsigned long lastTempAdjustTime = 0;
-        unsigned long currentMillis = millis();
-        if (currentMillis - lastTempAdjustTime >= 200) {      // Check if 500ms have passed
-          item_selected_submenu = item_selected_submenu - 1;  // select previous item
-          if (item_selected_submenu < 0) {                    // if first item was selected, jump to last item
-            item_selected_submenu = NUM_SUBMENU_ITEMS - 1;
-          }
-          lastTempAdjustTime = currentMillis;  // Update the last adjustment time
+    } else {
+      for (uint8_t i = 0; i < dirtyRectCount; i++) {  // Only push the regions that changed, the part of them in this band
+        DirtyRect& r = dirtyRects[i];
+        int top = max((int)r.y, bandTop);
+        int bottom = min(r.y + r.h, bandBottom);
+        if (top < bottom) {
+          pushCanvas(r.x, top, r.w, bottom - top);
         }
       }
+    }
 
-      if (upButtonState == LOW && PreviousButtonState == HIGH) {
-        isPressing = false;
-        releasedTime = millis();
-
-        long pressDuration = releasedTime - pressedTime;
-
-        // Determine the type of press based on the duration
-        if (pressDuration >= LONG_PRESS_TIME_MENU) {
-          isLongDetected = true;
-        } else {
-          isLongDetected = false;
-        }
-
-        // Check if it was a short press and long press was not detected
-        if (pressDuration < SHORT_PRESS_TIME && !isLongDetected) {
-          item_selected_submenu = item_selected_submenu - 1;  // select previous item
-          if (item_selected_submenu < 0) {                    // if first item was selected, jump to last item
-            item_selected_submenu = NUM_SUBMENU_ITEMS - 1;
+    if (mirror.active()) {
+      // The mirror only gets the regions that changed, even when the whole canvas goes to the display
+      if (bandIndex == 0) {
+        mirrorWhole = mirror.beginFrame(tftWidth, tftHeight) || fullRedrawPending;
+      }
+      if (mirrorWhole) {
+        mirrorRegion(0, bandTop, tftWidth, bandBottom - bandTop);
+      } else {
+        for (uint8_t i = 0; i < dirtyRectCount; i++) {
+          DirtyRect& r = dirtyRects[i];
+          int top = max((int)r.y, bandTop);
+          int bottom = min(r.y + r.h, bandBottom);
+          if (top < bottom) {
+            mirrorRegion(r.x, top, r.w, bottom - top);
           }
         }
-        ButtonPressProcessed = false;  // Reset the control variable when the button is not pressed anymore
       }
-
-      PreviousButtonState = upButtonState;
-    }
-    if (BUTTON_DOWN_PIN != NULL) {
-
-      int downButtonState = digitalRead(BUTTON_DOWN_PIN);  // Read the current button state
-
-      if (downButtonState == HIGH && !ButtonPressProcessed) {
-        if (PreviousButtonState == LOW) {
-          pressedTime = millis();
-          isPressing = true;
-          isLongDetected = false;  // Ensure long press flag is reset each time button is pressed
-          ButtonPressProcessed = true;
-        }
+      if (bandIndex == bandCount - 1) {
+        mirror.endFrame();
       }
+    }
 
-      if (isPressing && !isLongDetected) {
-        long pressDuration = millis() - pressedTime;
+    if (dmaPushed) {
+      // Draw the next band or frame in the other buffer while this one is sent. Nothing was sent from this one
+      // when nothing changed, it is drawn again: the other one may still be read by the previous transfer
+      dmaPushed = false;
+      dmaFrame = dmaFrame == 1 ? 2 : 1;
+      canvas.frameBuffer(dmaFrame);
+    }
+  }
 
-        if (pressDuration > LONG_PRESS_TIME_MENU) {
-          isLongDetected = true;
-        }
-      }
-      if (isPressing && isLongDetected) {
-        static unsigned long lastTempAdjustTime = 0;
-        unsigned long currentMillis = millis();
-        if (currentMillis - lastTempAdjustTime >= 200) {      // Check if 500ms have passed
-          item_selected_submenu = item_selected_submenu + 1;  // select next item
-          if (item_selected_submenu >= NUM_SUBMENU_ITEMS) {   // if last item was selected, jump to first item
-            item_selected_submenu = 0;
-          }
-          lastTempAdjustTime = currentMillis;  // Update the last adjustment time
-        }
-      }
+  if (bandIndex < bandCount - 1) {
+    return;  // The frame continues in the next bands, see nextBand()
+  }
+#ifdef OPENMENUOS_PROFILE
+  profiler.endFrame();
+#endif
+  governor.endFrame(micros());
+
+  dirtyRectCount = 0;
+  fullRedrawPending = false;
+  lastPushedScreen = current_screen;
+  scenesDrawnPrevious = scenesDrawn;
+  scenesDrawn = 0;
+  scenesChanged = 0;
+
+  if (frameCount == 0) {
+    firstFrameTime = max(millis(), 1UL);
+  }
+  frameCount++;
+  frameTimeSet = false;  // The next frame takes a new time
+  redrawRequested = false;
+  animationPending = frameAnimationPending;
+  animationDeadline = frameAnimationDeadline;
+  frameAnimationPending = false;
+}
+bool OpenMenuOS::nextBand() {
+  if (frameSkipped) return false;
+  if (bandIndex < bandCount - 1) {
+    bandIndex++;
+    bandTop = bandIndex * bandHeight;
+    applyBandViewport();
+    PROFILE_SCOPE(PROFILE_BLIT);
+    canvas.fillSprite(TFT_BLACK);
+    return true;
+  }
+  bandIndex = 0;  // Frame complete, the next one starts with the first band
+  bandTop = 0;
+  applyBandViewport();
+  return false;
+}
+void OpenMenuOS::setBandCount(int count) {
+  bandCount = constrain(count, 1, 16);
+  if (canvas.created()) {  // Called after begin(), resize the canvas
+#ifdef ESP32
+    if (dmaMode) {
+      tft.dmaWait();  // The buffer may still be read by a transfer
+    }
+#endif
+    canvas.deleteSprite();
+    createCanvas();
+    if (bandCount > 1) {
+      popupBox.sprite.deleteSprite();  // Not used with bands, the popups are drawn directly
+    }
+    fullRedrawPending = true;
+  }
+}
+void OpenMenuOS::setRotation(int rotation) {
+  tft.setRotation(rotation);
+  tftWidth = tft.width();
+  tftHeight = tft.height();
+  updateLayout();
+  if (canvas.created()) {  // Called after begin(), the canvas takes the new size
+#ifdef ESP32
+    if (dmaMode) {
+      tft.dmaWait();
+    }
+#endif
+    canvas.deleteSprite();
+    createCanvas();
+    if (staticSprites) {
+      reserveSprites();  // For the new width
+    }
+    fullRedrawPending = true;
+  }
+}
+void OpenMenuOS::setDMAMode(bool x) {
+  dmaMode = x;  // Used by begin()
+}
+void OpenMenuOS::setDirtyRectMode(bool x) {
+  dirtyRectMode = x;
+  fullRedrawPending = true;
+}
+void OpenMenuOS::markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (bandIndex > 0) return;  // The other bands draw the same frame, its damage was found in the first one
 
-      if (downButtonState == LOW && PreviousButtonState == HIGH) {
-        isPressing = false;
-        releasedTime = millis();
+  // Clip the region to the screen
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > tftWidth) w = tftWidth - x;
+  if (y + h > tftHeight) h = tftHeight - y;
+  if (w <= 0 || h <= 0) return;
+
+  DirtyRect region = { x, y, w, h };
+
+  // Merge it with the regions it overlaps or touches so no pixel is pushed twice
+  uint8_t i = 0;
+  while (i < dirtyRectCount) {
+    DirtyRect& r = dirtyRects[i];
+    if (region.x <= r.x + r.w && r.x <= region.x + region.w && region.y <= r.y + r.h && r.y <= region.y + region.h) {
+      unionRect(region, r);
+      dirtyRects[i] = dirtyRects[--dirtyRectCount];  // The grown region may now touch the others, check them all again
+      i = 0;
+    } else {
+      i++;
+    }
+  }
 
-        long pressDuration = releasedTime - pressedTime;
+  if (dirtyRectCount == MAX_DIRTY_RECTS) {  // No more room, fold everything into one bounding box
+    for (i = 0; i < dirtyRectCount; i++) {
+      unionRect(region, dirtyRects[i]);
+    }
+    dirtyRectCount = 0;
+  }
+  dirtyRects[dirtyRectCount++] = region;
+}
+void OpenMenuOS::invalidateScreen() {
+  fullRedrawPending = true;
+  redrawRequested = true;
+}
+bool OpenMenuOS::needsRedraw() {
+  buttons.update();  // Turn the edges recorded by the interrupts into events
+  pollMirror();
+  if (redrawRequested || buttons.available()) {
+    return true;
+  }
+  return animationPending && (long)(millis() - animationDeadline) >= 0;
+}
+bool OpenMenuOS::waitForEvent(unsigned long timeoutMs) {
+  unsigned long start = millis();
+  while (!needsRedraw()) {
+    settingsStore.update();  // loop() may not run for a while
+    unsigned long now = millis();
+    if (now - start >= timeoutMs) {
+      return false;
+    }
 
-        // Determine the type of press based on the duration
-        if (pressDuration >= LONG_PRESS_TIME_MENU) {
-          isLongDetected = true;
-        } else {
-          isLongDetected = false;
-        }
+    // Sleep until the first of the timeout, the next animation frame and the next long press or repeat
+    unsigned long sleepTime = timeoutMs - (now - start);
+    unsigned long deadline;
+    if (animationPending && (long)(animationDeadline - now) < (long)sleepTime) {
+      sleepTime = (long)(animationDeadline - now) > 0 ? animationDeadline - now : 0;  // Can pass since needsRedraw()
+    }
+    if (buttons.nextDeadline(deadline) && (long)(deadline - now) < (long)sleepTime) {
+      sleepTime = (long)(deadline - now) > 0 ? deadline - now : 0;
+    }
 
-        // Check if it was a short press and long press was not detected
-        if (pressDuration < SHORT_PRESS_TIME && !isLongDetected) {
-          item_selected_submenu = item_selected_submenu + 1;  // select next item
-          if (item_selected_submenu >= NUM_SUBMENU_ITEMS) {   // if last item was selected, jump to first item
-            item_selected_submenu = 0;
-          }
-        }
-        ButtonPressProcessed = false;  // Reset the control variable when the button is not pressed anymore
+#ifdef ESP32
+    if (lightSleep && sleepTime > 0) {
+      if (dmaMode) {
+        tft.dmaWait();  // The SPI stops during the sleep
       }
-
-      PreviousButtonState = downButtonState;
+      buttons.enableWakeup();  // A button press ends the sleep early
+      esp_sleep_enable_timer_wakeup((uint64_t)sleepTime * 1000);
+      esp_light_sleep_start();
+      buttons.disableWakeup();
+      continue;
     }
+#endif
+    delay(1);  // Gives the time to the system (and lets it sleep) while the interrupts record the button presses
   }
-  if (digitalRead(BUTTON_SELECT_PIN) == buttonVoltage) {
-    if (button_select_clicked == 0 && !long_press_handled) {
-      select_button_press_time = millis();  // Start measuring button press time
-      button_select_clicked = 1;
-      long_press_handled = false;  // Reset the long press handled flag
-    } else {
-      // Button still pressed, check for long press
-      if (current_screen == 2 && (millis() - select_button_press_time >= SELECT_BUTTON_LONG_PRESS_DURATION)) {
-        if (!long_press_handled) {  // Check if long press action has been handled
-          current_screen = 1;
-          long_press_handled = true;  // Set the long press handled flag
-        }
-      }
+  return true;
+}
+void OpenMenuOS::requestRedraw() {
+  redrawRequested = true;
+}
+void OpenMenuOS::setLightSleep(bool x) {
+  lightSleep = x;
+}
+#ifdef ESP32
+bool OpenMenuOS::startTask(int rotation, MenuTaskCallback render, void* context, BaseType_t core, UBaseType_t priority) {
+  if (uiTask != NULL) return false;
+  uiCommands = xQueueCreate(UI_COMMAND_QUEUE_SIZE, sizeof(UICommand));
+  uiEvents = xQueueCreate(UI_EVENT_QUEUE_SIZE, sizeof(MenuEvent));
+  if (uiCommands == NULL || uiEvents == NULL) return false;
+  uiRender = render;
+  uiRenderContext = context;
+  uiRotation = rotation;
+  uiStarter = xTaskGetCurrentTaskHandle();
+  if (xTaskCreatePinnedToCore(uiTaskMain, "OpenMenuOS", UI_TASK_STACK_SIZE, this, priority, &uiTask, core) != pdPASS) {
+    uiTask = NULL;
+    return false;
+  }
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);  // The settings are loaded when it returns
+  return true;
+}
+void OpenMenuOS::uiTaskMain(void* arg) {
+  ((OpenMenuOS*)arg)->runTask();
+}
+void OpenMenuOS::runTask() {
+  begin(uiRotation);  // On the task, so the display and its SPI bus are only used from it
+  uiReportedScreen = current_screen;
+  uiReportedSelection = -1;
+  uiReportedView = VIEW_NONE;
+  memcpy(uiReportedSettings, menu_items_settings_bool, sizeof(uiReportedSettings));
+  xTaskNotifyGive(uiStarter);
+
+  for (;;) {
+    // Sleep until a command arrives, the next animation frame or the next check of the buttons
+    unsigned long wait = UI_TASK_POLL_TIME;
+    unsigned long now = millis();
+    if (needsRedraw()) {
+      wait = getIdleTime();  // 0 unless setTargetFPS() was used
+    } else if (animationPending && animationDeadline - now < wait) {
+      wait = animationDeadline - now;
     }
-  } else if (digitalRead(BUTTON_SELECT_PIN) == LOW) {
-    if (button_select_clicked == 1) {
-      if (current_screen == 1 && !long_press_handled) {
-        current_screen = 2;
+    UICommand command;
+    TickType_t ticks = pdMS_TO_TICKS(wait);
+    while (xQueueReceive(uiCommands, &command, ticks) == pdTRUE) {
+      handleCommand(command);
+      ticks = 0;  // Take the other waiting commands, then draw
+    }
+    if (!needsRedraw() || !loop()) continue;
+    do {
+      if (uiRender != NULL) {
+        uiRender(*this, uiRenderContext);
       }
-      button_select_clicked = 0;   // Reset the button state
-      long_press_handled = false;  // Reset the long press handled flag when the button is released
+      drawCanvasOnTFT();  // With the popups queued by postPopup() over it
+    } while (nextBand());
+    postEvents();
+  }
+}
+void OpenMenuOS::handleCommand(const UICommand& command) {
+  switch (command.type) {
+    case UI_COMMAND_REDIRECT:
+      redirectToMenu(command.handle, command.count);
+      break;
+    case UI_COMMAND_POPUP:
+      showPopup(command.message, command.count);
+      break;
+    case UI_COMMAND_TOAST:
+      showToast(command.message, command.count, command.duration);
+      break;
+    case UI_COMMAND_ITEMS:
+      updateMenu(command.handle, command.items, command.count);
+      break;
+    case UI_COMMAND_PROVIDER:
+      updateMenu(command.handle, command.provider, command.context, command.count);
+      break;
+    case UI_COMMAND_ENTRIES:
+      updateMenu(command.handle, command.entries, command.count);
+      break;
+    case UI_COMMAND_CALL:
+      command.call(*this, command.context);
+      break;
+  }
+  requestRedraw();
+}
+bool OpenMenuOS::postCommand(UICommand& command) {
+  if (uiCommands == NULL) return false;
+  return xQueueSend(uiCommands, &command, 0) == pdTRUE;  // Never blocks the application
+}
+bool OpenMenuOS::postRedirect(int screen, int item) {
+  UICommand command = {};
+  command.type = UI_COMMAND_REDIRECT;
+  command.handle = screen;
+  command.count = item;
+  return postCommand(command);
+}
+bool OpenMenuOS::postPopup(const char* message, int type) {
+  UICommand command = {};
+  command.type = UI_COMMAND_POPUP;
+  command.count = type;
+  strncpy(command.message, message, UI_POPUP_LENGTH - 1);
+  return postCommand(command);
+}
+bool OpenMenuOS::postToast(const char* message, int type, unsigned long duration) {
+  UICommand command = {};
+  command.type = UI_COMMAND_TOAST;
+  command.count = type;
+  command.duration = duration;
+  strncpy(command.message, message, UI_POPUP_LENGTH - 1);
+  return postCommand(command);
+}
+bool OpenMenuOS::postMenuItems(int handle, const char* const items[], int count) {
+  UICommand command = {};
+  command.type = UI_COMMAND_ITEMS;
+  command.handle = handle;
+  command.items = items;
+  command.count = count;
+  return postCommand(command);
+}
+bool OpenMenuOS::postMenuItems(int handle, MenuItemProvider provider, void* context, int count) {
+  UICommand command = {};
+  command.type = UI_COMMAND_PROVIDER;
+  command.handle = handle;
+  command.provider = provider;
+  command.context = context;
+  command.count = count;
+  return postCommand(command);
+}
+bool OpenMenuOS::postMenuItems(int handle, const MenuEntry entries[], int count) {
+  UICommand command = {};
+  command.type = UI_COMMAND_ENTRIES;
+  command.handle = handle;
+  command.entries = entries;
+  command.count = count;
+  return postCommand(command);
+}
+bool OpenMenuOS::postCall(MenuTaskCallback call, void* context) {
+  if (call == NULL) return false;
+  UICommand command = {};
+  command.type = UI_COMMAND_CALL;
+  command.call = call;
+  command.context = context;
+  return postCommand(command);
+}
+bool OpenMenuOS::postRedraw() {
+  UICommand command = {};
+  command.type = UI_COMMAND_REDRAW;
+  return postCommand(command);
+}
+bool OpenMenuOS::readEvent(MenuEvent& event, unsigned long timeoutMs) {
+  if (uiEvents == NULL) return false;
+  return xQueueReceive(uiEvents, &event, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+}
+void OpenMenuOS::postEvent(uint8_t type, int item, int value) {
+  MenuEvent event = { type, current_screen, item, value };
+  xQueueSend(uiEvents, &event, 0);  // Dropped if the application doesn't read them
+}
+void OpenMenuOS::postEvents() {
+  if (current_screen != uiReportedScreen) {
+    uiReportedScreen = current_screen;
+    postEvent(MENU_EVENT_SCREEN, 0, 0);
+  }
+  int selection = -1;  // Selection of the list drawn during the frame
+  if (activeView == VIEW_MENU) {
+    selection = item_selected;
+  } else if (activeView == VIEW_SUBMENU) {
+    selection = item_selected_submenu;
+  } else if (activeView == VIEW_SETTINGS) {
+    selection = item_selected_settings;
+  } else if (activeView == VIEW_TILE_MENU) {
+    selection = item_selected_tile_menu;
+  }
+  if (selection >= 0 && (selection != uiReportedSelection || activeView != uiReportedView)) {
+    uiReportedSelection = selection;
+    uiReportedView = activeView;
+    postEvent(MENU_EVENT_SELECTION, selection, 0);
+  }
+  for (int i = 0; i < MAX_SETTINGS_ITEMS; i++) {
+    if (menu_items_settings_bool[i] != uiReportedSettings[i]) {
+      uiReportedSettings[i] = menu_items_settings_bool[i];
+      postEvent(MENU_EVENT_SETTING, i, uiReportedSettings[i]);
     }
   }
-
-  // set correct values for the previous and next items
-  item_sel_previous_submenu = item_selected_submenu - 1;
-  if (item_sel_previous_submenu < 0) { item_sel_previous_submenu = NUM_SUBMENU_ITEMS - 1; }  // previous item would be below first = make it the last
-  item_sel_next_submenu = item_selected_submenu + 1;
-  if (item_sel_next_submenu >= NUM_SUBMENU_ITEMS) { item_sel_next_submenu = 0; }  // next item would be after last = make it the first
 }
-
-
-void OpenMenuOS::drawCanvasOnTFT() {
-  canvas.pushSprite(0, 0);
+#endif
+void OpenMenuOS::beginScene(uint8_t scene, uint32_t key) {
+  scenesDrawn |= 1 << scene;
+  currentScene = scene;
+  if (bandIndex > 0) {  // Same frame drawn again for another band
+    sceneChanged = scenesChanged & (1 << scene);
+    return;
+  }
+  sceneChanged = key != sceneKeys[scene];
+  sceneKeys[scene] = key;
+  if (sceneChanged) {
+    scenesChanged |= 1 << scene;
+  }
+}
+void OpenMenuOS::endScene() {
+  sceneChanged = true;
+  currentScene = SCENE_COUNT;
 }
 void OpenMenuOS::saveToEEPROM() {
-  // Save the contents of the array in EEPROM memory
+  // Save the contents of the array, the settings are written to the memory once they stopped changing for a while
   for (int i = 0; i < MAX_SETTINGS_ITEMS; i++) {
-    EEPROM.write(i, menu_items_settings_bool[i]);
+    settingsStore.setBool(i, menu_items_settings_bool[i]);
   }
-
-  EEPROM.commit();  // Don't forget to call the commit() function to save the data to EEPROM
 }
 void OpenMenuOS::readFromEEPROM() {
-  // Read the contents of the EEPROM memory and restore it to the array
+  // Restore the array from the saved settings
   for (int i = 0; i < MAX_SETTINGS_ITEMS; i++) {
-    menu_items_settings_bool[i] = EEPROM.read(i);
+    menu_items_settings_bool[i] = settingsStore.getBool(i);
   }
 }
+void OpenMenuOS::flushSettings() {
+  settingsStore.flush();
+}
+void OpenMenuOS::setSettingsCommitDelay(unsigned long ms) {
+  settingsStore.setCommitDelay(ms);
+}
+void OpenMenuOS::setSettingInt(uint8_t index, int32_t value) {
+  settingsStore.setInt(index, value);
+}
+int32_t OpenMenuOS::getSettingInt(uint8_t index) const {
+  return settingsStore.getInt(index);
+}
+void OpenMenuOS::setSettingString(uint8_t index, const char* value) {
+  settingsStore.setString(index, value);
+}
+const char* OpenMenuOS::getSettingString(uint8_t index) const {
+  return settingsStore.getString(index);
+}
 
 int OpenMenuOS::getCurrentScreen() const {
   return current_screen;
@@ -1699,7 +2636,7 @@ int OpenMenuOS::getSelectedItemSubmenu() const {
   return item_selected_submenu;
 }
 int OpenMenuOS::getSelectedItemTileMenu() const {
-  return item_selected_submenu;
+  return item_selected_tile_menu;
 }
 int OpenMenuOS::getTftHeight() const {
   return tftHeight;
@@ -1707,12 +2644,18 @@ int OpenMenuOS::getTftHeight() const {
 int OpenMenuOS::getTftWidth() const {
   return tftWidth;
 }
+TFT_eSPI& OpenMenuOS::getDisplay() {
+  return tft;
+}
+TFT_eSprite& OpenMenuOS::getCanvas() {
+  return canvas;
+}
 int OpenMenuOS::UpButton() const {
-  return BUTTON_UP_PIN;
+  return upPin;
 }
 int OpenMenuOS::DownButton() const {
-  return BUTTON_DOWN_PIN;
+  return downPin;
 }
 int OpenMenuOS::SelectButton() const {
-  return BUTTON_SELECT_PIN;
+  return selectPin;
 }
@@ -10,40 +10,181 @@
 #include "Arduino.h"
 #include <TFT_eSPI.h>
 #include "images.h"
+#include "ImageAsset.h"
+#include "ButtonInput.h"
+#include "Tween.h"
+#include "StringArena.h"
+#include "FrameProfiler.h"
+#include "MenuContext.h"
+#include "MenuDataSource.h"
+#ifdef ESP32
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#endif
 
-#define MAX_MENU_ITEMS 20                        // Maximum number of menu items
-#define MAX_SETTINGS_ITEMS 10                    // Maximum number of settings items
-#define MAX_ITEM_LENGTH 100                      // Maximum length of each menu item
-#define MAX_ITEM_LENGTH_NOT_SCROLLING 11         // Maximum length of each menu item when not scrolling
-#define MAX_SETTING_ITEM_LENGTH_NOT_SCROLLING 9  // Maximum length of each setting item when not scroling
+#define MAX_ITEM_LENGTH 100                      // Maximum length of an item given by a provider, longer texts are cut
+#define MAX_MENU_MODELS 8                        // Maximum number of menus registered with addMenu()
+#define UI_TASK_STACK_SIZE 8192                  // Stack of the UI task, in bytes (ESP32 only)
+#define UI_COMMAND_QUEUE_SIZE 8                  // Commands waiting for the UI task
+#define UI_EVENT_QUEUE_SIZE 16                   // Events waiting to be read by the application, the next ones are dropped
+#define UI_POPUP_LENGTH POPUP_MESSAGE_LENGTH     // Longest message of a popup shown by the UI task, longer ones are cut
+#define UI_TASK_POLL_TIME 10                     // Milliseconds between two checks of the buttons while the UI task is idle
 
-extern TFT_eSPI tft;        // Declare tft as extern
-extern TFT_eSprite canvas;  // Declare canvas as extern
+extern TFT_eSPI tft;        // Display of the menus created without one
+extern TFT_eSprite canvas;  // Their canvas, see getCanvas() for the others
 
-class OpenMenuOS {
+// Gives the text of an item of a menu, only the items on the screen are asked for. Return a string that stays valid
+// until the next call, or write the text in buffer (MAX_ITEM_LENGTH bytes) and return buffer
+typedef const char* (*MenuItemProvider)(int index, char* buffer, void* context);
+
+// An item of a menu kept in flash (PROGMEM), given to addMenu(). The entries and their labels are read where they are,
+// nothing is copied to RAM. The links aren't followed by the library, getMenuEntry() gives them to the sketch
+struct MenuEntry {
+  PGM_P label;     // Text, in PROGMEM too (see MENU_LABEL)
+  int8_t icon;     // Index in bitmap_icons, or -1 for none
+  int8_t submenu;  // Id of the menu the item opens, or -1
+  int8_t setting;  // Index of the setting the item toggles, or -1
+};
+// Declare the label of a MenuEntry in flash
+#define MENU_LABEL(name, text) static const char name[] PROGMEM = text
+
+class OpenMenuOS;
+
+// Called with the index of a node of a menu tree
+typedef void (*MenuNodeCallback)(OpenMenuOS& menu, int node);
+
+// A node of a menu tree, see setMenuTree(). The nodes are in one array (it can be in PROGMEM), the children of a node
+// are consecutive so a list is shown straight from the array. A node without children is a page drawn by onRender, or
+// an action if it has no onRender either: select calls its onEnter and the list stays
+struct MenuNode {
+  PGM_P label;                // Text in the list of the parent, in PROGMEM too (see MENU_LABEL)
+  int8_t icon;                // Index in bitmap_icons, or -1 for none
+  int16_t parent;             // Index of the parent, -1 for the root
+  int16_t firstChild;         // Index of the first child
+  int16_t childCount;         // 0 for a page or an action
+  MenuNodeCallback onEnter;   // Called when the node is opened, or NULL
+  MenuNodeCallback onLeave;   // Called when going back from the node, or NULL
+  MenuNodeCallback onRender;  // Draws a page every frame, or NULL
+};
+
+// A menu registered once with addMenu() and drawn from its handle
+struct MenuModel {
+  int id;                     // Identifier given to addMenu()
+  const char* const* items;   // Items of the menu. They are not copied, so they must stay valid. NULL with a provider
+  MenuItemProvider provider;  // Gives the items one at a time instead of items, or NULL
+  void* context;              // Given to the provider
+  int count;                  // Number of items
+  uint16_t generation;        // Incremented every time the items change
+  const MenuEntry* entries;   // Items in flash instead of items, or NULL
+  const MenuNode* nodes;      // Children of a node of a menu tree instead of items, or NULL
+  MenuDataSource* source;     // Gives the items and their number through provider, or NULL
+};
+
+// Draws the content of a tile in the coordinates of the tile, 0, 0 is its top left corner and what is outside of it is clipped
+typedef void (*TileDrawCallback)(int index, int16_t w, int16_t h, bool selected);
+
+// A tile given to drawTileMenu(). The tiles are not copied, so they must stay valid
+struct TileItem {
+  const char* label;      // Text under the icon, or NULL
+  const uint8_t* icon;    // 16x16 image (raw or compressed), or NULL
+  uint16_t color;         // Background colour of the tile
+  TileDrawCallback draw;  // Draws the rest of the content after the icon and the label, or NULL
+};
+
+// Draws the screens from the UI task, like loop() does without it. Also used to run any call on the UI task
+typedef void (*MenuTaskCallback)(OpenMenuOS& menu, void* context);
+
+enum MenuEventType {
+  MENU_EVENT_SCREEN,     // The current screen changed, screen is the new one
+  MENU_EVENT_SELECTION,  // The selected item of the list shown on screen changed, item is the new one
+  MENU_EVENT_SETTING,    // A setting was toggled, item is its index and value its state
+  MENU_EVENT_POPUP       // A popup was closed, item is its id and value its type
+};
+
+// Sent by the UI task to the application, see readEvent()
+struct MenuEvent {
+  uint8_t type;  // MenuEventType
+  int screen;    // Current screen when the event was sent
+  int item;
+  int value;
+};
+
+class OpenMenuOS : private MenuContext {  // Each menu has its own state, see MenuContext.h
 public:
-  static bool menu_items_settings_bool[];
+  bool menu_items_settings_bool[MAX_SETTINGS_ITEMS];
 
-  OpenMenuOS(int btn_up, int btn_down, int btn_sel, int tft_bl);  // BTN_UP pin, BTN_DOWN pin, BTN_SEL pin, TFT Backlight pin
+  OpenMenuOS(int btn_up, int btn_down, int btn_sel, int tft_bl);  // BTN_UP pin, BTN_DOWN pin, BTN_SEL pin, TFT Backlight pin (BUTTON_NO_PIN for a missing button)
+  // Same, on another display. The menu draws on a canvas of its own, see getCanvas()
+  OpenMenuOS(TFT_eSPI& display, int btn_up, int btn_down, int btn_sel, int tft_bl);
 
   void begin(int rotation);  // Display type
-  void loop();
+  // Handle the buttons and start a frame. Returns false without starting one when setTargetFPS() is used and the frame
+  // isn't due yet: skip the drawing, the time until it is due (getIdleTime()) is the sketch's
+  bool loop();
 
   // Draw the main menu
   void drawMenu(bool images, const char* names...);
+  void drawMenu(int handle, bool images);
   // Draw a submenu
   void drawSubmenu(bool images, const char* names...);
+  void drawSubmenu(int handle, bool images);
   // Draw the setting menu
   void drawSettingMenu(const char* items...);
+  void drawSettingMenu(int handle);
+
+  // Register a menu once and get a handle to draw it. Registering an existing id updates it. Returns -1 if there is no room left
+  int addMenu(int id, const char* const items[], int count);
+  // Same, with the items given by provider when they are shown. The menu can have any number of items, only the ones on the screen are in memory
+  int addMenu(int id, MenuItemProvider provider, void* context, int count);
+  // Replace the items of a registered menu
+  void updateMenu(int handle, const char* const items[], int count);
+  void updateMenu(int handle, MenuItemProvider provider, void* context, int count);
+  // Same, with the items and their labels in flash. Label, icon and links of each item are read when it is shown
+  int addMenu(int id, const MenuEntry entries[], int count);
+  void updateMenu(int handle, const MenuEntry entries[], int count);
+  // Same, with the items of a data source. Its count() is asked every frame, and its items around the selection ahead
+  int addMenu(int id, MenuDataSource& source);
+  void updateMenu(int handle, MenuDataSource& source);
+  // Read an entry of a menu registered in flash, returns false if the menu has no entries or index is out of range
+  bool getMenuEntry(int handle, int index, MenuEntry& entry) const;
+  // Navigate a tree of menus instead of the screens: drawMenuTree() draws the list of the current node or its page,
+  // select opens the selected child and a long press goes back to the parent. The nodes are not copied
+  void setMenuTree(const MenuNode nodes[], int count, int root = 0);
+  void drawMenuTree(bool images);
+  // Open a node as if it was reached from the root, calling onLeave and onEnter of the nodes left and entered
+  void openNode(int node);
+  int getCurrentNode() const;   // Node shown by drawMenuTree(), -1 without a tree
+  int getSelectedNode() const;  // Node selected in the list of the current node, -1 if it has no children
+  int getTreeDepth() const;     // 1 at the root
+  // Tell the menu its items were modified in place
+  void touchMenu(int handle);
+  // Get the handle of a registered menu from its id, or -1
+  int findMenu(int id) const;
+  // Get the generation of a registered menu, it changes every time its items change
+  uint16_t getMenuGeneration(int handle) const;
 
   void drawToggleSwitch(int16_t x, int16_t y, bool state);
 
   // Draw a tile submenu
   void drawTileMenu(int rows, int columns, int tile_color);
+  // Draw count tiles, rows x columns at a time. When they don't fit on the screen, the page of the selected tile slides in
+  void drawTileMenu(const TileItem tiles[], int count, int rows, int columns);
+  // Redraw a tile whose content changed (in dirty rectangle mode, only the changed tiles are drawn)
+  void invalidateTile(int index);
   // Redirect to a menu
   void redirectToMenu(int screen, int item);
   // Draw a popup
   void drawPopup(char* message, bool& clicked, int type);
+  // Queue a popup shown over the screen until select is pressed, the buttons don't reach the menu meanwhile. The popups
+  // are shown one after the other and the message is copied. Returns an id, or -1 if MAX_POPUPS are already waiting
+  int showPopup(const char* message, int type);
+  // Same, for a toast: a line at the bottom of the screen for duration milliseconds, the menu keeps its buttons
+  int showToast(const char* message, int type, unsigned long duration = TOAST_DURATION);
+  // Check if a popup or a toast is still shown or waiting
+  bool isPopupShown(int id) const;
+  // Remove a popup or a toast without waiting for select or its time
+  void closePopup(int id);
   // Draw the scrollbar
   void drawScrollbar(int selectedItem, int nextItem);
   // Scroll text horizontally
@@ -54,6 +195,19 @@ public:
   void showBootImage(bool x);
   // Enable or disable button animation
   void setButtonAnimation(bool x);
+  // Enable or disable the transitions (selection, scrollbar and toggle switches)
+  void setAnimations(bool x);
+  // Draw flat shapes with integer fills instead of the anti-aliased ones, much faster on the small boards
+  void setFastRendering(bool x);
+  // Start fps frames per second: loop() returns false until the next frame is due. With adaptive, the quality is lowered while
+  // the frames take longer than that (see Quality) and raised again once they are fast. 0 to stop pacing
+  void setTargetFPS(uint8_t fps, bool adaptive = true);
+  unsigned long getIdleTime() const;  // Milliseconds before loop() starts the next frame, for the sketch to use
+  uint8_t getQuality() const;         // QUALITY_FULL unless the governor lowered it
+  uint32_t getFrameCost() const;      // Average microseconds from loop() to the end of drawCanvasOnTFT()
+  // Draw the menus and submenus as a list of rows sliding under the selection, rows is the number of rows shown (at most
+  // MAX_LIST_ROWS), 0 for as many as fit the display
+  void setListView(bool x, int rows = 0);
   // Set the style of the menu
   void setMenuStyle(int style);
   // Enable or disable scrollbar
@@ -65,13 +219,93 @@ public:
   void setSelectionFillColor(uint16_t color);
   void useStylePreset(char* preset);
   void setButtonsMode(char* mode);
+  // Enable or disable dirty rectangle mode (only the changed regions of the canvas are pushed to the display)
+  void setDirtyRectMode(bool x);
+  // Mark a region of the canvas as changed so it is pushed by the next drawCanvasOnTFT()
+  void markDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+  // Push the whole canvas on the next drawCanvasOnTFT()
+  void invalidateScreen();
+  // Draw each frame in count horizontal bands, the canvas only holds one band (uses count times less memory)
+  void setBandCount(int count);
+  // Change the rotation of the display after begin(), the canvas and the layout follow the new size
+  void setRotation(int rotation);
+  // Move to the next band after drawCanvasOnTFT(), returns false once the whole frame is drawn
+  bool nextBand();
+  // Push the canvas with DMA while the next frame is drawn in a second buffer, call it before begin() (ESP32 only, uses twice the memory of the canvas)
+  void setDMAMode(bool x);
+  // Check if a new frame is needed: a button event, an animation (scrolling text...) or requestRedraw()
+  bool needsRedraw();
+  // Wait until a new frame is needed or until timeoutMs elapsed. Returns needsRedraw()
+  bool waitForEvent(unsigned long timeoutMs);
+  // Ask for a new frame, call it when what you draw yourself changes
+  void requestRedraw();
+  // Enable or disable light sleep while waiting in waitForEvent() (ESP32 only)
+  void setLightSleep(bool x);
+
+  // Keep the settings of this menu apart from those of the other menus of the device, call it before begin()
+  void setSettingsId(uint8_t id);
+
+  // Send the boot image to the display as it is decoded, in one window, and with DMA in DMA mode while the canvas and
+  // the settings are set up. Call it before begin()
+  void setFastStartup(bool x);
+  unsigned long getStartupTime() const;     // Milliseconds spent in begin()
+  unsigned long getFirstFrameTime() const;  // Milliseconds from power on to the first frame on the display, 0 before it
+  // Change the SPI clock of the display after begin(). On the panels wired for reading (TFT_MISO), a few pixels are
+  // written and read back: returns false and keeps the previous clock if they don't match. The display stays selected
+  // afterwards, like in DMA mode
+  bool setSPIFrequency(uint32_t frequency);
+  uint32_t getSPIFrequency() const;  // 0 on the parallel displays
+  // Create the caches of the labels and of the scrolling texts at their largest size in begin(), then never allocate
+  // from the heap while drawing. The rows of the list view, the popup boxes and the toasts are drawn directly instead
+  // of being cached, and a text that doesn't fit its cache is printed
+  void setStaticSprites(bool x);
+  uint32_t getAllocationCount() const;  // Sprite buffers created by the caches since begin(), stays at 0 with setStaticSprites(true)
+  // Send what changes on the display to stream (Serial, a TCP client...) for extras/mirror/viewer.html, and take the
+  // buttons pressed in the viewer from it. NULL to stop
+  void setMirror(Stream* stream);
+  uint32_t getMirrorBytes() const;  // Bytes sent to the mirror
+
+#ifdef ESP32
+  // Call it instead of begin() to draw the menu from a task of its own: the task calls begin(), then render for every
+  // frame that is needed. From then on, only the UI task draws and reads the buttons, the other tasks talk to it through
+  // the post functions and readEvent(). Returns false if the task couldn't be created
+  bool startTask(int rotation, MenuTaskCallback render, void* context, BaseType_t core = 0, UBaseType_t priority = 1);
+  // Commands for the UI task, they can be sent from any task. They return false if the queue is full
+  bool postRedirect(int screen, int item);
+  bool postPopup(const char* message, int type);  // The message is copied
+  bool postToast(const char* message, int type, unsigned long duration = TOAST_DURATION);
+  bool postMenuItems(int handle, const char* const items[], int count);
+  bool postMenuItems(int handle, MenuItemProvider provider, void* context, int count);
+  bool postMenuItems(int handle, const MenuEntry entries[], int count);
+  bool postCall(MenuTaskCallback call, void* context);  // Runs call(menu, context) on the UI task, to change the style for example
+  bool postRedraw();
+  // Get the next event sent by the UI task, waiting up to timeoutMs for one. Returns false if there is none
+  bool readEvent(MenuEvent& event, unsigned long timeoutMs = 0);
+#endif
 
   void printMenuToSerial();
+  // Min/avg/max time of a phase of the frame (ProfilePhase) over the last PROFILE_HISTORY frames. Returns false without
+  // OPENMENUOS_PROFILE or before the first frame
+  bool getProfileStats(uint8_t phase, ProfileStats& stats) const;
+  void printProfileToSerial();
+  void resetProfile();
+  // Show the FPS and the free heap in the top left corner (needs OPENMENUOS_PROFILE)
+  void setProfileOverlay(bool x);
+  // Update the items around the selection, the buttons themselves are handled by loop()
   void checkForButtonPress();
   void checkForButtonPressSubmenu();
   void drawCanvasOnTFT();
   void saveToEEPROM();
   void readFromEEPROM();
+  // Write the changed settings now instead of after the commit delay (before a reset or a deep sleep)
+  void flushSettings();
+  // Time without change before the settings are written, in milliseconds
+  void setSettingsCommitDelay(unsigned long ms);
+  // Values saved with the settings: SETTINGS_INT_COUNT ints and SETTINGS_STRING_COUNT strings (32, 64, 32 and 64 characters)
+  void setSettingInt(uint8_t index, int32_t value);
+  int32_t getSettingInt(uint8_t index) const;
+  void setSettingString(uint8_t index, const char* value);
+  const char* getSettingString(uint8_t index) const;
 
   int getCurrentScreen() const;          // Getter method for current_screen
   int getCurrentScreenTileMenu() const;  // Getter method for current_screen
@@ -80,15 +314,95 @@ public:
   int getSelectedItemTileMenu() const;   // Getter method for item_selected_tile_menu
   int getTftHeight() const;              // Getter method for tftHeight
   int getTftWidth() const;               // Getter method for tftWidth
+  TFT_eSPI& getDisplay();                // Display the menu draws on
+  TFT_eSprite& getCanvas();              // Canvas the menu draws in, draw your own screens in it too
   int UpButton() const;                  // Getter method for Up Button
   int DownButton() const;                // Getter method for Down Button
   int SelectButton() const;              // Getter method for Select Button
 private:
-  char menu_items[MAX_MENU_ITEMS][MAX_ITEM_LENGTH];
-  char submenu_items[MAX_MENU_ITEMS][MAX_ITEM_LENGTH];
+  StringArena menu_items;     // Items given to drawMenu() directly
+  StringArena submenu_items;  // Items given to drawSubmenu() directly
   int NUM_MENU_ITEMS;
   int NUM_SUBMENU_ITEMS;
   int current_screen;
+
+  MenuModel main_menu;  // Menu shown by drawMenu()
+  MenuModel sub_menu;   // Menu shown by drawSubmenu()
+  uint16_t menu_items_generation;
+  uint16_t submenu_items_generation;
+
+  MenuModel menu_models[MAX_MENU_MODELS];
+  int NUM_MENU_MODELS;
+
+  void init(int btn_up, int btn_down, int btn_sel, int tft_bl);
+#ifdef ESP32
+  enum UICommandType {
+    UI_COMMAND_REDIRECT,
+    UI_COMMAND_POPUP,
+    UI_COMMAND_TOAST,
+    UI_COMMAND_ITEMS,
+    UI_COMMAND_PROVIDER,
+    UI_COMMAND_ENTRIES,
+    UI_COMMAND_CALL,
+    UI_COMMAND_REDRAW
+  };
+  struct UICommand {
+    uint8_t type;  // UICommandType
+    int handle;    // Screen for a redirect
+    int count;     // Item for a redirect, type for a popup
+    unsigned long duration;  // Of a toast
+    const char* const* items;
+    MenuItemProvider provider;
+    const MenuEntry* entries;
+    MenuTaskCallback call;
+    void* context;
+    char message[UI_POPUP_LENGTH];
+  };
+
+  TaskHandle_t uiTask;
+  TaskHandle_t uiStarter;  // Waits for begin() to run on the task
+  QueueHandle_t uiCommands;
+  QueueHandle_t uiEvents;
+  MenuTaskCallback uiRender;
+  void* uiRenderContext;
+  int uiRotation;
+  int uiReportedScreen;  // Last state sent as events
+  int uiReportedSelection;
+  uint8_t uiReportedView;
+  bool uiReportedSettings[MAX_SETTINGS_ITEMS];
+
+  static void uiTaskMain(void* arg);
+  void runTask();
+  void handleCommand(const UICommand& command);
+  bool postCommand(UICommand& command);
+  void postEvent(uint8_t type, int item, int value);
+  void postEvents();  // Compare the state with the one last reported
+#endif
+  void drawMenuItems(uint8_t scene, const MenuModel& menu, int previous, int selected, int next, bool images);
+  void drawListItems(uint8_t scene, const MenuModel& menu, int previous, int selected, int next, bool images);
+  void drawSettingItems(const MenuModel& items);  // The items after the backlight
+  void drawScrollbar(int selectedItem, int nextItem, int count);
+  void drawProfileOverlay();
+  void drawTileGrid(const TileItem* tiles, int count, int rows, int columns, uint16_t color);  // tiles is NULL for plain tiles of color
+
+  void drawPopupScene(uint8_t scene, const char* message, int type);
+  void drawToast(const Popup& toast);
+  void drawPopups();  // The front of the queue, over the screen
+
+  bool checkSPI();
+  void handleButtonEvent(const ButtonEvent& event);
+  void handlePopupEvent(const ButtonEvent& event);
+  void handleTreeEvent(const ButtonEvent& event);
+  void stepView(int step);  // Move the selection of the list or grid drawn inside a screen
+  void countSource(MenuModel& menu, int& selected);  // Before drawing a menu of a data source
+  void prefetchSource(const MenuModel& menu, int selected);  // After
+  void enterNode(int node);
+  void leaveNode();
+  void toggleSetting(int index);
+
+  void drawToggleSwitch(int16_t x, int16_t y, bool state, int16_t knob);  // knob goes from 0 (off) to 1024 (on)
+  void beginScene(uint8_t scene, uint32_t key);  // Start a renderer's frame, sceneChanged is set if what it draws has changed
+  void endScene();
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+/*
+  PopupQueue.cpp - Popups and toasts waiting to be shown for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "PopupQueue.h"
+
+PopupQueue::PopupQueue() {
+  count = 0;
+  nextId = 1;
+}
+
+int PopupQueue::push(const char* message, uint8_t type, bool toast, unsigned long duration) {
+  if (count >= MAX_POPUPS) return -1;
+  Popup& popup = popups[count++];
+  popup.id = nextId;
+  nextId = nextId < 0x7fff ? nextId + 1 : 1;  // Ids stay positive
+  popup.type = type;
+  popup.toast = toast;
+  popup.shown = false;
+  popup.duration = duration;
+  popup.shownAt = 0;
+  strncpy(popup.message, message != NULL ? message : "", POPUP_MESSAGE_LENGTH - 1);
+  popup.message[POPUP_MESSAGE_LENGTH - 1] = '\0';
+  return popup.id;
+}
+
+Popup* PopupQueue::front() {
+  return count > 0 ? &popups[0] : NULL;
+}
+
+void PopupQueue::pop() {
+  if (count > 0) {
+    remove(popups[0].id);
+  }
+}
+
+bool PopupQueue::remove(int id) {
+  for (uint8_t i = 0; i < count; i++) {
+    if (popups[i].id == id) {
+      count--;
+      for (uint8_t j = i; j < count; j++) {  // A few entries, shifting keeps them in order
+        popups[j] = popups[j + 1];
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+bool PopupQueue::contains(int id) const {
+  for (uint8_t i = 0; i < count; i++) {
+    if (popups[i].id == id) return true;
+  }
+  return false;
+}
+
+void PopupQueue::clear() {
+  count = 0;
+}
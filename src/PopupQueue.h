@@ -0,0 +1,47 @@
+/*
+  PopupQueue.h - Popups and toasts waiting to be shown for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#ifndef PopupQueue_h
+#define PopupQueue_h
+
+#include "Arduino.h"
+
+#define MAX_POPUPS 4             // Popups and toasts waiting to be shown, the one on the screen included
+#define POPUP_MESSAGE_LENGTH 64  // Longest message, longer ones are cut
+#define TOAST_DURATION 2000      // Milliseconds a toast stays on the screen by default
+
+struct Popup {
+  int id;
+  uint8_t type;  // 1 warning, 2 success, 3 info
+  bool toast;    // Leaves by itself after duration, the buttons keep driving the menu meanwhile
+  bool shown;    // Set the first time it is drawn, its time starts then
+  unsigned long duration;
+  unsigned long shownAt;
+  char message[POPUP_MESSAGE_LENGTH];
+};
+
+// The popups are shown one after the other, in the order they were queued
+class PopupQueue {
+public:
+  PopupQueue();
+
+  // Copy a popup at the end of the queue. Returns its id, or -1 if the queue is full
+  int push(const char* message, uint8_t type, bool toast, unsigned long duration);
+  // The popup on the screen, or NULL
+  Popup* front();
+  // Remove the popup on the screen, the next one takes its place
+  void pop();
+  // Remove a popup wherever it is in the queue. Returns false if it isn't there anymore
+  bool remove(int id);
+  bool contains(int id) const;
+  void clear();
+private:
+  Popup popups[MAX_POPUPS];
+  uint8_t count;
+  int nextId;
+};
+
+#endif
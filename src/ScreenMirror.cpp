@@ -0,0 +1,155 @@
+/*
+  ScreenMirror.cpp - Copy of the display over a Stream for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "ScreenMirror.h"
+
+ScreenMirror::ScreenMirror() {
+  stream = NULL;
+  width = 0;
+  height = 0;
+  keyframe = true;
+  regionsSent = false;
+  runColor = 0;
+  runLength = 0;
+  runColors[0] = 0;
+  runColors[1] = 0;
+  runsSent = 0;
+  used = 0;
+  sent = 0;
+  releasePending = false;
+  releaseButton = 0;
+}
+
+void ScreenMirror::begin(Stream* output) {
+  flush();
+  stream = output;
+  keyframe = true;
+  releasePending = false;
+}
+
+bool ScreenMirror::active() const {
+  return stream != NULL;
+}
+
+bool ScreenMirror::beginFrame(uint16_t w, uint16_t h) {
+  regionsSent = false;
+  if (w != width || h != height) {
+    width = w;
+    height = h;
+    keyframe = true;
+  }
+  if (!keyframe) return false;
+  header('S');
+  put16(width);
+  put16(height);
+  keyframe = false;
+  return true;
+}
+
+void ScreenMirror::beginRegion(int16_t x, int16_t y, int16_t w, int16_t h) {
+  header('R');
+  put16(x);
+  put16(y);
+  put16(w);
+  put16(h);
+  runLength = 0;
+  runsSent = 0;
+  regionsSent = true;
+}
+
+void ScreenMirror::pixel(uint16_t color) {
+  if (runLength > 0 && (color != runColor || runLength == MIRROR_MAX_RUN)) {
+    endRun();
+  }
+  runColor = color;
+  runLength++;
+}
+
+void ScreenMirror::endRegion() {
+  if (runLength > 0) {
+    endRun();
+  }
+}
+
+void ScreenMirror::endFrame() {
+  if (regionsSent) {
+    header('F');
+  }
+  flush();  // A frame is complete on the viewer before the next one is drawn
+}
+
+bool ScreenMirror::read(ButtonEvent& event) {
+  if (releasePending) {
+    releasePending = false;
+    event.button = releaseButton;
+    event.type = BUTTON_RELEASE;
+    return true;
+  }
+  while (stream != NULL && stream->available() > 0) {
+    int c = stream->read();
+    if (c == 'r') {
+      keyframe = true;
+      continue;
+    }
+    const char* buttons = "udsUDS";
+    const char* command = c > 0 ? strchr(buttons, c) : NULL;
+    if (command == NULL) continue;  // Not a command, the viewer started in the middle of one
+    event.button = (command - buttons) % 3;  // BUTTON_UP, BUTTON_DOWN, BUTTON_SELECT in the order of buttons
+    event.type = command - buttons < 3 ? BUTTON_SHORT_PRESS : BUTTON_LONG_PRESS;
+    releaseButton = event.button;
+    releasePending = true;
+    return true;
+  }
+  return false;
+}
+
+bool ScreenMirror::wantsFrame() const {
+  return stream != NULL && keyframe;
+}
+
+uint32_t ScreenMirror::bytesSent() const {
+  return sent;
+}
+
+void ScreenMirror::put(uint8_t byte) {
+  if (used == MIRROR_BUFFER_SIZE) {
+    flush();
+  }
+  buffer[used++] = byte;
+}
+
+void ScreenMirror::put16(uint16_t value) {
+  put(value & 0xFF);
+  put(value >> 8);
+}
+
+void ScreenMirror::header(char type) {
+  put('O');
+  put('M');
+  put(type);
+}
+
+void ScreenMirror::endRun() {
+  if (runsSent == 2 && runColor == runColors[1]) {
+    put((runLength - 1) | 0x80);
+  } else {
+    put(runLength - 1);
+    put16(runColor);
+  }
+  runColors[1] = runColors[0];
+  runColors[0] = runColor;
+  if (runsSent < 2) runsSent++;
+  runLength = 0;
+}
+
+void ScreenMirror::flush() {
+  if (stream != NULL && used > 0) {
+    stream->write(buffer, used);
+    sent += used;
+  }
+  used = 0;
+}
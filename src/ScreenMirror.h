@@ -0,0 +1,67 @@
+/*
+  ScreenMirror.h - Copy of the display over a Stream for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+
+  The regions pushed to the display are sent compressed to a viewer (extras/mirror/viewer.html), which sends the
+  buttons back. The numbers are little endian, the colours RGB565:
+    'O' 'M' 'S' width(2) height(2)              Size of the screen, before the first region and when it changes
+    'O' 'M' 'R' x(2) y(2) w(2) h(2) runs...     A region, row by row as runs of count - 1 (1) and colour (2)
+    'O' 'M' 'F'                                 End of a frame, the viewer can show it
+  The bit 7 of a count is set when the run has the colour of the run before the previous one, its colour is left out:
+  a text on its background takes a byte per run.
+  The viewer sends a byte per command: u, d and s press up, down and select, U, D and S hold them for a long press,
+  r asks for the whole screen.
+*/
+
+#ifndef ScreenMirror_h
+#define ScreenMirror_h
+
+#include "Arduino.h"
+#include "ButtonInput.h"
+
+#define MIRROR_BUFFER_SIZE 64  // Bytes written to the stream at once
+#define MIRROR_MAX_RUN 128     // Pixels of a run
+
+class ScreenMirror {
+public:
+  ScreenMirror();
+
+  // Start sending to stream, NULL to stop
+  void begin(Stream* stream);
+  bool active() const;
+  // Start a frame. Returns true if the whole screen has to be sent: first frame, new size or asked by the viewer
+  bool beginFrame(uint16_t width, uint16_t height);
+  // Send a region, call pixel() for each of its pixels row by row, then endRegion()
+  void beginRegion(int16_t x, int16_t y, int16_t w, int16_t h);
+  void pixel(uint16_t color);
+  void endRegion();
+  void endFrame();
+  // Read the commands of the viewer, returns the next button event (a press, then its release) or false if there is none
+  bool read(ButtonEvent& event);
+  bool wantsFrame() const;  // The viewer asked for the whole screen, it is sent with the next frame
+  uint32_t bytesSent() const;
+private:
+  Stream* stream;
+  uint16_t width;
+  uint16_t height;
+  bool keyframe;     // The next frame sends the whole screen
+  bool regionsSent;  // Since beginFrame()
+  uint16_t runColor;
+  uint16_t runLength;
+  uint16_t runColors[2];  // Colours of the previous run and of the one before it
+  uint8_t runsSent;       // Runs of the region, up to 2
+  uint8_t buffer[MIRROR_BUFFER_SIZE];
+  uint8_t used;
+  uint32_t sent;
+  bool releasePending;  // The release of the last press is the next event
+  uint8_t releaseButton;
+
+  void put(uint8_t byte);
+  void put16(uint16_t value);
+  void header(char type);
+  void endRun();
+  void flush();
+};
+
+#endif
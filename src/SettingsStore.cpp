@@ -0,0 +1,176 @@
+/*
+  SettingsStore.cpp - Persistent settings for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include <EEPROM.h>
+#include "SettingsStore.h"
+
+#define SETTINGS_MAGIC 0x4F4D  // "OM"
+
+#ifndef SETTINGS_USE_PREFERENCES
+static size_t eepromSize = 0;  // Bytes of the EEPROM reserved so far
+#endif
+static const uint8_t stringCapacity[SETTINGS_STRING_COUNT] = { 32, 64, 32, 64 };
+
+SettingsStore::SettingsStore() {
+  memset(&record, 0, sizeof(record));
+  id = 0;
+  record.magic = SETTINGS_MAGIC;
+  slot = SETTINGS_LOG_SLOTS - 1;  // So the first write goes to slot 0
+  dirty = false;
+  changedTime = 0;
+  commitDelay = SETTINGS_COMMIT_DELAY;
+}
+
+char* SettingsStore::stringAt(Record& record, uint8_t index) {
+  char* text = record.strings;
+  for (uint8_t i = 0; i < index; i++) {
+    text += stringCapacity[i] + 1;
+  }
+  return text;
+}
+
+// Address of a slot of the log of this id in the EEPROM
+int SettingsStore::slotAddress(uint8_t index) const {
+  return (id * SETTINGS_LOG_SLOTS + index) * sizeof(Record);
+}
+
+// CRC-16/CCITT of the record, without its crc field
+uint16_t SettingsStore::checksum(const Record& record) {
+  const uint8_t* bytes = (const uint8_t*)&record;
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < offsetof(Record, crc); i++) {
+    crc ^= (uint16_t)bytes[i] << 8;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+bool SettingsStore::begin(uint8_t storeId) {
+  id = storeId;
+#ifdef SETTINGS_USE_PREFERENCES
+  char name[16] = "OpenMenuOS";  // Id 0 keeps the namespace of the previous versions
+  if (id > 0) {
+    snprintf(name, sizeof(name), "OpenMenuOS%u", id);
+  }
+  preferences.begin(name, false);
+#else
+  // The logs of the ids follow each other. The EEPROM is shared by all of them, it only grows
+  size_t size = max((id + 1) * SETTINGS_LOG_SLOTS * sizeof(Record), (size_t)SETTINGS_LEGACY_BOOL_COUNT);
+  if (size > eepromSize) {
+    EEPROM.begin(size);
+    eepromSize = size;
+  }
+#endif
+  return load() || (id == 0 && loadLegacy());  // The previous versions only had one menu
+}
+
+bool SettingsStore::load() {
+  Record candidate;
+#ifdef SETTINGS_USE_PREFERENCES
+  if (preferences.getBytes("settings", &candidate, sizeof(candidate)) != sizeof(candidate)) return false;
+  if (candidate.magic != SETTINGS_MAGIC || candidate.crc != checksum(candidate)) return false;
+  record = candidate;
+  return true;
+#else
+  // Take the newest valid slot of the log, a slot torn by a power loss fails its crc and the previous one is used
+  bool found = false;
+  for (uint8_t i = 0; i < SETTINGS_LOG_SLOTS; i++) {
+    EEPROM.get(slotAddress(i), candidate);
+    if (candidate.magic != SETTINGS_MAGIC || candidate.crc != checksum(candidate)) continue;
+    if (!found || (int16_t)(candidate.sequence - record.sequence) > 0) {
+      record = candidate;
+      slot = i;
+      found = true;
+    }
+  }
+  return found;
+#endif
+}
+
+bool SettingsStore::loadLegacy() {
+  // The previous versions wrote one byte per bool at the start of the EEPROM
+#ifdef SETTINGS_USE_PREFERENCES
+  EEPROM.begin(SETTINGS_LEGACY_BOOL_COUNT);
+#endif
+  for (uint8_t i = 0; i < SETTINGS_LEGACY_BOOL_COUNT; i++) {
+    uint8_t value = EEPROM.read(i);
+    if (value > 1) return false;  // Erased or something else
+  }
+  for (uint8_t i = 0; i < SETTINGS_LEGACY_BOOL_COUNT; i++) {
+    setBool(i, EEPROM.read(i));  // Written in the new layout on the next commit
+  }
+  return true;
+}
+
+void SettingsStore::update() {
+  if (dirty && millis() - changedTime >= commitDelay) {
+    flush();
+  }
+}
+
+void SettingsStore::flush() {
+  if (!dirty) return;
+  dirty = false;
+  record.sequence++;
+  record.crc = checksum(record);
+#ifdef SETTINGS_USE_PREFERENCES
+  preferences.putBytes("settings", &record, sizeof(record));
+#else
+  slot = (slot + 1) % SETTINGS_LOG_SLOTS;  // Never overwrite the last good slot
+  EEPROM.put(slotAddress(slot), record);
+  EEPROM.commit();
+#endif
+}
+
+bool SettingsStore::pending() const {
+  return dirty;
+}
+
+void SettingsStore::setCommitDelay(unsigned long ms) {
+  commitDelay = ms;
+}
+
+void SettingsStore::changed() {
+  dirty = true;
+  changedTime = millis();
+}
+
+bool SettingsStore::getBool(uint8_t index) const {
+  return index < SETTINGS_BOOL_COUNT && (record.bools & ((uint32_t)1 << index));
+}
+
+void SettingsStore::setBool(uint8_t index, bool value) {
+  if (index >= SETTINGS_BOOL_COUNT || getBool(index) == value) return;
+  record.bools ^= (uint32_t)1 << index;
+  changed();
+}
+
+int32_t SettingsStore::getInt(uint8_t index) const {
+  return index < SETTINGS_INT_COUNT ? record.ints[index] : 0;
+}
+
+void SettingsStore::setInt(uint8_t index, int32_t value) {
+  if (index >= SETTINGS_INT_COUNT || record.ints[index] == value) return;
+  record.ints[index] = value;
+  changed();
+}
+
+const char* SettingsStore::getString(uint8_t index) const {
+  if (index >= SETTINGS_STRING_COUNT) return "";
+  return stringAt(const_cast<Record&>(record), index);
+}
+
+void SettingsStore::setString(uint8_t index, const char* value) {
+  if (index >= SETTINGS_STRING_COUNT) return;
+  char* text = stringAt(record, index);
+  if (strncmp(text, value, stringCapacity[index]) == 0) return;
+  strncpy(text, value, stringCapacity[index]);
+  text[stringCapacity[index]] = '\0';
+  changed();
+}
@@ -0,0 +1,73 @@
+/*
+  SettingsStore.h - Persistent settings for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#ifndef SettingsStore_h
+#define SettingsStore_h
+
+#include "Arduino.h"
+#ifdef ESP32
+#include <Preferences.h>
+#define SETTINGS_USE_PREFERENCES  // NVS already spreads the writes over its pages
+#endif
+
+#define SETTINGS_BOOL_COUNT 32        // Number of bools, stored one bit each
+#define SETTINGS_INT_COUNT 8          // Number of ints
+#define SETTINGS_STRING_COUNT 4       // Number of strings, their capacity is 32, 64, 32 and 64 characters
+#define SETTINGS_LOG_SLOTS 4          // Number of slots the EEPROM writes rotate through (when Preferences isn't used)
+#define SETTINGS_COMMIT_DELAY 2000    // 2000 milliseconds without change before the settings are written
+#define SETTINGS_LEGACY_BOOL_COUNT 10  // Bools saved by the previous versions, one byte each at the start of the EEPROM
+
+class SettingsStore {
+public:
+  SettingsStore();
+
+  // Load the settings, from the previous versions' layout if nothing was saved with this one yet. Returns false if nothing was found.
+  // Each id has its own settings, so several menus of a device don't overwrite each other's
+  bool begin(uint8_t id = 0);
+  // Write the settings once they stopped changing for the commit delay, call it once per frame
+  void update();
+  // Write the changed settings now
+  void flush();
+  // Check if there are changes not written yet
+  bool pending() const;
+  // Time without change before the settings are written, in milliseconds
+  void setCommitDelay(unsigned long ms);
+
+  bool getBool(uint8_t index) const;
+  void setBool(uint8_t index, bool value);
+  int32_t getInt(uint8_t index) const;
+  void setInt(uint8_t index, int32_t value);
+  const char* getString(uint8_t index) const;
+  void setString(uint8_t index, const char* value);  // Truncated to the capacity of the string
+private:
+  struct Record {
+    uint16_t magic;
+    uint16_t sequence;  // Incremented on every write, the newest slot of the log wins
+    uint32_t bools;
+    int32_t ints[SETTINGS_INT_COUNT];
+    char strings[(32 + 1) + (64 + 1) + (32 + 1) + (64 + 1)];
+    uint16_t crc;
+  };
+
+  Record record;
+  uint8_t id;
+#ifdef SETTINGS_USE_PREFERENCES
+  Preferences preferences;
+#endif
+  uint8_t slot;  // Slot of the log holding the last write
+  bool dirty;
+  unsigned long changedTime;
+  unsigned long commitDelay;
+
+  void changed();
+  int slotAddress(uint8_t index) const;
+  bool load();
+  bool loadLegacy();
+  static uint16_t checksum(const Record& record);
+  static char* stringAt(Record& record, uint8_t index);
+};
+
+#endif
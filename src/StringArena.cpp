@@ -0,0 +1,88 @@
+/*
+  StringArena.cpp - Packed storage for the menu items of OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "StringArena.h"
+
+#define STRING_ARENA_GRANULARITY 16  // The blocks grow by 16 bytes at least, so a slightly longer list doesn't always reallocate
+
+StringArena::StringArena() {
+  text = NULL;
+  textCapacity = 0;
+  rows = NULL;
+  rowCapacity = 0;
+  rowCount = 0;
+}
+
+StringArena::~StringArena() {
+  free(text);
+  free(rows);
+}
+
+bool StringArena::assign(int maxCount, const char* first, va_list args) {
+  // Compare with the stored list first, giving the same list every frame doesn't write anything
+  va_list list;
+  va_copy(list, args);
+  bool same = true;
+  int n = 0;
+  size_t size = 0;
+  for (const char* item = first; item != NULL && n < maxCount; item = va_arg(list, const char*)) {
+    if (n >= rowCount || strcmp(rows[n], item) != 0) {
+      same = false;
+    }
+    size += strlen(item) + 1;
+    n++;
+  }
+  va_end(list);
+  if (same && n == rowCount) {
+    return false;
+  }
+
+  if (!reserve(size, n)) {
+    n = 0;  // Not enough memory, the list is shown empty rather than cut at a random item
+  }
+  char* end = text;
+  const char* item = first;
+  for (int i = 0; i < n; i++) {
+    size_t length = strlen(item) + 1;
+    memcpy(end, item, length);
+    rows[i] = end;
+    end += length;
+    item = va_arg(args, const char*);
+  }
+  rowCount = n;
+  return true;
+}
+
+void StringArena::clear() {
+  rowCount = 0;
+}
+
+int StringArena::count() const {
+  return rowCount;
+}
+
+const char* const* StringArena::items() const {
+  return rows;
+}
+
+bool StringArena::reserve(size_t textSize, int rowsNeeded) {
+  if (textSize > textCapacity) {
+    size_t capacity = (textSize + STRING_ARENA_GRANULARITY - 1) / STRING_ARENA_GRANULARITY * STRING_ARENA_GRANULARITY;
+    char* grown = (char*)realloc(text, capacity);
+    if (grown == NULL) return false;
+    text = grown;
+    textCapacity = capacity;
+  }
+  if (rowsNeeded > rowCapacity) {
+    int capacity = (rowsNeeded + 3) & ~3;
+    const char** grown = (const char**)realloc(rows, capacity * sizeof(const char*));
+    if (grown == NULL) return false;
+    rows = grown;
+    rowCapacity = capacity;
+  }
+  return true;
+}
@@ -0,0 +1,39 @@
+/*
+  StringArena.h - Packed storage for the menu items of OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#ifndef StringArena_h
+#define StringArena_h
+
+#include "Arduino.h"
+
+// A list of strings stored back to back in one block, so each item only takes its length instead of a fixed size slot
+class StringArena {
+public:
+  StringArena();
+  ~StringArena();
+
+  // Store the NULL terminated list first, ... (at most maxCount strings). Nothing is written when the list is the same as the
+  // stored one, and the memory only grows when the new list doesn't fit. Returns true if the list changed
+  bool assign(int maxCount, const char* first, va_list args);
+  // Remove all the strings, the memory is kept for the next list
+  void clear();
+
+  int count() const;
+  const char* const* items() const;  // The strings, count() of them
+private:
+  StringArena(const StringArena&);  // Not copyable, it owns its memory
+  StringArena& operator=(const StringArena&);
+
+  bool reserve(size_t textSize, int rows);
+
+  char* text;
+  size_t textCapacity;
+  const char** rows;  // Pointers into text
+  int rowCapacity;
+  int rowCount;
+};
+
+#endif
@@ -0,0 +1,92 @@
+/*
+  Tween.cpp - Time based animations for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "Tween.h"
+
+// Fixed point (1024 = 1), the ESP8266 has no FPU
+int32_t applyEasing(uint8_t easing, int32_t t) {
+  int32_t u = 1024 - t;
+  switch (easing) {
+    case EASE_IN_QUAD:
+      return (t * t) >> 10;
+    case EASE_OUT_QUAD:
+      return 1024 - ((u * u) >> 10);
+    case EASE_IN_OUT_QUAD:
+      return t < 512 ? (t * t) >> 9 : 1024 - ((u * u) >> 9);
+    case EASE_OUT_CUBIC:
+      return 1024 - ((((u * u) >> 10) * u) >> 10);
+    default:
+      return t;
+  }
+}
+
+Tween::Tween() {
+  from = 0;
+  to = 0;
+  current = 0;
+  startTime = 0;
+  duration = 0;
+  easing = EASE_LINEAR;
+  active = false;
+  started = false;
+}
+
+void Tween::moveTo(int16_t target, uint16_t time, uint8_t ease) {
+  if (target == to) return;
+  start(current, target, time, ease);
+}
+
+void Tween::start(int16_t value, int16_t target, uint16_t time, uint8_t ease) {
+  from = value;
+  to = target;
+  current = value;
+  duration = time;
+  easing = ease;
+  active = value != target && time > 0;
+  started = false;
+  if (!active) {
+    current = target;
+  }
+}
+
+void Tween::jumpTo(int16_t value) {
+  from = value;
+  to = value;
+  current = value;
+  active = false;
+}
+
+bool Tween::update(unsigned long now) {
+  int16_t previous = current;
+  if (active) {
+    if (!started) {
+      startTime = now;
+      started = true;
+    }
+    unsigned long elapsed = now - startTime;
+    if (elapsed >= duration) {
+      current = to;
+      active = false;
+    } else {
+      int32_t progress = applyEasing(easing, (int32_t)((elapsed << 10) / duration));
+      current = from + (int16_t)(((int32_t)(to - from) * progress) >> 10);
+    }
+  }
+  return current != previous;
+}
+
+int16_t Tween::value() const {
+  return current;
+}
+
+int16_t Tween::target() const {
+  return to;
+}
+
+bool Tween::running() const {
+  return active;
+}
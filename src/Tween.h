@@ -0,0 +1,54 @@
+/*
+  Tween.h - Time based animations for OpenMenuOS.
+  Created by Loic Daigle aka The Young Maker.
+  Released into the public domain.
+*/
+
+#ifndef Tween_h
+#define Tween_h
+
+#include "Arduino.h"
+
+#define ANIMATION_FRAME_TIME 16  // 16 milliseconds between the frames of a running animation (about 60 FPS)
+
+enum Easing {
+  EASE_LINEAR,
+  EASE_IN_QUAD,
+  EASE_OUT_QUAD,
+  EASE_IN_OUT_QUAD,
+  EASE_OUT_CUBIC
+};
+
+// Progress of an animation (0 to 1024) after the easing, t goes from 0 to 1024
+int32_t applyEasing(uint8_t easing, int32_t t);
+
+// A value going from one number to another over a duration. The value is computed from the time, so a late frame
+// shows the value of its time instead of slowing the animation down, and the animation ends on time
+class Tween {
+public:
+  Tween();
+
+  // Go from the current value to target in duration milliseconds, nothing changes if target is already the target
+  void moveTo(int16_t target, uint16_t duration, uint8_t easing = EASE_OUT_QUAD);
+  // Go from from to target in duration milliseconds
+  void start(int16_t from, int16_t target, uint16_t duration, uint8_t easing = EASE_OUT_QUAD);
+  // Set the value right away, without animation
+  void jumpTo(int16_t value);
+  // Compute the value at the given time, returns true if it changed since the last update()
+  bool update(unsigned long now);
+
+  int16_t value() const;
+  int16_t target() const;
+  bool running() const;
+private:
+  int16_t from;
+  int16_t to;
+  int16_t current;
+  unsigned long startTime;
+  uint16_t duration;
+  uint8_t easing;
+  bool active;
+  bool started;  // startTime is set on the first update() after start(), so the animation starts with the frame
+};
+
+#endif